@@ -25,12 +25,14 @@ namespace chrono {
 static double default_model_envelope = 0.03;
 static double default_safe_margin = 0.01;
 
-ChCollisionModel::ChCollisionModel() : contactable(nullptr), family_group(1), family_mask(0x7FFF), impl(nullptr) {
+ChCollisionModel::ChCollisionModel()
+    : contactable(nullptr), family_group(1), family_mask(0x7FFF), sleeping(false), impl(nullptr) {
     model_envelope = (float)default_model_envelope;
     model_safe_margin = (float)default_safe_margin;
 }
 
-ChCollisionModel::ChCollisionModel(const ChCollisionModel& other) : contactable(nullptr), impl(nullptr) {
+ChCollisionModel::ChCollisionModel(const ChCollisionModel& other)
+    : contactable(nullptr), sleeping(false), impl(nullptr) {
     // Create new shape instances (sharing the collision shapes)
     for (const auto& si : other.m_shape_instances) {
         const auto& shape = si.first;
@@ -64,6 +66,14 @@ void ChCollisionModel::SyncPosition() {
         impl->SyncPosition();
 }
 
+void ChCollisionModel::SetSleeping(bool sleeping) {
+    if (this->sleeping == sleeping)
+        return;
+    this->sleeping = sleeping;
+    if (impl)
+        impl->OnSleepingChange(sleeping);
+}
+
 ChPhysicsItem* ChCollisionModel::GetPhysicsItem() {
     return contactable->GetPhysicsItem();
 }
@@ -83,6 +83,14 @@ class ChApi ChCollisionModel {
     /// Synchronize the position and orientation of the collision model to the associated contactable.
     void SyncPosition();
 
+    /// Mark the collision model as sleeping (i.e., the associated contactable is at rest and does not move).
+    /// A collision system may keep the bounding box of a sleeping model frozen and skip the collision tests between two
+    /// sleeping models.
+    void SetSleeping(bool sleeping);
+
+    /// Return true if the collision model is marked as sleeping.
+    bool IsSleeping() const { return sleeping; }
+
     /// Set the collision family for this model (0...15).
     /// By default, all collision objects belong to family 0.
     void SetFamily(int family);
@@ -193,6 +201,8 @@ class ChApi ChCollisionModel {
     short int family_group;  ///< Collision family group
     short int family_mask;   ///< Collision family mask
 
+    bool sleeping;  ///< Collision model of a sleeping contactable
+
     std::vector<ShapeInstance> m_shape_instances;  ///< list of collision shapes and positions in model
 
     ChCollisionModelImpl* impl;  ///< concrete implementation of the collision model
@@ -217,6 +227,9 @@ class ChCollisionModelImpl {
     /// Additional operations to be performed on a change in collision family.
     virtual void OnFamilyChange(short int family_group, short int family_mask) {}
 
+    /// Additional operations to be performed when the collision model is marked as sleeping or awake.
+    virtual void OnSleepingChange(bool sleeping) {}
+
     /// Return the current axis aligned bounding box (AABB) of the collision model.
     /// The two return vectors represent the min.max corners along the x,y,z world axes.
     /// Note that SyncPosition() should be invoked before calling this.
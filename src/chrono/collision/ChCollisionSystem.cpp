@@ -26,6 +26,18 @@ ChCollisionSystem::ChCollisionSystem() : m_system(nullptr), m_initialized(false)
 
 ChCollisionSystem::~ChCollisionSystem() {}
 
+void ChCollisionSystem::RayHitBatch(const std::vector<ChRay>& rays,
+                                    std::vector<ChRayhitResult>& results,
+                                    int nthreads) const {
+    int num_rays = (int)rays.size();
+    results.resize(num_rays);
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < num_rays; i++) {
+        RayHit(rays[i].from, rays[i].to, results[i]);
+    }
+}
+
 void ChCollisionSystem::Initialize() {
     if (m_initialized)
         return;
@@ -183,6 +183,22 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Ray (line segment) definition for batched ray-hit tests.
+    struct ChRay {
+        ChVector<> from;  ///< ray start point, in absolute space coordinates
+        ChVector<> to;    ///< ray end point, in absolute space coordinates
+    };
+
+    /// Perform ray-hit tests with the collision models for a batch of rays.
+    /// On return, 'results' has the same size as 'rays', with results[i] the closest hit (if any) along rays[i].
+    /// Rays are processed in packets of consecutive rays, with packets distributed over 'nthreads' OpenMP threads.
+    /// Collision systems which support it trace all rays of a packet together (collecting candidate shapes once per
+    /// packet), so rays should be provided in a spatially coherent order (e.g., ordered along a grid).
+    /// The default implementation calls RayHit() for each ray.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             int nthreads = 1) const;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -46,6 +46,8 @@ ChCollisionModelBullet::ChCollisionModelBullet(ChCollisionModel* collision_model
     bt_collision_object = std::unique_ptr<cbtCollisionObject>(new cbtCollisionObject);
     bt_collision_object->setCollisionShape(nullptr);
     bt_collision_object->setUserPointer((void*)this);
+    if (collision_model->IsSleeping())
+        bt_collision_object->forceActivationState(ISLAND_SLEEPING);
 }
 
 ChCollisionModelBullet::~ChCollisionModelBullet() {
@@ -647,6 +649,11 @@ void ChCollisionModelBullet::OnFamilyChange(short int family_group, short int fa
     coll_sys->GetBulletCollisionWorld()->addCollisionObject(bt_collision_object.get(), family_group, family_mask);
 }
 
+void ChCollisionModelBullet::OnSleepingChange(bool sleeping) {
+    // The AABB of the object was updated at the last collision detection pass and is kept frozen while sleeping
+    bt_collision_object->forceActivationState(sleeping ? ISLAND_SLEEPING : ACTIVE_TAG);
+}
+
 geometry::ChAABB ChCollisionModelBullet::GetBoundingBox() const {
     if (bt_collision_object->getCollisionShape()) {
         cbtVector3 btmin;
@@ -69,6 +69,10 @@ class ChApi ChCollisionModelBullet : public ChCollisionModelImpl {
     /// Additional operations to be performed on a change in collision family.
     virtual void OnFamilyChange(short int family_group, short int family_mask) override;
 
+    /// Freeze the Bullet collision object of a sleeping model (its AABB is not updated and it is not tested against
+    /// other sleeping objects).
+    virtual void OnSleepingChange(bool sleeping) override;
+
     void injectShape(std::shared_ptr<ChCollisionShape> shape,
                      std::shared_ptr<cbtCollisionShape> bt_shape,
                      const ChFrame<>& frame);
@@ -27,6 +27,7 @@
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
+#include "chrono/collision/bullet/LinearMath/cbtThreads.h"
 
 extern cbtScalar gContactBreakingThreshold;
 
@@ -37,7 +38,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr), m_num_threads(1) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -50,6 +51,9 @@ ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
     bt_broadphase = new cbtDbvtBroadphase();
     bt_collision_world = new cbtCollisionWorld(bt_dispatcher, bt_broadphase, bt_collision_configuration);
 
+    // Do not update the AABBs of sleeping collision objects
+    bt_collision_world->setForceUpdateAllAabbs(false);
+
     // custom collision for cylinder-sphere case, for improved precision
     ////cbtCollisionAlgorithmCreateFunc* m_collision_sph_cyl = new cbtSphereCylinderCollisionAlgorithm::CreateFunc;
     ////cbtCollisionAlgorithmCreateFunc* m_collision_cyl_sph = new cbtSphereCylinderCollisionAlgorithm::CreateFunc;
@@ -125,8 +129,10 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    // The Bullet thread-safe structures (e.g., the per-thread dispatcher data) support a limited number of threads
+    m_num_threads = std::max(1, std::min(nthreads, (int)BT_MAX_THREAD_COUNT));
 #ifdef BT_USE_OPENMP
-    cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
+    cbtGetOpenMPTaskScheduler()->setNumThreads(m_num_threads);
 #endif
 }
 
@@ -179,6 +185,11 @@ void ChCollisionSystemBullet::Remove(ChCollisionModelBullet* bt_model) {
 
 void ChCollisionSystemBullet::Run() {
     if (bt_collision_world) {
+#ifdef BT_USE_OPENMP
+        // The Bullet task scheduler is shared by all Bullet collision systems; use the thread count of this one
+        if (cbtGetOpenMPTaskScheduler()->getNumThreads() != m_num_threads)
+            cbtGetOpenMPTaskScheduler()->setNumThreads(m_num_threads);
+#endif
         bt_collision_world->performDiscreteCollisionDetection();
     }
 }
@@ -205,93 +216,129 @@ double ChCollisionSystemBullet::GetTimerCollisionNarrow() const {
     return bt_collision_world->timer_collision_narrow();
 }
 
-void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
-    // This should remove all old contacts (or at least rewind the index)
-    mcontactcontainer->BeginAddContact();
+int ChCollisionSystemBullet::CollectContacts(cbtPersistentManifold* contactManifold,
+                                             std::vector<ChCollisionInfo>& contacts) {
+    const cbtCollisionObject* obA = contactManifold->getBody0();
+    const cbtCollisionObject* obB = contactManifold->getBody1();
+    contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+
+    auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+    auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
 
     // NOTE: Bullet does not provide information on radius of curvature at a contact point.
     // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
     ChCollisionInfo icontact;
 
-    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
-    for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
-        const cbtCollisionObject* obA = contactManifold->getBody0();
-        const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+    icontact.modelA = bt_modelA->model;
+    icontact.modelB = bt_modelB->model;
 
-        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
-        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+    double envelopeA = icontact.modelA->GetEnvelope();
+    double envelopeB = icontact.modelB->GetEnvelope();
+
+    double marginA = icontact.modelA->GetSafeMargin();
+    double marginB = icontact.modelB->GetSafeMargin();
 
-        icontact.modelA = bt_modelA->model;
-        icontact.modelB = bt_modelB->model;
+    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+    int count = 0;
+    int numContacts = contactManifold->getNumContacts();
+    for (int j = 0; j < numContacts; j++) {
+        cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+        // Discard "too far" constraints (the Bullet engine also has its threshold)
+        if (pt.getDistance() < marginA + marginB) {
+            cbtVector3 ptA = pt.getPositionWorldOnA();
+            cbtVector3 ptB = pt.getPositionWorldOnB();
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (broad_callback)
-            do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+            icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+            icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
 
-        if (do_narrow_contactgeneration) {
-            int numContacts = contactManifold->getNumContacts();
-            // GetLog() << "numContacts=" << numContacts << "\n";
-            for (int j = 0; j < numContacts; j++) {
-                cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
+            icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(), -pt.m_normalWorldOnB.getZ());
+            icontact.vN.Normalize();
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    cbtVector3 ptA = pt.getPositionWorldOnA();
-                    cbtVector3 ptB = pt.getPositionWorldOnB();
+            double ptdist = pt.getDistance();
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+            icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+            icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+            icontact.distance = ptdist + envelopeA + envelopeB;
 
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
+            icontact.reaction_cache = pt.reactions_cache;
 
-                    double ptdist = pt.getDistance();
+            int indexA = compoundA ? pt.m_index0 : 0;
+            int indexB = compoundB ? pt.m_index1 : 0;
 
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
+            icontact.shapeA = bt_modelA->m_shapes[indexA].get();
+            icontact.shapeB = bt_modelB->m_shapes[indexB].get();
 
-                    icontact.reaction_cache = pt.reactions_cache;
+            contacts.push_back(icontact);
+            count++;
+        }
+    }
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+    return count;
+}
 
-                    int indexA = compoundA ? pt.m_index0 : 0;
-                    int indexB = compoundB ? pt.m_index1 : 0;
+void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
+    // This should remove all old contacts (or at least rewind the index)
+    mcontactcontainer->BeginAddContact();
 
-                    icontact.shapeA = bt_modelA->m_shapes[indexA].get();
-                    icontact.shapeB = bt_modelB->m_shapes[indexB].get();
+    auto dispatcher = bt_collision_world->getDispatcher();
+    int numManifolds = dispatcher->getNumManifolds();
+
+    // Collect contacts from all manifolds. Each thread processes a contiguous range of manifolds and stores the
+    // contacts in its own buffer (use a single thread if there are too few manifolds to amortize the overhead).
+    int nthreads = std::max(1, std::min(m_num_threads, numManifolds / 32));
+    int chunk = (numManifolds + nthreads - 1) / std::max(1, nthreads);
+
+    if ((int)m_buffers.size() < nthreads)
+        m_buffers.resize(nthreads);
+    m_manifold_contacts.resize(numManifolds);
+
+#pragma omp parallel for schedule(static, 1) num_threads(nthreads)
+    for (int t = 0; t < nthreads; t++) {
+        auto& buffer = m_buffers[t];
+        buffer.clear();
+        int end = std::min(numManifolds, (t + 1) * chunk);
+        for (int i = t * chunk; i < end; i++)
+            m_manifold_contacts[i] = CollectContacts(dispatcher->getManifoldByIndexInternal(i), buffer);
+    }
 
+    // Traverse the per-thread buffers in order (i.e., in manifold order) and add contacts to the container.
+    // User callbacks are invoked here, from a single thread.
+    for (int t = 0; t < nthreads; t++) {
+        auto& buffer = m_buffers[t];
+        int k = 0;
+        int end = std::min(numManifolds, (t + 1) * chunk);
+        for (int i = t * chunk; i < end; i++) {
+            int numContacts = m_manifold_contacts[i];
+
+            // Execute custom broadphase callback, if any
+            bool do_narrow_contactgeneration = true;
+            if (broad_callback) {
+                auto contactManifold = dispatcher->getManifoldByIndexInternal(i);
+                auto bt_modelA = (ChCollisionModelBullet*)contactManifold->getBody0()->getUserPointer();
+                auto bt_modelB = (ChCollisionModelBullet*)contactManifold->getBody1()->getUserPointer();
+                do_narrow_contactgeneration = broad_callback->OnBroadphase(bt_modelA->model, bt_modelB->model);
+            }
+
+            if (do_narrow_contactgeneration) {
+                for (int j = k; j < k + numContacts; j++) {
                     // Execute some user custom callback, if any
                     bool add_contact = true;
                     if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
+                        add_contact = this->narrow_callback->OnNarrowphase(buffer[j]);
 
                     // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
-                        /// icontact.shapeB->m_type << std::endl;
-
-                        mcontactcontainer->AddContact(icontact);
-                    }
+                    if (add_contact)
+                        mcontactcontainer->AddContact(buffer[j]);
                 }
             }
-        }
 
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
+            k += numContacts;
+        }
     }
+
     mcontactcontainer->EndAddContact();
 }
 
@@ -318,6 +365,27 @@ void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximity
     mproximitycontainer->EndAddProximities();
 }
 
+bool ChCollisionSystemBullet::GetClosestRayHit(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback,
+                                               ChRayhitResult& result) {
+    if (rayCallback.hasHit()) {
+        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
+        result.hitModel = bt_model->model;
+        if (result.hitModel) {
+            result.hit = true;
+            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
+                                    rayCallback.m_hitPointWorld.z());
+            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
+                                     rayCallback.m_hitNormalWorld.z());
+            result.abs_hitNormal.Normalize();
+            result.dist_factor = rayCallback.m_closestHitFraction;
+            result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
+            return true;
+        }
+    }
+    result.hit = false;
+    return false;
+}
+
 bool ChCollisionSystemBullet::RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& result) const {
     return RayHit(from, to, result, cbtBroadphaseProxy::DefaultFilter, cbtBroadphaseProxy::AllFilter);
 }
@@ -336,23 +404,7 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
 
     this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
 
-    if (rayCallback.hasHit()) {
-        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
-        result.hitModel = bt_model->model;
-        if (result.hitModel) {
-            result.hit = true;
-            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
-                                    rayCallback.m_hitPointWorld.z());
-            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
-                                     rayCallback.m_hitNormalWorld.z());
-            result.abs_hitNormal.Normalize();
-            result.dist_factor = rayCallback.m_closestHitFraction;
-            result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
-            return true;
-        }
-    }
-    result.hit = false;
-    return false;
+    return GetClosestRayHit(rayCallback, result);
 }
 
 bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
@@ -408,6 +460,85 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
     return true;
 }
 
+// Broadphase callback collecting all collision objects overlapping a given AABB.
+class ChRayPacketCallback : public cbtBroadphaseAabbCallback {
+  public:
+    ChRayPacketCallback(std::vector<cbtCollisionObject*>& objects) : m_objects(objects) {}
+    virtual bool process(const cbtBroadphaseProxy* proxy) override {
+        m_objects.push_back((cbtCollisionObject*)proxy->m_clientObject);
+        return true;
+    }
+
+  private:
+    std::vector<cbtCollisionObject*>& m_objects;
+};
+
+void ChCollisionSystemBullet::RayHitBatch(const std::vector<ChRay>& rays,
+                                          std::vector<ChRayhitResult>& results,
+                                          int nthreads) const {
+    static const int packet_size = 64;
+
+    int num_rays = (int)rays.size();
+    int num_packets = (num_rays + packet_size - 1) / packet_size;
+    results.resize(num_rays);
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        std::vector<cbtCollisionObject*> candidates;
+        ChRayPacketCallback packet_callback(candidates);
+
+#pragma omp for schedule(dynamic)
+        for (int ip = 0; ip < num_packets; ip++) {
+            int start = ip * packet_size;
+            int end = std::min(start + packet_size, num_rays);
+
+            // Bounding box of all rays in the packet
+            cbtVector3 packet_min(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+            cbtVector3 packet_max(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
+            for (int i = start; i < end; i++) {
+                cbtVector3 btfrom((cbtScalar)rays[i].from.x(), (cbtScalar)rays[i].from.y(), (cbtScalar)rays[i].from.z());
+                cbtVector3 btto((cbtScalar)rays[i].to.x(), (cbtScalar)rays[i].to.y(), (cbtScalar)rays[i].to.z());
+                packet_min.setMin(btfrom);
+                packet_min.setMin(btto);
+                packet_max.setMax(btfrom);
+                packet_max.setMax(btto);
+            }
+
+            // Single broadphase traversal for the entire packet
+            candidates.clear();
+            bt_broadphase->aabbTest(packet_min, packet_max, packet_callback);
+
+            // Test each ray in the packet against the candidate objects
+            for (int i = start; i < end; i++) {
+                cbtVector3 btfrom((cbtScalar)rays[i].from.x(), (cbtScalar)rays[i].from.y(), (cbtScalar)rays[i].from.z());
+                cbtVector3 btto((cbtScalar)rays[i].to.x(), (cbtScalar)rays[i].to.y(), (cbtScalar)rays[i].to.z());
+                cbtTransform from_trans(cbtQuaternion::getIdentity(), btfrom);
+                cbtTransform to_trans(cbtQuaternion::getIdentity(), btto);
+
+                cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+                rayCallback.m_collisionFilterGroup = cbtBroadphaseProxy::DefaultFilter;
+                rayCallback.m_collisionFilterMask = cbtBroadphaseProxy::AllFilter;
+
+                for (auto object : candidates) {
+                    if (rayCallback.m_closestHitFraction == cbtScalar(0))
+                        break;
+                    auto proxy = object->getBroadphaseHandle();
+                    if (!rayCallback.needsCollision(proxy))
+                        continue;
+                    cbtScalar param = rayCallback.m_closestHitFraction;
+                    cbtVector3 normal;
+                    if (!cbtRayAabb(btfrom, btto, proxy->m_aabbMin, proxy->m_aabbMax, param, normal))
+                        continue;
+                    cbtCollisionWorld::rayTestSingle(from_trans, to_trans, object, object->getCollisionShape(),
+                                                     object->getWorldTransform(), rayCallback);
+                }
+
+                GetClosestRayHit(rayCallback, results[i]);
+            }
+        }
+    }
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (cbtScalar)threshold;
 }
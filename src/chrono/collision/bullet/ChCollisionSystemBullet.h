@@ -50,6 +50,9 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     // virtual void RemoveAll();
 
     /// Set the number of OpenMP threads for collision detection.
+    /// These threads are used both for processing the broadphase overlapping pairs (Bullet narrowphase) and for
+    /// extracting the contacts from the resulting contact manifolds (see ReportContacts). The number of threads is
+    /// clamped to BT_MAX_THREAD_COUNT.
     virtual void SetNumThreads(int nthreads) override;
 
     /// Run the algorithm and finds all the contacts.
@@ -75,6 +78,9 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// The basic behavior of the implementation is the following: collision system
     /// will call in sequence the functions BeginAddContact(), AddContact() (x n times),
     /// EndAddContact() of the contact container.
+    /// Contact manifolds are processed in parallel, with each thread collecting the contacts from a contiguous range of
+    /// manifolds in its own buffer. The buffers are then traversed in order (invoking any user callbacks) to add
+    /// contacts to the container, so that the sequence of added contacts does not depend on the number of threads.
     virtual void ReportContacts(ChContactContainer* mcontactcontainer) override;
 
     /// After the Run() has completed, you can call this function to
@@ -95,6 +101,13 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// The broadphase is queried once per packet of consecutive rays (with the bounding box of the packet) and each ray
+    /// of the packet is then tested against the resulting candidate objects only.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             int nthreads = 1) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -139,6 +152,14 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// Remove the specified Bullet model from this collision stystem
     void Remove(ChCollisionModelBullet* bt_model);
 
+    /// Fill a ray-hit result from the closest hit (if any) found by a Bullet ray test.
+    static bool GetClosestRayHit(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback,
+                                 ChRayhitResult& result);
+
+    /// Refresh the specified contact manifold and append its contacts (within the collision margins) to the given list.
+    /// Return the number of collected contacts.
+    static int CollectContacts(cbtPersistentManifold* manifold, std::vector<ChCollisionInfo>& contacts);
+
     std::vector<std::shared_ptr<ChCollisionModelBullet>> bt_models;
 
     cbtCollisionConfiguration* bt_collision_configuration;
@@ -159,6 +180,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
 
     cbtIDebugDraw* m_debug_drawer;
 
+    int m_num_threads;                                    ///< number of threads for collision detection
+    std::vector<std::vector<ChCollisionInfo>> m_buffers;  ///< per-thread contact buffers (see ReportContacts)
+    std::vector<int> m_manifold_contacts;                 ///< number of collected contacts per manifold
+
     friend class ChCollisionModelBullet;
 };
 
@@ -38,6 +38,8 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      incremental(false),
+      num_active_shapes(0),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -47,16 +49,19 @@ auto inverted =
     thrust::make_tuple(real3(+C_REAL_MAX, +C_REAL_MAX, +C_REAL_MAX), real3(-C_REAL_MAX, -C_REAL_MAX, -C_REAL_MAX), 0);
 
 // Invert an AABB associated with an inactive shape or a shape on a non-colliding body.
+// If a vector of body activity flags is provided, also invert AABBs of shapes on inactive bodies.
 struct BoxInvert {
-    BoxInvert(const std::vector<char>* collide) : m_collide(collide) {}
+    BoxInvert(const std::vector<char>* collide, const std::vector<char>* active)
+        : m_collide(collide), m_active(active) {}
     thrust::tuple<real3, real3, uint> operator()(const thrust::tuple<real3, real3, uint>& lhs) {
         uint lhs_id = thrust::get<2>(lhs);
-        if (lhs_id == UINT_MAX || (*m_collide)[lhs_id] == 0)
+        if (lhs_id == UINT_MAX || (*m_collide)[lhs_id] == 0 || (m_active && (*m_active)[lhs_id] == 0))
             return inverted;
         else
             return lhs;
     }
     const std::vector<char>* m_collide;
+    const std::vector<char>* m_active;
 };
 
 // AABB union reduction operator
@@ -78,7 +83,8 @@ struct BoxReduce {
 
 // Calculate AABB of all rigid shapes.
 // This function excludes inactive shapes (marked with ID = UINT_MAX) and shapes
-// associated with non-colliding bodies.
+// associated with non-colliding bodies. With the incremental broadphase, shapes
+// associated with inactive bodies are also excluded (these are in the static grid).
 void ChBroadphase::RigidBoundingBox() {
     // Vectors of length = number of collision shapes
     const std::vector<real3>& aabb_min = cd_data->aabb_min;
@@ -87,12 +93,21 @@ void ChBroadphase::RigidBoundingBox() {
 
     // Vectors of length = number of rigid bodies
     const std::vector<char>& collide_rigid = *cd_data->state_data.collide_rigid;
+    const std::vector<char>* active_rigid = incremental ? cd_data->state_data.active_rigid : nullptr;
+
+    // With the incremental broadphase and no active shapes, use the extents of the static grid
+    if (incremental && num_active_shapes == 0 && !cd_data->static_grid.shapes.empty()) {
+        cd_data->rigid_min_bounding_point = cd_data->static_grid.min_bounding_point;
+        cd_data->rigid_max_bounding_point = cd_data->static_grid.max_bounding_point;
+        return;
+    }
 
     // Calculate union of all AABBs.
     // Excluded AABBs are inverted through the transform operation, prior to the reduction.
     auto begin = thrust::make_zip_iterator(thrust::make_tuple(aabb_min.begin(), aabb_max.begin(), id_rigid.begin()));
     auto end = thrust::make_zip_iterator(thrust::make_tuple(aabb_min.end(), aabb_max.end(), id_rigid.end()));
-    auto result = thrust::transform_reduce(THRUST_PAR begin, end, BoxInvert(&collide_rigid), inverted, BoxReduce());
+    auto result = thrust::transform_reduce(THRUST_PAR begin, end, BoxInvert(&collide_rigid, active_rigid), inverted,
+                                           BoxReduce());
 
     cd_data->rigid_min_bounding_point = thrust::get<0>(result);
     cd_data->rigid_max_bounding_point = thrust::get<1>(result);
@@ -176,7 +191,7 @@ void ChBroadphase::OffsetAABB() {
 
 // Determine resolution of the top level grid
 void ChBroadphase::ComputeTopLevelResolution() {
-    const int num_shapes = cd_data->num_rigid_shapes;
+    const int num_shapes = incremental ? num_active_shapes : cd_data->num_rigid_shapes;
     const real3& max_bounding_point = cd_data->max_bounding_point;
     const real3& global_origin = cd_data->global_origin;
 
@@ -196,7 +211,7 @@ void ChBroadphase::ComputeTopLevelResolution() {
             bins_per_axis.z = (int)std::ceil(diag.z / bin_size.z);
             break;
         case GridType::FIXED_DENSITY:
-            bins_per_axis = Compute_Grid_Resolution(num_shapes, diag, grid_density);
+            bins_per_axis = Compute_Grid_Resolution(num_shapes > 0 ? num_shapes : 1, diag, grid_density);
     }
 
     // Calculate actual bin dimension
@@ -210,6 +225,14 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
+    // With the incremental broadphase, separate shapes of active and static bodies and update the static grid.
+    // Note that this must be done before the shape AABBs are offset.
+    cd_data->static_grid.active = incremental;
+    if (incremental) {
+        ClassifyShapes();
+        UpdateStaticGrid();
+    }
+
     // Compute overall AABB and then offset all AABBs
     DetermineBoundingBox();
     OffsetAABB();
@@ -219,6 +242,8 @@ void ChBroadphase::Process() {
 
     if (cd_data->num_rigid_shapes != 0) {
         OneLevelBroadphase();
+        if (incremental)
+            StaticGridPairs();
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
     return;
@@ -256,10 +281,12 @@ void ChBroadphase::OneLevelBroadphase() {
     bin_intersections.resize(num_shapes + 1);
     bin_intersections[num_shapes] = 0;
 
-    // Count the number of bins intersected by each shape AABB -> bin_intersections
+    // Count the number of bins intersected by each shape AABB -> bin_intersections.
+    // Shapes of non-colliding bodies are not binned (these are not included in the grid bounding box).
+    // With the incremental broadphase, only shapes of active bodies are binned.
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX) {
+        if (obj_data_id[i] == UINT_MAX || !obj_collide[obj_data_id[i]] || (incremental && !shape_active[i])) {
             bin_intersections[i] = 0;
             continue;
         }
@@ -278,7 +305,7 @@ void ChBroadphase::OneLevelBroadphase() {
     // For each shape, store the bin index and the shape ID for intersections with this shape
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX)
+        if (obj_data_id[i] == UINT_MAX || !obj_collide[obj_data_id[i]] || (incremental && !shape_active[i]))
             continue;
         f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
                                       bin_aabb_number);
@@ -290,6 +317,7 @@ void ChBroadphase::OneLevelBroadphase() {
 
     if (num_active_bins <= 0) {
         num_possible_collisions = 0;
+        bin_start_index_ext.assign(num_bins + 1, 0);
         return;
     }
 
@@ -343,4 +371,244 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Incremental broadphase
+
+// Range of static grid bins intersected by an AABB (given relative to the static grid origin), clamped to the grid.
+static void StaticGridRange(const real3& Amin,
+                            const real3& Amax,
+                            const static_grid_container& grid,
+                            vec3& gmin,
+                            vec3& gmax) {
+    gmin = Clamp(HashMin(Amin, grid.inv_bin_size), vec3(0), grid.bins_per_axis - 1);
+    gmax = Clamp(HashMax(Amax, grid.inv_bin_size), gmin, grid.bins_per_axis - 1);
+}
+
+// Flag shapes of active bodies and collect the shapes of static (fixed or sleeping) bodies.
+// Shapes on non-colliding bodies and inactive shapes are in neither set.
+void ChBroadphase::ClassifyShapes() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    shape_active.resize(num_shapes);
+    static_shapes.clear();
+    num_active_shapes = 0;
+
+    for (int i = 0; i < num_shapes; i++) {
+        uint id = obj_data_id[i];
+        bool valid = (id != UINT_MAX) && obj_collide[id];
+        shape_active[i] = valid && obj_active[id];
+        if (!valid)
+            continue;
+        if (shape_active[i])
+            num_active_shapes++;
+        else
+            static_shapes.push_back(i);
+    }
+}
+
+// Rebuild the grid of static shapes if the set of static shapes or any of their AABBs changed since the last update.
+// Must be called with absolute shape AABBs (i.e., before OffsetAABB).
+void ChBroadphase::UpdateStaticGrid() {
+    static_grid_container& grid = cd_data->static_grid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    const int num_static = (int)static_shapes.size();
+
+    // Check for changes since the last update
+    bool changed = (grid.num_updates == 0) || (static_shapes != grid.shapes);
+    if (!changed) {
+        int num_changed = 0;
+#pragma omp parallel for reduction(+ : num_changed)
+        for (int k = 0; k < num_static; k++) {
+            uint i = static_shapes[k];
+            if (!(aabb_min[i] == grid.aabb_min[k]) || !(aabb_max[i] == grid.aabb_max[k]))
+                num_changed++;
+        }
+        changed = (num_changed > 0);
+    }
+
+    if (!changed)
+        return;
+
+    grid.num_updates++;
+    grid.shapes = static_shapes;
+    grid.aabb_min.resize(num_static);
+    grid.aabb_max.resize(num_static);
+
+    if (num_static == 0) {
+        grid.num_bins = 0;
+        grid.bin_number.clear();
+        grid.bin_aabb_number.clear();
+        grid.bin_start_index_ext.assign(1, 0);
+        return;
+    }
+
+    // Cache the static AABBs and calculate their union
+    real3 min_point(C_REAL_MAX);
+    real3 max_point(-C_REAL_MAX);
+    for (int k = 0; k < num_static; k++) {
+        uint i = static_shapes[k];
+        grid.aabb_min[k] = aabb_min[i];
+        grid.aabb_max[k] = aabb_max[i];
+        min_point = Min(min_point, aabb_min[i]);
+        max_point = Max(max_point, aabb_max[i]);
+    }
+
+    // Inflate the grid bounding box (see DetermineBoundingBox)
+    real fraction = 1e-3;
+    real3 size = max_point - min_point;
+    grid.min_bounding_point = min_point - fraction * size;
+    grid.max_bounding_point = max_point + fraction * size;
+
+    // Grid resolution
+    real3 diag = Abs(grid.max_bounding_point - grid.min_bounding_point);
+    grid.bins_per_axis = Compute_Grid_Resolution(num_static, diag, grid_density);
+    grid.bin_size = diag / real3(grid.bins_per_axis.x, grid.bins_per_axis.y, grid.bins_per_axis.z);
+    grid.inv_bin_size = 1.0 / grid.bin_size;
+    grid.num_bins = grid.bins_per_axis.x * grid.bins_per_axis.y * grid.bins_per_axis.z;
+
+    // Count the number of bins intersected by each static AABB
+    std::vector<uint> bin_intersections(num_static + 1, 0);
+#pragma omp parallel for
+    for (int k = 0; k < num_static; k++) {
+        vec3 gmin, gmax;
+        StaticGridRange(grid.aabb_min[k] - grid.min_bounding_point, grid.aabb_max[k] - grid.min_bounding_point, grid,
+                        gmin, gmax);
+        bin_intersections[k] = (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
+    }
+
+    Thrust_Exclusive_Scan(bin_intersections);
+    uint num_intersections = bin_intersections.back();
+
+    // Store the bin index and the (compact) static shape index for each intersection
+    grid.bin_number.resize(num_intersections);
+    grid.bin_aabb_number.resize(num_intersections);
+#pragma omp parallel for
+    for (int k = 0; k < num_static; k++) {
+        vec3 gmin, gmax;
+        StaticGridRange(grid.aabb_min[k] - grid.min_bounding_point, grid.aabb_max[k] - grid.min_bounding_point, grid,
+                        gmin, gmax);
+        uint count = bin_intersections[k];
+        for (int i = gmin.x; i <= gmax.x; i++) {
+            for (int j = gmin.y; j <= gmax.y; j++) {
+                for (int l = gmin.z; l <= gmax.z; l++) {
+                    grid.bin_number[count] = Hash_Index(vec3(i, j, l), grid.bins_per_axis);
+                    grid.bin_aabb_number[count] = k;
+                    count++;
+                }
+            }
+        }
+    }
+
+    Thrust_Sort_By_Key(grid.bin_number, grid.bin_aabb_number);
+
+    // Start index of each bin (including empty bins)
+    grid.bin_start_index_ext.assign(grid.num_bins + 1, 0);
+    for (uint e = 0; e < num_intersections; e++)
+        grid.bin_start_index_ext[grid.bin_number[e] + 1]++;
+    for (uint b = 0; b < grid.num_bins; b++)
+        grid.bin_start_index_ext[b + 1] += grid.bin_start_index_ext[b];
+}
+
+// Query the static grid with the AABB of the specified active shape (given relative to the static grid origin).
+// If 'pairs' is not null, store the encoded shape pairs starting at 'pairs'. Return the number of pairs.
+static uint QueryStaticGrid(uint shapeA,
+                            const real3& Amin,
+                            const real3& Amax,
+                            const static_grid_container& grid,
+                            const std::vector<short2>& fam_data,
+                            long long* pairs) {
+    // Quick rejection of AABBs outside the static grid
+    if (!overlap(Amin, Amax, real3(0), grid.max_bounding_point - grid.min_bounding_point))
+        return 0;
+
+    vec3 gmin, gmax;
+    StaticGridRange(Amin, Amax, grid, gmin, gmax);
+
+    uint count = 0;
+    for (int i = gmin.x; i <= gmax.x; i++) {
+        for (int j = gmin.y; j <= gmax.y; j++) {
+            for (int l = gmin.z; l <= gmax.z; l++) {
+                uint bin = Hash_Index(vec3(i, j, l), grid.bins_per_axis);
+                for (uint e = grid.bin_start_index_ext[bin]; e < grid.bin_start_index_ext[bin + 1]; e++) {
+                    uint k = grid.bin_aabb_number[e];
+                    uint shapeB = grid.shapes[k];
+                    if (!collide(fam_data[shapeA], fam_data[shapeB]))
+                        continue;
+                    real3 Bmin = grid.aabb_min[k] - grid.min_bounding_point;
+                    real3 Bmax = grid.aabb_max[k] - grid.min_bounding_point;
+                    if (!overlap(Amin, Amax, Bmin, Bmax))
+                        continue;
+                    // Report each pair only once, from the (common) bin containing the min corner of the AABB
+                    // intersection (see current_bin)
+                    vec3 bmin, bmax;
+                    StaticGridRange(Bmin, Bmax, grid, bmin, bmax);
+                    vec3 cell = Clamp(HashMin(Max(Amin, Bmin), grid.inv_bin_size), Max(gmin, bmin), Min(gmax, bmax));
+                    if (Hash_Index(cell, grid.bins_per_axis) != bin)
+                        continue;
+                    if (pairs) {
+                        pairs[count] = (shapeA < shapeB) ? ((long long)shapeA << 32 | (long long)shapeB)
+                                                         : ((long long)shapeB << 32 | (long long)shapeA);
+                    }
+                    count++;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// Append to the list of potential collisions all pairs between active shapes and shapes in the static grid.
+// Must be called after the shape AABBs were offset to the global origin.
+void ChBroadphase::StaticGridPairs() {
+    const static_grid_container& grid = cd_data->static_grid;
+    if (grid.shapes.empty() || num_active_shapes == 0)
+        return;
+
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    // Shape AABBs are relative to the global origin; express them relative to the static grid origin
+    real3 shift = cd_data->global_origin - grid.min_bounding_point;
+
+    // Count the number of static shapes in potential contact with each active shape
+    static_pair_count.resize(num_shapes + 1);
+    static_pair_count[num_shapes] = 0;
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        static_pair_count[i] = shape_active[i]
+                                   ? QueryStaticGrid(i, aabb_min[i] + shift, aabb_max[i] + shift, grid, fam_data, nullptr)
+                                   : 0;
+    }
+
+    Thrust_Exclusive_Scan(static_pair_count);
+    uint num_static_pairs = static_pair_count.back();
+    if (num_static_pairs == 0)
+        return;
+
+    // Append the active-static pairs to the list of pairs from the grid of active shapes
+    uint offset = num_possible_collisions;
+    pair_shapeIDs.resize(offset + num_static_pairs);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (!shape_active[i])
+            continue;
+        QueryStaticGrid(i, aabb_min[i] + shift, aabb_max[i] + shift, grid, fam_data,
+                        pair_shapeIDs.data() + offset + static_pair_count[i]);
+    }
+
+    num_possible_collisions += num_static_pairs;
+}
+
 }  // end namespace chrono
@@ -27,6 +27,14 @@ namespace chrono {
 /// @{
 
 /// Class for performing broad-phase collision detection.
+/// By default, a uniform grid containing all collision shapes is built from scratch at each call to Process().
+/// In incremental mode, the broadphase uses two grids instead:
+/// - a persistent grid of the shapes of static (fixed or sleeping) bodies, which is only rebuilt when the set of static
+///   shapes or their AABBs change (see static_grid_container);
+/// - a grid of the shapes of active bodies, rebuilt at each step. This grid spans only the moving shapes, so that its
+///   resolution is not affected by large static shapes (e.g., terrain meshes).
+/// Candidate pairs are generated from the grid of active shapes, and by querying the static grid with the AABB of each
+/// active shape. The incremental mode is appropriate for scenes with many static shapes.
 class ChApi ChBroadphase {
   public:
     /// Method for computing grid resolution
@@ -50,12 +58,22 @@ class ChApi ChBroadphase {
     void RigidBoundingBox();
     void FluidBoundingBox();
 
+    void ClassifyShapes();
+    void UpdateStaticGrid();
+    void StaticGridPairs();
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     GridType grid_type;    ///< (input) method for setting grid resolution
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    bool incremental;      ///< (input) use the incremental broadphase
+
+    uint num_active_shapes;               ///< number of shapes of active bodies (incremental broadphase)
+    std::vector<char> shape_active;       ///< flags for shapes of active bodies (incremental broadphase)
+    std::vector<uint> static_shapes;      ///< IDs of shapes of static bodies (incremental broadphase)
+    std::vector<uint> static_pair_count;  ///< number of static shapes paired with each shape (incremental broadphase)
 
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
@@ -85,6 +85,40 @@ struct state_container {
     std::vector<real3>* sorted_pos_3dof;  ///< [num_fluid_bodies] (output) 3-dof particle positions sorted by bin index
 };
 
+/// Persistent grid of the collision shapes of static (fixed or sleeping) bodies.
+/// This grid is used by the incremental broadphase (see ChBroadphase) and is only rebuilt when the set of static shapes
+/// or any of their AABBs change. Unlike the broadphase data in ChCollisionData, all quantities here are expressed in the
+/// absolute frame.
+struct static_grid_container {
+    static_grid_container()
+        : active(false),
+          num_updates(0),
+          num_bins(0),
+          bins_per_axis(vec3(1, 1, 1)),
+          bin_size(real3(1)),
+          inv_bin_size(real3(1)),
+          min_bounding_point(real3(0)),
+          max_bounding_point(real3(0)) {}
+
+    bool active;       ///< true if the grid is in use (incremental broadphase)
+    uint num_updates;  ///< number of times the grid was rebuilt
+
+    std::vector<uint> shapes;     ///< [num_static_shapes] IDs of the static shapes
+    std::vector<real3> aabb_min;  ///< [num_static_shapes] AABB min corners of static shapes at last update
+    std::vector<real3> aabb_max;  ///< [num_static_shapes] AABB max corners of static shapes at last update
+
+    uint num_bins;             ///< total number of bins
+    vec3 bins_per_axis;        ///< number of slices along each axis of the grid
+    real3 bin_size;            ///< bin sizes in each direction
+    real3 inv_bin_size;        ///< bin size reciprocals in each direction
+    real3 min_bounding_point;  ///< LBR corner of union of static AABBs (grid origin)
+    real3 max_bounding_point;  ///< RTF corner of union of static AABBs
+
+    std::vector<uint> bin_number;           ///< [num_bin_aabb_intersections] bin index, sorted
+    std::vector<uint> bin_aabb_number;      ///< [num_bin_aabb_intersections] index in 'shapes' of intersecting shape
+    std::vector<uint> bin_start_index_ext;  ///< [num_bins+1] start of each bin in bin_aabb_number
+};
+
 /// Global data for the custom Chrono multicore collision system.
 class ChApi ChCollisionData {
   public:
@@ -147,6 +181,8 @@ class ChApi ChCollisionData {
     state_container state_data;  ///< state data arrays
     shape_container shape_data;  ///< shape information data arrays
 
+    static_grid_container static_grid;  ///< persistent grid of static shapes (incremental broadphase only)
+
     real collision_envelope;  ///< collision envelope for rigid shapes
 
     real p_collision_envelope;  ///< collision envelope for 3-dof particles
@@ -186,6 +222,7 @@ class ChApi ChCollisionData {
     std::vector<int> reverse_mapping_3dof;
 
     // Broadphase Data
+    // (with the incremental broadphase, the grid only contains the shapes of active bodies; see static_grid)
     vec3 bins_per_axis;               ///< number of slices along each axis of the collision detection grid
     real3 bin_size;                   ///< bin sizes in each direction
     real3 inv_bin_size;               ///< bin size reciprocals in each direction
@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChParticleCloud.h"
@@ -54,7 +56,7 @@ void ChCollisionSystemMulticore::SetBroadphaseGridResolution(const ChVector<int>
 
 void ChCollisionSystemMulticore::SetBroadphaseGridSize(const ChVector<>& bin_size) {
     broadphase.bin_size = real3(bin_size.x(), bin_size.y(), bin_size.z());
-    broadphase.grid_type = ChBroadphase::GridType::FIXED_RESOLUTION;
+    broadphase.grid_type = ChBroadphase::GridType::FIXED_BIN_SIZE;
 }
 
 void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
@@ -62,10 +64,22 @@ void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemMulticore::EnableIncrementalBroadphase(bool val) {
+    broadphase.incremental = val;
+}
+
+unsigned int ChCollisionSystemMulticore::GetNumStaticGridUpdates() const {
+    return cd_data->static_grid.num_updates;
+}
+
 void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemMulticore::EnableBatchedMPR(bool val) {
+    narrowphase.batch_mpr = val;
+}
+
 void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector<>& aabb_min, const ChVector<>& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -211,10 +225,17 @@ bool ChCollisionSystemMulticore::GetActiveBoundingBox(ChVector<>& aabb_min, ChVe
 }
 
 geometry::ChAABB ChCollisionSystemMulticore::GetBoundingBox() const {
-    ChVector<> aabb_min((double)cd_data->min_bounding_point.x, (double)cd_data->min_bounding_point.y,
-                        (double)cd_data->min_bounding_point.z);
-    ChVector<> aabb_max((double)cd_data->max_bounding_point.x, (double)cd_data->max_bounding_point.y,
-                        (double)cd_data->max_bounding_point.z);
+    real3 min_point = cd_data->min_bounding_point;
+    real3 max_point = cd_data->max_bounding_point;
+
+    // With the incremental broadphase, include the shapes in the static grid
+    if (cd_data->static_grid.active && !cd_data->static_grid.shapes.empty()) {
+        min_point = Min(min_point, cd_data->static_grid.min_bounding_point);
+        max_point = Max(max_point, cd_data->static_grid.max_bounding_point);
+    }
+
+    ChVector<> aabb_min((double)min_point.x, (double)min_point.y, (double)min_point.z);
+    ChVector<> aabb_max((double)max_point.x, (double)max_point.y, (double)max_point.z);
 
     return geometry::ChAABB(aabb_min, aabb_max);
 }
@@ -571,11 +592,8 @@ std::vector<vec2> ChCollisionSystemMulticore::GetOverlappingPairs() {
 // -----------------------------------------------------------------------------
 
 bool ChCollisionSystemMulticore::RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& result) const {
-    if (cd_data->num_active_bins == 0) {
-        result.hit = false;
-        return false;
-    }
-
+    // Note that, with the incremental broadphase, the grid of active shapes may be empty while the grid of static
+    // shapes is not. The ray tester checks both grids (if available).
     ChRayTest tester(cd_data);
     ChRayTest::RayHitInfo info;
     if (tester.Check(FromChVector(from), FromChVector(to), info)) {
@@ -605,6 +623,50 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector<>& from,
     return false;
 }
 
+void ChCollisionSystemMulticore::RayHitBatch(const std::vector<ChRay>& rays,
+                                             std::vector<ChRayhitResult>& results,
+                                             int nthreads) const {
+    static const int packet_size = 64;
+
+    int num_rays = (int)rays.size();
+    int num_packets = (num_rays + packet_size - 1) / packet_size;
+    results.resize(num_rays);
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        ChRayTest tester(cd_data);
+        real3 start[packet_size];
+        real3 end[packet_size];
+        ChRayTest::RayHitInfo info[packet_size];
+        bool hit[packet_size];
+
+#pragma omp for schedule(dynamic)
+        for (int ip = 0; ip < num_packets; ip++) {
+            int first = ip * packet_size;
+            int n = std::min(packet_size, num_rays - first);
+
+            for (int i = 0; i < n; i++) {
+                start[i] = FromChVector(rays[first + i].from);
+                end[i] = FromChVector(rays[first + i].to);
+            }
+
+            tester.CheckPacket(n, start, end, info, hit);
+
+            for (int i = 0; i < n; i++) {
+                auto& result = results[first + i];
+                result.hit = hit[i];
+                if (hit[i]) {
+                    result.abs_hitNormal = ToChVector(info[i].normal);
+                    result.abs_hitPoint = ToChVector(info[i].point);
+                    result.dist_factor = info[i].t;
+                    uint bid = cd_data->shape_data.id_rigid[info[i].shapeID];
+                    result.hitModel = m_system->Get_bodylist()[bid]->GetCollisionModel().get();
+                }
+            }
+        }
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 void DrawHemisphere(ChCollisionSystem::VisualizationCallback* vis,
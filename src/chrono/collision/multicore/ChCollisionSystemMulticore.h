@@ -77,12 +77,27 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Enable the incremental broadphase (default: false).
+    /// If enabled, the collision shapes of static bodies (fixed or sleeping) are kept in a separate persistent grid,
+    /// which is rebuilt only when the set of static shapes or their bounding boxes change. The broadphase grid of the
+    /// remaining shapes is then rebuilt at each step, with a resolution (see SetBroadphaseGridDensity) that accounts
+    /// only for the moving shapes. This is appropriate for scenes with a large number of static shapes.
+    void EnableIncrementalBroadphase(bool val);
+
+    /// Return the number of times the grid of static shapes was rebuilt (incremental broadphase only).
+    unsigned int GetNumStaticGridUpdates() const;
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable batched processing of the MPR narrowphase (default: false).
+    /// If enabled, the candidate pairs handled by the MPR algorithm are grouped by shape types and processed several at
+    /// a time, using SIMD instructions (see ChNarrowphase::MPRCollisionBatch).
+    void EnableBatchedMPR(bool val);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -136,6 +151,13 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// Each packet of consecutive rays is tested against the shapes in the broadphase bins overlapping the packet
+    /// bounding box (see ChRayTest::CheckPacket).
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             int nthreads = 1) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -37,6 +37,7 @@ using namespace chrono::ch_utils;
 
 ChNarrowphase::ChNarrowphase()
     : algorithm(Algorithm::HYBRID),
+      batch_mpr(false),
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
@@ -243,6 +244,14 @@ void ChNarrowphase::DispatchMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
+    if (batch_mpr) {
+        std::vector<uint> pairs(num_potential_rigid_contacts);
+        for (uint index = 0; index < num_potential_rigid_contacts; index++)
+            pairs[index] = index;
+        DispatchMPRBatch(pairs);
+        return;
+    }
+
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
@@ -296,6 +305,32 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
+    if (batch_mpr) {
+        // Analytical collision detection first, then batched MPR for all pairs not supported by PRIMSCollision
+        std::vector<char> mpr_pending(num_potential_rigid_contacts, 0);
+
+#pragma omp parallel for private(shapeA, shapeB)
+        for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+            uint ID_A, ID_B, icoll;
+            int nC;
+            Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+            if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
+                               &contactDepth[icoll], &effective_radius[icoll], nC)) {
+                Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+            } else {
+                mpr_pending[index] = 1;
+            }
+        }
+
+        std::vector<uint> pairs;
+        for (uint index = 0; index < num_potential_rigid_contacts; index++) {
+            if (mpr_pending[index])
+                pairs.push_back(index);
+        }
+        DispatchMPRBatch(pairs);
+        return;
+    }
+
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
@@ -316,6 +351,81 @@ void ChNarrowphase::DispatchHybridMPR() {
     }
 }
 
+void ChNarrowphase::DispatchMPRBatch(const std::vector<uint>& pairs) {
+    const real envelope = cd_data->collision_envelope;
+    const std::vector<int>& typ_rigid = cd_data->shape_data.typ_rigid;
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* contactDepth = cd_data->dpth_rigid_rigid.data();
+    real* effective_radius = cd_data->erad_rigid_rigid.data();
+
+    double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
+
+    int num_pairs = (int)pairs.size();
+
+    // Group the candidate pairs by shape types, so that consecutive pairs can be processed in the same batch
+    std::vector<unsigned long long> keys(num_pairs);
+#pragma omp parallel for
+    for (int k = 0; k < num_pairs; k++) {
+        long long p = pair_shapeIDs[pairs[k]];
+        unsigned long long typeA = typ_rigid[int(p >> 32)];
+        unsigned long long typeB = typ_rigid[int(p & 0xffffffff)];
+        keys[k] = (((typeA << 8) | typeB) << 32) | pairs[k];
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<ConvexShape> shapesA(num_pairs);
+    std::vector<ConvexShape> shapesB(num_pairs);
+    std::vector<const ConvexBase*> ptrA(num_pairs);
+    std::vector<const ConvexBase*> ptrB(num_pairs);
+    std::vector<uint> ID_A(num_pairs);
+    std::vector<uint> ID_B(num_pairs);
+    std::vector<uint> icoll(num_pairs);
+
+#pragma omp parallel for
+    for (int k = 0; k < num_pairs; k++) {
+        uint index = uint(keys[k] & 0xffffffff);
+        Dispatch_Init(index, icoll[k], ID_A[k], ID_B[k], &shapesA[k], &shapesB[k]);
+        ptrA[k] = &shapesA[k];
+        ptrB[k] = &shapesB[k];
+    }
+
+    // Process blocks of pairs in parallel (block size is a multiple of the batch width)
+    std::vector<real3> b_norm(num_pairs);
+    std::vector<real3> b_ptA(num_pairs);
+    std::vector<real3> b_ptB(num_pairs);
+    std::vector<real> b_depth(num_pairs);
+    std::vector<char> b_found(num_pairs);
+
+    const int block_size = 16 * GetMPRBatchWidth();
+    int num_blocks = (num_pairs + block_size - 1) / block_size;
+
+#pragma omp parallel for
+    for (int b = 0; b < num_blocks; b++) {
+        int start = b * block_size;
+        int count = std::min(block_size, num_pairs - start);
+        MPRCollisionBatch(count, &ptrA[start], &ptrB[start], envelope, &b_norm[start], &b_ptA[start], &b_ptB[start],
+                          &b_depth[start], &b_found[start]);
+    }
+
+    // Load the contacts found
+#pragma omp parallel for
+    for (int k = 0; k < num_pairs; k++) {
+        if (!b_found[k])
+            continue;
+        uint i = icoll[k];
+        norm[i] = b_norm[k];
+        ptA[i] = b_ptA[k];
+        ptB[i] = b_ptB[k];
+        contactDepth[i] = b_depth[k];
+        effective_radius[i] = default_eff_radius;
+        // The number of contacts reported by MPR is always 1.
+        Dispatch_Finalize(i, ID_A[k], ID_B[k], 1);
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 void ChNarrowphase::ProcessRigidRigid() {
@@ -77,6 +77,25 @@ class ChApi ChNarrowphase {
                              real3& pointB,
                              real& depth);
 
+    /// Batched Minkovski Portal Refinement convex-convex collision detection.
+    /// Consecutive pairs with the same combination of shape types are processed together, one pair per SIMD lane (see
+    /// GetMPRBatchWidth); for best performance, the input pairs should therefore be grouped by shape types. Each pair
+    /// goes through the same steps as in MPRCollision, so results match those of the scalar algorithm up to round-off.
+    /// 'found' is set for the pairs in contact, in which case the corresponding normal, points, and depth are loaded.
+    static void MPRCollisionBatch(int num_pairs,                     ///< number of candidate pairs
+                                  const ConvexBase* const* shapesA,  ///< first shape of each pair
+                                  const ConvexBase* const* shapesB,  ///< second shape of each pair
+                                  real envelope,                     ///< collision envelope
+                                  real3* normal,                     ///< [output] contact normal
+                                  real3* pointA,                     ///< [output] contact point on first shape
+                                  real3* pointB,                     ///< [output] contact point on second shape
+                                  real* depth,                       ///< [output] penetration depth
+                                  char* found                        ///< [output] contact flag
+    );
+
+    /// Return the number of pairs processed together by MPRCollisionBatch.
+    static int GetMPRBatchWidth();
+
     /// Dispatcher for analytic collision functions between a pair of candidate shapes.
     /// Each candidate pair of shapes can result in 0, 1, or more contacts.  For each actual contact, the function
     /// calculates various geometrical quantities and load them in the output arguments (starting from the given
@@ -132,6 +151,7 @@ class ChApi ChNarrowphase {
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
+    void DispatchMPRBatch(const std::vector<uint>& pairs);
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
@@ -147,6 +167,7 @@ class ChApi ChNarrowphase {
     uint num_potential_rigid_fluid_contacts;
 
     Algorithm algorithm;
+    bool batch_mpr;
 
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
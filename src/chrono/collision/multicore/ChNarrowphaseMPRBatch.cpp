@@ -0,0 +1,898 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched Minkowski Portal Refinement Narrowphase.
+//
+// Processes several candidate pairs with the same combination of shape types at
+// once, one pair per SIMD lane (structure-of-arrays layout). Each lane follows
+// exactly the steps of the scalar algorithm (see ChNarrowphaseMPR.cpp); lanes
+// that completed a given phase are masked out until all lanes in the batch are
+// done. Support functions for shapes with a closed-form support mapping are
+// vectorized; the remaining shapes (triangles, convex hulls, tetrahedra) are
+// evaluated one lane at a time.
+//
+// =============================================================================
+
+#include "chrono/collision/multicore/ChNarrowphase.h"
+#include "chrono/collision/multicore/ChCollisionUtils.h"
+#include "chrono/multicore_math/simd.h"
+
+namespace chrono {
+
+using namespace chrono::ch_utils;
+
+#define MPR_TOLERANCE C_REAL_EPSILON
+#define MAX_ITERATIONS 100
+#define WHILE_LOOP_MAX 1000
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Lane types: vreal holds one real per pair in the batch, vmask one flag per pair.
+// -----------------------------------------------------------------------------
+
+const int W = 4;  // number of lanes
+
+#if defined(USE_AVX)
+
+struct vreal {
+    vreal() {}
+    vreal(__m256d a) : v(a) {}
+    vreal(real a) : v(_mm256_set1_pd(a)) {}
+    __m256d v;
+};
+
+struct vmask {
+    vmask() {}
+    vmask(__m256d a) : m(a) {}
+    __m256d m;
+};
+
+inline vreal Load(const real* p) {
+    return _mm256_load_pd(p);
+}
+inline void Store(real* p, const vreal& a) {
+    _mm256_store_pd(p, a.v);
+}
+
+inline vreal operator+(const vreal& a, const vreal& b) {
+    return _mm256_add_pd(a.v, b.v);
+}
+inline vreal operator-(const vreal& a, const vreal& b) {
+    return _mm256_sub_pd(a.v, b.v);
+}
+inline vreal operator*(const vreal& a, const vreal& b) {
+    return _mm256_mul_pd(a.v, b.v);
+}
+inline vreal operator/(const vreal& a, const vreal& b) {
+    return _mm256_div_pd(a.v, b.v);
+}
+inline vreal operator-(const vreal& a) {
+    return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0));
+}
+inline vreal Sqrt(const vreal& a) {
+    return _mm256_sqrt_pd(a.v);
+}
+inline vreal Abs(const vreal& a) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v);
+}
+inline vreal Min(const vreal& a, const vreal& b) {
+    return _mm256_min_pd(a.v, b.v);
+}
+inline vreal Max(const vreal& a, const vreal& b) {
+    return _mm256_max_pd(a.v, b.v);
+}
+
+inline vmask operator<(const vreal& a, const vreal& b) {
+    return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ);
+}
+inline vmask operator<=(const vreal& a, const vreal& b) {
+    return _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ);
+}
+inline vmask operator>(const vreal& a, const vreal& b) {
+    return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ);
+}
+inline vmask operator>=(const vreal& a, const vreal& b) {
+    return _mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ);
+}
+
+inline vmask operator&(const vmask& a, const vmask& b) {
+    return _mm256_and_pd(a.m, b.m);
+}
+inline vmask operator|(const vmask& a, const vmask& b) {
+    return _mm256_or_pd(a.m, b.m);
+}
+inline vmask operator~(const vmask& a) {
+    return _mm256_xor_pd(a.m, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)));
+}
+inline vmask MaskAll() {
+    return _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+}
+inline vmask MaskNone() {
+    return _mm256_setzero_pd();
+}
+inline bool Any(const vmask& a) {
+    return _mm256_movemask_pd(a.m) != 0;
+}
+inline int Bits(const vmask& a) {
+    return _mm256_movemask_pd(a.m);
+}
+
+/// Return a where the mask is set and b elsewhere.
+inline vreal Select(const vmask& m, const vreal& a, const vreal& b) {
+    return _mm256_blendv_pd(b.v, a.v, m.m);
+}
+
+#elif defined(USE_SSE)
+
+struct vreal {
+    vreal() {}
+    vreal(__m128 a) : v(a) {}
+    vreal(real a) : v(_mm_set1_ps(a)) {}
+    __m128 v;
+};
+
+struct vmask {
+    vmask() {}
+    vmask(__m128 a) : m(a) {}
+    __m128 m;
+};
+
+inline vreal Load(const real* p) {
+    return _mm_load_ps(p);
+}
+inline void Store(real* p, const vreal& a) {
+    _mm_store_ps(p, a.v);
+}
+
+inline vreal operator+(const vreal& a, const vreal& b) {
+    return _mm_add_ps(a.v, b.v);
+}
+inline vreal operator-(const vreal& a, const vreal& b) {
+    return _mm_sub_ps(a.v, b.v);
+}
+inline vreal operator*(const vreal& a, const vreal& b) {
+    return _mm_mul_ps(a.v, b.v);
+}
+inline vreal operator/(const vreal& a, const vreal& b) {
+    return _mm_div_ps(a.v, b.v);
+}
+inline vreal operator-(const vreal& a) {
+    return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f));
+}
+inline vreal Sqrt(const vreal& a) {
+    return _mm_sqrt_ps(a.v);
+}
+inline vreal Abs(const vreal& a) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v);
+}
+inline vreal Min(const vreal& a, const vreal& b) {
+    return _mm_min_ps(a.v, b.v);
+}
+inline vreal Max(const vreal& a, const vreal& b) {
+    return _mm_max_ps(a.v, b.v);
+}
+
+inline vmask operator<(const vreal& a, const vreal& b) {
+    return _mm_cmplt_ps(a.v, b.v);
+}
+inline vmask operator<=(const vreal& a, const vreal& b) {
+    return _mm_cmple_ps(a.v, b.v);
+}
+inline vmask operator>(const vreal& a, const vreal& b) {
+    return _mm_cmpgt_ps(a.v, b.v);
+}
+inline vmask operator>=(const vreal& a, const vreal& b) {
+    return _mm_cmpge_ps(a.v, b.v);
+}
+
+inline vmask operator&(const vmask& a, const vmask& b) {
+    return _mm_and_ps(a.m, b.m);
+}
+inline vmask operator|(const vmask& a, const vmask& b) {
+    return _mm_or_ps(a.m, b.m);
+}
+inline vmask operator~(const vmask& a) {
+    return _mm_xor_ps(a.m, _mm_castsi128_ps(_mm_set1_epi32(-1)));
+}
+inline vmask MaskAll() {
+    return _mm_castsi128_ps(_mm_set1_epi32(-1));
+}
+inline vmask MaskNone() {
+    return _mm_setzero_ps();
+}
+inline bool Any(const vmask& a) {
+    return _mm_movemask_ps(a.m) != 0;
+}
+inline int Bits(const vmask& a) {
+    return _mm_movemask_ps(a.m);
+}
+
+/// Return a where the mask is set and b elsewhere.
+inline vreal Select(const vmask& m, const vreal& a, const vreal& b) {
+    return _mm_or_ps(_mm_and_ps(m.m, a.v), _mm_andnot_ps(m.m, b.v));
+}
+
+#else
+
+// Fallback without SIMD support (plain loops over the lanes)
+
+struct vreal {
+    vreal() {}
+    vreal(real a) {
+        for (int i = 0; i < W; i++)
+            v[i] = a;
+    }
+    real v[W];
+};
+
+struct vmask {
+    bool m[W];
+};
+
+#define VREAL_UNARY(expr)      \
+    vreal r;                   \
+    for (int i = 0; i < W; i++) \
+        r.v[i] = expr;         \
+    return r;
+
+#define VMASK_BINARY(expr)     \
+    vmask r;                   \
+    for (int i = 0; i < W; i++) \
+        r.m[i] = expr;         \
+    return r;
+
+inline vreal Load(const real* p) {
+    VREAL_UNARY(p[i])
+}
+inline void Store(real* p, const vreal& a) {
+    for (int i = 0; i < W; i++)
+        p[i] = a.v[i];
+}
+
+inline vreal operator+(const vreal& a, const vreal& b) {
+    VREAL_UNARY(a.v[i] + b.v[i])
+}
+inline vreal operator-(const vreal& a, const vreal& b) {
+    VREAL_UNARY(a.v[i] - b.v[i])
+}
+inline vreal operator*(const vreal& a, const vreal& b) {
+    VREAL_UNARY(a.v[i] * b.v[i])
+}
+inline vreal operator/(const vreal& a, const vreal& b) {
+    VREAL_UNARY(a.v[i] / b.v[i])
+}
+inline vreal operator-(const vreal& a) {
+    VREAL_UNARY(-a.v[i])
+}
+inline vreal Sqrt(const vreal& a) {
+    VREAL_UNARY(chrono::Sqrt(a.v[i]))
+}
+inline vreal Abs(const vreal& a) {
+    VREAL_UNARY(chrono::Abs(a.v[i]))
+}
+inline vreal Min(const vreal& a, const vreal& b) {
+    VREAL_UNARY(a.v[i] < b.v[i] ? a.v[i] : b.v[i])
+}
+inline vreal Max(const vreal& a, const vreal& b) {
+    VREAL_UNARY(a.v[i] > b.v[i] ? a.v[i] : b.v[i])
+}
+
+inline vmask operator<(const vreal& a, const vreal& b) {
+    VMASK_BINARY(a.v[i] < b.v[i])
+}
+inline vmask operator<=(const vreal& a, const vreal& b) {
+    VMASK_BINARY(a.v[i] <= b.v[i])
+}
+inline vmask operator>(const vreal& a, const vreal& b) {
+    VMASK_BINARY(a.v[i] > b.v[i])
+}
+inline vmask operator>=(const vreal& a, const vreal& b) {
+    VMASK_BINARY(a.v[i] >= b.v[i])
+}
+
+inline vmask operator&(const vmask& a, const vmask& b) {
+    VMASK_BINARY(a.m[i] && b.m[i])
+}
+inline vmask operator|(const vmask& a, const vmask& b) {
+    VMASK_BINARY(a.m[i] || b.m[i])
+}
+inline vmask operator~(const vmask& a) {
+    VMASK_BINARY(!a.m[i])
+}
+inline vmask MaskAll() {
+    VMASK_BINARY(true)
+}
+inline vmask MaskNone() {
+    VMASK_BINARY(false)
+}
+inline bool Any(const vmask& a) {
+    for (int i = 0; i < W; i++)
+        if (a.m[i])
+            return true;
+    return false;
+}
+inline int Bits(const vmask& a) {
+    int bits = 0;
+    for (int i = 0; i < W; i++)
+        bits |= (a.m[i] ? 1 : 0) << i;
+    return bits;
+}
+
+/// Return a where the mask is set and b elsewhere.
+inline vreal Select(const vmask& m, const vreal& a, const vreal& b) {
+    VREAL_UNARY(m.m[i] ? a.v[i] : b.v[i])
+}
+
+#undef VREAL_UNARY
+#undef VMASK_BINARY
+
+#endif
+
+// -----------------------------------------------------------------------------
+// Lane vectors and quaternions
+// -----------------------------------------------------------------------------
+
+struct vreal3 {
+    vreal3() {}
+    vreal3(const vreal& a, const vreal& b, const vreal& c) : x(a), y(b), z(c) {}
+    vreal x, y, z;
+};
+
+struct vquat {
+    vreal w, x, y, z;
+};
+
+inline vreal3 operator+(const vreal3& a, const vreal3& b) {
+    return vreal3(a.x + b.x, a.y + b.y, a.z + b.z);
+}
+inline vreal3 operator-(const vreal3& a, const vreal3& b) {
+    return vreal3(a.x - b.x, a.y - b.y, a.z - b.z);
+}
+inline vreal3 operator-(const vreal3& a) {
+    return vreal3(-a.x, -a.y, -a.z);
+}
+inline vreal3 operator*(const vreal3& a, const vreal& s) {
+    return vreal3(a.x * s, a.y * s, a.z * s);
+}
+inline vreal3 operator*(const vreal& s, const vreal3& a) {
+    return vreal3(a.x * s, a.y * s, a.z * s);
+}
+inline vreal3 operator*(const vreal3& a, const vreal3& b) {
+    return vreal3(a.x * b.x, a.y * b.y, a.z * b.z);
+}
+
+inline vreal3 operator/(const vreal3& a, const vreal& s) {
+    return vreal3(a.x / s, a.y / s, a.z / s);
+}
+inline vreal Dot(const vreal3& a, const vreal3& b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+inline vreal3 Cross(const vreal3& a, const vreal3& b) {
+    return vreal3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+inline vreal Length(const vreal3& a) {
+    return Sqrt(Dot(a, a));
+}
+inline vreal3 Normalize(const vreal3& a) {
+    return a / Sqrt(Dot(a, a));
+}
+inline vmask IsZero(const vreal3& a) {
+    vreal eps(C_REAL_EPSILON);
+    return (Abs(a.x) < eps) & (Abs(a.y) < eps) & (Abs(a.z) < eps);
+}
+inline vreal3 Select(const vmask& m, const vreal3& a, const vreal3& b) {
+    return vreal3(Select(m, a.x, b.x), Select(m, a.y, b.y), Select(m, a.z, b.z));
+}
+
+// Same operation order as the scalar Rotate (see real4.cpp)
+inline vreal3 Rotate(const vreal3& v, const vquat& q) {
+    vreal3 qv(q.x, q.y, q.z);
+    vreal3 t = Cross(qv, v) * vreal(2);
+    return v + q.w * t + Cross(qv, t);
+}
+inline vreal3 RotateT(const vreal3& v, const vquat& q) {
+    vreal3 qv(-q.x, -q.y, -q.z);
+    vreal3 t = Cross(qv, v) * vreal(2);
+    return v + q.w * t + Cross(qv, t);
+}
+
+inline vreal3 Gather(const real3* p) {
+    alignas(32) real x[W], y[W], z[W];
+    for (int i = 0; i < W; i++) {
+        x[i] = p[i].x;
+        y[i] = p[i].y;
+        z[i] = p[i].z;
+    }
+    return vreal3(Load(x), Load(y), Load(z));
+}
+
+inline void Scatter(const vreal3& a, real3* p) {
+    alignas(32) real x[W], y[W], z[W];
+    Store(x, a.x);
+    Store(y, a.y);
+    Store(z, a.z);
+    for (int i = 0; i < W; i++)
+        p[i] = real3(x[i], y[i], z[i]);
+}
+
+// -----------------------------------------------------------------------------
+// Batch of shapes of the same type
+// -----------------------------------------------------------------------------
+
+// Check if the support function of the given shape type is vectorized.
+inline bool IsVectorized(int type) {
+    switch (type) {
+        case ChCollisionShape::Type::SPHERE:
+        case ChCollisionShape::Type::ELLIPSOID:
+        case ChCollisionShape::Type::BOX:
+        case ChCollisionShape::Type::CYLINDER:
+        case ChCollisionShape::Type::CONE:
+        case ChCollisionShape::Type::CAPSULE:
+        case ChCollisionShape::Type::ROUNDEDBOX:
+        case ChCollisionShape::Type::ROUNDEDCYL:
+        case ChCollisionShape::Type::CYLSHELL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Shape center, as used by the scalar algorithm (GetCenter in ChNarrowphaseMPR.cpp).
+inline real3 ShapeCenter(const ConvexBase* shape) {
+    switch (shape->Type()) {
+        case ChCollisionShape::Type::TRIANGLE:
+            return GetCenter_Triangle(shape->Triangles());
+        case ChCollisionShape::Type::CONVEXHULL:
+            return GetCenter_Convex(shape->Size(), shape->Convex()) + shape->A();
+        case ChCollisionShape::Type::TETRAHEDRON:
+            return GetCenter_Tetrahedron(shape->TetIndex(), shape->TetNodes());
+        default:
+            return shape->A();
+    }
+}
+
+// Shape data loaded once per batch. The lanes beyond the number of pairs in the batch replicate the first lane.
+struct ShapeBatch {
+    ShapeBatch(const ConvexBase* const* s, int n, real env);
+
+    vreal3 Support(const vreal3& n) const;
+
+    int type;
+    bool vectorized;
+    real envelope;
+    const ConvexBase* shapes[W];
+    vreal3 center;  // center of each shape
+    vreal3 A;       // position
+    vquat R;        // orientation
+    vreal3 B;       // dimensions
+    vreal r;        // radius (sphere, capsule, rounded shapes)
+};
+
+ShapeBatch::ShapeBatch(const ConvexBase* const* s, int n, real env) : envelope(env) {
+    type = s[0]->Type();
+    vectorized = IsVectorized(type);
+    for (int i = 0; i < W; i++)
+        shapes[i] = s[i < n ? i : 0];
+
+    real3 c[W];
+    for (int i = 0; i < W; i++)
+        c[i] = ShapeCenter(shapes[i]);
+    center = Gather(c);
+
+    if (!vectorized)
+        return;
+
+    real3 pos[W];
+    real3 dims[W];
+    alignas(32) real rw[W], rx[W], ry[W], rz[W], rad[W];
+    for (int i = 0; i < W; i++) {
+        pos[i] = shapes[i]->A();
+        quaternion q = shapes[i]->R();
+        rw[i] = q.w;
+        rx[i] = q.x;
+        ry[i] = q.y;
+        rz[i] = q.z;
+        rad[i] = 0;
+        switch (type) {
+            case ChCollisionShape::Type::SPHERE:
+                dims[i] = real3(0);
+                rad[i] = shapes[i]->Radius();
+                break;
+            case ChCollisionShape::Type::CAPSULE: {
+                real2 cap = shapes[i]->Capsule();
+                dims[i] = real3(cap.x, cap.y, 0);
+                rad[i] = cap.x;
+                break;
+            }
+            case ChCollisionShape::Type::ROUNDEDBOX:
+            case ChCollisionShape::Type::ROUNDEDCYL: {
+                real4 rb = shapes[i]->Rbox();
+                dims[i] = real3(rb.x, rb.y, rb.z);
+                rad[i] = rb.w;
+                break;
+            }
+            default:
+                dims[i] = shapes[i]->Box();
+                break;
+        }
+    }
+    A = Gather(pos);
+    B = Gather(dims);
+    R.w = Load(rw);
+    R.x = Load(rx);
+    R.y = Load(ry);
+    R.z = Load(rz);
+    r = Load(rad);
+}
+
+inline vreal3 SupportBox(const vreal3& B, const vreal3& n) {
+    // Sign(n) * B, with Sign(0) = 0
+    vreal zero(0);
+    vreal3 res;
+    res.x = Select(n.x > zero, B.x, Select(n.x < zero, -B.x, zero));
+    res.y = Select(n.y > zero, B.y, Select(n.y < zero, -B.y, zero));
+    res.z = Select(n.z > zero, B.z, Select(n.z < zero, -B.z, zero));
+    return res;
+}
+
+inline vreal3 SupportCylinder(const vreal3& B, const vreal3& n) {
+    vreal zero(0);
+    vreal s = Sqrt(n.x * n.x + n.y * n.y);
+    vmask axial = s < vreal(1e-9);
+    vreal3 res;
+    res.x = Select(axial, B.x, n.x * B.x / s);
+    res.y = Select(axial, zero, n.y * B.x / s);
+    res.z = Select(n.z < zero, -B.z, B.z);
+    return res;
+}
+
+inline vreal3 SupportCone(const vreal3& B, const vreal3& n) {
+    vreal zero(0);
+    vreal sinAngle = B.x / Sqrt(B.x * B.x + B.y * B.y);
+    vmask apex = n.z > Length(n) * sinAngle;
+    vreal s = Sqrt(n.x * n.x + n.y * n.y);
+    vmask axial = s < vreal(1e-9);
+    vreal3 res;
+    res.x = Select(apex | axial, zero, n.x * B.x / s);
+    res.y = Select(apex | axial, zero, n.y * B.x / s);
+    res.z = Select(apex, B.y, zero);
+    return res;
+}
+
+// Vectorized version of TransformSupportVert (see ChCollisionUtilsMPR.cpp).
+vreal3 ShapeBatch::Support(const vreal3& dir) const {
+    if (!vectorized) {
+        real3 nv[W];
+        real3 sv[W];
+        Scatter(dir, nv);
+        for (int i = 0; i < W; i++)
+            sv[i] = TransformSupportVert(shapes[i], nv[i], envelope);
+        return Gather(sv);
+    }
+
+    vreal3 n = Normalize(RotateT(dir, R));
+    vreal3 local;
+    switch (type) {
+        case ChCollisionShape::Type::SPHERE:
+            local = n * r;
+            break;
+        case ChCollisionShape::Type::ELLIPSOID:
+            local = B * B * n / Length(B * n);
+            break;
+        case ChCollisionShape::Type::BOX:
+            local = SupportBox(B, n);
+            break;
+        case ChCollisionShape::Type::CYLINDER:
+        case ChCollisionShape::Type::CYLSHELL:
+            local = SupportCylinder(B, n);
+            break;
+        case ChCollisionShape::Type::CONE:
+            local = SupportCone(B, n);
+            break;
+        case ChCollisionShape::Type::CAPSULE: {
+            vreal zero(0);
+            local = n * r;
+            local.x = local.x + Select(n.x > zero, B.y, Select(n.x < zero, -B.y, zero));
+            break;
+        }
+        case ChCollisionShape::Type::ROUNDEDBOX:
+            local = SupportBox(B, n) + n * r;
+            break;
+        case ChCollisionShape::Type::ROUNDEDCYL:
+            local = SupportCylinder(B, n) + n * r;
+            break;
+    }
+    local = local + n * vreal(envelope);
+
+    return Rotate(local, R) + A;
+}
+
+// -----------------------------------------------------------------------------
+// Lane-wise MPR
+// -----------------------------------------------------------------------------
+
+struct vsupport {
+    vreal3 v, v1, v2;
+};
+
+struct vsimplex {
+    vsupport s0, s1, s2, s3, s4;
+};
+
+inline vsupport Select(const vmask& m, const vsupport& a, const vsupport& b) {
+    vsupport s;
+    s.v = Select(m, a.v, b.v);
+    s.v1 = Select(m, a.v1, b.v1);
+    s.v2 = Select(m, a.v2, b.v2);
+    return s;
+}
+
+inline vsupport MPRSupport(const ShapeBatch& shapeA, const ShapeBatch& shapeB, const vreal3& n) {
+    vsupport s;
+    s.v1 = shapeA.Support(-n);
+    s.v2 = shapeB.Support(n);
+    s.v = s.v2 - s.v1;
+    return s;
+}
+
+inline void ExpandPortal(vsimplex& portal, const vmask& active) {
+    vreal zero(0);
+    vmask d1 = Dot(Cross(portal.s4.v, portal.s1.v), portal.s0.v) < zero;
+    vmask d2 = Dot(Cross(portal.s4.v, portal.s2.v), portal.s0.v) < zero;
+    vmask d3 = Dot(Cross(portal.s4.v, portal.s3.v), portal.s0.v) < zero;
+    vmask e1 = active & ((d1 & d2) | (~d1 & ~d3));  // eliminate v1
+    vmask e3 = active & d1 & ~d2;                   // eliminate v3
+    vmask e2 = active & ~d1 & d3;                   // eliminate v2
+    portal.s1 = Select(e1, portal.s4, portal.s1);
+    portal.s2 = Select(e2, portal.s4, portal.s2);
+    portal.s3 = Select(e3, portal.s4, portal.s3);
+}
+
+inline vreal3 PortalDir(const vsimplex& portal) {
+    return Normalize(Cross((portal.s2.v - portal.s1.v), (portal.s3.v - portal.s1.v)));
+}
+
+inline vreal3 FindPos(const vsimplex& portal) {
+    vreal3 n = PortalDir(portal);
+    vreal b0 = Dot(Cross(portal.s1.v, portal.s2.v), portal.s3.v);
+    vreal b1 = Dot(Cross(portal.s3.v, portal.s2.v), portal.s0.v);
+    vreal b2 = Dot(Cross(portal.s0.v, portal.s1.v), portal.s3.v);
+    vreal b3 = Dot(Cross(portal.s2.v, portal.s1.v), portal.s0.v);
+    vreal sum = b0 + b1 + b2 + b3;
+
+    vmask flat = sum <= vreal(0);
+    if (Any(flat)) {
+        b0 = Select(flat, vreal(0), b0);
+        b1 = Select(flat, Dot(Cross(portal.s2.v, portal.s3.v), n), b1);
+        b2 = Select(flat, Dot(Cross(portal.s3.v, portal.s1.v), n), b2);
+        b3 = Select(flat, Dot(Cross(portal.s1.v, portal.s2.v), n), b3);
+        sum = Select(flat, b1 + b2 + b3, sum);
+    }
+
+    vreal inv = vreal(1) / sum;
+    vreal3 p1 = (b0 * portal.s0.v1 + b1 * portal.s1.v1 + b2 * portal.s2.v1 + b3 * portal.s3.v1) * inv;
+    vreal3 p2 = (b0 * portal.s0.v2 + b1 * portal.s1.v2 + b2 * portal.s2.v2 + b3 * portal.s3.v2) * inv;
+    return (p1 + p2) * vreal(0.5);
+}
+
+inline vmask PortalReachTolerance(const vsimplex& portal, const vreal3& n) {
+    vreal dv1 = Dot(portal.s1.v, n);
+    vreal dv2 = Dot(portal.s2.v, n);
+    vreal dv3 = Dot(portal.s3.v, n);
+    vreal dv4 = Dot(portal.s4.v, n);
+
+    vreal dot = Min(Min(dv4 - dv1, dv4 - dv2), dv4 - dv3);
+
+    // IsEqual(dot, MPR_TOLERANCE) || dot < MPR_TOLERANCE
+    vreal tol(MPR_TOLERANCE);
+    vreal diff = Abs(dot - tol);
+    return (dot < tol) | (diff < tol) | (diff < tol * Max(Abs(dot), tol));
+}
+
+// Find the contacts between the shapes in the two batches (one pair per lane).
+// Returns a mask of the lanes in contact.
+vmask MPRContact(const ShapeBatch& shapeA,
+                 const ShapeBatch& shapeB,
+                 vreal3& normal,
+                 vreal3& pointA,
+                 vreal3& pointB,
+                 vreal& depth) {
+    vreal zero(0);
+    vsimplex portal;
+    vreal3 point(zero, zero, zero);
+    normal = point;
+
+    // Phase 1: discover portal
+
+    portal.s0.v1 = shapeA.center;
+    portal.s0.v2 = shapeB.center;
+    portal.s0.v = portal.s0.v2 - portal.s0.v1;
+    portal.s0.v = Select(IsZero(portal.s0.v), vreal3(vreal(1), zero, zero), portal.s0.v);
+
+    vreal3 n = Normalize(-portal.s0.v);
+    portal.s1 = MPRSupport(shapeA, shapeB, n);
+    vmask active = ~(Dot(portal.s1.v, n) < zero);
+
+    n = Cross(portal.s0.v, portal.s1.v);
+    vmask degenerate = active & IsZero(n);
+    vmask touch = degenerate & IsZero(portal.s1.v);
+    vmask segment = degenerate & ~IsZero(portal.s1.v);
+    active = active & ~degenerate;
+
+    vmask found = MaskNone();
+
+    if (Any(active)) {
+        n = Normalize(n);
+        portal.s2 = Select(active, MPRSupport(shapeA, shapeB, n), portal.s2);
+        active = active & ~(Dot(portal.s2.v, n) <= zero);
+
+        n = Normalize(Cross((portal.s1.v - portal.s0.v), (portal.s2.v - portal.s0.v)));
+        vmask swap = active & (Dot(n, portal.s0.v) > zero);
+        vsupport tmp = portal.s1;
+        portal.s1 = Select(swap, portal.s2, portal.s1);
+        portal.s2 = Select(swap, tmp, portal.s2);
+        n = Select(swap, -n, n);
+
+        for (int wi = 0; wi < WHILE_LOOP_MAX && Any(active); wi++) {
+            portal.s3 = Select(active, MPRSupport(shapeA, shapeB, n), portal.s3);
+            active = active & ~(Dot(portal.s3.v, n) <= zero);
+
+            // If origin is outside (v1,v0,v3), then eliminate v2 and loop
+            vmask out1 = active & (Dot(Cross(portal.s1.v, portal.s3.v), portal.s0.v) < zero);
+            portal.s2 = Select(out1, portal.s3, portal.s2);
+            n = Select(out1, Normalize(Cross((portal.s1.v - portal.s0.v), (portal.s3.v - portal.s0.v))), n);
+
+            // If origin is outside (v3,v0,v2), then eliminate v1 and loop
+            vmask out2 = active & ~out1 & (Dot(Cross(portal.s3.v, portal.s2.v), portal.s0.v) < zero);
+            portal.s1 = Select(out2, portal.s3, portal.s1);
+            n = Select(out2, Normalize(Cross((portal.s3.v - portal.s0.v), (portal.s2.v - portal.s0.v))), n);
+
+            vmask done = active & ~out1 & ~out2;
+            found = found | done;
+            active = active & ~done;
+        }
+        found = found | active;
+    }
+
+    // Phase 2: refine portal
+
+    active = found;
+    found = MaskNone();
+    for (int i = 0; i < MAX_ITERATIONS && Any(active); i++) {
+        n = PortalDir(portal);
+
+        vmask encapsulates = active & (Dot(n, portal.s1.v) >= zero);
+        found = found | encapsulates;
+        active = active & ~encapsulates;
+        if (!Any(active))
+            break;
+
+        portal.s4 = Select(active, MPRSupport(shapeA, shapeB, n), portal.s4);
+
+        vmask stop = active & (PortalReachTolerance(portal, n) | ~(Dot(portal.s4.v, n) >= zero));
+        found = found | (stop & (Dot(n, portal.s1.v) >= zero));
+        active = active & ~stop;
+
+        ExpandPortal(portal, active);
+    }
+
+    // Phase 3: find penetration
+
+    active = found;
+    for (int i = 0; i < MAX_ITERATIONS && Any(active); i++) {
+        vreal3 dir = PortalDir(portal);
+        portal.s4 = Select(active, MPRSupport(shapeA, shapeB, dir), portal.s4);
+
+        vmask stop = active & (i == MAX_ITERATIONS - 1 ? MaskAll() : PortalReachTolerance(portal, dir));
+        normal = Select(stop, Normalize(dir), normal);
+        point = Select(stop, FindPos(portal), point);
+        active = active & ~stop;
+
+        ExpandPortal(portal, active);
+    }
+
+    // Touching contacts and contacts along the segment between the shape centers
+    vmask ts = touch | segment;
+    if (Any(ts)) {
+        point = Select(ts, (portal.s1.v1 + portal.s1.v2) * vreal(0.5), point);
+        normal = Select(touch, Normalize(portal.s1.v - portal.s0.v), normal);
+        normal = Select(segment, Normalize(portal.s1.v), normal);
+        found = found | ts;
+    }
+
+    if (!Any(found))
+        return found;
+
+    // Contact points on the two shapes
+    pointA = Dot((shapeA.Support(-normal) - point), normal) * normal + point;
+    pointB = Dot((shapeB.Support(normal) - point), normal) * normal + point;
+    normal = -normal;
+
+    vreal env(shapeA.envelope);
+    pointA = pointA - normal * env;
+    pointB = pointB + normal * env;
+    depth = Dot(normal, pointB - pointA);
+
+    return found;
+}
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+int ChNarrowphase::GetMPRBatchWidth() {
+    return W;
+}
+
+void ChNarrowphase::MPRCollisionBatch(int num_pairs,
+                                      const ConvexBase* const* shapesA,
+                                      const ConvexBase* const* shapesB,
+                                      real envelope,
+                                      real3* normal,
+                                      real3* pointA,
+                                      real3* pointB,
+                                      real* depth,
+                                      char* found) {
+    int start = 0;
+    while (start < num_pairs) {
+        // Collect up to W consecutive pairs with the same shape types
+        int typeA = shapesA[start]->Type();
+        int typeB = shapesB[start]->Type();
+        int n = 1;
+        while (n < W && start + n < num_pairs && shapesA[start + n]->Type() == typeA &&
+               shapesB[start + n]->Type() == typeB) {
+            n++;
+        }
+
+        if (n == 1) {
+            found[start] = MPRCollision(shapesA[start], shapesB[start], envelope, normal[start], pointA[start],
+                                        pointB[start], depth[start]);
+            start++;
+            continue;
+        }
+
+        ShapeBatch batchA(&shapesA[start], n, envelope);
+        ShapeBatch batchB(&shapesB[start], n, envelope);
+
+        vreal3 v_normal;
+        vreal3 v_pointA;
+        vreal3 v_pointB;
+        vreal v_depth;
+        vmask v_found = MPRContact(batchA, batchB, v_normal, v_pointA, v_pointB, v_depth);
+
+        int bits = Bits(v_found);
+        real3 l_normal[W];
+        real3 l_pointA[W];
+        real3 l_pointB[W];
+        alignas(32) real l_depth[W];
+        if (bits) {
+            Scatter(v_normal, l_normal);
+            Scatter(v_pointA, l_pointA);
+            Scatter(v_pointB, l_pointB);
+            Store(l_depth, v_depth);
+        }
+        for (int i = 0; i < n; i++) {
+            found[start + i] = (bits >> i) & 1;
+            if (found[start + i]) {
+                normal[start + i] = l_normal[i];
+                pointA[start + i] = l_pointA[i];
+                pointB[start + i] = l_pointB[i];
+                depth[start + i] = l_depth[i];
+            }
+        }
+
+        start += n;
+    }
+}
+
+}  // end namespace chrono
@@ -12,6 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/collision/multicore/ChRayTest.h"
 #include "chrono/collision/multicore/ChCollisionUtils.h"
 
@@ -375,22 +377,62 @@ bool triangle_ray(const real3& A,
 
 // =============================================================================
 
+// Collect the broadphase grids to be searched: the grid of all shapes (or of active shapes only, with the incremental
+// broadphase) and, with the incremental broadphase, the grid of static shapes.
+int ChRayTest::GetGrids(GridView grids[2]) const {
+    int num_grids = 0;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    size_t num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
+    if (cd_data->num_rigid_shapes > 0 && cd_data->bin_start_index_ext.size() >= num_bins + 1) {
+        GridView& grid = grids[num_grids++];
+        grid.bins_per_axis = cd_data->bins_per_axis;
+        grid.bin_size = cd_data->bin_size;
+        grid.inv_bin_size = cd_data->inv_bin_size;
+        grid.lbr = cd_data->min_bounding_point;
+        grid.rtf = cd_data->max_bounding_point;
+        grid.bin_start_ext = &cd_data->bin_start_index_ext;
+        grid.bin_aabb = &cd_data->bin_aabb_number;
+        grid.shapes = nullptr;
+    }
+
+    const static_grid_container& sgrid = cd_data->static_grid;
+    if (sgrid.active && sgrid.num_bins > 0) {
+        GridView& grid = grids[num_grids++];
+        grid.bins_per_axis = sgrid.bins_per_axis;
+        grid.bin_size = sgrid.bin_size;
+        grid.inv_bin_size = sgrid.inv_bin_size;
+        grid.lbr = sgrid.min_bounding_point;
+        grid.rtf = sgrid.max_bounding_point;
+        grid.bin_start_ext = &sgrid.bin_start_index_ext;
+        grid.bin_aabb = &sgrid.bin_aabb_number;
+        grid.shapes = &sgrid.shapes;
+    }
+
+    return num_grids;
+}
+
 // Use a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems", 1986)
 // to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
-bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
+bool ChRayTest::CheckGrid(const GridView& grid,
+                          const real3& start,
+                          const real3& end,
+                          int& shapeID,
+                          real3& normal,
+                          real& mindist2) {
     // Readability replacements
-    const vec3& bins_per_axis = cd_data->bins_per_axis;
-    const real3& bin_size = cd_data->bin_size;
-    const real3& inv_bin_size = cd_data->inv_bin_size;
-    const real3& lbr = cd_data->min_bounding_point;
-    const real3& rtf = cd_data->max_bounding_point;
-    const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
-    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const vec3& bins_per_axis = grid.bins_per_axis;
+    const real3& bin_size = grid.bin_size;
+    const real3& inv_bin_size = grid.inv_bin_size;
+    const real3& lbr = grid.lbr;
+    const real3& rtf = grid.rtf;
+    const std::vector<uint>& bin_start_index_ext = *grid.bin_start_ext;
+    const std::vector<uint>& bin_aabb_number = *grid.bin_aabb;
 
     // Calculate ray parameter at intersection of overall AABB. Return now if no intersection
-    real3 center = 0.5 * (rtf + lbr), loc, normal;
+    real3 center = 0.5 * (rtf + lbr), loc, box_normal;
     real t_min;
-    if (!aabb_ray(0.5 * (rtf - lbr), start - center, end - center, t_min, loc, normal))
+    if (!aabb_ray(0.5 * (rtf - lbr), start - center, end - center, t_min, loc, box_normal))
         return false;
 
     // Ray direction
@@ -426,13 +468,17 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
 
     // Walk through each bin intersected by the ray (DDA).
     ConvexShape shape(-1, &cd_data->shape_data);
-    real mindist2 = C_REAL_MAX;
+    real len2 = Length2(ray);
     bool hit = false;
 
     ////std::cout << "Ray start: [" << start.x << "," << start.y << "," << start.z << "]" << std::endl;
     ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
 
     while (true) {
+        // Stop if the ray enters the current bin past the closest hit found so far (possibly in a different grid)
+        if (t_min * t_min * len2 > mindist2)
+            break;
+
         ////std::cout << "  Test BIN:  [" << bin.x << "," << bin.y << "," << bin.z << "]" << std::endl;
         num_bin_tests++;
 
@@ -443,25 +489,24 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
 
         for (uint j = start_index; j < end_index; j++) {
             num_shape_tests++;
-            shape.index = bin_aabb_number[j];
+            shape.index = grid.shapes ? (*grid.shapes)[bin_aabb_number[j]] : bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
+            real3 shape_normal;
+            if (CheckShape(shape, start, end, shape_normal, mindist2)) {
                 hit = true;
+                shapeID = shape.index;  // Identifier of closest hit shape
+                normal = shape_normal;  // Normal at hit point
+            }
         }
 
-        // If a shape in the current bin was hit, stop.
-        if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
-            info.dist = Sqrt(mindist2);         // Distance from ray origin
-            info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
-            info.point = start + info.t * ray;  // Intersection point
-            break;
-        }
-
-        // Move to the next cell (the one with lowest t_next)
+        // Move to the next cell (the one with lowest t_next).
+        // A shape hit in the current bin may extend beyond it, so stop only when the next bin starts past that hit.
         static const int map[8] = {2, 1, 2, 1, 2, 2, 0, 0};
         int k = ((t_next[0] < t_next[1]) << 2) + ((t_next[0] < t_next[2]) << 1) + ((t_next[1] < t_next[2]));
         int axis = map[k];
+        t_min = t_next[axis];
+        if (t_min >= 1)
+            break;
         bin[axis] += step[axis];
         if (bin[axis] == exit[axis])
             break;
@@ -471,6 +516,132 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     return hit;
 }
 
+bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
+    GridView grids[2];
+    int num_grids = GetGrids(grids);
+
+    // Search all grids, keeping track of the closest hit
+    real mindist2 = C_REAL_MAX;
+    bool hit = false;
+    for (int g = 0; g < num_grids; g++) {
+        if (CheckGrid(grids[g], start, end, info.shapeID, info.normal, mindist2))
+            hit = true;
+    }
+
+    if (hit) {
+        real3 ray = end - start;
+        info.dist = Sqrt(mindist2);         // Distance from ray origin
+        info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
+        info.point = start + info.t * ray;  // Intersection point
+    }
+
+    return hit;
+}
+
+// Collect shapes from all bins of the given grid overlapped by the specified box, discarding those not overlapping the
+// box. Note that shape AABBs are expressed relative to the global origin.
+bool ChRayTest::CollectCandidates(const GridView& grid, const real3& pmin, const real3& pmax, int max_bins) {
+    const std::vector<uint>& bin_start_index_ext = *grid.bin_start_ext;
+    const std::vector<uint>& bin_aabb_number = *grid.bin_aabb;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    // Nothing to collect if no overlap with the grid.
+    const real3& lbr = grid.lbr;
+    const real3& rtf = grid.rtf;
+    if (pmin.x > rtf.x || pmin.y > rtf.y || pmin.z > rtf.z || pmax.x < lbr.x || pmax.y < lbr.y || pmax.z < lbr.z)
+        return true;
+
+    // Range of bins overlapped by the box
+    vec3 bmin = Clamp(HashMin(pmin - lbr, grid.inv_bin_size), vec3(0, 0, 0), grid.bins_per_axis - vec3(1, 1, 1));
+    vec3 bmax = Clamp(HashMax(pmax - lbr, grid.inv_bin_size), vec3(0, 0, 0), grid.bins_per_axis - vec3(1, 1, 1));
+    int num_bins = (bmax.x - bmin.x + 1) * (bmax.y - bmin.y + 1) * (bmax.z - bmin.z + 1);
+    if (num_bins > max_bins)
+        return false;
+
+    real3 pmin_rel = pmin - cd_data->global_origin;
+    real3 pmax_rel = pmax - cd_data->global_origin;
+    vec3 bin;
+    for (bin.z = bmin.z; bin.z <= bmax.z; bin.z++) {
+        for (bin.y = bmin.y; bin.y <= bmax.y; bin.y++) {
+            for (bin.x = bmin.x; bin.x <= bmax.x; bin.x++) {
+                num_bin_tests++;
+                auto bin_index = Hash_Index(bin, grid.bins_per_axis);
+                for (uint j = bin_start_index_ext[bin_index]; j < bin_start_index_ext[bin_index + 1]; j++) {
+                    uint index = grid.shapes ? (*grid.shapes)[bin_aabb_number[j]] : bin_aabb_number[j];
+                    if (overlap(pmin_rel, pmax_rel, aabb_min[index], aabb_max[index]))
+                        candidates.push_back(index);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+// Test a packet of rays against the union of the shapes in all bins overlapping the packet bounding box.
+void ChRayTest::CheckPacket(int num_rays, const real3* start, const real3* end, RayHitInfo* info, bool* hit) {
+    // Readability replacements
+    const real3& origin = cd_data->global_origin;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    for (int i = 0; i < num_rays; i++)
+        hit[i] = false;
+
+    GridView grids[2];
+    int num_grids = GetGrids(grids);
+
+    // Bounding box of the packet
+    real3 pmin = start[0];
+    real3 pmax = start[0];
+    for (int i = 0; i < num_rays; i++) {
+        pmin = Min(pmin, Min(start[i], end[i]));
+        pmax = Max(pmax, Max(start[i], end[i]));
+    }
+
+    // Collect (unique) candidate shapes from all overlapped bins.
+    // If the packet is not coherent enough, fall back on individual DDA tests.
+    candidates.clear();
+    for (int g = 0; g < num_grids; g++) {
+        if (!CollectCandidates(grids[g], pmin, pmax, 4 * num_rays + 8)) {
+            for (int i = 0; i < num_rays; i++)
+                hit[i] = Check(start[i], end[i], info[i]);
+            return;
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    // Test each ray against all candidate shapes and keep the closest hit
+    ConvexShape shape(-1, &cd_data->shape_data);
+    for (int i = 0; i < num_rays; i++) {
+        real3 ray = end[i] - start[i];
+        real3 rmin = Min(start[i], end[i]) - origin;
+        real3 rmax = Max(start[i], end[i]) - origin;
+        real mindist2 = C_REAL_MAX;
+        real3 normal;
+
+        for (auto index : candidates) {
+            if (!overlap(rmin, rmax, aabb_min[index], aabb_max[index]))
+                continue;
+            num_shape_tests++;
+            shape.index = index;
+            if (CheckShape(shape, start[i], end[i], normal, mindist2)) {
+                hit[i] = true;
+                info[i].shapeID = index;
+                info[i].normal = normal;
+            }
+        }
+
+        if (hit[i]) {
+            info[i].dist = Sqrt(mindist2);              // Distance from ray origin
+            info[i].t = info[i].dist / Length(ray);     // Ray parameter at intersection with closest shape
+            info[i].point = start[i] + info[i].t * ray;  // Intersection point
+        }
+    }
+}
+
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
 // fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
@@ -43,11 +43,25 @@ class ChApi ChRayTest {
     /// Check for intersection of the given ray with all collision shapes in the system.
     /// Uses a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems",
     /// 1986) to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
+    /// With the incremental broadphase, both the grid of active shapes and the grid of static shapes are traversed.
     bool Check(const real3& start,  ///< ray start point
                const real3& end,    ///< ray end point
                RayHitInfo& info     ///< [output] test result info
     );
 
+    /// Check for intersection of a packet of rays with all collision shapes in the system.
+    /// The candidate shapes are collected only once for the entire packet, from the broadphase bins overlapping the
+    /// bounding box of the packet, and each ray is then tested against these candidates. For best performance, the
+    /// rays in a packet should be spatially coherent. If the packet bounding box covers too many bins, the rays are
+    /// tested individually (see Check). On return, hit[i] indicates whether ray i intersects a shape, in which case
+    /// info[i] contains the test result.
+    void CheckPacket(int num_rays,           ///< number of rays in packet
+                     const real3* start,     ///< ray start points
+                     const real3* end,       ///< ray end points
+                     RayHitInfo* info,       ///< [output] test result info
+                     bool* hit               ///< [output] test result flags
+    );
+
     /// Return the number of bins visited by the DDA algorithm during the last ray test.
     uint GetNumBinTests() const { return num_bin_tests; }
 
@@ -55,6 +69,35 @@ class ChApi ChRayTest {
     uint GetNumShapeTests() const { return num_shape_tests; }
 
   private:
+    /// View of a broadphase grid (the grid of all or active shapes, or the grid of static shapes).
+    struct GridView {
+        vec3 bins_per_axis;                      ///< number of slices along each axis of the grid
+        real3 bin_size;                          ///< bin sizes in each direction
+        real3 inv_bin_size;                      ///< bin size reciprocals in each direction
+        real3 lbr;                               ///< grid origin
+        real3 rtf;                               ///< grid RTF corner
+        const std::vector<uint>* bin_start_ext;  ///< [num_bins+1] start of each bin in bin_aabb_number
+        const std::vector<uint>* bin_aabb;       ///< entries in each bin
+        const std::vector<uint>* shapes;         ///< map from bin entries to shape IDs (identity if null)
+    };
+
+    /// Collect the broadphase grids to be searched. Return the number of grids.
+    int GetGrids(GridView grids[2]) const;
+
+    /// Traverse the given grid with the DDA algorithm and test the ray against the shapes in the visited bins.
+    /// Returns true if a shape closer than 'mindist2' was found, in which case 'mindist2', 'shapeID' and 'normal' are
+    /// updated.
+    bool CheckGrid(const GridView& grid,
+                   const real3& start,
+                   const real3& end,
+                   int& shapeID,
+                   real3& normal,
+                   real& mindist2);
+
+    /// Collect the shapes in the bins of the given grid overlapping the box [pmin, pmax].
+    /// Returns false (without collecting any candidates) if this box overlaps more than 'max_bins' bins.
+    bool CollectCandidates(const GridView& grid, const real3& pmin, const real3& pmax, int max_bins);
+
     /// Dispatcher for analytic functions for ray intersection with primitive shapes.
     bool CheckShape(const ConvexBase& shape,  ///< candidate shape
                     const real3& start,       ///< ray start point
@@ -64,6 +107,7 @@ class ChApi ChRayTest {
     );
 
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
+    std::vector<uint> candidates;              ///< candidate shapes for a packet of rays
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
 };
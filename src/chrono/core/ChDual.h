@@ -0,0 +1,259 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Dual numbers for forward-mode automatic differentiation.
+//
+// =============================================================================
+
+#ifndef CHDUAL_H
+#define CHDUAL_H
+
+#include <cmath>
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// Dual number for forward-mode automatic differentiation.
+/// A ChDual carries a value and its partial derivatives with respect to N independent variables. Evaluating a function
+/// templated on the scalar type with ChDual arguments, after seeding the independent variables, produces the function
+/// value together with N columns of its Jacobian in a single pass. The derivative arrays have fixed size, so the
+/// arithmetic operations are plain loops that the compiler can vectorize.
+template <int N>
+class ChDual {
+  public:
+    static const int size = N;
+
+    ChDual() : m_val(0) { SetDerivatives(0); }
+    ChDual(double val) : m_val(val) { SetDerivatives(0); }
+
+    /// Create an independent variable with the given value, seeded in direction 'i'.
+    ChDual(double val, int i) : m_val(val) {
+        SetDerivatives(0);
+        m_der[i] = 1;
+    }
+
+    /// Return the value.
+    double value() const { return m_val; }
+    double& value() { return m_val; }
+
+    /// Return the partial derivative in direction 'i'.
+    double derivative(int i) const { return m_der[i]; }
+    double& derivative(int i) { return m_der[i]; }
+
+    /// Make this an independent variable, seeded in direction 'i'.
+    void Seed(int i) {
+        SetDerivatives(0);
+        m_der[i] = 1;
+    }
+
+    /// Set all partial derivatives to the given value.
+    void SetDerivatives(double d) {
+        for (int i = 0; i < N; i++)
+            m_der[i] = d;
+    }
+
+    ChDual operator-() const {
+        ChDual r(-m_val);
+        for (int i = 0; i < N; i++)
+            r.m_der[i] = -m_der[i];
+        return r;
+    }
+    const ChDual& operator+() const { return *this; }
+
+    ChDual& operator+=(const ChDual& b) {
+        m_val += b.m_val;
+        for (int i = 0; i < N; i++)
+            m_der[i] += b.m_der[i];
+        return *this;
+    }
+    ChDual& operator-=(const ChDual& b) {
+        m_val -= b.m_val;
+        for (int i = 0; i < N; i++)
+            m_der[i] -= b.m_der[i];
+        return *this;
+    }
+    ChDual& operator*=(const ChDual& b) {
+        for (int i = 0; i < N; i++)
+            m_der[i] = m_der[i] * b.m_val + m_val * b.m_der[i];
+        m_val *= b.m_val;
+        return *this;
+    }
+    ChDual& operator/=(const ChDual& b) {
+        double inv = 1 / b.m_val;
+        m_val *= inv;
+        for (int i = 0; i < N; i++)
+            m_der[i] = (m_der[i] - m_val * b.m_der[i]) * inv;
+        return *this;
+    }
+
+    ChDual& operator+=(double b) {
+        m_val += b;
+        return *this;
+    }
+    ChDual& operator-=(double b) {
+        m_val -= b;
+        return *this;
+    }
+    ChDual& operator*=(double b) {
+        m_val *= b;
+        for (int i = 0; i < N; i++)
+            m_der[i] *= b;
+        return *this;
+    }
+    ChDual& operator/=(double b) { return *this *= (1 / b); }
+
+    /// Return a dual number with the given value and the derivatives of this one scaled by 'factor' (chain rule).
+    ChDual Chain(double val, double factor) const {
+        ChDual r(val);
+        for (int i = 0; i < N; i++)
+            r.m_der[i] = factor * m_der[i];
+        return r;
+    }
+
+    // Elementary functions, defined as friends so that they are found only through argument-dependent lookup
+    // (code templated on the scalar type can call them unqualified after 'using std::sqrt' etc.)
+
+    friend ChDual sqrt(const ChDual& a) {
+        double s = std::sqrt(a.m_val);
+        return a.Chain(s, 0.5 / s);
+    }
+    friend ChDual sin(const ChDual& a) { return a.Chain(std::sin(a.m_val), std::cos(a.m_val)); }
+    friend ChDual cos(const ChDual& a) { return a.Chain(std::cos(a.m_val), -std::sin(a.m_val)); }
+    friend ChDual tan(const ChDual& a) {
+        double t = std::tan(a.m_val);
+        return a.Chain(t, 1 + t * t);
+    }
+    friend ChDual atan(const ChDual& a) { return a.Chain(std::atan(a.m_val), 1 / (1 + a.m_val * a.m_val)); }
+    friend ChDual atan2(const ChDual& y, const ChDual& x) {
+        double r2 = x.m_val * x.m_val + y.m_val * y.m_val;
+        return y.Chain(std::atan2(y.m_val, x.m_val), x.m_val / r2) - x.Chain(0, y.m_val / r2);
+    }
+    friend ChDual exp(const ChDual& a) {
+        double e = std::exp(a.m_val);
+        return a.Chain(e, e);
+    }
+    friend ChDual log(const ChDual& a) { return a.Chain(std::log(a.m_val), 1 / a.m_val); }
+    friend ChDual pow(const ChDual& a, double p) {
+        return a.Chain(std::pow(a.m_val, p), p * std::pow(a.m_val, p - 1));
+    }
+    friend ChDual abs(const ChDual& a) { return a.m_val < 0 ? -a : a; }
+    friend ChDual fabs(const ChDual& a) { return a.m_val < 0 ? -a : a; }
+
+  private:
+    double m_val;
+    double m_der[N];
+};
+
+// Arithmetic operators
+
+template <int N>
+inline ChDual<N> operator+(ChDual<N> a, const ChDual<N>& b) {
+    return a += b;
+}
+template <int N>
+inline ChDual<N> operator+(ChDual<N> a, double b) {
+    return a += b;
+}
+template <int N>
+inline ChDual<N> operator+(double a, ChDual<N> b) {
+    return b += a;
+}
+
+template <int N>
+inline ChDual<N> operator-(ChDual<N> a, const ChDual<N>& b) {
+    return a -= b;
+}
+template <int N>
+inline ChDual<N> operator-(ChDual<N> a, double b) {
+    return a -= b;
+}
+template <int N>
+inline ChDual<N> operator-(double a, const ChDual<N>& b) {
+    return -b + a;
+}
+
+template <int N>
+inline ChDual<N> operator*(ChDual<N> a, const ChDual<N>& b) {
+    return a *= b;
+}
+template <int N>
+inline ChDual<N> operator*(ChDual<N> a, double b) {
+    return a *= b;
+}
+template <int N>
+inline ChDual<N> operator*(double a, ChDual<N> b) {
+    return b *= a;
+}
+
+template <int N>
+inline ChDual<N> operator/(ChDual<N> a, const ChDual<N>& b) {
+    return a /= b;
+}
+template <int N>
+inline ChDual<N> operator/(ChDual<N> a, double b) {
+    return a /= b;
+}
+template <int N>
+inline ChDual<N> operator/(double a, const ChDual<N>& b) {
+    return ChDual<N>(a) /= b;
+}
+
+// Comparison operators (on values only)
+
+template <int N>
+inline bool operator<(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() < b.value();
+}
+template <int N>
+inline bool operator>(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() > b.value();
+}
+template <int N>
+inline bool operator<=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() <= b.value();
+}
+template <int N>
+inline bool operator>=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() >= b.value();
+}
+template <int N>
+inline bool operator==(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() == b.value();
+}
+template <int N>
+inline bool operator!=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() != b.value();
+}
+
+}  // end namespace chrono
+
+// Let Eigen use ChDual as a scalar type (e.g. ChVectorDynamic<ChDual<N>>).
+namespace Eigen {
+template <int N>
+struct NumTraits<chrono::ChDual<N>> : NumTraits<double> {
+    typedef chrono::ChDual<N> Real;
+    typedef chrono::ChDual<N> NonInteger;
+    typedef chrono::ChDual<N> Nested;
+    enum {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = 1 + N,
+        AddCost = 1 + N,
+        MulCost = 1 + 2 * N
+    };
+};
+}  // namespace Eigen
+
+#endif
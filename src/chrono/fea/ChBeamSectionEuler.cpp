@@ -31,6 +31,19 @@ namespace fea {
 		if (compute_inertia_damping_matrix == false) 
 			return;
 
+		// If the section provides the quadratic terms as dual numbers, get the exact Ri by automatic differentiation.
+		ChVector<ChDual<3>> mWd(ChDual<3>(mW.x(), 0), ChDual<3>(mW.y(), 1), ChDual<3>(mW.z(), 2));
+		ChVector<ChDual<3>> mFd, mTd;
+		if (!this->compute_Ri_Ki_by_num_diff && this->ComputeQuadraticTermsAD(mFd, mTd, mWd)) {
+			for (int i = 0; i < 3; ++i) {
+				for (int j = 0; j < 3; ++j) {
+					Ri(i, 3 + j) = mFd[i].derivative(j);
+					Ri(3 + i, 3 + j) = mTd[i].derivative(j);
+				}
+			}
+			return;
+		}
+
 		// Fi=Fia+Fiv, where Fia depends on acceleration only, so restrict to Fiv quadratic terms for numerical differentiation.
 		// Also we assume first three columns of Ri are null because Fiv does not depend on linear velocity.
 		// Quadratic terms (gyro, centrifugal) at current state:
@@ -70,11 +83,28 @@ namespace fea {
 			return;
 
 		// We assume first three columns of Ki are null because Fi does not depend on displacement.
-		// We compute Ki by numerical differentiation.
 
-    
 		ChVector<> mF, mT;
 		this->ComputeInertialForce(mF, mT, mWvel, mWacc, mXacc);
+
+		if (!this->compute_Ri_Ki_by_num_diff) {
+			// Exact Ki by automatic differentiation with respect to the rotation increment dr. Fi depends on dr only
+			// through the acceleration in the rotated frame, (I+[dr~])'*xacc, and the force part of Fi is rotated by [dr~].
+			ChMatrixNM<double, 6, 6> Mi;
+			this->ComputeInertiaMatrix(Mi);
+			ChVector<ChDual<3>> dr(ChDual<3>(0, 0), ChDual<3>(0, 1), ChDual<3>(0, 2));
+			ChVector<ChDual<3>> mXacc_r = ChVector<ChDual<3>>(mXacc) - Vcross(dr, mXacc);
+			ChVector<ChDual<3>> drF = Vcross(dr, mF);
+			for (int i = 0; i < 6; ++i) {
+				for (int j = 0; j < 3; ++j) {
+					Ki(i, 3 + j) = Mi(i, 0) * mXacc_r.x().derivative(j) + Mi(i, 1) * mXacc_r.y().derivative(j) +
+								   Mi(i, 2) * mXacc_r.z().derivative(j) + (i < 3 ? drF[i].derivative(j) : 0);
+				}
+			}
+			return;
+		}
+
+		// Otherwise compute Ki by numerical differentiation.
 		ChVectorN<double,6> Fi0;
 		Fi0.segment(0, 3) = mF.eigen();
 		Fi0.segment(3, 3) = mT.eigen();
@@ -175,7 +205,7 @@ namespace fea {
 		Ri.setZero();
 		if (compute_inertia_damping_matrix == false) 
 			return;
-		if (this->compute_Ri_Ki_by_num_diff)
+		if (this->compute_Ri_Ki_by_num_diff || this->compute_Ri_Ki_by_autodiff)
 			return ChBeamSectionEuler::ComputeInertiaDampingMatrix(Ri, mW);
 
 		ChStarMatrix33<> wtilde(mW);   // [w~]
@@ -195,7 +225,7 @@ namespace fea {
 		Ki.setZero();
 		if (compute_inertia_stiffness_matrix == false) 
         return;
-		if (this->compute_Ri_Ki_by_num_diff)
+		if (this->compute_Ri_Ki_by_num_diff || this->compute_Ri_Ki_by_autodiff)
 			return ChBeamSectionEuler::ComputeInertiaStiffnessMatrix(Ki, mWvel, mWacc, mXacc);
 		// null [Ki^] (but only for the case where angular speeds and accelerations are assumed to corotate with local frames). 
 	}
@@ -243,7 +273,7 @@ namespace fea {
 		Ri.setZero();
 		if (compute_inertia_damping_matrix == false) 
 			return;
-		if (this->compute_Ri_Ki_by_num_diff)
+		if (this->compute_Ri_Ki_by_num_diff || this->compute_Ri_Ki_by_autodiff)
 			return ChBeamSectionEuler::ComputeInertiaDampingMatrix(Ri, mW);
 
 		ChStarMatrix33<> wtilde(mW);   // [w~]
@@ -266,7 +296,7 @@ namespace fea {
 		Ki.setZero();
 		if (compute_inertia_stiffness_matrix == false) 
 			return;
-		if (this->compute_Ri_Ki_by_num_diff)
+		if (this->compute_Ri_Ki_by_num_diff || this->compute_Ri_Ki_by_autodiff)
 			return ChBeamSectionEuler::ComputeInertiaStiffnessMatrix(Ki, mWvel, mWacc, mXacc);
 
 		ChStarMatrix33<> wtilde(mWvel);   // [w~]
@@ -297,6 +327,18 @@ namespace fea {
 	}
 
 
+	bool ChBeamSectionEulerAdvancedGeneric::ComputeQuadraticTermsAD(ChVector<ChDual<3>>& mF,
+		ChVector<ChDual<3>>& mT,
+		const ChVector<ChDual<3>>& mW
+	) {
+		// same as ComputeQuadraticTerms(), on dual numbers
+		mF = Vcross(mW, Vcross(mW, ChVector<>(0, My, Mz))) * ChDual<3>(this->mu);
+		mT = Vcross(mW, ChVector<ChDual<3>>( this->GetInertiaJxxPerUnitLength()*mW.x(),
+									0,
+									0 )  );
+		return true;
+	}
+
 	ChBeamSectionEulerEasyRectangular::ChBeamSectionEulerEasyRectangular(double width_y, double width_z, double myE,  double myG, double mydensity)
 	{
 		this->SetYoungModulus(myE);
@@ -332,7 +374,7 @@ namespace fea {
 		Ri.setZero();
 		if (compute_inertia_damping_matrix == false) 
 			return;
-		if (this->compute_Ri_Ki_by_num_diff)
+		if (this->compute_Ri_Ki_by_num_diff || this->compute_Ri_Ki_by_autodiff)
 			return ChBeamSectionEuler::ComputeInertiaDampingMatrix(Ri, mW);
 
 		ChStarMatrix33<> wtilde(mW);   // [w~]
@@ -352,7 +394,7 @@ namespace fea {
 		Ki.setZero();
 		if (compute_inertia_stiffness_matrix == false) 
 			return;
-		if (this->compute_Ri_Ki_by_num_diff)
+		if (this->compute_Ri_Ki_by_num_diff || this->compute_Ri_Ki_by_autodiff)
 			return ChBeamSectionEuler::ComputeInertiaStiffnessMatrix(Ki, mWvel, mWacc, mXacc);
 		// null [Ki^] (but only for the case where angular speeds and accelerations are assumed to corotate with local frames. 
 	}
@@ -458,7 +500,7 @@ namespace fea {
 		Ri.setZero();
 		if (compute_inertia_damping_matrix == false) 
 			return;
-		if (this->compute_Ri_Ki_by_num_diff)
+		if (this->compute_Ri_Ki_by_num_diff || this->compute_Ri_Ki_by_autodiff)
 			return ChBeamSectionEuler::ComputeInertiaDampingMatrix(Ri, mW);
 
 		ChStarMatrix33<> wtilde(mW);   // [w~]
@@ -481,7 +523,7 @@ namespace fea {
 		Ki.setZero();
 		if (compute_inertia_stiffness_matrix == false) 
 			return;
-		if (this->compute_Ri_Ki_by_num_diff)
+		if (this->compute_Ri_Ki_by_num_diff || this->compute_Ri_Ki_by_autodiff)
 			return ChBeamSectionEuler::ComputeInertiaStiffnessMatrix(Ki, mWvel, mWacc, mXacc);
 
 		ChStarMatrix33<> wtilde(mWvel);   // [w~]
@@ -511,6 +553,18 @@ namespace fea {
 									(this->Jzz + JzzJyy_factor * this->mu)*mW.z() - this->Jyz*mW.y() )  );
 	}
 
+	bool ChBeamSectionRayleighAdvancedGeneric::ComputeQuadraticTermsAD(ChVector<ChDual<3>>& mF,
+		ChVector<ChDual<3>>& mT,
+		const ChVector<ChDual<3>>& mW
+	) {
+		// same as ComputeQuadraticTerms(), on dual numbers
+		mF = Vcross(mW, Vcross(mW, ChVector<>(0, this->My, this->Mz))) * ChDual<3>(this->mu);
+		mT = Vcross(mW, ChVector<ChDual<3>>( this->GetInertiaJxxPerUnitLength()*mW.x(),
+									(this->Jyy + JzzJyy_factor * this->mu)*mW.y() - this->Jyz*mW.z(),
+									(this->Jzz + JzzJyy_factor * this->mu)*mW.z() - this->Jyz*mW.y() )  );
+		return true;
+	}
+
 
 
 }  // end namespace fea
@@ -15,6 +15,7 @@
 #ifndef CHBEAMSECTIONEULER_H
 #define CHBEAMSECTIONEULER_H
 
+#include "chrono/core/ChDual.h"
 #include "chrono/fea/ChBeamSection.h"
 
 namespace chrono {
@@ -82,8 +83,9 @@ class ChApi ChBeamSectionEuler : public ChBeamSection {
     /// Compute the 6x6 sectional inertia damping matrix [Ri] (gyroscopic matrix damping), as in linearization
     ///  dFi=[Mi]*d{xacc,wacc}+[Ri]*d{xvel,wvel}+[Ki]*d{pos,rot}
     /// The matrix is computed in the material reference, i.e. both linear and rotational coords assumed in the basis of the centerline reference.
-    /// Default implementation: falls back to numerical differentiation of ComputeInertialForce to compute Ri, 
-    /// please override this if analytical formula of Ri is known!
+    /// Default implementation: uses automatic differentiation if the section provides ComputeQuadraticTermsAD(),
+    /// otherwise (or with compute_Ri_Ki_by_num_diff) falls back to numerical differentiation of ComputeInertialForce
+    /// to compute Ri, please override this if analytical formula of Ri is known!
     virtual void ComputeInertiaDampingMatrix(ChMatrixNM<double, 6, 6>& Ri,  ///< 6x6 sectional inertial-damping (gyroscopic damping) matrix values here
         const ChVector<>& mW    ///< current angular velocity of section, in material frame
     );
@@ -93,7 +95,8 @@ class ChApi ChBeamSectionEuler : public ChBeamSection {
     /// The matrix is computed in the material reference.
     /// NOTE the matrix already contains the 'geometric' stiffness, so it transforms to absolute transl/local rot just like [Mi] and [Ri]:
     ///  [Ki]_al =[R,0;0,I]*[Ki^]*[R',0;0,I']  , with [Ki^]=([Ki]+[0,f~';0,0])  for f=current force part of inertial forces.
-    /// Default implementation: falls back to numerical differentiation of ComputeInertialForce to compute Ki^, 
+    /// Default implementation: uses automatic differentiation of Fi = [Mi]*{xacc,wacc}+{mF,mT} (with compute_Ri_Ki_by_num_diff,
+    /// falls back to numerical differentiation of ComputeInertialForce) to compute Ki^,
     /// please override this if analytical formula of Ki^ is known!
     virtual void ComputeInertiaStiffnessMatrix(ChMatrixNM<double, 6, 6>& Ki, ///< 6x6 sectional inertial-stiffness matrix [Ki^] values here
         const ChVector<>& mWvel,      ///< current angular velocity of section, in material frame
@@ -110,6 +113,17 @@ class ChApi ChBeamSectionEuler : public ChBeamSection {
                                        const ChVector<>& mW  ///< current angular velocity of section, in material frame
                                        ) = 0;
 
+    /// Dual-number version of ComputeQuadraticTerms(), where each component of mW carries its derivatives with respect
+    /// to the three components of the angular velocity. If a section implements this (returning true), the default
+    /// ComputeInertiaDampingMatrix() obtains the exact [Ri] by forward-mode automatic differentiation instead of using
+    /// numerical differentiation (see also compute_Ri_Ki_by_autodiff). Default: not implemented, returns false.
+    virtual bool ComputeQuadraticTermsAD(ChVector<ChDual<3>>& mF,       ///< centrifugal term (if any) returned here
+                                         ChVector<ChDual<3>>& mT,       ///< gyroscopic term returned here
+                                         const ChVector<ChDual<3>>& mW  ///< angular velocity, seeded
+    ) {
+        return false;
+    }
+
     /// Compute the total inertial forces (per unit length). This default implementation falls back to  Fi = [Mi]*{xacc,wacc}+{mF,mT} 
     /// where [Mi] is given by ComputeInertiaMatrix() and {F_quad,T_quad} are given by ComputeQuadraticTerms(), i.e. gyro and centrif.terms. 
     /// Note: both force and torque are returned in the basis of the material frame (not the absolute frame!), 
@@ -162,6 +176,12 @@ class ChApi ChBeamSectionEuler : public ChBeamSection {
     /// an analytical expression is provided. Children calsses must take care of this. Default: false.
     bool compute_Ri_Ki_by_num_diff = false;
 
+    /// Flag for computing the Ri and Ki matrices via automatic differentiation even if an analytical
+    /// expression is provided (Ri falls back to numerical differentiation if the section does not provide
+    /// ComputeQuadraticTermsAD). Ignored if compute_Ri_Ki_by_num_diff is set. Children classes must take care of this.
+    /// Default: false.
+    bool compute_Ri_Ki_by_autodiff = false;
+
 
   protected:
     double rdamping_beta;
@@ -572,6 +592,11 @@ class ChApi ChBeamSectionEulerAdvancedGeneric : public ChBeamSectionEuler {
     /// Compute the centrifugal term and gyroscopic term
     virtual void ComputeQuadraticTerms(ChVector<>& mF, ChVector<>& mT, const ChVector<>& mW) override;
 
+    /// Compute the centrifugal term and gyroscopic term, with their derivatives (automatic differentiation).
+    virtual bool ComputeQuadraticTermsAD(ChVector<ChDual<3>>& mF,
+                                         ChVector<ChDual<3>>& mT,
+                                         const ChVector<ChDual<3>>& mW) override;
+
     /// Get mass per unit length, ex.SI units [kg/m]
     virtual double GetMassPerUnitLength() const override { return this->mu; }
 
@@ -776,6 +801,11 @@ class ChApi ChBeamSectionRayleighAdvancedGeneric : public ChBeamSectionEulerAdva
 
     /// Compute the centrifugal term and gyroscopic term
     virtual void ComputeQuadraticTerms(ChVector<>& mF, ChVector<>& mT, const ChVector<>& mW) override;
+
+    /// Compute the centrifugal term and gyroscopic term, with their derivatives (automatic differentiation).
+    virtual bool ComputeQuadraticTermsAD(ChVector<ChDual<3>>& mF,
+                                         ChVector<ChDual<3>>& mT,
+                                         const ChVector<ChDual<3>>& mW) override;
 };
 
 
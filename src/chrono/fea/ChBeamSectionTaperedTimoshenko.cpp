@@ -831,10 +831,12 @@ void ChBeamSectionTaperedTimoshenkoAdvancedGeneric::ComputeInertiaDampingMatrix(
     this->sectionA->compute_inertia_damping_matrix = this->compute_inertia_damping_matrix;
     this->sectionA->compute_inertia_stiffness_matrix = this->compute_inertia_stiffness_matrix;
     this->sectionA->compute_Ri_Ki_by_num_diff = this->compute_Ri_Ki_by_num_diff;
+    this->sectionA->compute_Ri_Ki_by_autodiff = this->compute_Ri_Ki_by_autodiff;
 
     this->sectionB->compute_inertia_damping_matrix = this->compute_inertia_damping_matrix;
     this->sectionB->compute_inertia_stiffness_matrix = this->compute_inertia_stiffness_matrix;
     this->sectionB->compute_Ri_Ki_by_num_diff = this->compute_Ri_Ki_by_num_diff;
+    this->sectionB->compute_Ri_Ki_by_autodiff = this->compute_Ri_Ki_by_autodiff;
 
     ChMatrixNM<double, 6, 6> Ri_A;
     ChMatrixNM<double, 6, 6> Ri_B;
@@ -862,10 +864,12 @@ void ChBeamSectionTaperedTimoshenkoAdvancedGeneric::ComputeInertiaStiffnessMatri
     this->sectionA->compute_inertia_damping_matrix = this->compute_inertia_damping_matrix;
     this->sectionA->compute_inertia_stiffness_matrix = this->compute_inertia_stiffness_matrix;
     this->sectionA->compute_Ri_Ki_by_num_diff = this->compute_Ri_Ki_by_num_diff;
+    this->sectionA->compute_Ri_Ki_by_autodiff = this->compute_Ri_Ki_by_autodiff;
 
     this->sectionB->compute_inertia_damping_matrix = this->compute_inertia_damping_matrix;
     this->sectionB->compute_inertia_stiffness_matrix = this->compute_inertia_stiffness_matrix;
     this->sectionB->compute_Ri_Ki_by_num_diff = this->compute_Ri_Ki_by_num_diff;
+    this->sectionB->compute_Ri_Ki_by_autodiff = this->compute_Ri_Ki_by_autodiff;
 
     ChMatrixNM<double, 6, 6> Ki_A;
     ChMatrixNM<double, 6, 6> Ki_B;
@@ -364,6 +364,10 @@ class ChApi ChBeamSectionTaperedTimoshenkoAdvancedGeneric {
     /// an analytical expression is provided. Children calsses must take care of this. Default: false.
     bool compute_Ri_Ki_by_num_diff = false;
 
+    /// Flag for computing the Ri and Ki matrices via automatic differentiation even if an analytical
+    /// expression is provided. Ignored if compute_Ri_Ki_by_num_diff is set. Default: false.
+    bool compute_Ri_Ki_by_autodiff = false;
+
     /// A lock to avoid computing avg_sec_par several times, initialized as false by default.
     /// If one wants to recalculate the avg_sec_par again, set this variable to 'false' and 
     /// run ComputeAverageSectionParameters() again.
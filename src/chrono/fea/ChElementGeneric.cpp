@@ -25,16 +25,14 @@ void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c
     Fi *= c;
 
     //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    //// The owning ChMesh guarantees that elements processed concurrently do not share nodes (see element coloring),
+    //// so the global vector R can be updated without atomic operations.
 
     int stride = 0;
     for (int in = 0; in < GetNnodes(); in++) {
         int node_dofs = GetNodeNdofs_active(in);
-        if (!GetNodeN(in)->IsFixed()) {
-            for (int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNodeN(in)->NodeGetOffsetW() + j) += Fi(stride + j);
-        }
+        if (!GetNodeN(in)->IsFixed())
+            R.segment(GetNodeN(in)->NodeGetOffsetW(), node_dofs) += Fi.segment(stride, node_dofs);
         stride += GetNodeNdofs(in);
     }
     // GetLog() << "EleIntLoadResidual_F , R=" << R << "\n";
@@ -90,16 +88,14 @@ void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const
     Fg *= c;
 
     //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    //// The owning ChMesh guarantees that elements processed concurrently do not share nodes (see element coloring),
+    //// so the global vector R can be updated without atomic operations.
 
     int stride = 0;
     for (int in = 0; in < GetNnodes(); in++) {
         int node_dofs = GetNodeNdofs_active(in);
-        if (!GetNodeN(in)->IsFixed()) {
-            for (int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNodeN(in)->NodeGetOffsetW() + j) += Fg(stride + j);
-        }
+        if (!GetNodeN(in)->IsFixed())
+            R.segment(GetNodeN(in)->NodeGetOffsetW(), node_dofs) += Fg.segment(stride, node_dofs);
         stride += GetNodeNdofs(in);
     }
 }
@@ -1743,6 +1743,26 @@ ChVector<> ChElementShellANCF_3423::ComputeNormal(const double U, const double V
     return G1xG2 / G1xG2nrm;
 }
 
+// Shape functions at (U,V) coordinates of the mid-surface, with derivatives with respect to U and V.
+bool ChElementShellANCF_3423::ComputeShapeFunctionsUV(const double U,
+                                                      const double V,
+                                                      ChVectorDynamic<>& N,
+                                                      ChVectorDynamic<>& dNdu,
+                                                      ChVectorDynamic<>& dNdv) {
+    ShapeVector Ns;
+    ShapeVector Nx;
+    ShapeVector Ny;
+    ShapeFunctions(Ns, U, V, 0);
+    ShapeFunctionsDerivativeX(Nx, U, V, 0);
+    ShapeFunctionsDerivativeY(Ny, U, V, 0);
+
+    // Derivatives with respect to the normalized coordinates, as in ComputeNF
+    N = Ns.transpose();
+    dNdu = Nx.transpose() * (m_lenX / 2);
+    dNdv = Ny.transpose() * (m_lenY / 2);
+    return true;
+}
+
 // ============================================================================
 // Implementation of ChElementShellANCF_3423::Layer methods
 // ============================================================================
@@ -370,6 +370,14 @@ class ChApi ChElementShellANCF_3423 : public ChElementANCF,
     /// Each coordinate ranging in -1..+1.
     virtual ChVector<> ComputeNormal(const double U, const double V) override;
 
+    /// Get the shape functions and their derivatives at the parametric coordinates U,V of the mid-surface, one per
+    /// 3-coordinate block of the state {r0, D0, r1, D1, ...}. The shape functions of the gradients D vanish there.
+    virtual bool ComputeShapeFunctionsUV(const double U,
+                                         const double V,
+                                         ChVectorDynamic<>& N,
+                                         ChVectorDynamic<>& dNdu,
+                                         ChVectorDynamic<>& dNdv) override;
+
   private:
     /// Initial setup. This is used to precompute matrices that do not change during the simulation, such as the local
     /// stiffness of each element (if any), the mass, etc.
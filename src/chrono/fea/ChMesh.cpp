@@ -18,6 +18,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
@@ -47,6 +48,10 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    colored_elements = other.colored_elements;
+    color_start = other.color_start;
+    coloring_valid = other.coloring_valid;
 }
 
 void ChMesh::SetupInitial() {
@@ -67,6 +72,69 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    ComputeElementColoring();
+}
+
+void ChMesh::ComputeElementColoring() {
+    // Greedy (first fit) coloring: each element gets the smallest color not already used by any element sharing one
+    // of its nodes. For each node, keep track of the colors of the elements connected to it so far.
+    std::unordered_map<ChNodeFEAbase*, std::vector<unsigned int>> node_colors;
+    std::vector<unsigned int> element_color(velements.size());
+    std::vector<unsigned int> color_count;
+    std::vector<bool> used;
+
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        auto& element = velements[ie];
+
+        used.assign(color_count.size() + 1, false);
+        for (int in = 0; in < element->GetNnodes(); in++) {
+            for (auto color : node_colors[element->GetNodeN(in).get()])
+                used[color] = true;
+        }
+
+        unsigned int color = 0;
+        while (used[color])
+            color++;
+
+        for (int in = 0; in < element->GetNnodes(); in++) {
+            auto& colors = node_colors[element->GetNodeN(in).get()];
+            if (std::find(colors.begin(), colors.end(), color) == colors.end())
+                colors.push_back(color);
+        }
+
+        if (color == color_count.size())
+            color_count.push_back(0);
+        color_count[color]++;
+        element_color[ie] = color;
+    }
+
+    // Sort the element indices by color (counting sort, preserving the element order within each color)
+    color_start.assign(color_count.size() + 1, 0);
+    for (unsigned int c = 0; c < color_count.size(); c++)
+        color_start[c + 1] = color_start[c] + color_count[c];
+
+    std::vector<unsigned int> next(color_start.begin(), color_start.end() - 1);
+    colored_elements.resize(velements.size());
+    for (unsigned int ie = 0; ie < velements.size(); ie++)
+        colored_elements[next[element_color[ie]]++] = ie;
+
+    coloring_valid = true;
+}
+
+unsigned int ChMesh::GetNumElementColors() {
+    if (!coloring_valid)
+        ComputeElementColoring();
+    return (unsigned int)color_start.size() - 1;
+}
+
+std::vector<unsigned int> ChMesh::GetElementsOfColor(unsigned int color) {
+    if (!coloring_valid)
+        ComputeElementColoring();
+    if (color + 1 >= color_start.size())
+        return std::vector<unsigned int>();
+    return std::vector<unsigned int>(colored_elements.begin() + color_start[color],
+                                     colored_elements.begin() + color_start[color + 1]);
 }
 
 void ChMesh::Relax() {
@@ -96,6 +164,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    coloring_valid = false;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -107,6 +176,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    coloring_valid = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -118,6 +188,7 @@ void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    coloring_valid = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -290,22 +361,34 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     int nthreads = GetSystem()->nthreads_chrono;
 
+    if (!coloring_valid)
+        ComputeElementColoring();
+
     // elements internal forces
     timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+    //***PARALLEL FOR***, one color at a time: elements with the same color do not share nodes, so that no race
+    // condition can occur in writing to R
+    for (unsigned int ic = 0; ic + 1 < color_start.size(); ic++) {
+        int start = (int)color_start[ic];
+        int end = (int)color_start[ic + 1];
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+        for (int i = start; i < end; i++) {
+            velements[colored_elements[i]]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+        //***PARALLEL FOR***, one color at a time (no race condition in writing to R)
+        for (unsigned int ic = 0; ic + 1 < color_start.size(); ic++) {
+            int start = (int)color_start[ic];
+            int end = (int)color_start[ic + 1];
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
+            for (int i = start; i < end; i++) {
+                velements[colored_elements[i]]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
+            }
         }
     }
 
@@ -480,6 +563,7 @@ void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
+    //***PARALLEL FOR***, each element only writes to its own KRM block, so no coloring is needed here
 #pragma omp parallel for num_threads(nthreads)
     for (int ie = 0; ie < velements.size(); ie++)
         velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
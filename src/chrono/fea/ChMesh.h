@@ -44,7 +44,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          coloring_valid(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -100,6 +101,16 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Get the number of element colors.
+    /// Elements are partitioned in colors so that no two elements with the same color share a node. Elements of a given
+    /// color are processed in parallel when scattering internal forces and gravity loads into the global residual, with
+    /// colors processed in sequence, so that elements can load their contributions without synchronization.
+    /// The coloring is computed at initialization and updated whenever the mesh topology changes.
+    unsigned int GetNumElementColors();
+
+    /// Get the indices (in the list returned by GetElements) of all elements with the specified color.
+    std::vector<unsigned int> GetElementsOfColor(unsigned int color);
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -275,6 +286,9 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the elements in colors (greedy coloring of the element graph, with elements adjacent if sharing a node).
+    void ComputeElementColoring();
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -292,6 +306,9 @@ class ChApi ChMesh : public ChIndexedNodes {
     int ncalls_internal_forces;
     int ncalls_KRMload;
 
+    std::vector<unsigned int> colored_elements;  ///< element indices, sorted by color
+    std::vector<unsigned int> color_start;       ///< index of first element of each color (plus end marker)
+    bool coloring_valid;                         ///< false if the coloring must be recomputed
 
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
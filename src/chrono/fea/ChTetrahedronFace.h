@@ -162,6 +162,21 @@ class ChApi ChTetrahedronFace : public ChLoadableUV {
         return Vcross(p1 - p0, p2 - p0).GetNormalized();
     }
 
+    /// Get the shape functions and their derivatives at the parametric coordinates u,v (linear triangle).
+    virtual bool ComputeShapeFunctionsUV(const double U,
+                                         const double V,
+                                         ChVectorDynamic<>& N,
+                                         ChVectorDynamic<>& dNdu,
+                                         ChVectorDynamic<>& dNdv) override {
+        N.resize(3);
+        dNdu.resize(3);
+        dNdv.resize(3);
+        N << 1.0 - U - V, U, V;
+        dNdu << -1.0, 1.0, 0.0;
+        dNdv << -1.0, 0.0, 1.0;
+        return true;
+    }
+
   private:
     char m_face_id;                                   ///< id of the face on the tetrahedron
     std::shared_ptr<ChElementTetrahedron> m_element;  ///< associated tetrahedron element
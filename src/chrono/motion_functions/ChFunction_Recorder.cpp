@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <limits>
 
@@ -22,10 +24,8 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChFunction_Recorder)
 
-ChFunction_Recorder::ChFunction_Recorder(const ChFunction_Recorder& other) {
-    m_points = other.m_points;
-    m_last = m_points.end();
-}
+ChFunction_Recorder::ChFunction_Recorder(const ChFunction_Recorder& other)
+    : m_points(other.m_points), m_last(0), m_grid_valid(false), m_uniform(false), m_dx(0), m_inv_dx(0) {}
 
 void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
     if (m_points.empty()) {
@@ -41,24 +41,135 @@ void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
 }
 
 void ChFunction_Recorder::AddPoint(double mx, double my, double mw) {
-    for (auto iter = m_points.rbegin(); iter != m_points.rend(); ++iter) {
-        double dist = mx - iter->x;
-        if (std::abs(dist) < std::numeric_limits<double>::epsilon()) {
-            // Overwrite current iterator
-            iter->x = mx;
-            iter->y = my;
-            iter->w = mw;
-            return;
-        } else if (dist > 0) {
-            // Insert before current iterator
-            ChRecPoint rec(mx, my, mw);
-            m_points.insert(iter.base(), rec);
-            return;
+    // Append at the end (most common case)
+    if (m_points.empty() || mx - m_points.back().x >= std::numeric_limits<double>::epsilon()) {
+        m_points.push_back(ChRecPoint(mx, my, mw));
+        AppendToGrid();
+        return;
+    }
+
+    m_grid_valid = false;
+
+    // Find the first point not before mx and check it and its predecessor for a point to overwrite
+    auto iter = std::lower_bound(m_points.begin(), m_points.end(), mx,
+                                 [](const ChRecPoint& p, double x) { return p.x < x; });
+    if (iter != m_points.end() && std::abs(mx - iter->x) < std::numeric_limits<double>::epsilon()) {
+        *iter = ChRecPoint(mx, my, mw);
+        return;
+    }
+    if (iter != m_points.begin() && std::abs(mx - (iter - 1)->x) < std::numeric_limits<double>::epsilon()) {
+        *(iter - 1) = ChRecPoint(mx, my, mw);
+        return;
+    }
+
+    // Insert before the iterator
+    m_points.insert(iter, ChRecPoint(mx, my, mw));
+}
+
+void ChFunction_Recorder::AddPoints(const std::vector<double>& mx, const std::vector<double>& my) {
+    assert(mx.size() == my.size());
+    m_grid_valid = false;
+
+    size_t n = std::min(mx.size(), my.size());
+    m_points.reserve(m_points.size() + n);
+    for (size_t i = 0; i < n; i++)
+        m_points.push_back(ChRecPoint(mx[i], my[i], 1));
+
+    // Sort (stable, so that points added later come after existing points with the same x)
+    std::stable_sort(m_points.begin(), m_points.end(),
+                     [](const ChRecPoint& a, const ChRecPoint& b) { return a.x < b.x; });
+
+    // Remove duplicates, keeping the point added last
+    size_t j = 0;
+    for (size_t i = 1; i < m_points.size(); i++) {
+        if (std::abs(m_points[i].x - m_points[j].x) < std::numeric_limits<double>::epsilon())
+            m_points[j] = m_points[i];
+        else
+            m_points[++j] = m_points[i];
+    }
+    if (!m_points.empty())
+        m_points.resize(j + 1);
+}
+
+void ChFunction_Recorder::UpdateGrid() const {
+    bool uniform = false;
+    double dx = 0;
+
+    size_t n = m_points.size();
+    if (n >= 2) {
+        double x0 = m_points.front().x;
+        dx = (m_points.back().x - x0) / (n - 1);
+        if (dx > 0) {
+            double tol = 1e-9 * dx;
+            uniform = true;
+            for (size_t i = 1; i < n - 1; i++) {
+                if (std::abs(m_points[i].x - (x0 + i * dx)) > tol) {
+                    uniform = false;
+                    break;
+                }
+            }
         }
     }
 
-    // Insert in front of list
-    m_points.push_front(ChRecPoint(mx, my, mw));
+    m_uniform = uniform;
+    m_dx = dx;
+    m_inv_dx = uniform ? 1 / dx : 0;
+    m_grid_valid = true;
+}
+
+void ChFunction_Recorder::AppendToGrid() {
+    if (!m_grid_valid)
+        return;
+
+    size_t n = m_points.size();
+    if (n < 2) {
+        m_uniform = false;
+        return;
+    }
+
+    // A new second point defines the spacing
+    if (n == 2) {
+        m_dx = m_points[1].x - m_points[0].x;
+        m_uniform = m_dx > 0;
+        m_inv_dx = m_uniform ? 1 / m_dx : 0;
+        return;
+    }
+
+    // Points which are not equally spaced remain so after appending a point
+    if (m_uniform && std::abs(m_points.back().x - (m_points.front().x + (n - 1) * m_dx)) > 1e-9 * m_dx)
+        m_uniform = false;
+}
+
+size_t ChFunction_Recorder::FindInterval(double x) const {
+    size_t n = m_points.size();
+
+    if (!m_grid_valid)
+        UpdateGrid();
+
+    // Equally spaced points: compute the index directly, then correct for roundoff
+    if (m_uniform) {
+        size_t i = std::min(static_cast<size_t>((x - m_points.front().x) * m_inv_dx), n - 2);
+        if (x < m_points[i].x)
+            i--;
+        else if (x > m_points[i + 1].x)
+            i++;
+        return i;
+    }
+
+    // Check the interval used at the last call and the next one
+    size_t i = m_last;
+    if (i + 1 < n && m_points[i].x <= x) {
+        if (x <= m_points[i + 1].x)
+            return i;
+        if (i + 2 < n && x <= m_points[i + 2].x)
+            return m_last = i + 1;
+    }
+
+    // Binary search for the first point after x
+    auto iter = std::upper_bound(m_points.begin(), m_points.end(), x,
+                                 [](double x, const ChRecPoint& p) { return x < p.x; });
+    m_last = (iter - m_points.begin()) - 1;
+    return m_last;
 }
 
 double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
@@ -80,30 +191,8 @@ double ChFunction_Recorder::Get_y(double x) const {
 
     // At this point we are guaranteed that there are at least two records.
 
-    if (m_last == m_points.end()) {
-        m_last = m_points.begin();
-    }
-
-    if (x > m_last->x) {
-        // Search to the right
-        for (auto iter = m_last; iter != m_points.end(); ++iter) {
-            if (x <= iter->x) {
-                return Interpolate_y(x, *m_last, *iter);
-            }
-            m_last = iter;
-        }
-    } else {
-        // Search to the left
-        for (auto iter = m_last; iter != m_points.begin();) {
-            --iter;
-            if (x >= iter->x) {
-                return Interpolate_y(x, *iter, *m_last);
-            }
-            m_last = iter;
-        }
-    }
-
-    return 0;
+    size_t i = FindInterval(x);
+    return Interpolate_y(x, m_points[i], m_points[i + 1]);
 }
 
 double ChFunction_Recorder::Get_y_dx(double x) const {
@@ -121,8 +210,8 @@ void ChFunction_Recorder::ArchiveOut(ChArchiveOut& marchive) {
     marchive.VersionWrite<ChFunction_Recorder>();
     // serialize parent class
     ChFunction::ArchiveOut(marchive);
-    // serialize all member data: copy to vector and store
-    std::vector<ChRecPoint> tmpvect{std::begin(m_points), std::end(m_points)};
+    // serialize all member data
+    std::vector<ChRecPoint> tmpvect = m_points;
     marchive << CHNVP(tmpvect);
 }
 
@@ -131,11 +220,12 @@ void ChFunction_Recorder::ArchiveIn(ChArchiveIn& marchive) {
     /*int version =*/ marchive.VersionRead<ChFunction_Recorder>();
     // deserialize parent class
     ChFunction::ArchiveIn(marchive);
-    // stream in all member data: load vector of points and copy to list
+    // stream in all member data
     std::vector<ChRecPoint> tmpvect;
     marchive >> CHNVP(tmpvect);
-    m_points.clear();
-    std::copy(tmpvect.begin(), tmpvect.end(), std::back_inserter(m_points));
+    m_points = tmpvect;
+    m_last = 0;
+    m_grid_valid = false;
 }
 
 }  // end namespace chrono
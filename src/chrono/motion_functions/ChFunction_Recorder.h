@@ -15,8 +15,7 @@
 #ifndef CHFUNCT_RECORDER_H
 #define CHFUNCT_RECORDER_H
 
-#include <iterator>
-#include <list>
+#include <vector>
 
 #include "chrono/motion_functions/ChFunction_Base.h"
 
@@ -51,13 +50,27 @@ class ChApi ChRecPoint {
 ///
 /// y = interpolation of array of (x,y) data,
 ///     where (x,y) points can be inserted randomly.
+///
+/// Points are kept sorted in a contiguous array. Evaluation uses a binary search, preceded by a check of the interval
+/// used at the previous call (and of the following one), so that both sequential and random access are fast. If the
+/// points are equally spaced in x, evaluation directly computes the interval index. The spacing check is done at the
+/// first evaluation after a modification, except for points appended in increasing order of x, which update it in
+/// constant time (so that recording and evaluating can be interleaved).
+/// Points added in increasing order of x are appended in constant time; for large data sets, prefer the bulk
+/// AddPoints() which sorts only once.
+/// Note that evaluation updates cached data (the last interval and the spacing check), so this class is not thread
+/// safe: the same object must not be evaluated concurrently from several threads.
 class ChApi ChFunction_Recorder : public ChFunction {
   private:
-    std::list<ChRecPoint> m_points;  ///< the list of points
-    mutable std::list<ChRecPoint>::const_iterator m_last;
+    std::vector<ChRecPoint> m_points;       ///< the points, sorted by x
+    mutable size_t m_last;                  ///< index of the interval used at the last evaluation
+    mutable bool m_grid_valid;              ///< true if the uniform grid information is up to date
+    mutable bool m_uniform;                 ///< true if the points are equally spaced in x
+    mutable double m_dx;                    ///< point spacing (if uniform)
+    mutable double m_inv_dx;                ///< inverse of the point spacing (if uniform)
 
   public:
-    ChFunction_Recorder() : m_last(m_points.end()) {}
+    ChFunction_Recorder() : m_last(0), m_grid_valid(false), m_uniform(false), m_dx(0), m_inv_dx(0) {}
     ChFunction_Recorder(const ChFunction_Recorder& other);
     ~ChFunction_Recorder() {}
 
@@ -70,15 +83,26 @@ class ChApi ChFunction_Recorder : public ChFunction {
     virtual double Get_y_dx(double x) const override;
     virtual double Get_y_dxdx(double x) const override;
 
+    /// Add a point. If a point with the same x already exists, it is overwritten.
     void AddPoint(double mx, double my, double mw = 1);
 
+    /// Add a set of points (bulk load, sorting only once).
+    /// If there are points with the same x, the one added last is kept.
+    void AddPoints(const std::vector<double>& mx, const std::vector<double>& my);
+
     void Reset() {
         m_points.clear();
-        m_last = m_points.end();
+        m_last = 0;
+        m_grid_valid = false;
     }
 
-    const std::list<ChRecPoint>& GetPoints() const { return m_points; }
-    std::list<ChRecPoint>& GetPoints() { return m_points; }
+    const std::vector<ChRecPoint>& GetPoints() const { return m_points; }
+
+    /// Access the points for modification. Points must be left sorted by increasing x.
+    std::vector<ChRecPoint>& GetPoints() {
+        m_grid_valid = false;
+        return m_points;
+    }
 
     virtual void Estimate_x_range(double& xmin, double& xmax) const override;
 
@@ -87,6 +111,16 @@ class ChApi ChFunction_Recorder : public ChFunction {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
+
+  private:
+    /// Return the index i of the interval [x_i, x_i+1] containing x (x_0 < x < x_n-1).
+    size_t FindInterval(double x) const;
+
+    /// Check if the points are equally spaced in x.
+    void UpdateGrid() const;
+
+    /// Update the uniform grid information after appending a point at the end (if it is up to date).
+    void AppendToGrid();
 };
 
 /// @} chrono_functions
@@ -0,0 +1,309 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: structure-of-arrays batches of 3d vectors and quaternions, scalar
+// kernels, and run-time selection of the SIMD kernels.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "chrono/multicore_math/real3_batch.h"
+#include "chrono/multicore_math/real3_batch_kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define CH_BATCH_X86
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #include <immintrin.h>
+    #endif
+#endif
+
+namespace chrono {
+
+using namespace batch_kernels;
+
+// Storage is padded to a multiple of the widest SIMD register (AVX-512: 8 doubles)
+static const int batch_padding = 8;
+
+static_assert(std::is_same<real, double>::value, "batch kernels require double precision");
+
+static int PaddedSize(int size) {
+    return ((size + batch_padding - 1) / batch_padding) * batch_padding;
+}
+
+// -----------------------------------------------------------------------------
+
+void real3_batch::resize(int size) {
+    int new_cap = PaddedSize(size);
+    if (new_cap > cap) {
+        std::vector<real> new_data(3 * new_cap, 0);
+        for (int k = 0; k < 3; k++)
+            std::copy(data.begin() + k * cap, data.begin() + k * cap + n, new_data.begin() + k * new_cap);
+        data.swap(new_data);
+        cap = new_cap;
+    }
+    n = size;
+}
+
+void real3_batch::load(const real3* v, int size) {
+    resize(size);
+    for (int i = 0; i < size; i++)
+        set(i, v[i]);
+}
+
+void quaternion_batch::resize(int size) {
+    int new_cap = PaddedSize(size);
+    if (new_cap > cap) {
+        std::vector<real> new_data(4 * new_cap, 0);
+        for (int k = 0; k < 4; k++)
+            std::copy(data.begin() + k * cap, data.begin() + k * cap + n, new_data.begin() + k * new_cap);
+        data.swap(new_data);
+        cap = new_cap;
+    }
+    n = size;
+}
+
+void quaternion_batch::load(const quaternion* q, int size) {
+    resize(size);
+    for (int i = 0; i < size; i++)
+        set(i, q[i]);
+}
+
+// -----------------------------------------------------------------------------
+// Scalar kernels.
+// These follow the operation order of the corresponding real3 functions.
+
+static void RotateScalar(int n, soa3 v, soa4 q, soa3 out) {
+    for (int i = 0; i < n; i++) {
+        double tx = 2 * (q.y[i] * v.z[i] - q.z[i] * v.y[i]);
+        double ty = 2 * (q.z[i] * v.x[i] - q.x[i] * v.z[i]);
+        double tz = 2 * (q.x[i] * v.y[i] - q.y[i] * v.x[i]);
+        double ox = v.x[i] + q.w[i] * tx + (q.y[i] * tz - q.z[i] * ty);
+        double oy = v.y[i] + q.w[i] * ty + (q.z[i] * tx - q.x[i] * tz);
+        double oz = v.z[i] + q.w[i] * tz + (q.x[i] * ty - q.y[i] * tx);
+        out.x[i] = ox;
+        out.y[i] = oy;
+        out.z[i] = oz;
+    }
+}
+
+static void CrossScalar(int n, soa3 a, soa3 b, soa3 out) {
+    for (int i = 0; i < n; i++) {
+        double cx = a.y[i] * b.z[i] - a.z[i] * b.y[i];
+        double cy = a.z[i] * b.x[i] - a.x[i] * b.z[i];
+        double cz = a.x[i] * b.y[i] - a.y[i] * b.x[i];
+        out.x[i] = cx;
+        out.y[i] = cy;
+        out.z[i] = cz;
+    }
+}
+
+static void OrthogonalizeScalar(int n, soa3 u, soa3 v, soa3 w) {
+    for (int i = 0; i < n; i++) {
+        // w = u x (0,1,0), or u x (1,0,0) if u is nearly aligned with the y axis
+        double wx = -u.z[i];
+        double wy = 0;
+        double wz = u.x[i];
+        double len = std::sqrt(wx * wx + wz * wz);
+        if (len < 0.0001) {
+            wx = 0;
+            wy = u.z[i];
+            wz = -u.y[i];
+            len = std::sqrt(wy * wy + wz * wz);
+        }
+        wx /= len;
+        wy /= len;
+        wz /= len;
+        double vx = wy * u.z[i] - wz * u.y[i];
+        double vy = wz * u.x[i] - wx * u.z[i];
+        double vz = wx * u.y[i] - wy * u.x[i];
+        v.x[i] = vx;
+        v.y[i] = vy;
+        v.z[i] = vz;
+        w.x[i] = wx;
+        w.y[i] = wy;
+        w.z[i] = wz;
+    }
+}
+
+static int ProjectConeScalar(int n, double* gn, double* guv, const double* mu, int mu_stride, const double* coh) {
+    for (int i = 0; i < n; i++) {
+        double m = mu[i * mu_stride];
+        double c = coh[i];
+        if (m == 0) {
+            gn[i] = (gn[i] < -c) ? -c : gn[i];
+            guv[2 * i + 0] = 0;
+            guv[2 * i + 1] = 0;
+            continue;
+        }
+
+        double g_n = gn[i] + c;
+        double g_u = guv[2 * i + 0];
+        double g_v = guv[2 * i + 1];
+        double f_tang = std::sqrt(g_u * g_u + g_v * g_v);
+
+        if (f_tang < m * g_n) {
+            // inside upper cone: keep untouched
+        } else if (f_tang < -(1 / m) * g_n || std::abs(g_n) < 10e-15) {
+            // inside lower cone: reset to zero
+            g_n = 0;
+            g_u = 0;
+            g_v = 0;
+        } else {
+            // project orthogonally to generator segment of upper cone
+            g_n = (f_tang * m + g_n) / (m * m + 1);
+            double tproj_div_t = (g_n * m) / f_tang;
+            g_u *= tproj_div_t;
+            g_v *= tproj_div_t;
+        }
+
+        gn[i] = g_n - c;
+        guv[2 * i + 0] = g_u;
+        guv[2 * i + 1] = g_v;
+    }
+    return n;
+}
+
+static const Table table_scalar = {1, RotateScalar, CrossScalar, OrthogonalizeScalar, ProjectConeScalar};
+
+// -----------------------------------------------------------------------------
+// Run-time detection of the instruction sets supported by the CPU (and the OS).
+
+static bool CpuSupportsAVX2() {
+#if defined(CH_BATCH_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    bool fma = (info[2] & (1 << 12)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!fma || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif defined(CH_BATCH_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+    return false;
+#endif
+}
+
+static bool CpuSupportsAVX512() {
+#if defined(CH_BATCH_X86) && defined(_MSC_VER)
+    if (!CpuSupportsAVX2() || (_xgetbv(0) & 0xE6) != 0xE6)
+        return false;
+    int info[4];
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 16)) != 0;
+#elif defined(CH_BATCH_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    return CpuSupportsAVX2() && __builtin_cpu_supports("avx512f");
+#else
+    return false;
+#endif
+}
+
+// Kernel table for the given instruction set, or nullptr if not available.
+static const Table* GetTable(BatchInstructionSet set) {
+    switch (set) {
+        case BatchInstructionSet::AVX512:
+            return CpuSupportsAVX512() ? GetTableAVX512() : nullptr;
+        case BatchInstructionSet::AVX2:
+            return CpuSupportsAVX2() ? GetTableAVX2() : nullptr;
+        default:
+            return &table_scalar;
+    }
+}
+
+static BatchInstructionSet SelectBatchInstructionSet(BatchInstructionSet set, const Table*& table) {
+    while (!(table = GetTable(set)))
+        set = (set == BatchInstructionSet::AVX512) ? BatchInstructionSet::AVX2 : BatchInstructionSet::SCALAR;
+    return set;
+}
+
+struct BatchKernels {
+    BatchKernels() { set = SelectBatchInstructionSet(BatchInstructionSet::AVX512, table); }
+    BatchInstructionSet set;
+    const Table* table;
+};
+
+static BatchKernels& Kernels() {
+    static BatchKernels kernels;
+    return kernels;
+}
+
+BatchInstructionSet GetBatchInstructionSet() {
+    return Kernels().set;
+}
+
+BatchInstructionSet SetBatchInstructionSet(BatchInstructionSet set) {
+    auto& kernels = Kernels();
+    kernels.set = SelectBatchInstructionSet(set, kernels.table);
+    return kernels.set;
+}
+
+// -----------------------------------------------------------------------------
+
+static soa3 Components(real3_batch& v) {
+    return {v.x(), v.y(), v.z()};
+}
+
+static soa3 Components(const real3_batch& v) {
+    return {const_cast<real*>(v.x()), const_cast<real*>(v.y()), const_cast<real*>(v.z())};
+}
+
+static soa4 Components(const quaternion_batch& q) {
+    return {const_cast<real*>(q.w()), const_cast<real*>(q.x()), const_cast<real*>(q.y()), const_cast<real*>(q.z())};
+}
+
+// Number of elements processed by the batch kernels (the storage padding absorbs the remainder)
+static int KernelSize(int n, const Table* table) {
+    return ((n + table->width - 1) / table->width) * table->width;
+}
+
+void Rotate(const real3_batch& v, const quaternion_batch& q, real3_batch& out) {
+    int n = std::min(v.size(), q.size());
+    out.resize(n);
+    const Table* table = Kernels().table;
+    table->rotate(KernelSize(n, table), Components(v), Components(q), Components(out));
+}
+
+void Cross(const real3_batch& a, const real3_batch& b, real3_batch& out) {
+    int n = std::min(a.size(), b.size());
+    out.resize(n);
+    const Table* table = Kernels().table;
+    table->cross(KernelSize(n, table), Components(a), Components(b), Components(out));
+}
+
+void Orthogonalize(const real3_batch& u, real3_batch& v, real3_batch& w) {
+    int n = u.size();
+    v.resize(n);
+    w.resize(n);
+    const Table* table = Kernels().table;
+    table->orthogonalize(KernelSize(n, table), Components(u), Components(v), Components(w));
+}
+
+void ProjectFrictionCones(int n, real* gamma_n, real* gamma_uv, const real3* friction, const real* cohesion) {
+    const Table* table = Kernels().table;
+    const int mu_stride = (int)(sizeof(real3) / sizeof(real));
+    int done = table->project_cone(n, gamma_n, gamma_uv, &friction[0].x, mu_stride, cohesion);
+    if (done < n)
+        ProjectConeScalar(n - done, gamma_n + done, gamma_uv + 2 * done, &friction[done].x, mu_stride,
+                          cohesion + done);
+}
+
+}  // end namespace chrono
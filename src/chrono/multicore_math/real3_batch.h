@@ -0,0 +1,155 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: structure-of-arrays batches of 3d vectors and quaternions, with
+// kernels processing several elements at once. The kernels are implemented for
+// several instruction sets (scalar, AVX2, AVX-512) and the best one supported by
+// the CPU is selected at run time.
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/multicore_math/real.h"
+#include "chrono/multicore_math/real3.h"
+#include "chrono/multicore_math/real4.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_mc_math
+/// @{
+
+/// Instruction sets for the batch kernels.
+enum class BatchInstructionSet {
+    SCALAR,  ///< portable scalar code
+    AVX2,    ///< AVX2 and FMA, 4 doubles per register
+    AVX512   ///< AVX-512F, 8 doubles per register
+};
+
+/// Structure-of-arrays batch of 3d vectors.
+/// Each component is stored contiguously, with storage padded to a multiple of the widest SIMD register.
+class ChApi real3_batch {
+  public:
+    real3_batch() : n(0), cap(0) {}
+    explicit real3_batch(int size) : n(0), cap(0) { resize(size); }
+
+    /// Resize the batch. Existing elements are preserved.
+    void resize(int size);
+
+    /// Return the number of elements in the batch.
+    int size() const { return n; }
+
+    /// Return the size of the batch storage (number of elements, including padding).
+    int capacity() const { return cap; }
+
+    /// Copy the first `size` elements of the given array of vectors into this batch.
+    void load(const real3* v, int size);
+
+    /// Set the element with specified index.
+    void set(int i, const real3& v) {
+        data[i] = v.x;
+        data[cap + i] = v.y;
+        data[2 * cap + i] = v.z;
+    }
+
+    /// Get the element with specified index.
+    real3 get(int i) const { return real3(data[i], data[cap + i], data[2 * cap + i]); }
+
+    real* x() { return data.data(); }
+    real* y() { return data.data() + cap; }
+    real* z() { return data.data() + 2 * cap; }
+    const real* x() const { return data.data(); }
+    const real* y() const { return data.data() + cap; }
+    const real* z() const { return data.data() + 2 * cap; }
+
+  private:
+    int n;                   ///< number of elements
+    int cap;                 ///< padded number of elements
+    std::vector<real> data;  ///< components, in order x, y, z, each with cap elements
+};
+
+/// Structure-of-arrays batch of quaternions.
+/// Each component is stored contiguously, with storage padded to a multiple of the widest SIMD register.
+class ChApi quaternion_batch {
+  public:
+    quaternion_batch() : n(0), cap(0) {}
+    explicit quaternion_batch(int size) : n(0), cap(0) { resize(size); }
+
+    /// Resize the batch. Existing elements are preserved.
+    void resize(int size);
+
+    /// Return the number of elements in the batch.
+    int size() const { return n; }
+
+    /// Return the size of the batch storage (number of elements, including padding).
+    int capacity() const { return cap; }
+
+    /// Copy the first `size` elements of the given array of quaternions into this batch.
+    void load(const quaternion* q, int size);
+
+    /// Set the element with specified index.
+    void set(int i, const quaternion& q) {
+        data[i] = q.w;
+        data[cap + i] = q.x;
+        data[2 * cap + i] = q.y;
+        data[3 * cap + i] = q.z;
+    }
+
+    /// Get the element with specified index.
+    quaternion get(int i) const { return quaternion(data[i], data[cap + i], data[2 * cap + i], data[3 * cap + i]); }
+
+    real* w() { return data.data(); }
+    real* x() { return data.data() + cap; }
+    real* y() { return data.data() + 2 * cap; }
+    real* z() { return data.data() + 3 * cap; }
+    const real* w() const { return data.data(); }
+    const real* x() const { return data.data() + cap; }
+    const real* y() const { return data.data() + 2 * cap; }
+    const real* z() const { return data.data() + 3 * cap; }
+
+  private:
+    int n;                   ///< number of elements
+    int cap;                 ///< padded number of elements
+    std::vector<real> data;  ///< components, in order w, x, y, z, each with cap elements
+};
+
+/// Return the instruction set used by the batch kernels.
+/// By default, this is the widest one supported by both the CPU and the compiler.
+ChApi BatchInstructionSet GetBatchInstructionSet();
+
+/// Set the instruction set used by the batch kernels.
+/// If not available, the widest supported instruction set narrower than the requested one is used.
+/// Return the instruction set actually selected.
+ChApi BatchInstructionSet SetBatchInstructionSet(BatchInstructionSet set);
+
+/// Rotate the vectors in the batch `v` by the corresponding quaternions (see Rotate(real3, quaternion)).
+/// The output batch is resized as needed.
+ChApi void Rotate(const real3_batch& v, const quaternion_batch& q, real3_batch& out);
+
+/// Cross products of the corresponding vectors in the two batches.
+/// The output batch is resized as needed.
+ChApi void Cross(const real3_batch& a, const real3_batch& b, real3_batch& out);
+
+/// Complete each (unit) vector in `u` to an orthonormal frame (u, v, w).
+/// The output batches are resized as needed.
+ChApi void Orthogonalize(const real3_batch& u, real3_batch& v, real3_batch& w);
+
+/// Project contact impulses onto the friction cones of a set of contacts.
+/// Normal impulses are stored contiguously in `gamma_n`, while the two tangential impulses of each contact are
+/// interleaved in `gamma_uv`. The sliding friction coefficients are the x components of `friction`. Contacts with zero
+/// friction have their tangential impulses zeroed out and their normal impulse clamped at -cohesion.
+ChApi void ProjectFrictionCones(int n, real* gamma_n, real* gamma_uv, const real3* friction, const real* cohesion);
+
+/// @} chrono_mc_math
+
+}  // end namespace chrono
@@ -0,0 +1,199 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: AVX2 kernels for batches of 3d vectors (4 doubles per register).
+// This file is compiled with AVX2 code generation enabled and must only be
+// executed after checking for CPU support (see real3_batch.cpp).
+// =============================================================================
+
+#include "chrono/multicore_math/real3_batch_kernels.h"
+
+#if defined(__AVX2__)
+
+    #include <immintrin.h>
+
+namespace chrono {
+namespace batch_kernels {
+
+namespace {
+
+inline __m256d Neg(__m256d a) {
+    return _mm256_xor_pd(a, _mm256_set1_pd(-0.0));
+}
+
+inline __m256d Abs(__m256d a) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+}
+
+// Select b where mask is set, a otherwise
+inline __m256d Select(__m256d a, __m256d b, __m256d mask) {
+    return _mm256_blendv_pd(a, b, mask);
+}
+
+inline __m256d Lt(__m256d a, __m256d b) {
+    return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+}
+
+void Rotate(int n, soa3 v, soa4 q, soa3 out) {
+    const __m256d two = _mm256_set1_pd(2.0);
+    for (int i = 0; i < n; i += 4) {
+        __m256d vx = _mm256_loadu_pd(v.x + i);
+        __m256d vy = _mm256_loadu_pd(v.y + i);
+        __m256d vz = _mm256_loadu_pd(v.z + i);
+        __m256d qw = _mm256_loadu_pd(q.w + i);
+        __m256d qx = _mm256_loadu_pd(q.x + i);
+        __m256d qy = _mm256_loadu_pd(q.y + i);
+        __m256d qz = _mm256_loadu_pd(q.z + i);
+        __m256d tx = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(qy, vz), _mm256_mul_pd(qz, vy)));
+        __m256d ty = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(qz, vx), _mm256_mul_pd(qx, vz)));
+        __m256d tz = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(qx, vy), _mm256_mul_pd(qy, vx)));
+        __m256d ox = _mm256_add_pd(_mm256_add_pd(vx, _mm256_mul_pd(qw, tx)),
+                                   _mm256_sub_pd(_mm256_mul_pd(qy, tz), _mm256_mul_pd(qz, ty)));
+        __m256d oy = _mm256_add_pd(_mm256_add_pd(vy, _mm256_mul_pd(qw, ty)),
+                                   _mm256_sub_pd(_mm256_mul_pd(qz, tx), _mm256_mul_pd(qx, tz)));
+        __m256d oz = _mm256_add_pd(_mm256_add_pd(vz, _mm256_mul_pd(qw, tz)),
+                                   _mm256_sub_pd(_mm256_mul_pd(qx, ty), _mm256_mul_pd(qy, tx)));
+        _mm256_storeu_pd(out.x + i, ox);
+        _mm256_storeu_pd(out.y + i, oy);
+        _mm256_storeu_pd(out.z + i, oz);
+    }
+}
+
+void Cross(int n, soa3 a, soa3 b, soa3 out) {
+    for (int i = 0; i < n; i += 4) {
+        __m256d ax = _mm256_loadu_pd(a.x + i);
+        __m256d ay = _mm256_loadu_pd(a.y + i);
+        __m256d az = _mm256_loadu_pd(a.z + i);
+        __m256d bx = _mm256_loadu_pd(b.x + i);
+        __m256d by = _mm256_loadu_pd(b.y + i);
+        __m256d bz = _mm256_loadu_pd(b.z + i);
+        __m256d cx = _mm256_sub_pd(_mm256_mul_pd(ay, bz), _mm256_mul_pd(az, by));
+        __m256d cy = _mm256_sub_pd(_mm256_mul_pd(az, bx), _mm256_mul_pd(ax, bz));
+        __m256d cz = _mm256_sub_pd(_mm256_mul_pd(ax, by), _mm256_mul_pd(ay, bx));
+        _mm256_storeu_pd(out.x + i, cx);
+        _mm256_storeu_pd(out.y + i, cy);
+        _mm256_storeu_pd(out.z + i, cz);
+    }
+}
+
+void Orthogonalize(int n, soa3 u, soa3 v, soa3 w) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d tol = _mm256_set1_pd(0.0001);
+    for (int i = 0; i < n; i += 4) {
+        __m256d ux = _mm256_loadu_pd(u.x + i);
+        __m256d uy = _mm256_loadu_pd(u.y + i);
+        __m256d uz = _mm256_loadu_pd(u.z + i);
+
+        // w = u x (0,1,0), or u x (1,0,0) if u is nearly aligned with the y axis
+        __m256d len = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(uz, uz), _mm256_mul_pd(ux, ux)));
+        __m256d singular = Lt(len, tol);
+        __m256d wx = Select(Neg(uz), zero, singular);
+        __m256d wy = Select(zero, uz, singular);
+        __m256d wz = Select(ux, Neg(uy), singular);
+        len = _mm256_sqrt_pd(
+            _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(wx, wx), _mm256_mul_pd(wy, wy)), _mm256_mul_pd(wz, wz)));
+        wx = _mm256_div_pd(wx, len);
+        wy = _mm256_div_pd(wy, len);
+        wz = _mm256_div_pd(wz, len);
+
+        // v = w x u
+        __m256d vx = _mm256_sub_pd(_mm256_mul_pd(wy, uz), _mm256_mul_pd(wz, uy));
+        __m256d vy = _mm256_sub_pd(_mm256_mul_pd(wz, ux), _mm256_mul_pd(wx, uz));
+        __m256d vz = _mm256_sub_pd(_mm256_mul_pd(wx, uy), _mm256_mul_pd(wy, ux));
+
+        _mm256_storeu_pd(v.x + i, vx);
+        _mm256_storeu_pd(v.y + i, vy);
+        _mm256_storeu_pd(v.z + i, vz);
+        _mm256_storeu_pd(w.x + i, wx);
+        _mm256_storeu_pd(w.y + i, wy);
+        _mm256_storeu_pd(w.z + i, wz);
+    }
+}
+
+int ProjectCone(int n, double* gn, double* guv, const double* mu, int mu_stride, const double* coh) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d tol = _mm256_set1_pd(10e-15);
+    const __m256i mu_index = _mm256_setr_epi64x(0, mu_stride, 2 * mu_stride, 3 * mu_stride);
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d g = _mm256_loadu_pd(gn + i);
+        __m256d c = _mm256_loadu_pd(coh + i);
+        __m256d m = _mm256_i64gather_pd(mu + (long long)i * mu_stride, mu_index, 8);
+
+        // De-interleave the tangential impulses
+        __m256d a = _mm256_loadu_pd(guv + 2 * i);
+        __m256d b = _mm256_loadu_pd(guv + 2 * i + 4);
+        __m256d gu = _mm256_permute4x64_pd(_mm256_unpacklo_pd(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+        __m256d gv = _mm256_permute4x64_pd(_mm256_unpackhi_pd(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+
+        __m256d g_n = _mm256_add_pd(g, c);
+        __m256d f_tang = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(gu, gu), _mm256_mul_pd(gv, gv)));
+
+        // Projection onto the generator segment of the upper cone
+        __m256d p_n = _mm256_div_pd(_mm256_add_pd(_mm256_mul_pd(f_tang, m), g_n),
+                                    _mm256_add_pd(_mm256_mul_pd(m, m), one));
+        __m256d t = _mm256_div_pd(_mm256_mul_pd(p_n, m), f_tang);
+        __m256d p_u = _mm256_mul_pd(gu, t);
+        __m256d p_v = _mm256_mul_pd(gv, t);
+
+        // Inside lower cone: reset to zero. Inside upper cone: keep untouched.
+        __m256d upper = Lt(f_tang, _mm256_mul_pd(m, g_n));
+        __m256d lower = _mm256_or_pd(Lt(f_tang, _mm256_mul_pd(Neg(_mm256_div_pd(one, m)), g_n)), Lt(Abs(g_n), tol));
+        p_n = Select(Select(p_n, zero, lower), g_n, upper);
+        p_u = Select(Select(p_u, zero, lower), gu, upper);
+        p_v = Select(Select(p_v, zero, lower), gv, upper);
+        p_n = _mm256_sub_pd(p_n, c);
+
+        // Frictionless contacts: clamp normal impulse, zero tangential impulses
+        __m256d frictionless = _mm256_cmp_pd(m, zero, _CMP_EQ_OQ);
+        __m256d neg_c = Neg(c);
+        p_n = Select(p_n, Select(g, neg_c, Lt(g, neg_c)), frictionless);
+        p_u = Select(p_u, zero, frictionless);
+        p_v = Select(p_v, zero, frictionless);
+
+        // Re-interleave the tangential impulses
+        p_u = _mm256_permute4x64_pd(p_u, _MM_SHUFFLE(3, 1, 2, 0));
+        p_v = _mm256_permute4x64_pd(p_v, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_pd(gn + i, p_n);
+        _mm256_storeu_pd(guv + 2 * i, _mm256_unpacklo_pd(p_u, p_v));
+        _mm256_storeu_pd(guv + 2 * i + 4, _mm256_unpackhi_pd(p_u, p_v));
+    }
+
+    return i;
+}
+
+const Table table_avx2 = {4, Rotate, Cross, Orthogonalize, ProjectCone};
+
+}  // end anonymous namespace
+
+const Table* GetTableAVX2() {
+    return &table_avx2;
+}
+
+}  // end namespace batch_kernels
+}  // end namespace chrono
+
+#else
+
+namespace chrono {
+namespace batch_kernels {
+
+const Table* GetTableAVX2() {
+    return nullptr;
+}
+
+}  // end namespace batch_kernels
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,198 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: AVX-512 kernels for batches of 3d vectors (8 doubles per register).
+// This file is compiled with AVX-512 code generation enabled and must only be
+// executed after checking for CPU support (see real3_batch.cpp).
+// =============================================================================
+
+#include "chrono/multicore_math/real3_batch_kernels.h"
+
+#if defined(__AVX512F__)
+
+    #include <immintrin.h>
+
+namespace chrono {
+namespace batch_kernels {
+
+namespace {
+
+inline __m512d Neg(__m512d a) {
+    return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(0x8000000000000000LL)));
+}
+
+// Select b where mask is set, a otherwise
+inline __m512d Select(__m512d a, __m512d b, __mmask8 mask) {
+    return _mm512_mask_blend_pd(mask, a, b);
+}
+
+inline __mmask8 Lt(__m512d a, __m512d b) {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+}
+
+void Rotate(int n, soa3 v, soa4 q, soa3 out) {
+    const __m512d two = _mm512_set1_pd(2.0);
+    for (int i = 0; i < n; i += 8) {
+        __m512d vx = _mm512_loadu_pd(v.x + i);
+        __m512d vy = _mm512_loadu_pd(v.y + i);
+        __m512d vz = _mm512_loadu_pd(v.z + i);
+        __m512d qw = _mm512_loadu_pd(q.w + i);
+        __m512d qx = _mm512_loadu_pd(q.x + i);
+        __m512d qy = _mm512_loadu_pd(q.y + i);
+        __m512d qz = _mm512_loadu_pd(q.z + i);
+        __m512d tx = _mm512_mul_pd(two, _mm512_sub_pd(_mm512_mul_pd(qy, vz), _mm512_mul_pd(qz, vy)));
+        __m512d ty = _mm512_mul_pd(two, _mm512_sub_pd(_mm512_mul_pd(qz, vx), _mm512_mul_pd(qx, vz)));
+        __m512d tz = _mm512_mul_pd(two, _mm512_sub_pd(_mm512_mul_pd(qx, vy), _mm512_mul_pd(qy, vx)));
+        __m512d ox = _mm512_add_pd(_mm512_add_pd(vx, _mm512_mul_pd(qw, tx)),
+                                   _mm512_sub_pd(_mm512_mul_pd(qy, tz), _mm512_mul_pd(qz, ty)));
+        __m512d oy = _mm512_add_pd(_mm512_add_pd(vy, _mm512_mul_pd(qw, ty)),
+                                   _mm512_sub_pd(_mm512_mul_pd(qz, tx), _mm512_mul_pd(qx, tz)));
+        __m512d oz = _mm512_add_pd(_mm512_add_pd(vz, _mm512_mul_pd(qw, tz)),
+                                   _mm512_sub_pd(_mm512_mul_pd(qx, ty), _mm512_mul_pd(qy, tx)));
+        _mm512_storeu_pd(out.x + i, ox);
+        _mm512_storeu_pd(out.y + i, oy);
+        _mm512_storeu_pd(out.z + i, oz);
+    }
+}
+
+void Cross(int n, soa3 a, soa3 b, soa3 out) {
+    for (int i = 0; i < n; i += 8) {
+        __m512d ax = _mm512_loadu_pd(a.x + i);
+        __m512d ay = _mm512_loadu_pd(a.y + i);
+        __m512d az = _mm512_loadu_pd(a.z + i);
+        __m512d bx = _mm512_loadu_pd(b.x + i);
+        __m512d by = _mm512_loadu_pd(b.y + i);
+        __m512d bz = _mm512_loadu_pd(b.z + i);
+        __m512d cx = _mm512_sub_pd(_mm512_mul_pd(ay, bz), _mm512_mul_pd(az, by));
+        __m512d cy = _mm512_sub_pd(_mm512_mul_pd(az, bx), _mm512_mul_pd(ax, bz));
+        __m512d cz = _mm512_sub_pd(_mm512_mul_pd(ax, by), _mm512_mul_pd(ay, bx));
+        _mm512_storeu_pd(out.x + i, cx);
+        _mm512_storeu_pd(out.y + i, cy);
+        _mm512_storeu_pd(out.z + i, cz);
+    }
+}
+
+void Orthogonalize(int n, soa3 u, soa3 v, soa3 w) {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d tol = _mm512_set1_pd(0.0001);
+    for (int i = 0; i < n; i += 8) {
+        __m512d ux = _mm512_loadu_pd(u.x + i);
+        __m512d uy = _mm512_loadu_pd(u.y + i);
+        __m512d uz = _mm512_loadu_pd(u.z + i);
+
+        // w = u x (0,1,0), or u x (1,0,0) if u is nearly aligned with the y axis
+        __m512d len = _mm512_sqrt_pd(_mm512_add_pd(_mm512_mul_pd(uz, uz), _mm512_mul_pd(ux, ux)));
+        __mmask8 singular = Lt(len, tol);
+        __m512d wx = Select(Neg(uz), zero, singular);
+        __m512d wy = Select(zero, uz, singular);
+        __m512d wz = Select(ux, Neg(uy), singular);
+        len = _mm512_sqrt_pd(
+            _mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(wx, wx), _mm512_mul_pd(wy, wy)), _mm512_mul_pd(wz, wz)));
+        wx = _mm512_div_pd(wx, len);
+        wy = _mm512_div_pd(wy, len);
+        wz = _mm512_div_pd(wz, len);
+
+        // v = w x u
+        __m512d vx = _mm512_sub_pd(_mm512_mul_pd(wy, uz), _mm512_mul_pd(wz, uy));
+        __m512d vy = _mm512_sub_pd(_mm512_mul_pd(wz, ux), _mm512_mul_pd(wx, uz));
+        __m512d vz = _mm512_sub_pd(_mm512_mul_pd(wx, uy), _mm512_mul_pd(wy, ux));
+
+        _mm512_storeu_pd(v.x + i, vx);
+        _mm512_storeu_pd(v.y + i, vy);
+        _mm512_storeu_pd(v.z + i, vz);
+        _mm512_storeu_pd(w.x + i, wx);
+        _mm512_storeu_pd(w.y + i, wy);
+        _mm512_storeu_pd(w.z + i, wz);
+    }
+}
+
+int ProjectCone(int n, double* gn, double* guv, const double* mu, int mu_stride, const double* coh) {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d tol = _mm512_set1_pd(10e-15);
+    const long long s = mu_stride;
+    const __m512i mu_index = _mm512_setr_epi64(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+    const __m512i even = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m512i odd = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+    const __m512i lo = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+    const __m512i hi = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d g = _mm512_loadu_pd(gn + i);
+        __m512d c = _mm512_loadu_pd(coh + i);
+        __m512d m = _mm512_i64gather_pd(mu_index, mu + (long long)i * mu_stride, 8);
+
+        // De-interleave the tangential impulses
+        __m512d a = _mm512_loadu_pd(guv + 2 * i);
+        __m512d b = _mm512_loadu_pd(guv + 2 * i + 8);
+        __m512d gu = _mm512_permutex2var_pd(a, even, b);
+        __m512d gv = _mm512_permutex2var_pd(a, odd, b);
+
+        __m512d g_n = _mm512_add_pd(g, c);
+        __m512d f_tang = _mm512_sqrt_pd(_mm512_add_pd(_mm512_mul_pd(gu, gu), _mm512_mul_pd(gv, gv)));
+
+        // Projection onto the generator segment of the upper cone
+        __m512d p_n = _mm512_div_pd(_mm512_add_pd(_mm512_mul_pd(f_tang, m), g_n),
+                                    _mm512_add_pd(_mm512_mul_pd(m, m), one));
+        __m512d t = _mm512_div_pd(_mm512_mul_pd(p_n, m), f_tang);
+        __m512d p_u = _mm512_mul_pd(gu, t);
+        __m512d p_v = _mm512_mul_pd(gv, t);
+
+        // Inside lower cone: reset to zero. Inside upper cone: keep untouched.
+        __mmask8 upper = Lt(f_tang, _mm512_mul_pd(m, g_n));
+        __mmask8 lower = Lt(f_tang, _mm512_mul_pd(Neg(_mm512_div_pd(one, m)), g_n)) | Lt(_mm512_abs_pd(g_n), tol);
+        p_n = Select(Select(p_n, zero, lower), g_n, upper);
+        p_u = Select(Select(p_u, zero, lower), gu, upper);
+        p_v = Select(Select(p_v, zero, lower), gv, upper);
+        p_n = _mm512_sub_pd(p_n, c);
+
+        // Frictionless contacts: clamp normal impulse, zero tangential impulses
+        __mmask8 frictionless = _mm512_cmp_pd_mask(m, zero, _CMP_EQ_OQ);
+        __m512d neg_c = Neg(c);
+        p_n = Select(p_n, Select(g, neg_c, Lt(g, neg_c)), frictionless);
+        p_u = Select(p_u, zero, frictionless);
+        p_v = Select(p_v, zero, frictionless);
+
+        // Re-interleave the tangential impulses
+        _mm512_storeu_pd(gn + i, p_n);
+        _mm512_storeu_pd(guv + 2 * i, _mm512_permutex2var_pd(p_u, lo, p_v));
+        _mm512_storeu_pd(guv + 2 * i + 8, _mm512_permutex2var_pd(p_u, hi, p_v));
+    }
+
+    return i;
+}
+
+const Table table_avx512 = {8, Rotate, Cross, Orthogonalize, ProjectCone};
+
+}  // end anonymous namespace
+
+const Table* GetTableAVX512() {
+    return &table_avx512;
+}
+
+}  // end namespace batch_kernels
+}  // end namespace chrono
+
+#else
+
+namespace chrono {
+namespace batch_kernels {
+
+const Table* GetTableAVX512() {
+    return nullptr;
+}
+
+}  // end namespace batch_kernels
+}  // end namespace chrono
+
+#endif
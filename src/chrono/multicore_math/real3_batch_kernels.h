@@ -0,0 +1,62 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: internal interface to the SIMD kernels operating on batches of
+// 3d vectors (see real3_batch.h).
+//
+// Each instruction set has its own translation unit, compiled with the flags
+// enabling that instruction set. These files must not include any other Chrono
+// header: inline functions instantiated there could otherwise be selected by the
+// linker for the entire library and be executed on CPUs not supporting them.
+// For the same reason, kernels only operate on raw arrays of doubles.
+// =============================================================================
+
+#pragma once
+
+namespace chrono {
+namespace batch_kernels {
+
+/// Pointers to the components of a structure-of-arrays batch of 3d vectors.
+struct soa3 {
+    double* x;
+    double* y;
+    double* z;
+};
+
+/// Pointers to the components of a structure-of-arrays batch of quaternions.
+struct soa4 {
+    double* w;
+    double* x;
+    double* y;
+    double* z;
+};
+
+/// Table of batch kernels for a given instruction set.
+/// The first three kernels process n elements, with n a multiple of the SIMD width (batches are padded).
+/// The friction cone projection operates in place on solver arrays (not padded) and returns the number of contacts
+/// processed (a multiple of the SIMD width); the remaining ones are projected by the caller.
+struct Table {
+    int width;  ///< number of doubles per SIMD register
+    void (*rotate)(int n, soa3 v, soa4 q, soa3 out);
+    void (*cross)(int n, soa3 a, soa3 b, soa3 out);
+    void (*orthogonalize)(int n, soa3 u, soa3 v, soa3 w);
+    int (*project_cone)(int n, double* gamma_n, double* gamma_uv, const double* mu, int mu_stride, const double* coh);
+};
+
+/// Return the AVX2 kernels, or nullptr if they were not compiled in.
+const Table* GetTableAVX2();
+
+/// Return the AVX-512 kernels, or nullptr if they were not compiled in.
+const Table* GetTableAVX512();
+
+}  // end namespace batch_kernels
+}  // end namespace chrono
@@ -46,7 +46,8 @@ ChAssembly::ChAssembly()
       nsysvars_w(0),
       ndof(0),
       ndoc_w_C(0),
-      ndoc_w_D(0) {}
+      ndoc_w_D(0),
+      parallel_update(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nbodies = other.nbodies;
@@ -67,6 +68,7 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     ndof = other.ndof;
     nsysvars = other.nsysvars;
     nsysvars_w = other.nsysvars_w;
+    parallel_update = other.parallel_update;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, shaftlist, linklist, meshlist,  otherphysicslist)
@@ -108,6 +110,7 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.ndof, second.ndof);
     swap(first.nsysvars, second.nsysvars);
     swap(first.nsysvars_w, second.nsysvars_w);
+    swap(first.parallel_update, second.parallel_update);
 
     //// RADU
     //// TODO: deal with all other member variables...
@@ -151,6 +154,9 @@ void ChAssembly::AddBody(std::shared_ptr<ChBody> body) {
     body->SetSystem(system);
     bodylist.push_back(body);
 
+    // restart the sleep timer, so that a body added at rest is not put to sleep before it moves
+    body->sleep_starttime = float(system->GetChTime());
+
     ////system->is_initialized = false;  // Not needed, unless/until ChBody::SetupInitial does something
     system->is_updated = false;
 }
@@ -667,17 +673,41 @@ void ChAssembly::Update(double mytime, bool update_assets) {
     Update(update_assets);
 }
 
+int ChAssembly::GetNumThreadsUpdate() const {
+    return (parallel_update && system) ? system->nthreads_chrono : 1;
+}
+
+// Apply the given function to all items in the list.
+// With more than one thread, the thread-safe items are processed concurrently, followed by all other items (serially).
+template <class Titem, class Tfunc>
+static void ForEachItem(std::vector<std::shared_ptr<Titem>>& list, int nthreads, Tfunc func) {
+    int n = (int)list.size();
+    if (nthreads < 2 || n < 2 * nthreads) {
+        for (int ip = 0; ip < n; ++ip)
+            func(list[ip].get());
+        return;
+    }
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < n; ++ip) {
+        if (list[ip]->IsThreadSafe())
+            func(list[ip].get());
+    }
+    for (int ip = 0; ip < n; ++ip) {
+        if (!list[ip]->IsThreadSafe())
+            func(list[ip].get());
+    }
+}
+
 // Update all physical items (bodies, links, meshes, etc), including their auxiliary variables.
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
-        bodylist[ip]->Update(ChTime, update_assets);
-    }
-    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
-        shaftlist[ip]->Update(ChTime, update_assets);
-    }
+    int nthreads = GetNumThreadsUpdate();
+    double time = ChTime;
+
+    ForEachItem(bodylist, nthreads, [time, update_assets](ChBody* body) { body->Update(time, update_assets); });
+    ForEachItem(shaftlist, nthreads, [time, update_assets](ChShaft* shaft) { shaft->Update(time, update_assets); });
     for (int ip = 0; ip < (int)meshlist.size(); ++ip) {
         meshlist[ip]->Update(ChTime, update_assets);
     }
@@ -686,9 +716,7 @@ void ChAssembly::Update(bool update_assets) {
     }
     // The state of links depends on the bodylist,shaftlist,meshlist,otherphysicslist,
     // thus the update of linklist must be at the end.
-    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
-        linklist[ip]->Update(ChTime, update_assets);
-    }
+    ForEachItem(linklist, nthreads, [time, update_assets](ChLinkBase* link) { link->Update(time, update_assets); });
 }
 
 void ChAssembly::SetNoSpeedNoAcceleration() {
@@ -755,20 +783,21 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsUpdate();
 
-    for (auto& body : bodylist) {
+    ForEachItem(bodylist, nthreads, [&](ChBody* body) {
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
         else
             body->Update(T, full_update);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ForEachItem(shaftlist, nthreads, [&](ChShaft* shaft) {
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
                                    full_update);
         else
             shaft->Update(T, full_update);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
     }
@@ -782,12 +811,12 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // must be behind of bodylist,shaftlist,meshlist,otherphysicslist; otherwise, the Update() of ChLink() would
     // use the old (un-updated) status of bodylist,shaftlist,meshlist, resulting in a delay of Update() of ChLink()
     // for one time step, then the simulation might diverge!
-    for (auto& link : linklist) {
+    ForEachItem(linklist, nthreads, [&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
         else
             link->Update(T, full_update);
-    }
+    });
 
     SetChTime(T);
 }
@@ -899,21 +928,22 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
                                    const ChStateDelta& Dv) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsUpdate();
 
-    for (auto& body : bodylist) {
+    ForEachItem(bodylist, nthreads, [&](ChBody* body) {
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
-    }
+    });
 
-    for (auto& shaft : shaftlist) {
+    ForEachItem(shaftlist, nthreads, [&](ChShaft* shaft) {
         if (shaft->IsActive())
             shaft->IntStateIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
-    }
+    });
 
-    for (auto& link : linklist) {
+    ForEachItem(linklist, nthreads, [&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
-    }
+    });
 
     for (auto& mesh : meshlist) {
         mesh->IntStateIncrement(displ_x + mesh->GetOffset_x(), x_new, x, displ_v + mesh->GetOffset_w(), Dv);
@@ -963,19 +993,20 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreadsUpdate();
 
-    for (auto& body : bodylist) {
+    ForEachItem(bodylist, nthreads, [&](ChBody* body) {
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ForEachItem(shaftlist, nthreads, [&](ChShaft* shaft) {
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
-    }
-    for (auto& link : linklist) {
+    });
+    ForEachItem(linklist, nthreads, [&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c);
     }
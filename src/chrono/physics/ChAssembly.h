@@ -214,6 +214,18 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// bodies, forces, links, given their current state.
     virtual void Update(bool update_assets = true) override;
 
+    /// Enable/disable parallel execution of the per-item loops of this assembly (default: false).
+    /// If enabled, the loops over bodies, shafts, and links in Update(), IntStateScatter(), IntStateIncrement() and
+    /// IntLoadResidual_F() are executed with OpenMP, using the number of threads set with ChSystem::SetNumThreads
+    /// (num_threads_chrono). Only items declaring themselves as thread-safe
+    /// (see ChPhysicsItem::IsThreadSafe) are processed concurrently; all other items are processed serially, after the
+    /// thread-safe items of the same list. Lists are still processed in the same order as in serial mode (in
+    /// particular, links are updated after all bodies). Meshes and other physics items are always processed serially.
+    void SetParallelUpdate(bool val) { parallel_update = val; }
+
+    /// Return true if parallel execution of the per-item loops is enabled.
+    bool GetParallelUpdate() const { return parallel_update; }
+
     /// Set zero speed (and zero accelerations) in state, without changing the position.
     virtual void SetNoSpeedNoAcceleration() override;
 
@@ -358,6 +370,12 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int ndoc_w_C;    ///< number of scalar constraints C, when using 3 rot. dof. per body (excluding unilaterals)
     int ndoc_w_D;    ///< number of scalar constraints D, when using 3 rot. dof. per body (only unilaterals)
 
+    bool parallel_update;  ///< if true, use parallel loops over thread-safe items
+
+  private:
+    /// Number of threads for the parallel per-item loops (1 if parallel execution is disabled).
+    int GetNumThreadsUpdate() const;
+
     friend class ChSystem;
     friend class ChSystemMulticore;
 };
@@ -47,6 +47,7 @@ ChBody::ChBody()
     sleep_starttime = 0;
     sleep_minspeed = 0.1f;
     sleep_minwvel = 0.04f;
+    sleep_coord = CSYSNORM;
     SetUseSleeping(true);
 
     variables.SetUserData((void*)this);
@@ -80,6 +81,7 @@ ChBody::ChBody(const ChBody& other) : ChPhysicsItem(other), ChBodyFrame(other) {
     sleep_starttime = other.sleep_starttime;
     sleep_minspeed = other.sleep_minspeed;
     sleep_minwvel = other.sleep_minwvel;
+    sleep_coord = other.sleep_coord;
 }
 
 ChBody::~ChBody() {
@@ -666,6 +668,8 @@ bool ChBody::GetUseSleeping() const {
 
 void ChBody::SetSleeping(bool state) {
     BFlagSet(BodyFlag::SLEEPING, state);
+    if (collision_model)
+        collision_model->SetSleeping(state);
 }
 
 bool ChBody::GetSleeping() const {
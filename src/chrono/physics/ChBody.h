@@ -92,7 +92,8 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     bool GetUseSleeping() const;
 
     /// Force the body in sleeping mode or not.
-    /// Usually, this state change is handled internally.
+    /// Usually, this state change is handled internally. The bounding box of a sleeping body is not updated by the
+    /// collision system, so a sleeping body should be woken up before being moved explicitly.
     void SetSleeping(bool state);
 
     /// Return true if this body is currently in 'sleep' mode.
@@ -106,6 +107,11 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// A body is inactive if it is fixed to ground or in sleep mode.
     virtual bool IsActive() const override;
 
+    /// A body only modifies its own state, so it can be updated concurrently with other bodies, provided that it has
+    /// no markers and no forces (these evaluate ChFunction objects, which may be shared with other items).
+    /// Classes derived from ChBody are processed serially unless they override this function.
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBody>(); }
+
     /// Set body id for indexing (internal use only).
     void SetId(int id) { body_id = id; }
 
@@ -433,6 +439,13 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     std::vector<std::shared_ptr<ChMarker>> marklist;  ///< list of markers
     std::vector<std::shared_ptr<ChForce>> forcelist;  ///< list of forces
 
+    /// Utility for IsThreadSafe() overrides in classes derived from ChBody: return true if the dynamic type of this
+    /// object is exactly T and the body has no markers and no forces.
+    template <class T>
+    bool IsThreadSafeBody() const {
+        return IsExactType<T>() && marklist.empty() && forcelist.empty();
+    }
+
     ChVector<> gyro;  ///< gyroscopic torque, i.e. Qm = Wvel x (XInertia*Wvel)
 
     ChVector<> Xforce;   ///< force  acting on body, applied to COM (in absolute coords)
@@ -450,6 +463,7 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     float sleep_minspeed;
     float sleep_minwvel;
     float sleep_starttime;
+    ChCoordsys<> sleep_coord;  ///< position at the last sleeping check (to detect fixed bodies moved kinematically)
 
   private:
     // STATE FUNCTIONS
@@ -44,6 +44,11 @@ class ChApi ChBodyAuxRef : public ChBody {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChBodyAuxRef* Clone() const override { return new ChBodyAuxRef(*this); }
 
+    /// Besides the ChBody data, this class only updates its own auxiliary frame, so it can be updated concurrently
+    /// with other bodies (with the same conditions as ChBody). Derived classes are processed serially unless they
+    /// override this function.
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyAuxRef>(); }
+
     /// Set the auxiliary reference frame with respect to the absolute frame.
     /// This moves the entire body; the body COG is rigidly moved as well.
     void SetFrame_REF_to_abs(const ChFrame<>& mfra);
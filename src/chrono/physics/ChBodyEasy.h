@@ -33,6 +33,9 @@ namespace chrono {
 /// on the geometry.
 class ChApi ChBodyEasySphere : public ChBody {
   public:
+    /// This body can be updated concurrently with other bodies (see ChBody::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyEasySphere>(); }
+
     /// Create a rigid body with optional sphere visualization and/or collision shape.
     /// The sphere is created at the center of mass. Mass and inertia are set automatically depending on density.
     ChBodyEasySphere(double radius,                                         ///< radius of the sphere
@@ -70,6 +73,9 @@ class ChApi ChBodyEasySphere : public ChBody {
 /// on the geometry.
 class ChApi ChBodyEasyEllipsoid : public ChBody {
   public:
+    /// This body can be updated concurrently with other bodies (see ChBody::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyEasyEllipsoid>(); }
+
     /// Create a rigid body with optional ellipsoid visualization and/or collision shape.
     /// The ellipsoid is created at the center of mass. Mass and inertia are set automatically depending on density.
     ChBodyEasyEllipsoid(ChVector<> axes,                                       ///< ellipsoid axis lengths
@@ -107,6 +113,9 @@ class ChApi ChBodyEasyEllipsoid : public ChBody {
 /// on the geometry.
 class ChApi ChBodyEasyCylinder : public ChBody {
   public:
+    /// This body can be updated concurrently with other bodies (see ChBody::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyEasyCylinder>(); }
+
     /// Create a rigid body with optional cylinder visualization and/or collision shape.
     /// The cylinder is created along the specified axis and centered at the center of mass.
     /// Mass and inertia are set automatically depending on density.
@@ -152,6 +161,9 @@ class ChApi ChBodyEasyCylinder : public ChBody {
 /// on the geometry.
 class ChApi ChBodyEasyBox : public ChBody {
   public:
+    /// This body can be updated concurrently with other bodies (see ChBody::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyEasyBox>(); }
+
     /// Create a rigid body with optional box visualization and/or collision shape.
     /// The box is created at the center of mass. Mass and inertia are set automatically depending on density.
     ChBodyEasyBox(double Xsize,                                          ///< size along the X dimension
@@ -195,6 +207,9 @@ class ChApi ChBodyEasyBox : public ChBody {
 /// on the geometry.
 class ChApi ChBodyEasyConvexHull : public ChBody {
   public:
+    /// This body can be updated concurrently with other bodies (see ChBody::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyEasyConvexHull>(); }
+
     /// Create a rigid body with optional convex hull visualization and/or collision shape.
     /// The convex hull is defined with a set of points, expressed in a local frame. Mass and inertia are set
     /// automatically depending on density. The convex hull vertices are translated so that the barycenter coincides
@@ -240,6 +255,9 @@ class ChApi ChBodyEasyConvexHull : public ChBody {
 /// on the geometry.
 class ChApi ChBodyEasyConvexHullAuxRef : public ChBodyAuxRef {
   public:
+    /// This body can be updated concurrently with other bodies (see ChBody::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyEasyConvexHullAuxRef>(); }
+
     /// Create a ChBodyAuxRef with optional convex hull visualization and/or collision shape.
     /// The convex hull is defined with a set of points, expressed in a local frame. Mass and inertia are set
     /// automatically depending on density. The center of mass is set at the barycenter.
@@ -283,6 +301,9 @@ class ChApi ChBodyEasyConvexHullAuxRef : public ChBodyAuxRef {
 /// on the geometry.
 class ChApi ChBodyEasyMesh : public ChBodyAuxRef {
   public:
+    /// This body can be updated concurrently with other bodies (see ChBody::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyEasyMesh>(); }
+
     /// Create a ChBodyAuxRef with optional mesh visualization and/or collision shape.
     /// The mesh is assumed to be provided in a Wavefront OBJ file and defined with respect to the body reference frame.
     /// Mass and inertia are set automatically depending on density.
@@ -352,6 +373,9 @@ class ChApi ChBodyEasyMesh : public ChBodyAuxRef {
 /// formulas.
 class ChApi ChBodyEasyClusterOfSpheres : public ChBody {
   public:
+    /// This body can be updated concurrently with other bodies (see ChBody::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsThreadSafeBody<ChBodyEasyClusterOfSpheres>(); }
+
     /// Create a rigid body with optional sphere cluster mesh visualization and/or collision shapes.
     /// The cluster of spheres will be displaced so that their center of mass corresponds to the origin of the body.
     /// Mass and inertia are set automatically depending on density.
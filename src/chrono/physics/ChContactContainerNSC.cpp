@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <functional>
+
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
@@ -34,9 +37,15 @@ ChContactContainerNSC::ChContactContainerNSC()
       n_added_666_6(0),
       n_added_666_333(0),
       n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
+      n_added_6_6_rolling(0),
+      use_cache(false),
+      cache_tolerance(ChCollisionModel::GetDefaultSuggestedEnvelope()),
+      cache_hits(0) {}
 
 ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
+    use_cache = other.use_cache;
+    cache_tolerance = other.cache_tolerance;
+    cache_hits = 0;
     n_added_6_6 = 0;
     n_added_6_3 = 0;
     n_added_3_3 = 0;
@@ -86,7 +95,81 @@ void ChContactContainerNSC::RemoveAllContacts() {
     _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
 }
 
+bool ChContactContainerNSC::CachedReactionLess(const CachedReaction& a, const CachedReaction& b) {
+    std::less<ChContactable*> less;
+    if (a.objA != b.objA)
+        return less(a.objA, b.objA);
+    return less(a.objB, b.objB);
+}
+
+void ChContactContainerNSC::SortReactionCache() {
+    std::sort(reaction_cache.begin(), reaction_cache.end(), CachedReactionLess);
+}
+
+bool ChContactContainerNSC::FindCachedReaction(ChContactable* objA,
+                                               ChContactable* objB,
+                                               const ChVector<>& p1,
+                                               ChVector<>& force,
+                                               ChVector<>& torque) {
+    CachedReaction key;
+    key.objA = objA;
+    key.objB = objB;
+    auto range = std::equal_range(reaction_cache.begin(), reaction_cache.end(), key, CachedReactionLess);
+    if (range.first == range.second)
+        return false;
+
+    // Pick the closest unused cached contact point (in the frame of objA, so that it moves with objA)
+    ChVector<> pA = objA->GetCsysForCollisionModel().TransformPointParentToLocal(p1);
+    auto closest = range.second;
+    double closest_dist2 = cache_tolerance * cache_tolerance;
+    for (auto entry = range.first; entry != range.second; ++entry) {
+        if (entry->used)
+            continue;
+        double dist2 = (entry->pA - pA).Length2();
+        if (dist2 <= closest_dist2) {
+            closest = entry;
+            closest_dist2 = dist2;
+        }
+    }
+    if (closest == range.second)
+        return false;
+
+    closest->used = true;
+    force = closest->force;
+    torque = closest->torque;
+    return true;
+}
+
 void ChContactContainerNSC::BeginAddContact() {
+    // Cache the reactions of the current contacts, before the contact objects are reused
+    reaction_cache.clear();
+    cache_hits = 0;
+    if (use_cache) {
+        for (auto contact : contactlist_6_6)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_6_3)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_3_3)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_333_3)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_333_6)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_333_333)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_666_3)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_666_6)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_666_333)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_666_666)
+            CacheReaction(*contact);
+        for (auto contact : contactlist_6_6_rolling)
+            CacheReaction(*contact);
+        SortReactionCache();
+    }
+
     lastcontact_6_6 = contactlist_6_6.begin();
     n_added_6_6 = 0;
 
@@ -168,6 +251,33 @@ void ChContactContainerNSC::EndAddContact() {
         delete (*lastcontact_6_6_rolling);
         lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
     }
+
+    // Initialize the reactions of the new contacts from the contact cache
+    if (!reaction_cache.empty()) {
+        for (auto contact : contactlist_6_6)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_6_3)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_3_3)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_333_3)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_333_6)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_333_333)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_666_3)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_666_6)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_666_333)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_666_666)
+            WarmStartReaction(*contact);
+        for (auto contact : contactlist_6_6_rolling)
+            WarmStartReaction(*contact);
+        reaction_cache.clear();
+    }
 }
 
 template <class Tcont, class Titer, class Ta, class Tb>
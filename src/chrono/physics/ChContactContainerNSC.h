@@ -16,6 +16,7 @@
 #define CH_CONTACTCONTAINER_NSC_H
 
 #include <list>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
@@ -84,6 +85,21 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    /// Reaction of a contact found at the previous collision detection, used to warm start new contacts.
+    struct CachedReaction {
+        ChContactable* objA;  ///< first contactable object in the pair
+        ChContactable* objB;  ///< second contactable object in the pair
+        ChVector<> pA;        ///< contact point on objA, expressed in the collision frame of objA
+        ChVector<> force;     ///< contact force, in absolute frame
+        ChVector<> torque;    ///< contact torque (rolling and spinning resistance), in absolute frame
+        bool used;            ///< true if already inherited by a new contact
+    };
+
+    bool use_cache;                              ///< enable the contact cache
+    double cache_tolerance;                      ///< maximum distance between matched contact points
+    int cache_hits;                              ///< number of contacts initialized from the cache
+    std::vector<CachedReaction> reaction_cache;  ///< cached reactions, sorted by contactable pair
+
   public:
     ChContactContainerNSC();
     ChContactContainerNSC(const ChContactContainerNSC& other);
@@ -104,7 +120,7 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
     /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
     /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// allocation/deallocation. If the contact cache is enabled, the reactions of the current contacts are cached.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -121,8 +137,28 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
     /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// If the contact cache is enabled, the new contacts are initialized with the cached reactions.
     virtual void EndAddContact() override;
 
+    /// Enable/disable the persistent contact cache (default: false).
+    /// When enabled, the reactions of the current contacts are cached at the beginning of each collision detection
+    /// phase. Each new contact inherits the reaction of the closest cached contact between the same pair of objects,
+    /// reprojected onto its own contact plane. Together with ChIterativeSolver::EnableWarmStart, this provides a warm
+    /// start to the solver even when the collision system does not preserve contact manifolds across steps. The cache
+    /// is of no use without warm start, so it should be enabled only together with it.
+    void EnableContactCache(bool val) { use_cache = val; }
+
+    /// Return true if the persistent contact cache is enabled.
+    bool IsContactCacheEnabled() const { return use_cache; }
+
+    /// Set the maximum distance between the contact points of a new contact and of a cached one (default: the
+    /// collision envelope suggested by ChCollisionModel::GetDefaultSuggestedEnvelope). Contact points are compared in
+    /// the collision frame of the first object in the pair.
+    void SetContactCacheTolerance(double tol) { cache_tolerance = tol; }
+
+    /// Return the number of contacts which were initialized from the contact cache at the last collision detection.
+    int GetContactCacheHits() const { return cache_hits; }
+
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
     /// object.
     virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
@@ -224,6 +260,46 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
 
+  protected:
+    /// Add the reaction of the given contact to the contact cache.
+    template <class Tcont>
+    void CacheReaction(Tcont& contact) {
+        CachedReaction entry;
+        entry.objA = contact.GetObjA();
+        entry.objB = contact.GetObjB();
+        entry.pA = entry.objA->GetCsysForCollisionModel().TransformPointParentToLocal(contact.GetContactP1());
+        entry.force = contact.GetContactPlane() * contact.GetContactForce();
+        entry.torque = contact.GetContactPlane() * contact.GetContactTorque();
+        entry.used = false;
+        reaction_cache.push_back(entry);
+    }
+
+    /// Initialize the reactions of the given (new or reused) contact from the contact cache, if a match is found.
+    template <class Tcont>
+    void WarmStartReaction(Tcont& contact) {
+        ChVector<> force;
+        ChVector<> torque;
+        if (FindCachedReaction(contact.GetObjA(), contact.GetObjB(), contact.GetContactP1(), force, torque)) {
+            const ChMatrix33<>& plane = contact.GetContactPlane();
+            contact.SetContactReactions(plane.transpose() * force, plane.transpose() * torque);
+            cache_hits++;
+        }
+    }
+
+    /// Order cached reactions by contactable pair.
+    static bool CachedReactionLess(const CachedReaction& a, const CachedReaction& b);
+
+    /// Prepare the contact cache for lookups, after all reactions were cached.
+    void SortReactionCache();
+
+    /// Find the closest unused cached contact between the given objects, within the cache tolerance.
+    /// If found, the cached entry is marked as used and its reactions (in absolute frame) are returned.
+    bool FindCachedReaction(ChContactable* objA,
+                            ChContactable* objB,
+                            const ChVector<>& p1,
+                            ChVector<>& force,
+                            ChVector<>& torque);
+
   private:
     void InsertContact(const ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat);
 };
@@ -0,0 +1,702 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/physics/ChContactContainerNSCpooled.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+using namespace geometry;
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChContactContainerNSCpooled)
+
+ChContactContainerNSCpooled::ChContactContainerNSCpooled() {}
+
+ChContactContainerNSCpooled::ChContactContainerNSCpooled(const ChContactContainerNSCpooled& other)
+    : ChContactContainerNSC(other) {}
+
+ChContactContainerNSCpooled::~ChContactContainerNSCpooled() {
+    RemoveAllContacts();
+}
+
+int ChContactContainerNSCpooled::GetNcontacts() const {
+    return (int)(arena_6_6.size() + arena_6_3.size() + arena_3_3.size() + arena_333_3.size() + arena_333_6.size() +
+                 arena_333_333.size() + arena_666_3.size() + arena_666_6.size() + arena_666_333.size() +
+                 arena_666_666.size() + arena_6_6_rolling.size());
+}
+
+int ChContactContainerNSCpooled::GetDOC_d() {
+    return 3 * (int)(arena_6_6.size() + arena_6_3.size() + arena_3_3.size() + arena_333_3.size() +
+                     arena_333_6.size() + arena_333_333.size() + arena_666_3.size() + arena_666_6.size() +
+                     arena_666_333.size() + arena_666_666.size()) +
+           6 * (int)(arena_6_6_rolling.size());
+}
+
+void ChContactContainerNSCpooled::RemoveAllContacts() {
+    arena_6_6.Clear();
+    arena_6_3.Clear();
+    arena_3_3.Clear();
+    arena_333_3.Clear();
+    arena_333_6.Clear();
+    arena_333_333.Clear();
+    arena_666_3.Clear();
+    arena_666_6.Clear();
+    arena_666_333.Clear();
+    arena_666_666.Clear();
+    arena_6_6_rolling.Clear();
+}
+
+void ChContactContainerNSCpooled::BeginAddContact() {
+    // Cache the reactions of the current contacts, before the contact objects are reused
+    reaction_cache.clear();
+    cache_hits = 0;
+    if (use_cache) {
+        for (size_t i = 0; i < arena_6_6.size(); i++)
+            CacheReaction(arena_6_6[i]);
+        for (size_t i = 0; i < arena_6_3.size(); i++)
+            CacheReaction(arena_6_3[i]);
+        for (size_t i = 0; i < arena_3_3.size(); i++)
+            CacheReaction(arena_3_3[i]);
+        for (size_t i = 0; i < arena_333_3.size(); i++)
+            CacheReaction(arena_333_3[i]);
+        for (size_t i = 0; i < arena_333_6.size(); i++)
+            CacheReaction(arena_333_6[i]);
+        for (size_t i = 0; i < arena_333_333.size(); i++)
+            CacheReaction(arena_333_333[i]);
+        for (size_t i = 0; i < arena_666_3.size(); i++)
+            CacheReaction(arena_666_3[i]);
+        for (size_t i = 0; i < arena_666_6.size(); i++)
+            CacheReaction(arena_666_6[i]);
+        for (size_t i = 0; i < arena_666_333.size(); i++)
+            CacheReaction(arena_666_333[i]);
+        for (size_t i = 0; i < arena_666_666.size(); i++)
+            CacheReaction(arena_666_666[i]);
+        for (size_t i = 0; i < arena_6_6_rolling.size(); i++)
+            CacheReaction(arena_6_6_rolling[i]);
+        SortReactionCache();
+    }
+
+    arena_6_6.Rewind();
+    arena_6_3.Rewind();
+    arena_3_3.Rewind();
+    arena_333_3.Rewind();
+    arena_333_6.Rewind();
+    arena_333_333.Rewind();
+    arena_666_3.Rewind();
+    arena_666_6.Rewind();
+    arena_666_333.Rewind();
+    arena_666_666.Rewind();
+    arena_6_6_rolling.Rewind();
+}
+
+void ChContactContainerNSCpooled::EndAddContact() {
+    // Contact objects beyond the last active one are kept in the arenas for reuse at the next step.
+
+    // Initialize the reactions of the new contacts from the contact cache
+    if (!reaction_cache.empty()) {
+        for (size_t i = 0; i < arena_6_6.size(); i++)
+            WarmStartReaction(arena_6_6[i]);
+        for (size_t i = 0; i < arena_6_3.size(); i++)
+            WarmStartReaction(arena_6_3[i]);
+        for (size_t i = 0; i < arena_3_3.size(); i++)
+            WarmStartReaction(arena_3_3[i]);
+        for (size_t i = 0; i < arena_333_3.size(); i++)
+            WarmStartReaction(arena_333_3[i]);
+        for (size_t i = 0; i < arena_333_6.size(); i++)
+            WarmStartReaction(arena_333_6[i]);
+        for (size_t i = 0; i < arena_333_333.size(); i++)
+            WarmStartReaction(arena_333_333[i]);
+        for (size_t i = 0; i < arena_666_3.size(); i++)
+            WarmStartReaction(arena_666_3[i]);
+        for (size_t i = 0; i < arena_666_6.size(); i++)
+            WarmStartReaction(arena_666_6[i]);
+        for (size_t i = 0; i < arena_666_333.size(); i++)
+            WarmStartReaction(arena_666_333[i]);
+        for (size_t i = 0; i < arena_666_666.size(); i++)
+            WarmStartReaction(arena_666_666[i]);
+        for (size_t i = 0; i < arena_6_6_rolling.size(); i++)
+            WarmStartReaction(arena_6_6_rolling[i]);
+        reaction_cache.clear();
+    }
+}
+
+void ChContactContainerNSCpooled::AddContact(const ChCollisionInfo& cinfo,
+                                       std::shared_ptr<ChMaterialSurface> mat1,
+                                       std::shared_ptr<ChMaterialSurface> mat2) {
+    assert(cinfo.modelA->GetContactable());
+    assert(cinfo.modelB->GetContactable());
+
+    auto contactableA = cinfo.modelA->GetContactable();
+    auto contactableB = cinfo.modelB->GetContactable();
+
+    // Do nothing if any of the contactables is not contact-active
+    if (!contactableA->IsContactActive() && !contactableB->IsContactActive())
+        return;
+
+    // Check that the two collision models are compatible with complementarity contact.
+    if (mat1->GetContactMethod() != ChContactMethod::NSC || mat2->GetContactMethod() != ChContactMethod::NSC) {
+        return;
+    }
+
+    // Create the composite material
+    ChMaterialCompositeNSC cmat(GetSystem()->composition_strategy.get(),
+                                std::static_pointer_cast<ChMaterialSurfaceNSC>(mat1),
+                                std::static_pointer_cast<ChMaterialSurfaceNSC>(mat2));
+
+    InsertContact(cinfo, cmat);
+}
+
+void ChContactContainerNSCpooled::AddContact(const ChCollisionInfo& cinfo) {
+    assert(cinfo.modelA->GetContactable());
+    assert(cinfo.modelB->GetContactable());
+
+    auto contactableA = cinfo.modelA->GetContactable();
+    auto contactableB = cinfo.modelB->GetContactable();
+
+    // Do nothing if any of the contactables is not contact-active
+    if (!contactableA->IsContactActive() && !contactableB->IsContactActive())
+        return;
+
+    // Check that the two collision models are compatible with complementarity contact.
+    if (cinfo.shapeA->GetContactMethod() != ChContactMethod::NSC ||
+        cinfo.shapeB->GetContactMethod() != ChContactMethod::NSC) {
+        return;
+    }
+
+    // Create the composite material
+    ChMaterialCompositeNSC cmat(GetSystem()->composition_strategy.get(),
+                                std::static_pointer_cast<ChMaterialSurfaceNSC>(cinfo.shapeA->GetMaterial()),
+                                std::static_pointer_cast<ChMaterialSurfaceNSC>(cinfo.shapeB->GetMaterial()));
+
+    // Check for a user-provided callback to modify the material
+    if (GetAddContactCallback()) {
+        GetAddContactCallback()->OnAddContact(cinfo, &cmat);
+    }
+
+    InsertContact(cinfo, cmat);
+}
+
+void ChContactContainerNSCpooled::InsertContact(const ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat) {
+    auto contactableA = cinfo.modelA->GetContactable();
+    auto contactableB = cinfo.modelB->GetContactable();
+
+    // CREATE THE CONTACTS
+    //
+    // Switch among the various cases of contacts: i.e. between a 6-dof variable and another 6-dof variable,
+    // or 6 vs 3, etc.
+    // These cases are made distinct to exploit the optimization coming from templates and static data sizes
+    // in contact types.
+    //
+    // Notes:
+    // 1. this was formerly implemented using dynamic casting and introduced a performance bottleneck.
+    // 2. use a switch only for the outer level (nested switch negatively affects performance)
+
+    switch (contactableA->GetContactableType()) {
+        case ChContactable::CONTACTABLE_3: {
+            auto objA = static_cast<ChContactable_1vars<3>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 3_3
+                arena_3_3.Acquire(this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 3_6 -> 6_3
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                arena_6_3.Acquire(this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 3_333 -> 333_3
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                arena_333_3.Acquire(this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 3_666 -> 666_3
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                arena_666_3.Acquire(this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_6: {
+            auto objA = static_cast<ChContactable_1vars<6>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 6_3
+                arena_6_3.Acquire(this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 6_6    ***NOTE: for body-body one could have rolling friction: ***
+                if (cmat.rolling_friction || cmat.spinning_friction) {
+                    arena_6_6_rolling.Acquire(this, objA, objB, cinfo, cmat);
+                } else {
+                    arena_6_6.Acquire(this, objA, objB, cinfo, cmat);
+                }
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 6_333 -> 333_6
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                arena_333_6.Acquire(this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 6_666 -> 666_6
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                arena_666_6.Acquire(this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_333: {
+            auto objA = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 333_3
+                arena_333_3.Acquire(this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 333_6
+                arena_333_6.Acquire(this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 333_333
+                arena_333_333.Acquire(this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 333_666 -> 666_333
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                arena_666_333.Acquire(this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_666: {
+            auto objA = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 666_3
+                arena_666_3.Acquire(this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 666_6
+                arena_666_6.Acquire(this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 666_333
+                arena_666_333.Acquire(this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 666_666
+                arena_666_666.Acquire(this, objA, objB, cinfo, cmat);
+            }
+        } break;
+
+        default:
+            break;
+    }  // switch (contactableA->GetContactableType())
+}
+
+void ChContactContainerNSCpooled::ComputeContactForces() {
+    contact_forces.clear();
+    for (size_t i = 0; i < arena_6_6.size(); i++)
+        SumContactForce(arena_6_6[i], contact_forces);
+    for (size_t i = 0; i < arena_6_3.size(); i++)
+        SumContactForce(arena_6_3[i], contact_forces);
+    for (size_t i = 0; i < arena_3_3.size(); i++)
+        SumContactForce(arena_3_3[i], contact_forces);
+    for (size_t i = 0; i < arena_333_3.size(); i++)
+        SumContactForce(arena_333_3[i], contact_forces);
+    for (size_t i = 0; i < arena_333_6.size(); i++)
+        SumContactForce(arena_333_6[i], contact_forces);
+    for (size_t i = 0; i < arena_333_333.size(); i++)
+        SumContactForce(arena_333_333[i], contact_forces);
+    for (size_t i = 0; i < arena_666_3.size(); i++)
+        SumContactForce(arena_666_3[i], contact_forces);
+    for (size_t i = 0; i < arena_666_6.size(); i++)
+        SumContactForce(arena_666_6[i], contact_forces);
+    for (size_t i = 0; i < arena_666_333.size(); i++)
+        SumContactForce(arena_666_333[i], contact_forces);
+    for (size_t i = 0; i < arena_666_666.size(); i++)
+        SumContactForce(arena_666_666[i], contact_forces);
+    for (size_t i = 0; i < arena_6_6_rolling.size(); i++)
+        SumContactForce(arena_6_6_rolling[i], contact_forces);
+}
+
+template <class Tcont>
+void _ReportAllContacts(ChContactArena<Tcont>& arena, ChContactContainer::ReportContactCallback* mcallback) {
+    arena.ForEach([mcallback](Tcont& contact) {
+        return mcallback->OnReportContact(contact.GetContactP1(), contact.GetContactP2(), contact.GetContactPlane(),
+                                          contact.GetContactDistance(), contact.GetEffectiveCurvatureRadius(),
+                                          contact.GetContactForce(), VNULL, contact.GetObjA(), contact.GetObjB());
+    });
+}
+
+template <class Tcont>
+void _ReportAllContactsRolling(ChContactArena<Tcont>& arena, ChContactContainer::ReportContactCallback* mcallback) {
+    arena.ForEach([mcallback](Tcont& contact) {
+        return mcallback->OnReportContact(contact.GetContactP1(), contact.GetContactP2(), contact.GetContactPlane(),
+                                          contact.GetContactDistance(), contact.GetEffectiveCurvatureRadius(),
+                                          contact.GetContactForce(), contact.GetContactTorque(), contact.GetObjA(),
+                                          contact.GetObjB());
+    });
+}
+
+void ChContactContainerNSCpooled::ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) {
+    _ReportAllContacts(arena_6_6, callback.get());
+    _ReportAllContacts(arena_6_3, callback.get());
+    _ReportAllContacts(arena_3_3, callback.get());
+    _ReportAllContacts(arena_333_3, callback.get());
+    _ReportAllContacts(arena_333_6, callback.get());
+    _ReportAllContacts(arena_333_333, callback.get());
+    _ReportAllContacts(arena_666_3, callback.get());
+    _ReportAllContacts(arena_666_6, callback.get());
+    _ReportAllContacts(arena_666_333, callback.get());
+    _ReportAllContacts(arena_666_666, callback.get());
+    _ReportAllContactsRolling(arena_6_6_rolling, callback.get());
+}
+
+template <class Tcont>
+void _ReportAllContactsNSC(ChContactArena<Tcont>& arena,
+                           ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    arena.ForEach([mcallback](Tcont& contact) {
+        return mcallback->OnReportContact(contact.GetContactP1(), contact.GetContactP2(), contact.GetContactPlane(),
+                                          contact.GetContactDistance(), contact.GetEffectiveCurvatureRadius(),
+                                          contact.GetContactForce(), VNULL, contact.GetObjA(), contact.GetObjB(),
+                                          contact.GetConstraintNx()->GetOffset());
+    });
+}
+
+template <class Tcont>
+void _ReportAllContactsRollingNSC(ChContactArena<Tcont>& arena,
+                                  ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    arena.ForEach([mcallback](Tcont& contact) {
+        return mcallback->OnReportContact(contact.GetContactP1(), contact.GetContactP2(), contact.GetContactPlane(),
+                                          contact.GetContactDistance(), contact.GetEffectiveCurvatureRadius(),
+                                          contact.GetContactForce(), contact.GetContactTorque(), contact.GetObjA(),
+                                          contact.GetObjB(), contact.GetConstraintNx()->GetOffset());
+    });
+}
+
+void ChContactContainerNSCpooled::ReportAllContactsNSC(std::shared_ptr<ReportContactCallbackNSC> callback) {
+    _ReportAllContactsNSC(arena_6_6, callback.get());
+    _ReportAllContactsNSC(arena_6_3, callback.get());
+    _ReportAllContactsNSC(arena_3_3, callback.get());
+    _ReportAllContactsNSC(arena_333_3, callback.get());
+    _ReportAllContactsNSC(arena_333_6, callback.get());
+    _ReportAllContactsNSC(arena_333_333, callback.get());
+    _ReportAllContactsNSC(arena_666_3, callback.get());
+    _ReportAllContactsNSC(arena_666_6, callback.get());
+    _ReportAllContactsNSC(arena_666_333, callback.get());
+    _ReportAllContactsNSC(arena_666_666, callback.get());
+    _ReportAllContactsRollingNSC(arena_6_6_rolling, callback.get());
+}
+
+////////// STATE INTERFACE ////
+
+template <class Tcont>
+void _IntStateGatherReactions(unsigned int& coffset,
+                              ChContactArena<Tcont>& arena,
+                              const unsigned int off_L,
+                              ChVectorDynamic<>& L,
+                              const int stride) {
+    arena.ForEach([&](Tcont& contact) {
+        contact.ContIntStateGatherReactions(off_L + coffset, L);
+        coffset += stride;
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _IntStateGatherReactions(coffset, arena_6_6, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_6_3, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_3_3, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_333_3, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_333_6, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_333_333, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_666_3, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_666_6, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_666_333, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_666_666, off_L, L, 3);
+    _IntStateGatherReactions(coffset, arena_6_6_rolling, off_L, L, 6);
+}
+
+template <class Tcont>
+void _IntStateScatterReactions(unsigned int& coffset,
+                               ChContactArena<Tcont>& arena,
+                               const unsigned int off_L,
+                               const ChVectorDynamic<>& L,
+                               const int stride) {
+    arena.ForEach([&](Tcont& contact) {
+        contact.ContIntStateScatterReactions(off_L + coffset, L);
+        coffset += stride;
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _IntStateScatterReactions(coffset, arena_6_6, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_6_3, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_3_3, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_333_3, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_333_6, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_333_333, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_666_3, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_666_6, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_666_333, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_666_666, off_L, L, 3);
+    _IntStateScatterReactions(coffset, arena_6_6_rolling, off_L, L, 6);
+}
+
+template <class Tcont>
+void _IntLoadResidual_CqL(unsigned int& coffset,         // offset of the contacts
+                          ChContactArena<Tcont>& arena,  // contact arena
+                          const unsigned int off_L,      // offset in L multipliers
+                          ChVectorDynamic<>& R,          // result: the R residual, R += c*Cq'*L
+                          const ChVectorDynamic<>& L,    // the L vector
+                          const double c,                // a scaling factor
+                          const int stride               // stride
+) {
+    arena.ForEach([&](Tcont& contact) {
+        contact.ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
+        coffset += stride;
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::IntLoadResidual_CqL(const unsigned int off_L,
+                                                      ChVectorDynamic<>& R,
+                                                      const ChVectorDynamic<>& L,
+                                                      const double c) {
+    unsigned int coffset = 0;
+    _IntLoadResidual_CqL(coffset, arena_6_6, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_6_3, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_3_3, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_333_3, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_333_6, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_333_333, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_666_3, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_666_6, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_666_333, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_666_666, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, arena_6_6_rolling, off_L, R, L, c, 6);
+}
+
+template <class Tcont>
+void _IntLoadConstraint_C(unsigned int& coffset,         // contact offset
+                          ChContactArena<Tcont>& arena,  // contact arena
+                          const unsigned int off,        // offset in Qc residual
+                          ChVectorDynamic<>& Qc,         // result: the Qc residual, Qc += c*C
+                          const double c,                // a scaling factor
+                          bool do_clamp,                 // apply clamping to c*C?
+                          double recovery_clamp,         // value for min/max clamping of c*C
+                          const int stride               // stride
+) {
+    arena.ForEach([&](Tcont& contact) {
+        contact.ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
+        coffset += stride;
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::IntLoadConstraint_C(const unsigned int off,
+                                                      ChVectorDynamic<>& Qc,
+                                                      const double c,
+                                                      bool do_clamp,
+                                                      double recovery_clamp) {
+    unsigned int coffset = 0;
+    _IntLoadConstraint_C(coffset, arena_6_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_6_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_3_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_333_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_333_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_333_333, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_666_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_666_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_666_333, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_666_666, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, arena_6_6_rolling, off, Qc, c, do_clamp, recovery_clamp, 6);
+}
+
+template <class Tcont>
+void _IntToDescriptor(unsigned int& coffset,
+                      ChContactArena<Tcont>& arena,
+                      const unsigned int off_L,
+                      const ChVectorDynamic<>& L,
+                      const ChVectorDynamic<>& Qc,
+                      const int stride) {
+    arena.ForEach([&](Tcont& contact) {
+        contact.ContIntToDescriptor(off_L + coffset, L, Qc);
+        coffset += stride;
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::IntToDescriptor(const unsigned int off_v,
+                                                  const ChStateDelta& v,
+                                                  const ChVectorDynamic<>& R,
+                                                  const unsigned int off_L,
+                                                  const ChVectorDynamic<>& L,
+                                                  const ChVectorDynamic<>& Qc) {
+    unsigned int coffset = 0;
+    _IntToDescriptor(coffset, arena_6_6, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_6_3, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_3_3, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_333_3, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_333_6, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_333_333, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_666_3, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_666_6, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_666_333, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_666_666, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, arena_6_6_rolling, off_L, L, Qc, 6);
+}
+
+template <class Tcont>
+void _IntFromDescriptor(unsigned int& coffset,
+                        ChContactArena<Tcont>& arena,
+                        const unsigned int off_L,
+                        ChVectorDynamic<>& L,
+                        const int stride) {
+    arena.ForEach([&](Tcont& contact) {
+        contact.ContIntFromDescriptor(off_L + coffset, L);
+        coffset += stride;
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::IntFromDescriptor(const unsigned int off_v,
+                                                    ChStateDelta& v,
+                                                    const unsigned int off_L,
+                                                    ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _IntFromDescriptor(coffset, arena_6_6, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_6_3, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_3_3, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_333_3, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_333_6, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_333_333, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_666_3, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_666_6, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_666_333, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_666_666, off_L, L, 3);
+    _IntFromDescriptor(coffset, arena_6_6_rolling, off_L, L, 6);
+}
+
+// SOLVER INTERFACES
+
+template <class Tcont>
+void _InjectConstraints(ChContactArena<Tcont>& arena, ChSystemDescriptor& mdescriptor) {
+    arena.ForEach([&](Tcont& contact) {
+        contact.InjectConstraints(mdescriptor);
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::InjectConstraints(ChSystemDescriptor& mdescriptor) {
+    _InjectConstraints(arena_6_6, mdescriptor);
+    _InjectConstraints(arena_6_3, mdescriptor);
+    _InjectConstraints(arena_3_3, mdescriptor);
+    _InjectConstraints(arena_333_3, mdescriptor);
+    _InjectConstraints(arena_333_6, mdescriptor);
+    _InjectConstraints(arena_333_333, mdescriptor);
+    _InjectConstraints(arena_666_3, mdescriptor);
+    _InjectConstraints(arena_666_6, mdescriptor);
+    _InjectConstraints(arena_666_333, mdescriptor);
+    _InjectConstraints(arena_666_666, mdescriptor);
+    _InjectConstraints(arena_6_6_rolling, mdescriptor);
+}
+
+template <class Tcont>
+void _ConstraintsBiReset(ChContactArena<Tcont>& arena) {
+    arena.ForEach([](Tcont& contact) {
+        contact.ConstraintsBiReset();
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::ConstraintsBiReset() {
+    _ConstraintsBiReset(arena_6_6);
+    _ConstraintsBiReset(arena_6_3);
+    _ConstraintsBiReset(arena_3_3);
+    _ConstraintsBiReset(arena_333_3);
+    _ConstraintsBiReset(arena_333_6);
+    _ConstraintsBiReset(arena_333_333);
+    _ConstraintsBiReset(arena_666_3);
+    _ConstraintsBiReset(arena_666_6);
+    _ConstraintsBiReset(arena_666_333);
+    _ConstraintsBiReset(arena_666_666);
+    _ConstraintsBiReset(arena_6_6_rolling);
+}
+
+template <class Tcont>
+void _ConstraintsBiLoad_C(ChContactArena<Tcont>& arena, double factor, double recovery_clamp, bool do_clamp) {
+    arena.ForEach([&](Tcont& contact) {
+        contact.ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
+    _ConstraintsBiLoad_C(arena_6_6, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_6_3, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_3_3, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_333_3, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_333_6, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_333_333, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_666_3, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_666_6, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_666_333, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_666_666, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(arena_6_6_rolling, factor, recovery_clamp, do_clamp);
+}
+
+template <class Tcont>
+void _ConstraintsFetch_react(ChContactArena<Tcont>& arena, double factor) {
+    arena.ForEach([factor](Tcont& contact) {
+        contact.ConstraintsFetch_react(factor);
+        return true;
+    });
+}
+
+void ChContactContainerNSCpooled::ConstraintsFetch_react(double factor) {
+    _ConstraintsFetch_react(arena_6_6, factor);
+    _ConstraintsFetch_react(arena_6_3, factor);
+    _ConstraintsFetch_react(arena_3_3, factor);
+    _ConstraintsFetch_react(arena_333_3, factor);
+    _ConstraintsFetch_react(arena_333_6, factor);
+    _ConstraintsFetch_react(arena_333_333, factor);
+    _ConstraintsFetch_react(arena_666_3, factor);
+    _ConstraintsFetch_react(arena_666_6, factor);
+    _ConstraintsFetch_react(arena_666_333, factor);
+    _ConstraintsFetch_react(arena_666_666, factor);
+    _ConstraintsFetch_react(arena_6_6_rolling, factor);
+}
+
+void ChContactContainerNSCpooled::ArchiveOut(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChContactContainerNSCpooled>();
+    // serialize parent class
+    ChContactContainerNSC::ArchiveOut(marchive);
+    // serialize all member data:
+    // NO SERIALIZATION of contact arenas because assume they are volatile and generated when needed
+}
+
+/// Method to allow de serialization of transient data from archives.
+void ChContactContainerNSCpooled::ArchiveIn(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/marchive.VersionRead<ChContactContainerNSCpooled>();
+    // deserialize parent class
+    ChContactContainerNSC::ArchiveIn(marchive);
+    // stream in all member data:
+    RemoveAllContacts();
+    // NO SERIALIZATION of contact arenas because assume they are volatile and generated when needed
+}
+
+}  // end namespace chrono
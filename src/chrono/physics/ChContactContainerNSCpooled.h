@@ -0,0 +1,234 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CONTACTCONTAINER_NSC_POOLED_H
+#define CH_CONTACTCONTAINER_NSC_POOLED_H
+
+#include <new>
+#include <vector>
+
+#include "chrono/physics/ChContactContainerNSC.h"
+
+namespace chrono {
+
+/// Arena of contact objects of a given type.
+/// Contacts are constructed in place into large, contiguous chunks of memory which are never moved or released while
+/// the arena is alive. Objects are therefore never reallocated when the number of contacts changes between steps:
+/// Rewind() marks all contacts as free and Acquire() reinitializes them (via their Reset() function) in the order in
+/// which they are requested. Pointers to contacts (e.g. constraints registered in the system descriptor) stay valid
+/// until Clear() is called.
+template <class Tcont>
+class ChContactArena {
+  public:
+    ChContactArena() : n_constructed(0), n_active(0) {}
+    ~ChContactArena() { Clear(); }
+
+    // The arena owns the storage of its contacts and cannot be copied.
+    ChContactArena(const ChContactArena&) = delete;
+    ChContactArena& operator=(const ChContactArena&) = delete;
+
+    /// Number of active contacts (i.e., acquired since the last call to Rewind).
+    size_t size() const { return n_active; }
+
+    /// Number of contact objects constructed in the arena (active or available for reuse).
+    size_t capacity() const { return n_constructed; }
+
+    /// Access the i-th active contact.
+    Tcont& operator[](size_t i) { return chunks[i / chunk_size][i % chunk_size]; }
+    const Tcont& operator[](size_t i) const { return chunks[i / chunk_size][i % chunk_size]; }
+
+    /// Mark all contacts as available for reuse. No memory is released.
+    void Rewind() { n_active = 0; }
+
+    /// Activate a contact, reusing an existing object if possible, or constructing a new one in place.
+    template <class Ta, class Tb>
+    Tcont* Acquire(ChContactContainer* container,
+                   Ta* objA,
+                   Tb* objB,
+                   const ChCollisionInfo& cinfo,
+                   const ChMaterialCompositeNSC& cmat) {
+        Tcont* mc;
+        if (n_active < n_constructed) {
+            mc = &(*this)[n_active];
+            mc->Reset(objA, objB, cinfo, cmat);
+        } else {
+            if (n_constructed == chunks.size() * chunk_size)
+                chunks.push_back(allocator.allocate(chunk_size));
+            mc = &chunks[n_constructed / chunk_size][n_constructed % chunk_size];
+            ::new (static_cast<void*>(mc)) Tcont(container, objA, objB, cinfo, cmat);
+            n_constructed++;
+        }
+        n_active++;
+        return mc;
+    }
+
+    /// Destroy all contact objects and release the arena memory.
+    void Clear() {
+        for (size_t i = 0; i < n_constructed; i++)
+            (*this)[i].~Tcont();
+        for (auto chunk : chunks)
+            allocator.deallocate(chunk, chunk_size);
+        chunks.clear();
+        n_constructed = 0;
+        n_active = 0;
+    }
+
+    /// Apply the specified function to all active contacts, in insertion order.
+    /// Contacts are visited chunk by chunk, i.e. sweeping contiguous memory.
+    template <class Tfunc>
+    bool ForEach(Tfunc func) {
+        size_t remaining = n_active;
+        for (size_t ic = 0; remaining > 0; ic++) {
+            size_t n = remaining < chunk_size ? remaining : chunk_size;
+            Tcont* chunk = chunks[ic];
+            for (size_t i = 0; i < n; i++) {
+                if (!func(chunk[i]))
+                    return false;
+            }
+            remaining -= n;
+        }
+        return true;
+    }
+
+  private:
+    static const size_t chunk_size = 1024;  ///< number of contacts per chunk
+
+    Eigen::aligned_allocator<Tcont> allocator;
+    std::vector<Tcont*> chunks;
+    size_t n_constructed;
+    size_t n_active;
+};
+
+/// Class representing a container of many non-smooth contacts, stored in contiguous memory.
+/// This container is a drop-in replacement for ChContactContainerNSC (install it with ChSystem::SetContactContainer)
+/// and produces the same contacts, in the same order, as the default container. Unlike the latter, contacts of each
+/// contactable pair type are constructed in place into chunked arenas (see ChContactArena) so that:
+/// - no heap allocation is performed per contact, once the arenas have grown to the peak number of contacts;
+/// - all loops over contacts (state, residual and descriptor functions) sweep contiguous memory instead of chasing
+///   the nodes of a linked list of pointers.
+/// Memory is retained across steps and only released by RemoveAllContacts().
+class ChApi ChContactContainerNSCpooled : public ChContactContainerNSC {
+  public:
+    ChContactContainerNSCpooled();
+    ChContactContainerNSCpooled(const ChContactContainerNSCpooled& other);
+    virtual ~ChContactContainerNSCpooled();
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChContactContainerNSCpooled* Clone() const override { return new ChContactContainerNSCpooled(*this); }
+
+    /// Report the number of added contacts.
+    virtual int GetNcontacts() const override;
+
+    /// Remove (delete) all contained contact data and release the contact arenas.
+    virtual void RemoveAllContacts() override;
+
+    /// The collision system will call BeginAddContact() before adding all contacts.
+    /// This rewinds all arenas; existing contact objects are reused in place.
+    virtual void BeginAddContact() override;
+
+    /// Add a contact between two collision shapes, storing it into this container.
+    /// A composite contact material is created from the two given materials.
+    virtual void AddContact(const ChCollisionInfo& cinfo,
+                            std::shared_ptr<ChMaterialSurface> mat1,
+                            std::shared_ptr<ChMaterialSurface> mat2) override;
+
+    /// Add a contact between two collision shapes, storing it into this container.
+    /// A composite contact material is created from the materials of the two colliding shapes.
+    virtual void AddContact(const ChCollisionInfo& cinfo) override;
+
+    /// The collision system will call EndAddContact() after adding all contacts.
+    /// Unused contact objects are kept in the arenas for reuse at the next step. If the contact cache is enabled,
+    /// the new contacts are initialized with the cached reactions.
+    virtual void EndAddContact() override;
+
+    /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
+    /// object.
+    virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
+
+    /// Scan all the NSC contacts and for each contact executes the OnReportContact() function of the provided callback
+    /// object.
+    virtual void ReportAllContactsNSC(std::shared_ptr<ReportContactCallbackNSC> callback) override;
+
+    /// Report the number of scalar unilateral constraints.
+    virtual int GetDOC_d() override;
+
+    /// Compute contact forces on all contactable objects in this container.
+    virtual void ComputeContactForces() override;
+
+    //
+    // STATE FUNCTIONS
+    //
+
+    virtual void IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) override;
+    virtual void IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) override;
+    virtual void IntLoadResidual_CqL(const unsigned int off_L,
+                                     ChVectorDynamic<>& R,
+                                     const ChVectorDynamic<>& L,
+                                     const double c) override;
+    virtual void IntLoadConstraint_C(const unsigned int off,
+                                     ChVectorDynamic<>& Qc,
+                                     const double c,
+                                     bool do_clamp,
+                                     double recovery_clamp) override;
+    virtual void IntToDescriptor(const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const ChVectorDynamic<>& R,
+                                 const unsigned int off_L,
+                                 const ChVectorDynamic<>& L,
+                                 const ChVectorDynamic<>& Qc) override;
+    virtual void IntFromDescriptor(const unsigned int off_v,
+                                   ChStateDelta& v,
+                                   const unsigned int off_L,
+                                   ChVectorDynamic<>& L) override;
+
+    //
+    // SOLVER INTERFACE
+    //
+
+    virtual void InjectConstraints(ChSystemDescriptor& mdescriptor) override;
+    virtual void ConstraintsBiReset() override;
+    virtual void ConstraintsBiLoad_C(double factor = 1, double recovery_clamp = 0.1, bool do_clamp = false) override;
+    virtual void ConstraintsFetch_react(double factor = 1) override;
+
+    //
+    // SERIALIZATION
+    //
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& marchive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& marchive) override;
+
+  protected:
+    ChContactArena<ChContactNSC_6_6> arena_6_6;
+    ChContactArena<ChContactNSC_6_3> arena_6_3;
+    ChContactArena<ChContactNSC_3_3> arena_3_3;
+    ChContactArena<ChContactNSC_333_3> arena_333_3;
+    ChContactArena<ChContactNSC_333_6> arena_333_6;
+    ChContactArena<ChContactNSC_333_333> arena_333_333;
+    ChContactArena<ChContactNSC_666_3> arena_666_3;
+    ChContactArena<ChContactNSC_666_6> arena_666_6;
+    ChContactArena<ChContactNSC_666_333> arena_666_333;
+    ChContactArena<ChContactNSC_666_666> arena_666_666;
+
+    ChContactArena<ChContactNSCrolling_6_6> arena_6_6_rolling;
+
+  private:
+    void InsertContact(const ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat);
+};
+
+CH_CLASS_VERSION(ChContactContainerNSCpooled, 0)
+
+}  // end namespace chrono
+
+#endif
@@ -122,6 +122,10 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector<> GetContactForce() const override { return react_force; }
 
+    /// Set the contact reactions, in contact coordinate system (e.g., to warm start an iterative solver).
+    /// The torque is only used by contacts with rolling and spinning resistance.
+    virtual void SetContactReactions(const ChVector<>& force, const ChVector<>& torque) { react_force = force; }
+
     /// Get the contact friction coefficient
     virtual double GetFriction() { return Nx.GetFrictionCoefficient(); }
 
@@ -104,8 +104,14 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
         this->react_torque = VNULL;
     }
 
-    /// Get the contact force, if computed, in contact coordinate system
-    virtual ChVector<> GetContactTorque() { return react_torque; }
+    /// Get the contact torque, if computed, in contact coordinate system
+    virtual ChVector<> GetContactTorque() const override { return react_torque; }
+
+    /// Set the contact reactions, in contact coordinate system (e.g., to warm start an iterative solver).
+    virtual void SetContactReactions(const ChVector<>& force, const ChVector<>& torque) override {
+        this->react_force = force;
+        react_torque = torque;
+    }
 
     /// Get the contact rolling friction coefficient
     virtual float GetRollingFriction() { return Rx.GetRollingFrictionCoefficient(); }
@@ -27,6 +27,7 @@ ChLink::ChLink(const ChLink& other) : ChLinkBase(other) {
 
     react_force = other.react_force;
     react_torque = other.react_torque;
+    sleeping = false;
 }
 
 void ChLink::UpdateTime(double time) {
@@ -37,9 +37,10 @@ class ChApi ChLink : public ChLinkBase {
     ChBodyFrame* Body2;       ///< second connected body
     ChVector<> react_force;   ///< store the xyz reactions, expressed in local coordinate system of link;
     ChVector<> react_torque;  ///< store the torque reactions, expressed in local coordinate system of link;
+    bool sleeping;            ///< both bodies are inactive and at least one is sleeping (set by the owner ChSystem)
 
   public:
-    ChLink() : Body1(NULL), Body2(NULL), react_force(VNULL), react_torque(VNULL) {}
+    ChLink() : Body1(NULL), Body2(NULL), react_force(VNULL), react_torque(VNULL), sleeping(false) {}
     ChLink(const ChLink& other);
     virtual ~ChLink() {}
 
@@ -52,6 +53,11 @@ class ChApi ChLink : public ChLinkBase {
     /// Get the number of scalar variables affected by constraints in this link
     virtual int GetNumCoords() override { return 12; }
 
+    /// Tell if the link is active. Besides the conditions in ChLinkBase, a link connecting two inactive bodies, at least
+    /// one of which is sleeping, is not active (it is excluded from the system until the bodies are woken up).
+    /// The sleeping state of the link is refreshed by the owner system at each sleeping check.
+    virtual bool IsActive() const override { return ChLinkBase::IsActive() && !sleeping; }
+
     /// Get the constrained body '1', the 'slave' body.
     ChBodyFrame* GetBody1() { return Body1; }
     /// Get the constrained body '2', the 'master' body.
@@ -103,6 +109,8 @@ class ChApi ChLink : public ChLinkBase {
 
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
+
+    friend class ChSystem;
 };
 
 CH_CLASS_VERSION(ChLink,0)
@@ -81,6 +81,11 @@ class ChApi ChLinkMateGeneric : public ChLinkMate {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMateGeneric* Clone() const override { return new ChLinkMateGeneric(*this); }
 
+    /// A mate only reads the states of the two connected bodies and modifies its own constraint data, so it can be
+    /// updated concurrently with other links. Classes derived from ChLinkMateGeneric (e.g., motors) are processed
+    /// serially unless they override this function.
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMateGeneric>(); }
+
     /// Get the link coordinate system, expressed relative to Body2 (the 'master'
     /// body). This represents the 'main' reference of the link: reaction forces
     /// are expressed in this coordinate system.
@@ -286,6 +291,9 @@ class ChApi ChLinkMatePlane : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMatePlane* Clone() const override { return new ChLinkMatePlane(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMatePlane>(); }
+
     /// Tell if the two normals must be opposed (flipped=false) or must have the same verse (flipped=true)
     void SetFlipped(bool doflip);
     bool IsFlipped() const { return flipped; }
@@ -336,6 +344,9 @@ class ChApi ChLinkMateCoaxial : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMateCoaxial* Clone() const override { return new ChLinkMateCoaxial(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMateCoaxial>(); }
+
     /// Tell if the two axes must be opposed (flipped=false) or must have the same verse (flipped=true)
     void SetFlipped(bool doflip);
     bool IsFlipped() const { return flipped; }
@@ -377,6 +388,9 @@ class ChApi ChLinkMateRevolute : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMateRevolute* Clone() const override { return new ChLinkMateRevolute(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMateRevolute>(); }
+
     using ChLinkMateGeneric::Initialize;
 
     /// Tell if the two axes must be opposed (flipped=false) or must have the same verse (flipped=true)
@@ -430,6 +444,9 @@ class ChApi ChLinkMatePrismatic : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMatePrismatic* Clone() const override { return new ChLinkMatePrismatic(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMatePrismatic>(); }
+
     using ChLinkMateGeneric::Initialize;
 
     /// Tell if the two axes must be opposed (flipped=false) or must have the same verse (flipped=true)
@@ -480,6 +497,9 @@ class ChApi ChLinkMateSpherical : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMateSpherical* Clone() const override { return new ChLinkMateSpherical(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMateSpherical>(); }
+
     using ChLinkMateGeneric::Initialize;
 
     /// Specialized initialization for coincident mate, given the two bodies to be connected, and two points
@@ -510,6 +530,9 @@ class ChApi ChLinkMateXdistance : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMateXdistance* Clone() const override { return new ChLinkMateXdistance(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMateXdistance>(); }
+
     /// Set the distance on X of frame 2
     void SetDistance(double msep) { distance = msep; }
     /// Get the requested distance on X of frame 2
@@ -558,6 +581,9 @@ class ChApi ChLinkMateParallel : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMateParallel* Clone() const override { return new ChLinkMateParallel(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMateParallel>(); }
+
     /// Tell if the two axes must be opposed (flipped=false) or must have the same verse (flipped=true)
     void SetFlipped(bool doflip);
     bool IsFlipped() const { return flipped; }
@@ -603,6 +629,9 @@ class ChApi ChLinkMateOrthogonal : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMateOrthogonal* Clone() const override { return new ChLinkMateOrthogonal(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMateOrthogonal>(); }
+
     /// Specialized initialization for orthogonal mate, given the two bodies to be connected, two points and two
     /// directions (each expressed in body or abs. coordinates).
     virtual void Initialize(std::shared_ptr<ChBodyFrame> mbody1,  ///< first body to link
@@ -640,6 +669,9 @@ class ChApi ChLinkMateFix : public ChLinkMateGeneric {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChLinkMateFix* Clone() const override { return new ChLinkMateFix(*this); }
 
+    /// This mate can be updated concurrently with other links (see ChLinkMateGeneric::IsThreadSafe).
+    virtual bool IsThreadSafe() const override { return IsExactType<ChLinkMateFix>(); }
+
     using ChLinkMateGeneric::Initialize;
 
     /// Specialized initialization for "fix" mate, given the two bodies to be connected, the positions of the two
@@ -50,6 +50,10 @@ class ChApi ChLinkMotor : public ChLinkMateGeneric {
     /// Update state of the LinkMotor.
     virtual void Update(double mytime, bool update_assets) override;
 
+    /// Motors are processed serially: some apply loads directly to the connected bodies, and the motor function may be
+    /// shared with other items.
+    virtual bool IsThreadSafe() const override { return false; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& marchive) override;
 
@@ -119,6 +119,14 @@ class ChApi ChLoadBase : public ChObj {
     /// the jacobians of the load.
     virtual bool IsStiff() = 0;
 
+    /// Append to the given list the loadable objects on which this load acts.
+    /// Default: none. Used by the system to manage sleeping bodies.
+    virtual void GetLoadables(std::vector<std::shared_ptr<ChLoadable>>& mloadables) {}
+
+    /// Report if the generalized load Q, as computed at the last update, is null.
+    /// Default: true. Used by the system to wake up sleeping bodies subject to loads.
+    virtual bool IsLoadNull() { return true; }
+
     //
     // Functions for interfacing to the state bookkeeping and solver
     //
@@ -190,7 +198,9 @@ class ChLoad : public ChLoadBase {
                           ) override;
 
     /// Compute jacobians (default fallback).
-    /// Uses a numerical differentiation for computing K, R, M jacobians, if stiff load.
+    /// Uses a numerical differentiation for computing K, R, M jacobians, if stiff load, unless the loader
+    /// supports automatic differentiation (see ChLoader::ComputeJacobianAD), in which case exact K and R jacobians are
+    /// obtained.
     /// If possible, override this with an analytical jacobian.
     /// Compute the K=-dQ/dx, R=-dQ/dv , M=-dQ/da jacobians.
     /// Note the sign that is flipped because assuming Q a right hand side, and dQ/d... at left hand side!
@@ -223,6 +233,11 @@ class ChLoad : public ChLoadBase {
     /// Default: load is stiff if the loader is stiff. Override if needed.
     virtual bool IsStiff() override { return loader.IsStiff(); }
 
+    virtual void GetLoadables(std::vector<std::shared_ptr<ChLoadable>>& mloadables) override {
+        mloadables.push_back(loader.GetLoadable());
+    }
+    virtual bool IsLoadNull() override { return loader.Q.isZero(); }
+
     /// Create the jacobian loads if needed, and also
     /// set the ChVariables referenced by the sparse KRM block.
     virtual void CreateJacobianMatrices() override;
@@ -288,6 +303,11 @@ class ChApi ChLoadCustom : public ChLoadBase {
 
     /// Access the generalized load vector Q.
     virtual ChVectorDynamic<>& GetQ() { return load_Q; }
+
+    virtual void GetLoadables(std::vector<std::shared_ptr<ChLoadable>>& mloadables) override {
+        mloadables.push_back(loadable);
+    }
+    virtual bool IsLoadNull() override { return load_Q.isZero(); }
 };
 
 // -----------------------------------------------------------------------------
@@ -359,6 +379,11 @@ class ChApi ChLoadCustomMultiple : public ChLoadBase {
 
     /// Access the generalized load vector Q.
     virtual ChVectorDynamic<>& GetQ() { return load_Q; }
+
+    virtual void GetLoadables(std::vector<std::shared_ptr<ChLoadable>>& mloadables) override {
+        mloadables.insert(mloadables.end(), loadables.begin(), loadables.end());
+    }
+    virtual bool IsLoadNull() override { return load_Q.isZero(); }
 };
 
 // =============================================================================
@@ -406,11 +431,15 @@ inline void ChLoad<Tloader>::ComputeJacobian(ChState* state_x,
                                              ChMatrixRef mK,
                                              ChMatrixRef mR,
                                              ChMatrixRef mM) {
-    double Delta = 1e-8;
-
     int mrows_w = this->LoadGet_ndof_w();
     int mrows_x = this->LoadGet_ndof_x();
 
+    // use automatic differentiation if the loader supports it (only if position increments are additive, dx = dw)
+    if (mrows_x == mrows_w && this->loader.ComputeJacobianAD(*state_x, *state_w, mK, mR))
+        return;
+
+    double Delta = 1e-8;
+
     // compute Q at current speed & position, x_0, v_0
     ChVectorDynamic<> Q0(mrows_w);
     this->loader.ComputeQ(state_x, state_w);  // Q0 = Q(x, v)
@@ -139,6 +139,14 @@ void ChLoadBodyMesh::CreateJacobianMatrices() {
     }
 }
 
+bool ChLoadBodyMesh::IsLoadNull() {
+    for (auto& force : forces) {
+        if (!force->IsLoadNull())
+            return false;
+    }
+    return true;
+}
+
 void ChLoadBodyMesh::LoadIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
     for (int i = 0; i < forces.size(); ++i) {
         forces[i]->LoadIntLoadResidual_F(R, c);
@@ -95,6 +95,11 @@ class ChApi ChLoadBodyMesh : public ChLoadBase {
     virtual bool IsStiff() override { return false; }
 
     virtual void CreateJacobianMatrices() override;
+
+    virtual void GetLoadables(std::vector<std::shared_ptr<ChLoadable>>& mloadables) override {
+        mloadables.push_back(contactbody);
+    }
+    virtual bool IsLoadNull() override;
     virtual void LoadIntLoadResidual_F(ChVectorDynamic<>& R, double c) override;
     virtual void LoadIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, double c) override {}
     virtual void LoadIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, double& err, double c) override {}
@@ -136,6 +136,21 @@ class ChApi ChLoadableUV : virtual public ChLoadable {
     /// If true, use quadrature over u,v in [0..1] range as triangle area coords (with z=1-u-v)
     /// otherwise use default quadrature over u,v in [-1..+1] as rectangular isoparametric coords.
     virtual bool IsTriangleIntegrationNeeded() { return false; }
+
+    /// Optional: for a surface whose position is a linear combination of the 3-coordinate blocks x_i of the position
+    /// state, x(u,v) = sum_i N_i(u,v)*x_i (e.g. node positions, or positions and gradients of ANCF nodes), return the
+    /// shape functions N and their derivatives dN/du and dN/dv at U,V, one per block. This must be consistent with
+    /// ComputeNF and ComputeNormal, i.e. the normal times det[J] is the cross product of dx/du and dx/dv. Used by
+    /// loaders that evaluate the generalized load for a generic state, e.g. for automatic differentiation. Return
+    /// false if not supported (default), e.g. for states with rotation coordinates.
+    virtual bool ComputeShapeFunctionsUV(const double U,          ///< parametric coordinate in surface
+                                         const double V,          ///< parametric coordinate in surface
+                                         ChVectorDynamic<>& N,    ///< shape functions, one per node
+                                         ChVectorDynamic<>& dNdu, ///< derivatives of shape functions w.r.t. U
+                                         ChVectorDynamic<>& dNdv  ///< derivatives of shape functions w.r.t. V
+    ) {
+        return false;
+    }
 };
 
 /// Interface for objects that can be subject to line loads,
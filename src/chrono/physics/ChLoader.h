@@ -25,6 +25,11 @@ namespace chrono {
 /// a ChBody, the load is a wrench (force+torque), for a tetrahedron FE it is a force, etc.
 /// Objects of this class must be capable of computing the generalized load Q from
 /// the load F.
+///
+/// By default, the Jacobians of stiff loads are computed by ChLoad with numerical differentiation of ComputeQ().
+/// A loader can opt in to exact Jacobians, obtained by forward-mode automatic differentiation, by overriding
+/// ComputeJacobianAD(). See ChLoaderAD.h for the utilities to implement it from a function template evaluating Q
+/// for a generic scalar type.
 
 class ChLoader {
   public:
@@ -39,6 +44,18 @@ class ChLoader {
     virtual std::shared_ptr<ChLoadable> GetLoadable() = 0;
 
     virtual bool IsStiff() { return false; }
+
+    /// Compute the jacobians K=-dQ/dx and R=-dQ/dv at the given state by automatic differentiation, if supported by
+    /// this loader, and also set Q to the load at that state.
+    /// Called by ChLoad only for loadables whose position increments are additive (with as many position coordinates
+    /// as speed coordinates, such as xyz nodes). Return false to fall back to numerical differentiation (default).
+    virtual bool ComputeJacobianAD(const ChVectorDynamic<>& state_x,  ///< state position to evaluate jacobians
+                                   const ChVectorDynamic<>& state_w,  ///< state speed to evaluate jacobians
+                                   ChMatrixRef K,                     ///< result -dQ/dx
+                                   ChMatrixRef R                      ///< result -dQ/dv
+    ) {
+        return false;
+    }
 };
 
 }  // end namespace chrono
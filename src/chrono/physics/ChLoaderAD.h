@@ -0,0 +1,113 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHLOADER_AD_H
+#define CHLOADER_AD_H
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "chrono/core/ChDual.h"
+#include "chrono/physics/ChLoader.h"
+
+namespace chrono {
+
+/// Dual number type used for the jacobians of loads by automatic differentiation.
+/// Each evaluation of the loader provides the derivatives with respect to 8 state coordinates.
+typedef ChDual<8> ChLoadDual;
+
+/// Type trait telling if a loader provides ComputeQ_AD() (see ChLoaderComputeJacobianAD).
+template <class Tloader, class = void>
+struct ChLoaderHasAD : std::false_type {};
+
+template <class Tloader>
+struct ChLoaderHasAD<Tloader,
+                     decltype(std::declval<Tloader&>().template ComputeQ_AD<ChLoadDual>(
+                                  std::declval<const ChVectorDynamic<ChLoadDual>&>(),
+                                  std::declval<const ChVectorDynamic<ChLoadDual>&>(),
+                                  std::declval<ChVectorDynamic<ChLoadDual>&>()),
+                              void())> : std::true_type {};
+
+/// Compute the jacobians K=-dQ/dx and R=-dQ/dv of a loader by forward-mode automatic differentiation.
+/// The loader must provide a member function template that evaluates Q for a given packed state on a generic scalar
+/// type, returning false if this is not possible (e.g. not supported by its loadable):
+/// <pre>
+///    template <typename Real>
+///    bool ComputeQ_AD(const ChVectorDynamic<Real>& state_x,  // state position
+///                     const ChVectorDynamic<Real>& state_w,  // state speed
+///                     ChVectorDynamic<Real>& Q);             // resulting generalized load
+/// </pre>
+/// This function evaluates it once with dual numbers per chunk of ChLoadDual::size state coordinates. It is meant to be
+/// called from the loader's override of ChLoader::ComputeJacobianAD(), which must be implemented in a single
+/// translation unit (or inline in the loader header, including this file).
+/// On success, the loader Q is set to the load at the given state.
+template <class Tloader>
+bool ChLoaderComputeJacobianAD(Tloader& loader,
+                               const ChVectorDynamic<>& state_x,
+                               const ChVectorDynamic<>& state_w,
+                               ChMatrixRef K,
+                               ChMatrixRef R) {
+    static_assert(ChLoaderHasAD<Tloader>::value, "loader does not provide ComputeQ_AD()");
+
+    int mrows_x = (int)state_x.size();
+    int mrows_w = (int)state_w.size();
+
+    ChVectorDynamic<ChLoadDual> x(mrows_x);
+    ChVectorDynamic<ChLoadDual> w(mrows_w);
+    ChVectorDynamic<ChLoadDual> Q(mrows_w);
+    for (int i = 0; i < mrows_x; ++i)
+        x(i) = ChLoadDual(state_x(i));
+    for (int i = 0; i < mrows_w; ++i)
+        w(i) = ChLoadDual(state_w(i));
+
+    // Seed a chunk of the (x, v) coordinates at a time; each pass provides as many columns of K and R
+    int nvars = mrows_x + mrows_w;
+    for (int start = 0; start < nvars; start += ChLoadDual::size) {
+        int nseeds = std::min((int)ChLoadDual::size, nvars - start);
+        for (int k = 0; k < nseeds; ++k) {
+            int j = start + k;
+            if (j < mrows_x)
+                x(j).Seed(k);
+            else
+                w(j - mrows_x).Seed(k);
+        }
+
+        if (!loader.ComputeQ_AD(x, w, Q))
+            return false;
+
+        for (int k = 0; k < nseeds; ++k) {
+            int j = start + k;
+            for (int r = 0; r < mrows_w; ++r) {
+                if (j < mrows_x)
+                    K(r, j) = -Q(r).derivative(k);  // - sign because K=-dQ/dx
+                else
+                    R(r, j - mrows_x) = -Q(r).derivative(k);  // - sign because R=-dQ/dv
+            }
+            if (j < mrows_x)
+                x(j).SetDerivatives(0);
+            else
+                w(j - mrows_x).SetDerivatives(0);
+        }
+    }
+
+    // leave the loader with the load at the given state
+    loader.Q.resize(mrows_w);
+    for (int r = 0; r < mrows_w; ++r)
+        loader.Q(r) = Q(r).value();
+
+    return true;
+}
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/physics/ChLoaderUV.h"
+#include "chrono/physics/ChLoaderAD.h"
+
+namespace chrono {
+
+template <typename Real>
+bool ChLoaderPressure::ComputeQ_AD(const ChVectorDynamic<Real>& state_x,
+                                   const ChVectorDynamic<Real>& state_w,
+                                   ChVectorDynamic<Real>& Qad) {
+    int nblocks = (int)state_x.size() / 3;
+    ChVectorDynamic<> N;
+    ChVectorDynamic<> dNdu;
+    ChVectorDynamic<> dNdv;
+
+    Qad.setZero(state_w.size());
+
+    // Add the contribution of a quadrature point:  Q += N' * F * det[J] * weight,
+    // where the pressure force times det[J] is -p * (dx/du x dx/dv)
+    auto add_point = [&](double U, double V, double weight) -> bool {
+        if (!loadable->ComputeShapeFunctionsUV(U, V, N, dNdu, dNdv) || N.size() != nblocks)
+            return false;
+
+        ChVector<Real> xu(Real(0));
+        ChVector<Real> xv(Real(0));
+        for (int i = 0; i < nblocks; i++) {
+            ChVector<Real> xi(state_x(3 * i + 0), state_x(3 * i + 1), state_x(3 * i + 2));
+            xu += xi * Real(dNdu(i));
+            xv += xi * Real(dNdv(i));
+        }
+        ChVector<Real> f = Vcross(xu, xv) * Real(-pressure * weight);
+
+        for (int i = 0; i < nblocks; i++) {
+            Qad(3 * i + 0) += f.x() * N(i);
+            Qad(3 * i + 1) += f.y() * N(i);
+            Qad(3 * i + 2) += f.z() * N(i);
+        }
+        return true;
+    };
+
+    // Use the same quadrature as ChLoaderUVdistributed::ComputeQ
+    if (!loadable->IsTriangleIntegrationNeeded()) {
+        const std::vector<double>& Ulroots = ChQuadrature::GetStaticTables()->Lroots[GetIntegrationPointsU() - 1];
+        const std::vector<double>& Uweight = ChQuadrature::GetStaticTables()->Weight[GetIntegrationPointsU() - 1];
+        const std::vector<double>& Vlroots = ChQuadrature::GetStaticTables()->Lroots[GetIntegrationPointsV() - 1];
+        const std::vector<double>& Vweight = ChQuadrature::GetStaticTables()->Weight[GetIntegrationPointsV() - 1];
+        for (unsigned int iu = 0; iu < Ulroots.size(); iu++) {
+            for (unsigned int iv = 0; iv < Vlroots.size(); iv++) {
+                if (!add_point(Ulroots[iu], Vlroots[iv], Uweight[iu] * Vweight[iv]))
+                    return false;
+            }
+        }
+    } else {
+        const std::vector<double>& Ulroots =
+            ChQuadrature::GetStaticTablesTriangle()->LrootsU[GetIntegrationPointsU() - 1];
+        const std::vector<double>& Vlroots =
+            ChQuadrature::GetStaticTablesTriangle()->LrootsV[GetIntegrationPointsU() - 1];
+        const std::vector<double>& weight = ChQuadrature::GetStaticTablesTriangle()->Weight[GetIntegrationPointsU() - 1];
+        for (unsigned int i = 0; i < Ulroots.size(); i++) {
+            if (!add_point(Ulroots[i], Vlroots[i], weight[i] * (1. / 2.)))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool ChLoaderPressure::ComputeJacobianAD(const ChVectorDynamic<>& state_x,
+                                         const ChVectorDynamic<>& state_w,
+                                         ChMatrixRef K,
+                                         ChMatrixRef R) {
+    return ChLoaderComputeJacobianAD(*this, state_x, state_w, K, R);
+}
+
+}  // end namespace chrono
@@ -174,8 +174,12 @@ class ChLoaderForceOnSurface : public ChLoaderUVatomic {
 };
 
 /// A very usual type of surface loader: the constant pressure load, a 3D per-area force that is aligned to the surface normal.
+/// If the loadable provides its shape functions (see ChLoadableUV::ComputeShapeFunctionsUV), the jacobians of a stiff
+/// pressure load are obtained by automatic differentiation, and include the follower-load stiffness. This is the case of
+/// ChTetrahedronFace and ChElementShellANCF_3423. Other loadables (e.g. ChElementShellReissner4, whose state includes
+/// rotations) use numerical differentiation.
 
-class ChLoaderPressure : public ChLoaderUVdistributed {
+class ChApi ChLoaderPressure : public ChLoaderUVdistributed {
   private:
     double pressure;
     bool is_stiff;
@@ -204,6 +208,18 @@ class ChLoaderPressure : public ChLoaderUVdistributed {
 
     void SetStiff(bool val) { is_stiff = val; }
     virtual bool IsStiff() override { return is_stiff; }
+
+    virtual bool ComputeJacobianAD(const ChVectorDynamic<>& state_x,
+                                   const ChVectorDynamic<>& state_w,
+                                   ChMatrixRef K,
+                                   ChMatrixRef R) override;
+
+    /// Evaluate Q at the given state, for a generic scalar type (see ChLoaderComputeJacobianAD).
+    /// Return false if the loadable does not provide its shape functions.
+    template <typename Real>
+    bool ComputeQ_AD(const ChVectorDynamic<Real>& state_x,
+                     const ChVectorDynamic<Real>& state_w,
+                     ChVectorDynamic<Real>& Qad);
 };
 
 }  // end namespace chrono
@@ -90,6 +90,10 @@ ChVector<> ChLoadBodyForce::GetForce() const {
     return m_force * m_scale;
 }
 
+bool ChLoadBodyForce::IsLoadNull() {
+    return m_force.IsNull() || m_modulation->Get_y(std::dynamic_pointer_cast<ChBody>(loadable)->GetChTime()) == 0;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyTorque
 // -----------------------------------------------------------------------------
@@ -144,6 +148,10 @@ ChVector<> ChLoadBodyTorque::GetTorque() const {
     return m_torque * m_scale;
 }
 
+bool ChLoadBodyTorque::IsLoadNull() {
+    return m_torque.IsNull() || m_modulation->Get_y(std::dynamic_pointer_cast<ChBody>(loadable)->GetChTime()) == 0;
+}
+
 
 
 // -----------------------------------------------------------------------------
@@ -85,6 +85,10 @@ class ChApi ChLoadBodyForce : public ChLoadCustom {
                           ChStateDelta* state_w  ///< state speed to evaluate Q
                           ) override;
 
+    /// Report if the force, as modulated at the current time, is null.
+    /// Unlike Q, this is also evaluated for a sleeping body (so that the load can wake it up).
+    virtual bool IsLoadNull() override;
+
   private:
     ChVector<> m_force;  ///< base force value
     ChVector<> m_point;  ///< application point
@@ -133,6 +137,10 @@ class ChApi ChLoadBodyTorque : public ChLoadCustom {
                           ChStateDelta* state_w  ///< state speed to evaluate Q
                           ) override;
 
+    /// Report if the torque, as modulated at the current time, is null.
+    /// Unlike Q, this is also evaluated for a sleeping body (so that the load can wake it up).
+    virtual bool IsLoadNull() override;
+
   private:
     ChVector<> m_torque;  ///< base torque value
     bool m_local_torque;  ///< is torque expressed in local frame?
@@ -15,6 +15,8 @@
 #ifndef CH_PHYSICSITEM_H
 #define CH_PHYSICSITEM_H
 
+#include <typeinfo>
+
 #include "chrono/core/ChFrame.h"
 #include "chrono/geometry/ChGeometry.h"
 #include "chrono/physics/ChObject.h"
@@ -100,6 +102,19 @@ class ChApi ChPhysicsItem : public ChObj {
     /// Return true if the object is active and included in dynamics.
     virtual bool IsActive() const { return true; }
 
+    /// Return true if this item can be processed concurrently with other items of the same assembly list.
+    /// This is used by a ChAssembly in parallel update mode (see ChAssembly::SetParallelUpdate). A thread-safe item
+    /// guarantees that its Update(), IntStateScatter(), IntStateIncrement() and IntLoadResidual_F() functions:
+    /// - modify only data owned by the item (including its own visual assets and force generators);
+    /// - write only to the entries of the global state and residual vectors at the item's own offsets;
+    /// - read data of other items only if those are processed in an earlier phase (e.g., links reading body states);
+    /// - do not throw exceptions.
+    /// Items that return false (default) are always processed serially. Thread safety is not inherited: a class that
+    /// returns true does so only if the dynamic type of the object is that class itself, so that any derived class
+    /// (which may add shared state, e.g. through a ChFunction) is processed serially unless it also overrides this
+    /// function after verifying the above contract.
+    virtual bool IsThreadSafe() const { return false; }
+
     // Collisions - override these in child classes if needed
 
     /// Tell if the object is subject to collision.
@@ -447,6 +462,12 @@ class ChApi ChPhysicsItem : public ChObj {
     unsigned int offset_w;  ///< offset in vector of state (speed part)
     unsigned int offset_L;  ///< offset in vector of lagrangian multipliers
 
+    /// Utility for IsThreadSafe() overrides: return true if the dynamic type of this object is exactly T.
+    template <class T>
+    bool IsExactType() const {
+        return typeid(*this) == typeid(T);
+    }
+
   private:
     virtual void SetupInitial() {}
 
@@ -103,6 +103,10 @@ class ChApi ChShaft : public ChPhysicsItem, public ChLoadable {
     /// A shaft is inactive if it is fixed to ground or is in sleep mode.
     virtual bool IsActive() const override { return !(sleeping || fixed); }
 
+    /// A shaft only modifies its own state, so it can be updated concurrently with other shafts.
+    /// Classes derived from ChShaft are processed serially unless they override this function.
+    virtual bool IsThreadSafe() const override { return IsExactType<ChShaft>(); }
+
     //
     // FUNCTIONS
     //
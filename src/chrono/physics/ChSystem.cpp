@@ -13,12 +13,16 @@
 // =============================================================================
 
 #include <algorithm>
+#include <functional>
+#include <unordered_map>
 
 #include "chrono/collision/bullet/ChCollisionSystemBullet.h"
 #ifdef CHRONO_COLLISION
     #include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
 #endif
 #include "chrono/assets/ChVisualSystem.h"
+#include "chrono/physics/ChForce.h"
+#include "chrono/physics/ChLoadContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChSolverAPGD.h"
@@ -27,6 +31,7 @@
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
@@ -300,6 +305,12 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::PSSOR:
             solver = chrono_types::make_shared<ChSolverPSSOR>();
             break;
+        case ChSolver::Type::PSOR_COLORED: {
+            auto psor_colored = chrono_types::make_shared<ChSolverPSORcolored>();
+            psor_colored->SetNumThreads(nthreads_chrono);
+            solver = psor_colored;
+            break;
+        }
         case ChSolver::Type::PJACOBI:
             solver = chrono_types::make_shared<ChSolverPJacobi>();
             break;
@@ -428,6 +439,9 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
 
     if (collision_system)
         collision_system->SetNumThreads(nthreads_collision);
+
+    if (auto psor_colored = std::dynamic_pointer_cast<ChSolverPSORcolored>(solver))
+        psor_colored->SetNumThreads(nthreads_chrono);
 }
 
 // -----------------------------------------------------------------------------
@@ -514,132 +528,282 @@ void ChSystem::SetTimestepperType(ChTimestepper::Type type) {
     }
 }
 
+// Sleeping is managed per island, i.e. per connected component of the graph whose nodes are the non-fixed bodies and
+// whose edges are the links, the loads, and the contacts between them. Fixed bodies do not connect islands (bodies
+// resting on the ground form separate islands). An island is at rest if its kinetic energy does not exceed the sum of
+// the thresholds of its bodies (see ChBody::SetSleepMinSpeed and ChBody::SetSleepMinWvel). An island that stays at rest
+// for longer than the sleep time of its bodies is put to sleep as a whole. An island is woken up as a whole if it
+// moves (e.g., a moving body came in contact with one of its sleeping bodies), if one of its bodies is subject to
+// external forces (accumulated forces, ChForce objects, non-stiff loads), or if one of its bodies is in contact with a
+// fixed body that is moved kinematically.
 bool ChSystem::ManageSleepingBodies() {
-    if (!GetUseSleeping())
-        return 0;
+    if (!GetUseSleeping()) {
+        // Reactivate the links deactivated by earlier checks (if sleeping was disabled in the meantime)
+        bool changed = false;
+        for (auto& link : assembly.linklist) {
+            auto clink = dynamic_cast<ChLink*>(link.get());
+            if (clink && clink->sleeping) {
+                clink->sleeping = false;
+                changed = true;
+            }
+        }
+        if (changed)
+            Setup();
+        return changed;
+    }
 
-    // STEP 1:
-    // See if some body could change from no sleep to sleep
+    auto& bodies = assembly.bodylist;
+    int num_bodies = (int)bodies.size();
+    if (num_bodies == 0)
+        return false;
 
-    for (auto& body : assembly.bodylist) {
-        // mark as 'could sleep' candidate
-        body->TrySleeping();
+    // Disjoint-set forest over the bodies (fixed bodies stay singletons and are ignored)
+    std::vector<int> parent(num_bodies);
+    std::unordered_map<ChBody*, int> index;
+    index.reserve(num_bodies);
+    for (int i = 0; i < num_bodies; i++) {
+        parent[i] = i;
+        index[bodies[i].get()] = i;
     }
 
-    // STEP 2:
-    // See if some sleeping or potential sleeping body is touching a non sleeping one; if so, set to no sleep.
+    auto find = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    auto unite = [&parent, &find](int i, int j) {
+        i = find(i);
+        j = find(j);
+        if (i != j)
+            parent[std::max(i, j)] = std::min(i, j);
+    };
+    auto body_index = [&index, &bodies](ChBody* body) {
+        auto it = index.find(body);
+        return (it == index.end() || bodies[it->second]->GetBodyFixed()) ? -1 : it->second;
+    };
 
-    // Make this class for iterating through contacts
-    class _wakeup_reporter_class : public ChContactContainer::ReportContactCallback {
-      public:
-        // Callback, used to report contact points already added to the container.
-        // If returns false, the contact scanning will be stopped.
-        virtual bool OnReportContact(
-            const ChVector<>& pA,             // get contact pA
-            const ChVector<>& pB,             // get contact pB
-            const ChMatrix33<>& plane_coord,  // get contact plane coordsystem (A column 'X' is contact normal)
-            const double& distance,           // get contact distance
-            const double& eff_radius,         // effective radius of curvature at contact
-            const ChVector<>& react_forces,   // get react.forces (if already computed). In coordsystem 'plane_coord'
-            const ChVector<>& react_torques,  // get react.torques, if rolling friction (if already computed).
-            ChContactable* contactobjA,  // get model A (note: some containers may not support it and could be zero!)
-            ChContactable* contactobjB   // get model B (note: some containers may not support it and could be zero!)
-            ) override {
-            if (!(contactobjA && contactobjB))
-                return true;
-            ChBody* b1 = dynamic_cast<ChBody*>(contactobjA);
-            ChBody* b2 = dynamic_cast<ChBody*>(contactobjB);
-            if (!(b1 && b2))
-                return true;
-            bool sleep1 = b1->GetSleeping();
-            bool sleep2 = b2->GetSleeping();
-            bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-            bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-            bool ground1 = b1->GetBodyFixed();
-            bool ground2 = b2->GetBodyFixed();
-            if (sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (could_sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-            }
-            if (could_sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+    // Islands that must stay awake (this flag is only set on the island roots at the end)
+    std::vector<char> keep_awake(num_bodies, 0);
+
+    // Fixed bodies that were moved since the last check wake the bodies they touch
+    std::vector<char> moved(num_bodies, 0);
+    for (int i = 0; i < num_bodies; i++) {
+        ChBody* body = bodies[i].get();
+        if (!body->GetBodyFixed())
+            continue;
+        moved[i] = !(body->GetCoord() == body->sleep_coord) || !body->GetPos_dt().IsNull() ||
+                   !body->GetWvel_loc().IsNull();
+        body->sleep_coord = body->GetCoord();
+    }
+
+    // Links connect their two bodies in the same island. A link that requires waking and connects a body to ground
+    // (or to an object that is not a body) keeps that body awake.
+    struct LinkBodies {
+        ChLink* link;
+        ChBody* body1;
+        ChBody* body2;
+    };
+    std::vector<LinkBodies> links;
+    links.reserve(assembly.linklist.size());
+    for (auto& link : assembly.linklist) {
+        auto clink = dynamic_cast<ChLink*>(link.get());
+        if (!clink)
+            continue;
+        LinkBodies lb{clink, dynamic_cast<ChBody*>(clink->GetBody1()), dynamic_cast<ChBody*>(clink->GetBody2())};
+        links.push_back(lb);
+        if (!clink->IsRequiringWaking() || clink->IsDisabled() || clink->IsBroken())
+            continue;
+        int i1 = body_index(lb.body1);
+        int i2 = body_index(lb.body2);
+        if (i1 >= 0 && i2 >= 0)
+            unite(i1, i2);
+        else if (i1 >= 0)
+            keep_awake[i1] = 1;
+        else if (i2 >= 0)
+            keep_awake[i2] = 1;
+    }
+
+    // Loads acting on several bodies connect them in the same island. External (non-stiff) loads wake the bodies they
+    // act on, while stiff loads (e.g., bushings) only depend on the state and do not.
+    std::vector<std::shared_ptr<ChLoadable>> loadables;
+    for (auto& item : assembly.otherphysicslist) {
+        auto container = std::dynamic_pointer_cast<ChLoadContainer>(item);
+        if (!container)
+            continue;
+        for (auto& load : container->GetLoadList()) {
+            loadables.clear();
+            load->GetLoadables(loadables);
+            bool wake = !load->IsStiff() && !load->IsLoadNull();
+            int first = -1;
+            for (auto& loadable : loadables) {
+                int i = body_index(dynamic_cast<ChBody*>(loadable.get()));
+                if (i < 0)
+                    continue;
+                if (wake)
+                    keep_awake[i] = 1;
+                if (first >= 0)
+                    unite(first, i);
+                else
+                    first = i;
             }
-            someone_sleeps = someone_sleeps || sleep1 || sleep2;
+        }
+    }
 
-            return true;  // to continue scanning contacts
+    // Contacts between two bodies connect them in the same island. Contacts with a moved fixed body keep the other body
+    // awake. Note that the contact container only includes contacts involving at least one active body: contacts
+    // between two sleeping bodies and between a sleeping body and a fixed body are not reported here (see below).
+    class _island_reporter_class : public ChContactContainer::ReportContactCallback {
+      public:
+        virtual bool OnReportContact(const ChVector<>& pA,
+                                     const ChVector<>& pB,
+                                     const ChMatrix33<>& plane_coord,
+                                     const double& distance,
+                                     const double& eff_radius,
+                                     const ChVector<>& react_forces,
+                                     const ChVector<>& react_torques,
+                                     ChContactable* contactobjA,
+                                     ChContactable* contactobjB) override {
+            auto it1 = index->find(dynamic_cast<ChBody*>(contactobjA));
+            auto it2 = index->find(dynamic_cast<ChBody*>(contactobjB));
+            if (it1 == index->end() || it2 == index->end())
+                return true;
+            int i1 = it1->second;
+            int i2 = it2->second;
+            bool fixed1 = (*bodies)[i1]->GetBodyFixed();
+            bool fixed2 = (*bodies)[i2]->GetBodyFixed();
+            if (!fixed1 && !fixed2)
+                unite(i1, i2);
+            else if (fixed1 && !fixed2 && (*moved)[i1])
+                (*keep_awake)[i2] = 1;
+            else if (fixed2 && !fixed1 && (*moved)[i2])
+                (*keep_awake)[i1] = 1;
+            return true;
         }
 
-        // Data
-        bool someone_sleeps;
-        bool need_Setup_A;
+        std::unordered_map<ChBody*, int>* index;
+        std::vector<std::shared_ptr<ChBody>>* bodies;
+        std::vector<char>* moved;
+        std::vector<char>* keep_awake;
+        std::function<void(int, int)> unite;
     };
 
-    auto my_waker = chrono_types::make_shared<_wakeup_reporter_class>();
-    my_waker->need_Setup_A = false;
-
-    bool need_Setup_L = false;
+    auto island_reporter = chrono_types::make_shared<_island_reporter_class>();
+    island_reporter->index = &index;
+    island_reporter->bodies = &bodies;
+    island_reporter->moved = &moved;
+    island_reporter->keep_awake = &keep_awake;
+    island_reporter->unite = unite;
+    contact_container->ReportAllContacts(island_reporter);
+
+    // A sleeping body in contact with an awake body is part of the island of the latter (and is woken up with it). A
+    // sleeping body in contact with a moved fixed body is detected through the overlap of their bounding boxes, since
+    // such contacts are not in the contact container. Sleeping bodies only in contact with other sleeping bodies are
+    // woken up at a later check, once the bodies they touch are awake and their contacts are reported.
+    auto overlap = [](const geometry::ChAABB& a, const geometry::ChAABB& b) {
+        return !a.IsInverted() && !b.IsInverted() && a.min.x() <= b.max.x() && b.min.x() <= a.max.x() &&
+               a.min.y() <= b.max.y() && b.min.y() <= a.max.y() && a.min.z() <= b.max.z() && b.min.z() <= a.max.z();
+    };
+    for (int i = 0; i < num_bodies; i++) {
+        if (!moved[i] || !bodies[i]->GetCollide())
+            continue;
+        auto aabb = bodies[i]->GetTotalAABB();
+        for (int j = 0; j < num_bodies; j++) {
+            ChBody* body = bodies[j].get();
+            if (body->GetSleeping() && !body->GetBodyFixed() && body->GetCollide() &&
+                overlap(aabb, body->GetTotalAABB()))
+                keep_awake[j] = 1;
+        }
+    }
 
-    for (int i = 0; i < 1; i++)  //***TO DO*** reconfigurable number of wakeup cycles
-    {
-        my_waker->someone_sleeps = false;
+    // Accumulate the kinetic energy and the energy threshold of each island (at its root)
+    std::vector<double> energy(num_bodies, 0.0);
+    std::vector<double> threshold(num_bodies, 0.0);
+    std::vector<char> can_sleep(num_bodies, 1);
+
+    for (int i = 0; i < num_bodies; i++) {
+        ChBody* body = bodies[i].get();
+        if (body->GetBodyFixed())
+            continue;
+        int root = find(i);
+        keep_awake[root] |= keep_awake[i];
+
+        // Bodies with applied accumulated forces or applied ChForce objects wake their island
+        if (!body->Force_acc.IsNull() || !body->Torque_acc.IsNull())
+            keep_awake[root] = 1;
+        for (auto& force : body->forcelist) {
+            ChVector<> force_body;
+            ChVector<> torque_body;
+            force->GetBodyForceTorque(force_body, torque_body);
+            if (!force_body.IsNull() || !torque_body.IsNull())
+                keep_awake[root] = 1;
+        }
+        if (!body->GetUseSleeping())
+            can_sleep[root] = 0;
+        if (body->GetSleeping())
+            continue;
+
+        const ChMatrix33<>& J = body->GetInertia();
+        ChVector<> w = body->GetWvel_loc();
+        double m = body->GetMass();
+        energy[root] += 0.5 * (m * body->GetPos_dt().Length2() + Vdot(w, J * w));
+        threshold[root] += 0.5 * (m * body->sleep_minspeed * body->sleep_minspeed +
+                                  J.trace() / 3 * body->sleep_minwvel * body->sleep_minwvel);
+    }
 
-        // scan all links and wake connected bodies
-        for (auto& link : assembly.linklist) {
-            if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
-                if (Lpointer->IsRequiringWaking()) {
-                    ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
-                    ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
-                    if (b1 && b2) {
-                        bool sleep1 = b1->GetSleeping();
-                        bool sleep2 = b2->GetSleeping();
-                        bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-                        bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-                        if (sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (could_sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-                        }
-                        if (could_sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-                        }
-                    }
-                }
+    // Wake up all bodies in moving islands and restart their sleep timers. For islands at rest, check whether all
+    // awake bodies have been at rest for long enough.
+    bool changed = false;
+    double time = GetChTime();
+    std::vector<char> ready(num_bodies, 1);
+
+    for (int i = 0; i < num_bodies; i++) {
+        ChBody* body = bodies[i].get();
+        if (body->GetBodyFixed())
+            continue;
+        int root = find(i);
+        if (keep_awake[root] || energy[root] > threshold[root]) {
+            if (body->GetSleeping()) {
+                body->SetSleeping(false);
+                changed = true;
             }
+            body->sleep_starttime = float(time);
+            ready[root] = 0;
+        } else if (!body->GetSleeping() && (time - body->sleep_starttime) <= body->sleep_time) {
+            ready[root] = 0;
         }
-
-        // scan all contacts and wake neighboring bodies
-        contact_container->ReportAllContacts(my_waker);
-
-        // bailout wakeup cycle prematurely, if all bodies are not sleeping
-        if (!my_waker->someone_sleeps)
-            break;
     }
 
-    /// If some body still must change from no sleep-> sleep, do it
-    int need_Setup_B = 0;
-    for (auto& body : assembly.bodylist) {
-        if (body->BFlagGet(ChBody::BodyFlag::COULDSLEEP)) {
+    // Put to sleep the islands that have been at rest for long enough
+    for (int i = 0; i < num_bodies; i++) {
+        ChBody* body = bodies[i].get();
+        if (body->GetBodyFixed() || body->GetSleeping())
+            continue;
+        int root = find(i);
+        if (ready[root] && can_sleep[root]) {
             body->SetSleeping(true);
-            ++need_Setup_B;
+            body->SetPos_dt(VNULL);
+            body->SetWvel_loc(VNULL);
+            body->SetPos_dtdt(VNULL);
+            body->SetWacc_loc(VNULL);
+            changed = true;
+        }
+    }
+
+    // Links between inactive bodies, at least one of which is sleeping, are inactive
+    for (auto& lb : links) {
+        bool sleeping = lb.body1 && lb.body2 && !lb.body1->IsActive() && !lb.body2->IsActive() &&
+                        (lb.body1->GetSleeping() || lb.body2->GetSleeping());
+        if (lb.link->sleeping != sleeping) {
+            lb.link->sleeping = sleeping;
+            changed = true;
         }
     }
 
-    // if some body has been activated/deactivated because of sleep state changes,
-    // the offsets and DOF counts must be updated:
-    if (my_waker->need_Setup_A || need_Setup_B || need_Setup_L) {
+    // If some body or link has been activated/deactivated because of sleep state changes,
+    // the offsets and DOF counts must be updated
+    if (changed) {
         Setup();
         return true;
     }
@@ -223,8 +223,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in SCM deformable terrain calculations, and in the ChSolverPSORcolored solver.
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -243,6 +243,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int GetNumthreadsCollision() const { return nthreads_collision; }
     int GetNumthreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable parallel execution of the per-item loops of the underlying assembly (default: false).
+    /// See ChAssembly::SetParallelUpdate for details and ChPhysicsItem::IsThreadSafe for the threading contract.
+    void SetParallelUpdate(bool val) { assembly.SetParallelUpdate(val); }
+
     // DATABASE HANDLING
 
     /// Get the underlying assembly containing all physics items.
@@ -501,7 +505,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     void InjectVariables(ChSystemDescriptor& mdescriptor);
 
     void InjectConstraints(ChSystemDescriptor& mdescriptor);
-    void ConstraintsLoadJacobians();
+    virtual void ConstraintsLoadJacobians() override;
 
     void InjectKRMmatrices(ChSystemDescriptor& mdescriptor);
     void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor);
@@ -943,6 +947,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     friend class fea::ChMesh;
 
     friend class ChContactContainerNSC;
+    friend class ChContactContainerNSCpooled;
     friend class ChContactContainerSMC;
 
     friend class ChVisualSystem;
@@ -0,0 +1,452 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/serialization/ChCheckpointBinary.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+// Current version of the checkpoint file format
+static const uint32_t checkpoint_version = 2;
+
+// File signature
+static const char checkpoint_magic[8] = {'C', 'H', 'C', 'K', 'P', 'T', '\0', '\0'};
+
+// Alignment (in bytes) of all data blocks in the file
+static const uint64_t checkpoint_alignment = 64;
+
+// Flags stored for a body or shaft
+static uint32_t ItemFlags(bool fixed, bool sleeping) {
+    uint32_t flags = 0;
+    if (fixed)
+        flags |= static_cast<uint32_t>(ChCheckpointBinary::FLAG_FIXED);
+    if (sleeping)
+        flags |= static_cast<uint32_t>(ChCheckpointBinary::FLAG_SLEEPING);
+    return flags;
+}
+
+// Fixed-size file header
+struct ChCheckpointBinary::Header {
+    char magic[8];        // file signature
+    uint32_t version;     // file format version
+    uint32_t num_blocks;  // number of entries in the block table (which immediately follows the header)
+    double time;          // simulation time
+    uint64_t ncoords;     // size of position-level state
+    uint64_t ncoords_w;   // size of velocity-level state
+    uint64_t nconstr;     // number of constraints (including contacts)
+    uint64_t nbodies;     // number of bodies
+    uint64_t nshafts;     // number of shafts
+    uint64_t file_size;   // total file size (bytes)
+};
+
+// Entry in the block table
+struct ChCheckpointBinary::BlockEntry {
+    uint32_t type;       // block identifier (BlockType)
+    uint32_t elem_size;  // size of one element (bytes)
+    uint64_t offset;     // offset of block data from the start of the file (bytes)
+    uint64_t count;      // number of elements in the block
+};
+
+static uint64_t AlignOffset(uint64_t offset) {
+    return (offset + checkpoint_alignment - 1) / checkpoint_alignment * checkpoint_alignment;
+}
+
+// Collect the location of the multipliers of all items with constraints, in the order of the system reaction vector.
+// Must be called after ChSystem::Setup.
+static void GatherReactionLayout(ChSystem& sys, std::vector<ChCheckpointBinary::ReactionEntry>& layout) {
+    using ItemList = ChCheckpointBinary::ItemList;
+    auto add = [&layout](ItemList list, size_t index, ChPhysicsItem* item) {
+        ChCheckpointBinary::ReactionEntry entry;
+        entry.list = static_cast<uint32_t>(list);
+        entry.index = static_cast<uint32_t>(index);
+        entry.offset = item->GetOffset_L();
+        entry.count = static_cast<uint64_t>(item->GetDOC());
+        layout.push_back(entry);
+    };
+
+    layout.clear();
+    const auto& links = sys.Get_linklist();
+    for (size_t i = 0; i < links.size(); i++) {
+        if (links[i]->IsActive() && links[i]->GetDOC() > 0)
+            add(ItemList::LINKS, i, links[i].get());
+    }
+    const auto& meshes = sys.Get_meshlist();
+    for (size_t i = 0; i < meshes.size(); i++) {
+        if (meshes[i]->GetDOC() > 0)
+            add(ItemList::MESHES, i, meshes[i].get());
+    }
+    const auto& others = sys.Get_otherphysicslist();
+    for (size_t i = 0; i < others.size(); i++) {
+        if (others[i]->IsActive() && others[i]->GetDOC() > 0)
+            add(ItemList::OTHER_ITEMS, i, others[i].get());
+    }
+    if (sys.GetContactContainer() && sys.GetContactContainer()->GetDOC() > 0)
+        add(ItemList::CONTACTS, 0, sys.GetContactContainer().get());
+}
+
+// -----------------------------------------------------------------------------
+
+ChCheckpointBinary::ChCheckpointBinary() : m_data(nullptr), m_size(0), m_handle(nullptr) {}
+
+ChCheckpointBinary::~ChCheckpointBinary() {
+    Close();
+}
+
+bool ChCheckpointBinary::Write(ChSystem& sys, const std::string& filename) {
+    // Make sure counts and offsets are up-to-date
+    sys.Setup();
+
+    // Gather state vectors and multipliers
+    ChState x(sys.GetNcoords_x(), &sys);
+    ChStateDelta v(sys.GetNcoords_v(), &sys);
+    ChStateDelta a(sys.GetNcoords_v(), &sys);
+    ChVectorDynamic<> L(sys.GetNconstr());
+    double T;
+    sys.StateGather(x, v, T);
+    sys.StateGatherAcceleration(a);
+    sys.StateGatherReactions(L);
+    std::vector<ReactionEntry> layout;
+    GatherReactionLayout(sys, layout);
+
+    // Gather auxiliary per-item data
+    std::vector<uint32_t> body_flags;
+    body_flags.reserve(sys.Get_bodylist().size());
+    for (const auto& body : sys.Get_bodylist()) {
+        body_flags.push_back(ItemFlags(body->GetBodyFixed(), body->GetSleeping()));
+    }
+    std::vector<uint32_t> shaft_flags;
+    shaft_flags.reserve(sys.Get_shaftlist().size());
+    for (const auto& shaft : sys.Get_shaftlist()) {
+        shaft_flags.push_back(ItemFlags(shaft->GetShaftFixed(), shaft->GetSleeping()));
+    }
+
+    // Set up block table
+    struct BlockData {
+        BlockType type;
+        uint32_t elem_size;
+        uint64_t count;
+        const void* data;
+    };
+    BlockData blocks[] = {
+        {BlockType::STATE_X, sizeof(double), (uint64_t)x.size(), x.data()},
+        {BlockType::STATE_V, sizeof(double), (uint64_t)v.size(), v.data()},
+        {BlockType::STATE_A, sizeof(double), (uint64_t)a.size(), a.data()},
+        {BlockType::REACTIONS, sizeof(double), (uint64_t)L.size(), L.data()},
+        {BlockType::BODY_FLAGS, sizeof(uint32_t), (uint64_t)body_flags.size(), body_flags.data()},
+        {BlockType::SHAFT_FLAGS, sizeof(uint32_t), (uint64_t)shaft_flags.size(), shaft_flags.data()},
+        {BlockType::REACTION_LAYOUT, sizeof(ReactionEntry), (uint64_t)layout.size(), layout.data()},
+    };
+    const uint32_t num_blocks = sizeof(blocks) / sizeof(blocks[0]);
+
+    std::vector<BlockEntry> table(num_blocks);
+    uint64_t offset = sizeof(Header) + num_blocks * sizeof(BlockEntry);
+    for (uint32_t ib = 0; ib < num_blocks; ib++) {
+        offset = AlignOffset(offset);
+        table[ib].type = static_cast<uint32_t>(blocks[ib].type);
+        table[ib].elem_size = blocks[ib].elem_size;
+        table[ib].offset = offset;
+        table[ib].count = blocks[ib].count;
+        offset += blocks[ib].count * blocks[ib].elem_size;
+    }
+
+    Header header;
+    std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+    header.version = checkpoint_version;
+    header.num_blocks = num_blocks;
+    header.time = T;
+    header.ncoords = (uint64_t)x.size();
+    header.ncoords_w = (uint64_t)v.size();
+    header.nconstr = (uint64_t)L.size();
+    header.nbodies = (uint64_t)body_flags.size();
+    header.nshafts = (uint64_t)shaft_flags.size();
+    header.file_size = offset;
+
+    // Write header, block table, and all (aligned) data blocks
+    std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        GetLog() << "ChCheckpointBinary: cannot open file " << filename << " for writing\n";
+        return false;
+    }
+
+    static const char padding[checkpoint_alignment] = {0};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char*>(table.data()), num_blocks * sizeof(BlockEntry));
+    uint64_t pos = sizeof(Header) + num_blocks * sizeof(BlockEntry);
+    for (uint32_t ib = 0; ib < num_blocks; ib++) {
+        file.write(padding, table[ib].offset - pos);
+        uint64_t size = table[ib].count * table[ib].elem_size;
+        file.write(static_cast<const char*>(blocks[ib].data), size);
+        pos = table[ib].offset + size;
+    }
+
+    return file.good();
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChCheckpointBinary::Open(const std::string& filename) {
+    Close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        GetLog() << "ChCheckpointBinary: cannot open file " << filename << "\n";
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        GetLog() << "ChCheckpointBinary: invalid file " << filename << "\n";
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        GetLog() << "ChCheckpointBinary: cannot map file " << filename << "\n";
+        return false;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        GetLog() << "ChCheckpointBinary: cannot map file " << filename << "\n";
+        return false;
+    }
+    m_handle = mapping;
+    m_data = static_cast<const char*>(data);
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        GetLog() << "ChCheckpointBinary: cannot open file " << filename << "\n";
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        GetLog() << "ChCheckpointBinary: invalid file " << filename << "\n";
+        return false;
+    }
+    void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        GetLog() << "ChCheckpointBinary: cannot map file " << filename << "\n";
+        return false;
+    }
+    m_data = static_cast<const char*>(data);
+    m_size = static_cast<size_t>(st.st_size);
+#endif
+
+    // Validate header and block table
+    const Header* header = GetHeader();
+    bool valid = m_size >= sizeof(Header) && std::memcmp(header->magic, checkpoint_magic, sizeof(header->magic)) == 0 &&
+                 header->version == checkpoint_version && header->file_size == m_size &&
+                 sizeof(Header) + header->num_blocks * sizeof(BlockEntry) <= m_size;
+    if (valid) {
+        auto table = reinterpret_cast<const BlockEntry*>(m_data + sizeof(Header));
+        for (uint32_t ib = 0; ib < header->num_blocks; ib++) {
+            if (table[ib].offset + table[ib].count * table[ib].elem_size > m_size)
+                valid = false;
+        }
+    }
+    if (!valid) {
+        GetLog() << "ChCheckpointBinary: " << filename << " is not a valid checkpoint file\n";
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void ChCheckpointBinary::Close() {
+    if (!m_data)
+        return;
+#if defined(_WIN32)
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_handle));
+#else
+    munmap(const_cast<char*>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_handle = nullptr;
+}
+
+const ChCheckpointBinary::Header* ChCheckpointBinary::GetHeader() const {
+    return reinterpret_cast<const Header*>(m_data);
+}
+
+double ChCheckpointBinary::GetTime() const {
+    return m_data ? GetHeader()->time : 0;
+}
+
+const void* ChCheckpointBinary::GetBlock(BlockType type, size_t& count) const {
+    count = 0;
+    if (!m_data)
+        return nullptr;
+    auto table = reinterpret_cast<const BlockEntry*>(m_data + sizeof(Header));
+    for (uint32_t ib = 0; ib < GetHeader()->num_blocks; ib++) {
+        if (table[ib].type == static_cast<uint32_t>(type)) {
+            count = static_cast<size_t>(table[ib].count);
+            return m_data + table[ib].offset;
+        }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChCheckpointBinary::Restore(ChSystem& sys) const {
+    if (!m_data)
+        return false;
+    const Header* header = GetHeader();
+
+    if (header->nbodies != sys.Get_bodylist().size() || header->nshafts != sys.Get_shaftlist().size()) {
+        GetLog() << "ChCheckpointBinary: checkpoint does not match the system model\n";
+        return false;
+    }
+
+    size_t nx, nv, na, nL, nlayout;
+    auto x_data = static_cast<const double*>(GetBlock(BlockType::STATE_X, nx));
+    auto v_data = static_cast<const double*>(GetBlock(BlockType::STATE_V, nv));
+    auto a_data = static_cast<const double*>(GetBlock(BlockType::STATE_A, na));
+    auto L_data = static_cast<const double*>(GetBlock(BlockType::REACTIONS, nL));
+    auto saved_layout = static_cast<const ReactionEntry*>(GetBlock(BlockType::REACTION_LAYOUT, nlayout));
+    if (!x_data || !v_data || !L_data || !saved_layout) {
+        GetLog() << "ChCheckpointBinary: checkpoint is missing required data blocks\n";
+        return false;
+    }
+
+    // Apply per-item flags (these determine which items contribute to the state vectors), saving the current values
+    // so that they can be reverted if the checkpoint turns out to be incompatible
+    std::vector<uint32_t> old_body_flags;
+    std::vector<uint32_t> old_shaft_flags;
+    for (const auto& body : sys.Get_bodylist())
+        old_body_flags.push_back(ItemFlags(body->GetBodyFixed(), body->GetSleeping()));
+    for (const auto& shaft : sys.Get_shaftlist())
+        old_shaft_flags.push_back(ItemFlags(shaft->GetShaftFixed(), shaft->GetSleeping()));
+
+    auto apply_flags = [&sys](const uint32_t* body_flags, const uint32_t* shaft_flags) {
+        for (size_t i = 0; i < sys.Get_bodylist().size(); i++) {
+            const auto& body = sys.Get_bodylist()[i];
+            body->SetBodyFixed((body_flags[i] & FLAG_FIXED) != 0);
+            body->SetSleeping((body_flags[i] & FLAG_SLEEPING) != 0);
+        }
+        for (size_t i = 0; i < sys.Get_shaftlist().size(); i++) {
+            const auto& shaft = sys.Get_shaftlist()[i];
+            shaft->SetShaftFixed((shaft_flags[i] & FLAG_FIXED) != 0);
+            shaft->SetSleeping((shaft_flags[i] & FLAG_SLEEPING) != 0);
+        }
+    };
+
+    size_t nbf, nsf;
+    auto body_flags = static_cast<const uint32_t*>(GetBlock(BlockType::BODY_FLAGS, nbf));
+    auto shaft_flags = static_cast<const uint32_t*>(GetBlock(BlockType::SHAFT_FLAGS, nsf));
+    if (!body_flags || nbf != header->nbodies || !shaft_flags || nsf != header->nshafts) {
+        GetLog() << "ChCheckpointBinary: checkpoint is missing required data blocks\n";
+        return false;
+    }
+    apply_flags(body_flags, shaft_flags);
+
+    // Recompute counts and offsets and check that the state layout and the constraint layout of all items (other
+    // than contacts, which are re-created below) match the saved ones
+    sys.Setup();
+    std::vector<ReactionEntry> layout;
+    GatherReactionLayout(sys, layout);
+
+    std::string error;
+    if (nx != (size_t)sys.GetNcoords_x() || nv != (size_t)sys.GetNcoords_v())
+        error = "checkpoint state size does not match the system state size";
+    auto is_contacts = [](const ReactionEntry& e) { return e.list == static_cast<uint32_t>(ItemList::CONTACTS); };
+    size_t is = 0;
+    for (const auto& entry : layout) {
+        if (!error.empty() || is_contacts(entry))
+            break;
+        if (is >= nlayout || is_contacts(saved_layout[is]) || saved_layout[is].list != entry.list ||
+            saved_layout[is].index != entry.index || saved_layout[is].count != entry.count) {
+            error = "constraints of item " + std::to_string(entry.index) + " in list " +
+                    std::to_string(entry.list) + " do not match the checkpoint";
+        }
+        is++;
+    }
+    if (error.empty() && is < nlayout && !is_contacts(saved_layout[is]))
+        error = "checkpoint has constraints for items not present (or not active) in the system";
+
+    if (!error.empty()) {
+        GetLog() << "ChCheckpointBinary: " << error << "\n";
+        apply_flags(old_body_flags.data(), old_shaft_flags.data());
+        sys.Setup();
+        return false;
+    }
+
+    // Scatter state vectors (with a full update of all items)
+    ChState x(nx, &sys);
+    ChStateDelta v(nv, &sys);
+    std::memcpy(x.data(), x_data, nx * sizeof(double));
+    std::memcpy(v.data(), v_data, nv * sizeof(double));
+    sys.StateScatter(x, v, header->time, true);
+
+    if (a_data && na == nv) {
+        ChStateDelta a(na, &sys);
+        std::memcpy(a.data(), a_data, na * sizeof(double));
+        sys.StateScatterAcceleration(a);
+    }
+
+    // Re-create contacts at the restored configuration, then restore multipliers (for solver warm start).
+    // Multipliers are copied item by item, from the saved location of each item to its current location.
+    if (sys.GetCollisionSystem()) {
+        sys.ComputeCollisions();
+        sys.Setup();
+        GatherReactionLayout(sys, layout);
+    }
+
+    ChVectorDynamic<> L(sys.GetNconstr());
+    L.setZero();
+    for (size_t il = 0; il < layout.size(); il++) {
+        const auto& entry = layout[il];
+        const ReactionEntry* saved = nullptr;
+        if (is_contacts(entry)) {
+            if (nlayout > 0 && is_contacts(saved_layout[nlayout - 1]) && saved_layout[nlayout - 1].count == entry.count)
+                saved = &saved_layout[nlayout - 1];
+        } else {
+            saved = &saved_layout[il];
+        }
+        if (saved && saved->offset + saved->count <= nL && entry.offset + entry.count <= (uint64_t)L.size())
+            std::memcpy(L.data() + entry.offset, L_data + saved->offset, entry.count * sizeof(double));
+    }
+    sys.StateScatterReactions(L);
+    if (sys.GetTimestepper())
+        sys.GetTimestepper()->get_L() = L;
+
+    return true;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CHECKPOINT_BINARY_H
+#define CH_CHECKPOINT_BINARY_H
+
+#include <cstdint>
+#include <string>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChSystem;
+
+/// @addtogroup chrono_serialization
+/// @{
+
+/// Binary checkpoint of the full dynamic state of a ChSystem.\n
+/// Unlike the ChArchive classes, which serialize an entire model (one value and one class name at a time), a checkpoint
+/// only stores the state of a system whose model is otherwise known (e.g., re-created by the same program), so that a
+/// simulation can be restarted (or branched, for example in a parameter sweep) from the saved state.\n
+/// A checkpoint file consists of a fixed-size header, a table of blocks (with their offsets and sizes), and contiguous,
+/// 64-byte aligned data blocks:
+/// - STATE_X, STATE_V, STATE_A: the state vectors x, v, and a, as obtained with ChSystem::StateGather and
+///   ChSystem::StateGatherAcceleration;
+/// - REACTIONS: the Lagrange multipliers of all constraints, including contacts (used to warm-start the solver);
+/// - BODY_FLAGS, SHAFT_FLAGS: per-item auxiliary data (fixed and sleeping flags), which determine the state layout;
+/// - REACTION_LAYOUT: the location of the multipliers of each item with constraints (link, mesh, other physics item,
+///   or contact container) in the REACTIONS block, identified by the item list and its index in that list.
+///
+/// Data is written with native endianness and is read back through a memory mapping of the file, without any parsing,
+/// so that the cost of both writing and restoring a checkpoint is that of copying the state vectors.
+class ChApi ChCheckpointBinary {
+  public:
+    /// Identifiers for the data blocks in a checkpoint file.
+    enum class BlockType : uint32_t {
+        STATE_X = 1,      ///< position-level state (doubles)
+        STATE_V = 2,      ///< velocity-level state (doubles)
+        STATE_A = 3,      ///< acceleration-level state (doubles)
+        REACTIONS = 4,    ///< constraint and contact multipliers (doubles)
+        BODY_FLAGS = 5,   ///< per-body flags (uint32)
+        SHAFT_FLAGS = 6,  ///< per-shaft flags (uint32)
+        REACTION_LAYOUT = 7  ///< multiplier location for each item with constraints (see ReactionEntry)
+    };
+
+    /// Lists of physics items with constraints, used to identify items in the REACTION_LAYOUT block.
+    enum class ItemList : uint32_t {
+        LINKS = 0,         ///< ChSystem::Get_linklist
+        MESHES = 1,        ///< ChSystem::Get_meshlist
+        OTHER_ITEMS = 2,   ///< ChSystem::Get_otherphysicslist
+        CONTACTS = 3       ///< ChSystem::GetContactContainer
+    };
+
+    /// Entry in the REACTION_LAYOUT block.
+    struct ReactionEntry {
+        uint32_t list;    ///< item list (ItemList)
+        uint32_t index;   ///< index of the item in its list
+        uint64_t offset;  ///< offset of the item multipliers in the REACTIONS block
+        uint64_t count;   ///< number of item multipliers
+    };
+
+    /// Flags stored for bodies and shafts.
+    enum ItemFlag : uint32_t {
+        FLAG_FIXED = 1 << 0,    ///< item fixed to ground
+        FLAG_SLEEPING = 1 << 1  ///< item in sleep mode
+    };
+
+    ChCheckpointBinary();
+    ~ChCheckpointBinary();
+
+    /// Write a checkpoint file with the current state of the given system.
+    /// Return false if the file could not be written.
+    static bool Write(ChSystem& sys, const std::string& filename);
+
+    /// Open (memory-map) the specified checkpoint file.
+    /// Return false if the file could not be opened or is not a valid checkpoint file.
+    bool Open(const std::string& filename);
+
+    /// Unmap the currently open checkpoint file (if any).
+    void Close();
+
+    /// Return true if a checkpoint file is currently open.
+    bool IsOpen() const { return m_data != nullptr; }
+
+    /// Return the simulation time at which the open checkpoint was created.
+    double GetTime() const;
+
+    /// Return a pointer to the data of the specified block in the mapped file and set the number of elements in that
+    /// block, or return nullptr if the block is not present. The pointer is valid until the file is closed.
+    const void* GetBlock(BlockType type, size_t& count) const;
+
+    /// Restore the state of the given system from the open checkpoint.
+    /// The system must have the same model (same bodies, shafts, links, meshes, etc., in the same order) as the system
+    /// used to write the checkpoint. Body and shaft flags are applied first and the checkpoint is validated against the
+    /// resulting layout of the system: the state sizes must match and every link, mesh, and other physics item must have
+    /// the same number of active constraints as when the checkpoint was written. If not, an error message is printed,
+    /// the flags are reverted, and false is returned without modifying the system state.\n
+    /// Otherwise, the state vectors are scattered to the system (with a full update), collision detection is run, and
+    /// the saved multipliers are restored item by item to warm-start the next step. Contact multipliers are restored
+    /// only if the number of contact constraints matches the saved one (otherwise they are set to zero).
+    bool Restore(ChSystem& sys) const;
+
+  private:
+    struct Header;
+    struct BlockEntry;
+
+    const Header* GetHeader() const;
+
+    const char* m_data;  ///< start of mapped file (nullptr if no file open)
+    size_t m_size;       ///< size of mapped file
+    void* m_handle;      ///< platform-specific mapping handle
+};
+
+/// @} chrono_serialization
+
+}  // end namespace chrono
+
+#endif
@@ -60,6 +60,12 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     /// automatically creating/resizing jacobians if needed.
     void SetVariables(std::vector<ChVariables*> mvars);
 
+    /// Append all referenced variable objects to the given list.
+    virtual bool GetReferencedVariables(std::vector<ChVariables*>& vars) override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+        return true;
+    }
+
     /// This function updates the following auxiliary data:
     ///  - the Eq  matrices
     ///  - the g_i product
@@ -65,6 +65,13 @@ class ChApi ChConstraintTwo : public ChConstraint {
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b) = 0;
 
+    /// Append the two referenced variable objects to the given list.
+    virtual bool GetReferencedVariables(std::vector<ChVariables*>& vars) override {
+        vars.push_back(variables_a);
+        vars.push_back(variables_b);
+        return true;
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& marchive) override;
 
@@ -89,6 +89,13 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_b.Increment_q(deltal);
     }
 
+    /// Append the variable objects referenced by the two tuples to the given list.
+    virtual bool GetReferencedVariables(std::vector<ChVariables*>& vars) override {
+        tuple_a.GetVariables(vars);
+        tuple_b.GetVariables(vars);
+        return true;
+    }
+
     /// Computes the product of the corresponding block in the
     /// system matrix by 'vect', and add to 'result'.
     /// NOTE: the 'vect' vector must already have
@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/solver/ChKblockGeneric.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
 
@@ -23,6 +24,9 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_use_cache(false),
+      m_cache_valid(false),
+      m_structure_hash(0),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -30,7 +34,14 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_setup_reuse(0) {}
+
+void ChDirectSolverLS::UseSparsityPatternCache(bool val) {
+    m_use_cache = val;
+    m_cache_valid = false;
+    m_force_update = true;
+}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
@@ -46,22 +57,36 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     // Note that ChSystemDescriptor::UpdateCountsAndOffsets was already called at the beginning of the step.
     m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
+    // If caching of the sparsity pattern is enabled, check for structural changes since the last call.
+    // The cached pattern and symbolic factorization can be reused only if the descriptor layout did not change.
+    bool reuse = false;
+    if (m_use_cache) {
+        size_t hash = ComputeStructureHash(sysd);
+        reuse = m_cache_valid && !m_force_update && hash == m_structure_hash && m_dim == m_mat.rows();
+        m_structure_hash = hash;
+        m_force_update = false;
+    }
+
     // If use of the sparsity pattern learner is enabled, call it if:
     // (a) an explicit update was requested (by default this is true at the first call), or
-    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_learner = m_use_learner && (m_force_update || !m_lock);
+    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call, or
+    // (c) the sparsity pattern is cached, but a structural change was detected
+    bool call_learner = !reuse && m_use_learner && (m_force_update || !m_lock || m_use_cache);
 
     // If use of the sparsity pattern learner is disabled, reserve space for nonzeros,
     // using the current sparsity level estimate, if:
     // (a) this is the first call to setup, or
-    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_reserve = !m_use_learner && (m_setup_call == 0 || !m_lock);
+    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call, or
+    // (c) the sparsity pattern is cached, but a structural change was detected
+    bool call_reserve = !reuse && !m_use_learner && (m_setup_call == 0 || !m_lock || m_use_cache);
 
     if (verbose) {
         GetLog() << "Solver setup\n";
         GetLog() << "  call number:    " << m_setup_call << "\n";
         GetLog() << "  use learner?    " << m_use_learner << "\n";
         GetLog() << "  pattern locked? " << m_lock << "\n";
+        GetLog() << "  pattern cached? " << m_use_cache << "\n";
+        GetLog() << "  REUSE pattern:  " << reuse << "\n";
         GetLog() << "  CALL learner:   " << call_learner << "\n";
         GetLog() << "  CALL reserve:   " << call_reserve << "\n";
     }
@@ -77,9 +102,14 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
     }
 
-    // Let the system descriptor load the current matrix
+    // Let the system descriptor load the current matrix.
+    // If reusing the cached pattern, values are refilled in place in the existing (compressed) storage.
     sysd.ConvertToMatrixForm(&m_mat, nullptr);
 
+    // If any new nonzero was inserted, the structure changed even though the descriptor layout did not.
+    if (reuse && !m_mat.isCompressed())
+        reuse = false;
+
     // Allow the matrix to be compressed
     m_mat.makeCompressed();
 
@@ -88,11 +118,15 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     if (write_matrix)
         WriteMatrix("LS_" + frame_id + "_A.dat", m_mat);
 
-    // Let the concrete solver perform the facorization
+    // Let the concrete solver perform the facorization (numeric only, if the cached pattern was reused)
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = reuse ? RefactorizeMatrix() : FactorizeMatrix();
     m_timer_setup_solvercall.stop();
 
+    m_cache_valid = m_use_cache && result;
+    if (reuse)
+        m_setup_reuse++;
+
     if (write_matrix)
         WriteMatrix("LS_" + frame_id + "_F.dat", m_mat);
 
@@ -212,6 +246,56 @@ double ChDirectSolverLS::SolveCurrent() {
 
 // ---------------------------------------------------------------------------
 
+// Combine the given value into the specified hash
+static inline void HashCombine(size_t& hash, size_t val) {
+    hash ^= val + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+size_t ChDirectSolverLS::ComputeStructureHash(ChSystemDescriptor& sysd) const {
+    size_t hash = 0;
+    HashCombine(hash, (size_t)m_dim);
+
+    // Mass blocks of active variables
+    for (const auto var : sysd.GetVariablesList()) {
+        if (!var->IsActive())
+            continue;
+        HashCombine(hash, (size_t)var->GetOffset());
+        HashCombine(hash, (size_t)var->Get_ndof());
+    }
+
+    // Stiffness blocks (the pattern of a generic block depends on its active variables)
+    for (const auto kblock : sysd.GetKblocksList()) {
+        auto kgen = dynamic_cast<ChKblockGeneric*>(kblock);
+        if (!kgen) {
+            HashCombine(hash, reinterpret_cast<size_t>(kblock));
+            continue;
+        }
+        for (unsigned int iv = 0; iv < kgen->GetNvars(); iv++) {
+            auto var = kgen->GetVariableN(iv);
+            HashCombine(hash, var->IsActive() ? (size_t)var->GetOffset() : ~size_t(0));
+        }
+    }
+
+    // Jacobian rows of active constraints (the pattern of a row depends on the referenced active variables)
+    std::vector<ChVariables*> vars;
+    for (const auto constr : sysd.GetConstraintsList()) {
+        if (!constr->IsActive())
+            continue;
+        HashCombine(hash, (size_t)constr->GetOffset());
+        vars.clear();
+        if (!constr->GetReferencedVariables(vars)) {
+            HashCombine(hash, reinterpret_cast<size_t>(constr));
+            continue;
+        }
+        for (const auto var : vars)
+            HashCombine(hash, var->IsActive() ? (size_t)var->GetOffset() : ~size_t(0));
+    }
+
+    return hash;
+}
+
+// ---------------------------------------------------------------------------
+
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
     ChStreamOutAsciiFile file(filename);
     file.SetNumFormat("%.12g");
@@ -269,6 +353,11 @@ bool ChSolverSparseLU::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseLU::RefactorizeMatrix() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseLU::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -298,6 +387,11 @@ bool ChSolverSparseQR::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseQR::RefactorizeMatrix() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseQR::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -37,9 +37,10 @@ performing the actual matrix factorization and then computing the solution vecto
 See ChSolverMkl (which implements Eigen's interface to the Intel MKL Pardiso solver) and ChSolverMumps (which interfaces
 to the MUMPS solver).
 
-ChDirectSolverLS manages the detection and update of the matrix sparsity pattern, providing two main features:
+ChDirectSolverLS manages the detection and update of the matrix sparsity pattern, providing three main features:
 - sparsity pattern lock
 - sparsity pattern learning
+- sparsity pattern caching
 
 The sparsity pattern \e lock skips sparsity identification or reserving memory for nonzeros on all but the first call to
 Setup. This feature is intended for problems where the system matrix sparsity pattern does not change significantly from
@@ -56,6 +57,14 @@ to a fully dense matrix). This value is used if the sparsity pattern learner is
 space for matrix indices and nonzeros.
 See #SetSparsityEstimate();
 
+The sparsity pattern \e cache keeps the matrix structure and the symbolic factorization from one call to Setup to the
+next. At each call, a hash of the system descriptor layout (active variables, constraints, and stiffness blocks, with
+their offsets and referenced variables) is compared with that of the previous call. If unchanged, the matrix values are
+refilled in place and only a numeric refactorization is performed. Otherwise, the pattern is re-evaluated and a full
+analysis and factorization is performed. This feature is intended for problems with fixed topology (no contacts or
+other constraints created or removed during the simulation), but can be used safely in all situations.\n
+See #UseSparsityPatternCache();
+
 <br>
 
 <div class="ce-warning">
@@ -92,6 +101,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable caching of the sparsity pattern and symbolic factorization (default: false).\n
+    /// If enabled, structural changes in the problem are detected automatically and only a numeric refactorization is
+    /// performed as long as the structure of the problem matrix does not change. This option takes precedence over the
+    /// sparsity pattern lock.
+    void UseSparsityPatternCache(bool val);
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -127,6 +142,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of calls to the solver's Setup function which reused the cached sparsity pattern and symbolic
+    /// factorization (see #UseSparsityPatternCache).
+    int GetNumSetupReuses() const { return m_setup_reuse; }
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
@@ -175,6 +193,11 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
+    /// Factorize the current sparse matrix, reusing the symbolic analysis of a previous call to FactorizeMatrix for a
+    /// matrix with the same sparsity pattern, and return true if successful.
+    /// The default implementation performs a full factorization.
+    virtual bool RefactorizeMatrix() { return FactorizeMatrix(); }
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() = 0;
@@ -194,13 +217,18 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChVectorDynamic<double> m_rhs;  ///< right-hand side vector
     ChVectorDynamic<double> m_sol;  ///< solution vector
 
-    int m_solve_call;  ///< counter for calls to Solve
-    int m_setup_call;  ///< counter for calls to Setup
+    int m_solve_call;   ///< counter for calls to Solve
+    int m_setup_call;   ///< counter for calls to Setup
+    int m_setup_reuse;  ///< counter for calls to Setup with reuse of the cached pattern
 
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
 
+    bool m_use_cache;         ///< cache sparsity pattern and symbolic factorization?
+    bool m_cache_valid;       ///< are the cached pattern and symbolic factorization valid?
+    size_t m_structure_hash;  ///< hash of the descriptor layout for the cached pattern
+
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
@@ -211,6 +239,10 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChTimer m_timer_solve_solvercall;  ///< timer for solution
 
   private:
+    /// Calculate a hash of the layout of the given system descriptor (i.e., of all information that determines the
+    /// sparsity pattern of the problem matrix).
+    size_t ComputeStructureHash(ChSystemDescriptor& sysd) const;
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
 };
@@ -231,6 +263,9 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numeric factorization only, reusing the current symbolic analysis.
+    virtual bool RefactorizeMatrix() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -256,6 +291,9 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numeric factorization only, reusing the current symbolic analysis.
+    virtual bool RefactorizeMatrix() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
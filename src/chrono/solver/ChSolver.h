@@ -51,6 +51,8 @@ class ChApi ChSolver {
         GMRES,     ///< Generalized Minimal RESidual Algorithm
         MINRES,    ///< MINimum RESidual method
         BICGSTAB,  ///< Bi-conjugate gradient stabilized
+        // Parallel iterative VI solvers
+        PSOR_COLORED,  ///< Projected SOR, parallelized through graph coloring of the constraints
         // Other
         CUSTOM,
     };
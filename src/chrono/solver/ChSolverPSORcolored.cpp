@@ -0,0 +1,303 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChSolverPSORcolored.h"
+#include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORcolored)
+CH_UPCASTING(ChSolverPSORcolored, ChIterativeSolverVI)
+
+// Maximum number of colors (one bit per color in the per-variable masks)
+static const int max_colors = 64;
+
+ChSolverPSORcolored::ChSolverPSORcolored() : m_nthreads(ChOMP::GetNumProcs()), maxviolation(0) {
+    m_color_start.push_back(0);
+}
+
+void ChSolverPSORcolored::SetNumThreads(int nthreads) {
+    m_nthreads = std::max(1, nthreads);
+}
+
+void ChSolverPSORcolored::ColorBlocks(std::vector<ChConstraint*>& mconstraints, int n_q) {
+    m_blocks.clear();
+    m_serial_blocks.clear();
+    m_var_colors.assign(n_q, 0);
+
+    std::vector<int> block_color;
+    std::vector<unsigned int> color_count(max_colors, 0);
+
+    unsigned int ic = 0;
+    while (ic < mconstraints.size()) {
+        // A friction triplet (normal and two tangential components) is always processed as a whole
+        Block block;
+        block.start = ic;
+        block.size = (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC && ic + 2 < mconstraints.size()) ? 3 : 1;
+        ic += block.size;
+
+        if (!mconstraints[block.start]->IsActive())
+            continue;
+
+        // Collect the variables referenced by the constraints in this block
+        m_block_vars.clear();
+        bool known = true;
+        for (unsigned int k = 0; k < block.size; k++)
+            known = known && mconstraints[block.start + k]->GetReferencedVariables(m_block_vars);
+        for (auto var : m_block_vars) {
+            if (var && var->IsActive() && var->GetOffset() >= n_q)
+                known = false;
+        }
+        if (!known) {
+            m_serial_blocks.push_back(block);
+            continue;
+        }
+
+        // Colors already taken by other blocks acting on the same variables.
+        // Inactive variables (e.g. fixed bodies) are never modified, so they do not create conflicts.
+        uint64_t used = 0;
+        for (auto var : m_block_vars) {
+            if (var && var->IsActive())
+                used |= m_var_colors[var->GetOffset()];
+        }
+
+        // Pick the first available color, or defer the block to the serial set if none is left
+        int color = 0;
+        while (color < max_colors && (used & (uint64_t(1) << color)))
+            color++;
+        if (color == max_colors) {
+            m_serial_blocks.push_back(block);
+            continue;
+        }
+
+        uint64_t bit = uint64_t(1) << color;
+        for (auto var : m_block_vars) {
+            if (var && var->IsActive())
+                m_var_colors[var->GetOffset()] |= bit;
+        }
+
+        m_blocks.push_back(block);
+        block_color.push_back(color);
+        color_count[color]++;
+    }
+
+    // Sort the blocks by color (counting sort, stable)
+    int num_colors = 0;
+    while (num_colors < max_colors && color_count[num_colors] > 0)
+        num_colors++;
+
+    m_color_start.assign(num_colors + 1, 0);
+    for (int c = 0; c < num_colors; c++)
+        m_color_start[c + 1] = m_color_start[c] + color_count[c];
+
+    std::vector<unsigned int> next(m_color_start.begin(), m_color_start.end() - 1);
+    std::vector<Block> sorted(m_blocks.size());
+    for (size_t ib = 0; ib < m_blocks.size(); ib++)
+        sorted[next[block_color[ib]]++] = m_blocks[ib];
+    m_blocks.swap(sorted);
+}
+
+void ChSolverPSORcolored::RelaxBlock(std::vector<ChConstraint*>& mconstraints,
+                                     const Block& block,
+                                     double& max_violation,
+                                     double& max_deltalambda) {
+    if (block.size == 3) {
+        // Friction triplet: update all three multipliers, then project on the friction cone
+        double old_lambda_friction[3];
+        double candidate_violation = 0;
+        for (unsigned int k = 0; k < 3; k++) {
+            ChConstraint* constraint = mconstraints[block.start + k];
+
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual =
+                constraint->Compute_Cq_q() + constraint->Get_b_i() + constraint->Get_cfm_i() * constraint->Get_l_i();
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / constraint->Get_g_i()) * (-mresidual);
+
+            // update:   lambda += delta_lambda;
+            old_lambda_friction[k] = constraint->Get_l_i();
+            constraint->Set_l_i(old_lambda_friction[k] + deltal);
+
+            if (k == 0)
+                candidate_violation = fabs(ChMin(0.0, mresidual));
+        }
+
+        mconstraints[block.start]->Project();  // the N normal component will take care of N,U,V
+
+        for (unsigned int k = 0; k < 3; k++) {
+            ChConstraint* constraint = mconstraints[block.start + k];
+            double new_lambda = constraint->Get_l_i();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda_friction[k];
+                constraint->Set_l_i(new_lambda);
+            }
+            double true_delta = new_lambda - old_lambda_friction[k];
+            constraint->Increment_q(true_delta);
+
+            if (this->record_violation_history)
+                max_deltalambda = ChMax(max_deltalambda, fabs(true_delta));
+        }
+
+        max_violation = ChMax(max_violation, candidate_violation);
+        return;
+    }
+
+    ChConstraint* constraint = mconstraints[block.start];
+
+    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+    double mresidual =
+        constraint->Compute_Cq_q() + constraint->Get_b_i() + constraint->Get_cfm_i() * constraint->Get_l_i();
+
+    // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+    double candidate_violation = fabs(constraint->Violation(mresidual));
+    if (constraint->GetMode() == CONSTRAINT_UNILATERAL)
+        candidate_violation = fabs(ChMin(0.0, mresidual));
+
+    // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+    double deltal = (m_omega / constraint->Get_g_i()) * (-mresidual);
+
+    // update:   lambda += delta_lambda;
+    double old_lambda = constraint->Get_l_i();
+    constraint->Set_l_i(old_lambda + deltal);
+
+    // If new lagrangian multiplier does not satisfy inequalities, project
+    // it into an admissible orthant (or, in general, onto an admissible set)
+    constraint->Project();
+
+    // After projection, the lambda may have changed a bit..
+    double new_lambda = constraint->Get_l_i();
+
+    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+    if (m_shlambda != 1.0) {
+        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+        constraint->Set_l_i(new_lambda);
+    }
+
+    double true_delta = new_lambda - old_lambda;
+
+    // For all items with variables, add the effect of incremented
+    // (and projected) lagrangian reactions:
+    constraint->Increment_q(true_delta);
+
+    if (this->record_violation_history)
+        max_deltalambda = ChMax(max_deltalambda, fabs(true_delta));
+
+    max_violation = ChMax(max_violation, candidate_violation);
+}
+
+double ChSolverPSORcolored::Solve(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    m_iterations = 0;
+    maxviolation = 0;
+    double maxdeltalambda = 0.;
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+    int nc = (int)mconstraints.size();
+#pragma omp parallel for num_threads(m_nthreads)
+    for (int ic = 0; ic < nc; ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+    //
+    int j_friction_comp = 0;
+    double gi_values[3];
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+            gi_values[j_friction_comp] = mconstraints[ic]->Get_g_i();
+            j_friction_comp++;
+            if (j_friction_comp == 3) {
+                double average_g_i = (gi_values[0] + gi_values[1] + gi_values[2]) / 3.0;
+                mconstraints[ic - 2]->Set_g_i(average_g_i);
+                mconstraints[ic - 1]->Set_g_i(average_g_i);
+                mconstraints[ic - 0]->Set_g_i(average_g_i);
+                j_friction_comp = 0;
+            }
+        }
+    }
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+    int nv = (int)mvariables.size();
+#pragma omp parallel for num_threads(m_nthreads)
+    for (int iv = 0; iv < nv; iv++) {
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
+    }
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    //     Note: done serially, as constraints may share variables.
+    if (m_warm_start) {
+        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+            if (mconstraints[ic]->IsActive())
+                mconstraints[ic]->Increment_q(mconstraints[ic]->Get_l_i());
+    } else {
+        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+            mconstraints[ic]->Set_l_i(0.);
+    }
+
+    // 4)  Partition the constraints in independent sets
+    ColorBlocks(mconstraints, sysd.CountActiveVariables());
+
+    // 5)  Perform the iteration loops
+    //
+    std::vector<double> thread_violation(m_nthreads);
+    std::vector<double> thread_deltalambda(m_nthreads);
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        std::fill(thread_violation.begin(), thread_violation.end(), 0.0);
+        std::fill(thread_deltalambda.begin(), thread_deltalambda.end(), 0.0);
+
+        // Sweep all colors in sequence; blocks of the same color are independent
+        for (size_t c = 0; c + 1 < m_color_start.size(); c++) {
+            int start = (int)m_color_start[c];
+            int end = (int)m_color_start[c + 1];
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+            for (int ib = start; ib < end; ib++) {
+                int tid = ChOMP::GetThreadNum();
+                RelaxBlock(mconstraints, m_blocks[ib], thread_violation[tid], thread_deltalambda[tid]);
+            }
+        }
+
+        // Blocks which could not be colored are processed serially
+        for (const auto& block : m_serial_blocks)
+            RelaxBlock(mconstraints, block, thread_violation[0], thread_deltalambda[0]);
+
+        maxviolation = *std::max_element(thread_violation.begin(), thread_violation.end());
+        maxdeltalambda = *std::max_element(thread_deltalambda.begin(), thread_deltalambda.end());
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+
+    }  // end iteration loop
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_COLORED_H
+#define CHSOLVER_PSOR_COLORED_H
+
+#include <cstdint>
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// A parallel version of the projective SOR solver, based on graph coloring of the constraints.\n
+/// At each solve, constraints are grouped in blocks (a single constraint, or the triplet of normal and tangential
+/// constraints of a frictional contact) and blocks are colored so that no two blocks with the same color act on the
+/// same (active) ChVariables object. All blocks of a given color can then be relaxed concurrently, without data races,
+/// while the colors are swept sequentially as in a Gauss-Seidel iteration.\n
+/// Projection on the friction cone, over-relaxation, sharpness and warm start are treated exactly as in ChSolverPSOR.
+/// Note however that the order in which constraints are relaxed differs from that of ChSolverPSOR, so that results
+/// match those of the serial solver only to within the solver tolerance.\n
+/// Constraints which do not report their variables (see ChConstraint::GetReferencedVariables) and blocks that could
+/// not be assigned one of the available colors are relaxed serially, after all colors.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORcolored : public ChIterativeSolverVI {
+  public:
+    ChSolverPSORcolored();
+
+    ~ChSolverPSORcolored() {}
+
+    virtual Type GetType() const override { return Type::PSOR_COLORED; }
+
+    /// Set the number of OpenMP threads used to sweep each color (default: number of available processors).
+    void SetNumThreads(int nthreads);
+
+    /// Get the number of OpenMP threads used to sweep each color.
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Return the number of colors used in the last solve (not including the serial set).
+    int GetNumColors() const { return (int)m_color_start.size() - 1; }
+
+    /// Return the number of blocks which were relaxed serially in the last solve.
+    int GetNumSerialBlocks() const { return (int)m_serial_blocks.size(); }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PSOR solver, this is the maximum constraint violation.
+    virtual double GetError() const override { return maxviolation; }
+
+  private:
+    /// A block of consecutive constraints processed as a unit (1 constraint, or a friction triplet).
+    struct Block {
+        unsigned int start;  ///< index of first constraint in the descriptor list
+        unsigned int size;   ///< number of constraints in the block (1 or 3)
+    };
+
+    /// Group the active constraints in blocks and color them.
+    /// The colors used at each variable are recorded at the variable offset (n_q is the number of active scalar
+    /// variables in the system descriptor).
+    void ColorBlocks(std::vector<ChConstraint*>& mconstraints, int n_q);
+
+    /// Relax the specified block, updating the maximum violation and maximum delta lambda.
+    void RelaxBlock(std::vector<ChConstraint*>& mconstraints,
+                    const Block& block,
+                    double& max_violation,
+                    double& max_deltalambda);
+
+    int m_nthreads;                             ///< number of OpenMP threads
+    std::vector<Block> m_blocks;                ///< colored blocks, sorted by color
+    std::vector<unsigned int> m_color_start;    ///< index of first block of each color (plus end marker)
+    std::vector<Block> m_serial_blocks;         ///< blocks processed serially
+    std::vector<ChVariables*> m_block_vars;     ///< scratch list of referenced variables
+    std::vector<uint64_t> m_var_colors;         ///< colors already used at each variable (indexed by offset)
+    double maxviolation;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -435,6 +435,11 @@ class ChApi ChIntegrableIIorder : public ChIntegrable {
         throw ChException("LoadConstraint_Ct() not implemented, implicit integrators cannot be used. ");
     }
 
+    /// Reload the constraint Jacobians Cq at the current state.
+    /// Used by integrators that evaluate the Cq'*L residual term while reusing an older Newton matrix
+    /// (otherwise the Jacobians are loaded only when the matrix is set up). Default: no-op.
+    virtual void ConstraintsLoadJacobians() {}
+
     //
     // OVERRIDE ChIntegrable BASE MEMBERS TO SUPPORT 1st ORDER INTEGRATORS:
     //
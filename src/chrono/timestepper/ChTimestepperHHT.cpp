@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
@@ -34,10 +35,30 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       h_min(1e-10),
       h(1e6),
       num_successful_steps(0),
-      modified_Newton(true) {
+      modified_Newton(true),
+      contraction_rate(0),
+      jacobian_update(JacobianUpdate::EVERY_STEP),
+      max_jacobian_age(20),
+      max_contraction_rate(0.5),
+      jacobian_valid(false),
+      jacobian_age(0),
+      jacobian_h(0),
+      jacobian_nv(0),
+      jacobian_nc(0) {
     SetAlpha(-0.2);  // default: some dissipation
 }
 
+void ChTimestepperHHT::SetModifiedNewton(bool enable) {
+    modified_Newton = enable;
+    jacobian_update = enable ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION;
+}
+
+void ChTimestepperHHT::SetJacobianUpdateMethod(JacobianUpdate method) {
+    jacobian_update = method;
+    modified_Newton = (method != JacobianUpdate::EVERY_ITERATION);
+    jacobian_valid = false;
+}
+
 void ChTimestepperHHT::SetAlpha(double val) {
     alpha = val;
     if (alpha < -1.0 / 3.0)
@@ -102,14 +123,20 @@ void ChTimestepperHHT::Advance(const double dt) {
     //   - at the beginning of a step
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
+    // With the AUTOMATIC policy, the matrix from previous steps is reused unless one of the triggers
+    // in CheckJacobianUpdate fires.
     // Otherwise, the matrix is updated at each iteration.
     matrix_is_current = false;
-    call_setup = true;
+    call_setup = (jacobian_update != JacobianUpdate::AUTOMATIC);
 
     // Loop until reaching final time
     while (true) {
         Prepare(mintegrable);
 
+        if (jacobian_update == JacobianUpdate::AUTOMATIC && !call_setup)
+            call_setup = CheckJacobianUpdate(mintegrable);
+        contraction_rate = 0;
+
         // Newton for state at T+h
         Da_nrm_hist.fill(0.0);
         Dl_nrm_hist.fill(0.0);
@@ -128,6 +155,11 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                jacobian_valid = true;
+                jacobian_age = 0;
+                jacobian_h = h;
+                jacobian_nv = mintegrable->GetNcoords_v();
+                jacobian_nc = mintegrable->GetNconstr();
             }
 
             // If using modified Newton, do not call Setup again
@@ -166,20 +198,21 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
+            jacobian_age++;
+            matrix_is_current = false;
 
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+        } else if (jacobian_update == JacobianUpdate::AUTOMATIC && !matrix_is_current) {
+            // ------ NR did not converge but the matrix was out-of-date
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    GetLog() << " HHT re-attempt step with updated matrix.\n";
-                }
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
 
-                call_setup = true;
-            */
+            // re-attempt step with updated matrix
+            if (verbose) {
+                GetLog() << " HHT re-attempt step with updated matrix.\n";
+            }
+
+            call_setup = true;
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -199,6 +232,10 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
+            // do not trust the current matrix for the next step
+            jacobian_valid = false;
+            matrix_is_current = false;
+
         } else {
             // ------ NR did not converge
 
@@ -220,6 +257,7 @@ void ChTimestepperHHT::Advance(const double dt) {
 
             // force a matrix re-evaluation (due to change in stepsize)
             call_setup = true;
+            matrix_is_current = false;
         }
 
         if (T >= tfinal) {
@@ -252,6 +290,8 @@ void ChTimestepperHHT::Prepare(ChIntegrableIIorder* integrable) {
         Anew = A;
     Vnew = V + Anew * h;
     Xnew = X + Vnew * h + Anew * (h * h);
+    if (jacobian_update == JacobianUpdate::AUTOMATIC)
+        integrable->ConstraintsLoadJacobians();  // Cq at the current state (the matrix may be older)
     integrable->LoadResidual_F(Rold, -alpha / (1.0 + alpha));       // -alpha/(1.0+alpha) * f_old
     integrable->LoadResidual_CqL(Rold, L, -alpha / (1.0 + alpha));  // -alpha/(1.0+alpha) * Cq'*l_old
     CalcErrorWeights(A, reltol, abstolS, ewtS);
@@ -282,6 +322,10 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
     R = Rold;      // terms related to state at time T
     Qc.setZero();  // zero
 
+    // With the AUTOMATIC policy, the matrix (and with it Cq) may be several steps old: reload Cq at the new estimate
+    if (jacobian_update == JacobianUpdate::AUTOMATIC)
+        integrable->ConstraintsLoadJacobians();
+
     // Set up linear system
     integrable->LoadResidual_F(R, 1.0);                                              //  f_new
     integrable->LoadResidual_CqL(R, Lnew, 1.0);                                      //  Cq'*l_new
@@ -305,8 +349,29 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
     Xnew = X + V * h + A * (h * h * (0.5 - beta)) + Anew * (h * h * beta);
     Vnew = V + A * (h * (1.0 - gamma)) + Anew * (h * gamma);
 
-    // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
+    // If Setup was called at this iteration, mark the Newton matrix as up-to-date for the current step attempt
+    if (call_setup)
+        matrix_is_current = true;
+}
+
+// Decide whether the Newton matrix kept from previous steps must be updated (AUTOMATIC policy only).
+bool ChTimestepperHHT::CheckJacobianUpdate(ChIntegrableIIorder* integrable) {
+    const char* reason = nullptr;
+    if (!jacobian_valid)
+        reason = "no valid matrix";
+    else if (integrable->GetNcoords_v() != jacobian_nv || integrable->GetNconstr() != jacobian_nc)
+        reason = "problem size changed";
+    else if (std::abs(h - jacobian_h) > 1e-10 * jacobian_h)
+        reason = "stepsize changed";
+    else if (jacobian_age >= max_jacobian_age)
+        reason = "maximum age reached";
+    else if (contraction_rate > max_contraction_rate)
+        reason = "slow convergence";
+
+    if (verbose && reason)
+        GetLog() << " HHT update Newton matrix (" << reason << ").\n";
+
+    return reason != nullptr;
 }
 
 // Convergence test
@@ -326,6 +391,10 @@ bool ChTimestepperHHT::CheckConvergence(int it) {
     // Estimate convergence rate
     Da_nrm_hist[it % 3] = Da.norm();
     Dl_nrm_hist[it % 3] = Dl.norm();
+    // The first iterations of a step can expand even with an up-to-date matrix (predictor, constraint terms scaled
+    // by 1/h^2), so the contraction rate is taken from the last two iterations.
+    if (it > 0 && Da_nrm_hist[(it - 1) % 3] > 0)
+        contraction_rate = Da_nrm_hist[it % 3] / Da_nrm_hist[(it - 1) % 3];
     if (it < 2)
         convergence_rate = 1;
     else {
@@ -354,6 +423,17 @@ void ChTimestepperHHT::CalcErrorWeights(const ChVectorDynamic<>& x, double rtol,
     ewt = (rtol * x.cwiseAbs() + atol).cwiseInverse();
 }
 
+// Trick to avoid putting the following mapper macro inside the class definition in .h file:
+// enclose macros in local 'ChTimestepperHHT_JacobianUpdate_enum_mapper', to avoid cluttering of the parent class.
+class ChTimestepperHHT_JacobianUpdate_enum_mapper : public ChTimestepperHHT {
+  public:
+    CH_ENUM_MAPPER_BEGIN(JacobianUpdate);
+    CH_ENUM_VAL(JacobianUpdate::EVERY_ITERATION);
+    CH_ENUM_VAL(JacobianUpdate::EVERY_STEP);
+    CH_ENUM_VAL(JacobianUpdate::AUTOMATIC);
+    CH_ENUM_MAPPER_END(JacobianUpdate);
+};
+
 void ChTimestepperHHT::ArchiveOut(ChArchiveOut& archive) {
     // version number
     archive.VersionWrite<ChTimestepperHHT>();
@@ -364,6 +444,10 @@ void ChTimestepperHHT::ArchiveOut(ChArchiveOut& archive) {
     archive << CHNVP(alpha);
     archive << CHNVP(beta);
     archive << CHNVP(gamma);
+    ChTimestepperHHT_JacobianUpdate_enum_mapper::JacobianUpdate_mapper updatemapper;
+    archive << CHNVP(updatemapper(jacobian_update), "jacobian_update");
+    archive << CHNVP(max_jacobian_age);
+    archive << CHNVP(max_contraction_rate);
 }
 
 void ChTimestepperHHT::ArchiveIn(ChArchiveIn& archive) {
@@ -376,6 +460,12 @@ void ChTimestepperHHT::ArchiveIn(ChArchiveIn& archive) {
     archive >> CHNVP(alpha);
     archive >> CHNVP(beta);
     archive >> CHNVP(gamma);
+    ChTimestepperHHT_JacobianUpdate_enum_mapper::JacobianUpdate_mapper updatemapper;
+    JacobianUpdate method = jacobian_update;
+    archive >> CHNVP(updatemapper(method), "jacobian_update");
+    SetJacobianUpdateMethod(method);
+    archive >> CHNVP(max_jacobian_age);
+    archive >> CHNVP(max_contraction_rate);
 }
 
 }  // end namespace chrono
\ No newline at end of file
@@ -27,6 +27,13 @@ namespace chrono {
 /// Newton scheme for the solution of the resulting nonlinear problem.
 class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
   public:
+    /// Policy for updating the Newton matrix (Jacobian evaluation, assembly, and factorization).
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< at every Newton iteration (full Newton)
+        EVERY_STEP,       ///< once per step, and on a stepsize decrease (modified Newton)
+        AUTOMATIC         ///< kept across steps, updated only when one of the refactorization triggers fires
+    };
+
     ChTimestepperHHT(ChIntegrableIIorder* intgr = nullptr);
 
     /// Return type of the integration method.
@@ -73,7 +80,40 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// per step or if the Newton iteration does not converge with an out-of-date matrix.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Default: true.
-    void SetModifiedNewton(bool enable) { modified_Newton = enable; }
+    void SetModifiedNewton(bool enable);
+
+    /// Set the policy for updating the Newton matrix.
+    /// With JacobianUpdate::AUTOMATIC, the factorized Newton matrix is reused across steps and is updated only:
+    ///   - if the number of states or constraints changed,
+    ///   - if the (internal) step size differs from the one used when the matrix was evaluated,
+    ///   - if the matrix is older than the maximum allowed age (see SetMaxJacobianAge),
+    ///   - if, in the previous step, the Newton contraction rate exceeded the threshold (see SetMaxContractionRate),
+    ///   - if the Newton iteration does not converge with an out-of-date matrix (the step is then re-attempted).
+    /// The factorization is kept by the linear solver, so this is mostly useful with direct sparse solvers. If the
+    /// same solver is used for other analyses between steps, call ForceJacobianUpdate().
+    /// With this policy, the constraint Jacobians are reloaded before each residual evaluation.
+    /// Default: JacobianUpdate::EVERY_STEP (modified Newton).
+    void SetJacobianUpdateMethod(JacobianUpdate method);
+
+    /// Return the current policy for updating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update; }
+
+    /// Set the maximum number of steps that can reuse the same Newton matrix (JacobianUpdate::AUTOMATIC only).
+    /// Default: 20.
+    void SetMaxJacobianAge(int steps) { max_jacobian_age = steps; }
+
+    /// Return the maximum number of steps that can reuse the same Newton matrix.
+    int GetMaxJacobianAge() const { return max_jacobian_age; }
+
+    /// Set the maximum Newton contraction rate |Da_k+1| / |Da_k| for which the Newton matrix is still reused at the
+    /// next step (JacobianUpdate::AUTOMATIC only). Default: 0.5.
+    void SetMaxContractionRate(double rate) { max_contraction_rate = rate; }
+
+    /// Return the maximum Newton contraction rate for which the Newton matrix is reused at the next step.
+    double GetMaxContractionRate() const { return max_contraction_rate; }
+
+    /// Force an update of the Newton matrix at the next step.
+    void ForceJacobianUpdate() { jacobian_valid = false; }
 
     /// Perform an integration timestep, by advancing the state by the specified time step.
     virtual void Advance(const double dt) override;
@@ -83,6 +123,13 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// convergence rate estimate is set to 1.
     double GetEstimatedConvergenceRate() const { return convergence_rate; }
 
+    /// Get the Newton contraction rate |Da_k+1| / |Da_k| at the last iteration of the last (internal) step.
+    /// Values close to 1 indicate slow convergence, typically with an out-of-date Newton matrix.
+    double GetContractionRate() const { return contraction_rate; }
+
+    /// Get the number of steps taken with the current Newton matrix since it was last updated.
+    int GetJacobianAge() const { return jacobian_age; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive) override;
 
@@ -93,6 +140,7 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     void Prepare(ChIntegrableIIorder* integrable);
     void Increment(ChIntegrableIIorder* integrable);
     bool CheckConvergence(int it);
+    bool CheckJacobianUpdate(ChIntegrableIIorder* integrable);
     void CalcErrorWeights(const ChVectorDynamic<>& x, double rtol, double atol, ChVectorDynamic<>& ewt);
 
   private:
@@ -113,6 +161,7 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     std::array<double, 3> Da_nrm_hist;  ///< last 3 update norms
     std::array<double, 3> Dl_nrm_hist;  ///< last 3 update norms
     double convergence_rate;            ///< estimated Newton rate of convergence
+    double contraction_rate;            ///< Newton contraction rate at the last iteration
 
     bool step_control;            ///< step size control enabled?
     int maxiters_success;         ///< maximum number of NR iterations to declare a step successful
@@ -124,9 +173,18 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     int num_successful_steps;     ///< number of successful steps
 
     bool modified_Newton;    ///< use modified Newton?
-    bool matrix_is_current;  ///< is the Newton matrix up-to-date?
+    bool matrix_is_current;  ///< was the Newton matrix updated during the current step attempt?
     bool call_setup;         ///< should the solver's Setup function be called?
 
+    JacobianUpdate jacobian_update;  ///< policy for updating the Newton matrix
+    int max_jacobian_age;            ///< maximum number of steps reusing the same Newton matrix
+    double max_contraction_rate;     ///< maximum contraction rate for reusing the Newton matrix at the next step
+    bool jacobian_valid;             ///< can the current Newton matrix be reused?
+    int jacobian_age;                ///< number of steps since the last Newton matrix update
+    double jacobian_h;               ///< stepsize used at the last Newton matrix update
+    int jacobian_nv;                 ///< number of states at the last Newton matrix update
+    int jacobian_nc;                 ///< number of constraints at the last Newton matrix update
+
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
     ChVectorDynamic<> ewtL;  ///< vector of error weights (Lagrange multipliers)
 };
@@ -22,6 +22,7 @@
 
 #include "chrono_thirdparty/googlebenchmark/include/benchmark/benchmark.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChIterativeSolver.h"
 
 namespace chrono {
 namespace utils {
@@ -55,6 +56,8 @@ class ChBenchmarkTest {
     double m_timer_collision_narrow;  ///< time for narrow-phase collision
     double m_timer_setup;             ///< time for system update
     double m_timer_update;            ///< time for system update
+    int m_solver_iterations;          ///< number of iterations of an iterative solver
+    int m_num_steps;                  ///< number of simulated steps
 };
 
 inline ChBenchmarkTest::ChBenchmarkTest()
@@ -67,7 +70,9 @@ inline ChBenchmarkTest::ChBenchmarkTest()
       m_timer_collision_broad(0),
       m_timer_collision_narrow(0),
       m_timer_setup(0),
-      m_timer_update(0) {}
+      m_timer_update(0),
+      m_solver_iterations(0),
+      m_num_steps(0) {}
 
 inline void ChBenchmarkTest::Simulate(int num_steps) {
     ////std::cout << "  simulate from t=" << GetSystem()->GetChTime() << " for steps=" << num_steps << std::endl;
@@ -84,7 +89,10 @@ inline void ChBenchmarkTest::Simulate(int num_steps) {
         m_timer_collision_narrow += GetSystem()->GetTimerCollisionNarrow();
         m_timer_setup += GetSystem()->GetTimerSetup();
         m_timer_update += GetSystem()->GetTimerUpdate();
+        if (auto solver = std::dynamic_pointer_cast<ChIterativeSolver>(GetSystem()->GetSolver()))
+            m_solver_iterations += solver->GetIterations();
     }
+    m_num_steps += num_steps;
 }
 
 inline void ChBenchmarkTest::ResetTimers() {
@@ -98,6 +106,8 @@ inline void ChBenchmarkTest::ResetTimers() {
     m_timer_collision_narrow = 0;
     m_timer_setup = 0;
     m_timer_update = 0;
+    m_solver_iterations = 0;
+    m_num_steps = 0;
 }
 
 // =============================================================================
@@ -171,6 +181,8 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
         st.counters["CD_Total"] = m_test->m_timer_collision * 1e3;
         st.counters["CD_Broad"] = m_test->m_timer_collision_broad * 1e3;
         st.counters["CD_Narrow"] = m_test->m_timer_collision_narrow * 1e3;
+        if (m_test->m_solver_iterations > 0)
+            st.counters["LS_Iterations"] = m_test->m_solver_iterations / (double)m_test->m_num_steps;
     }
 
     void Reset(int num_init_steps) {
@@ -20,15 +20,35 @@
 #ifndef CHFSI_CUSTOM_MATH_H
 #define CHFSI_CUSTOM_MATH_H
 
-#include <cuda_runtime.h>
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <cuda_runtime.h>
+#else
+    #include "chrono_gpu/utils/ChCudaHostRuntime.h"
+    // Function qualifiers, as defined by cuda_runtime.h in CUDA builds
+    #ifndef __host__
+        #define __host__
+    #endif
+    #ifndef __device__
+        #define __device__
+    #endif
+    #if defined(_MSC_VER) && !defined(__inline__)
+        #define __inline__ inline
+    #endif
+#endif
 #ifndef __CUDACC__
 #include <cmath>
 #endif
-#include "chrono_fsi/ChConfigFSI.h"
 
 namespace chrono {
 namespace fsi {
 
+#ifndef CHRONO_FSI_USE_CUDA
+// Without CUDA, the vector types and runtime functions are provided by the host runtime
+using namespace chrono::cuda_host;
+#endif
+
 /// @addtogroup fsi_math
 /// @{
 
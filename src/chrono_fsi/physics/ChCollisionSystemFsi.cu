@@ -15,6 +15,7 @@
 // Base class for processing proximity in fsi system.
 // =============================================================================
 
+#include <thrust/gather.h>
 #include <thrust/sort.h>
 #include "chrono_fsi/physics/ChCollisionSystemFsi.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
@@ -77,6 +78,7 @@ __global__ void calcHashD(uint* gridMarkerHashD,   // gridMarkerHash Store parti
     gridMarkerIndexD[index] = index;
 }
 // ------------------------------------------------------------------------------
+#ifdef CHRONO_FSI_USE_CUDA
 __global__ void reorderDataAndFindCellStartD(uint* cellStartD,          // output: cell start index
                                              uint* cellEndD,            // output: cell end index
                                              Real4* sortedPosRadD,      // output: sorted positions
@@ -213,6 +215,55 @@ __global__ void findCellStartEndD(uint* cellStartD,         // output: cell star
             cellEndD[hash] = index + 1;
     }
 }
+#else
+// Host version of findCellStartEndD. The CUDA kernel caches the hashes of a block in shared memory; here, the hash of
+// the previous marker is read directly from the sorted array.
+static void findCellStartEndH(uint* cellStartD,       // output: cell start index
+                              uint* cellEndD,         // output: cell end index
+                              uint* gridMarkerHashD,  // input: sorted grid hashes
+                              int numMarkers          // input: number of markers
+                              ) {
+#pragma omp parallel for
+    for (int index = 0; index < numMarkers; index++) {
+        uint hash = gridMarkerHashD[index];
+        if (index == 0 || hash != gridMarkerHashD[index - 1]) {
+            cellStartD[hash] = index;
+            if (index > 0)
+                cellEndD[gridMarkerHashD[index - 1]] = index;
+        }
+        if (index == numMarkers - 1)
+            cellEndD[hash] = index + 1;
+    }
+}
+// ------------------------------------------------------------------------------
+// Spread the lower 21 bits of v so that there are two zero bits between consecutive bits.
+__device__ inline unsigned long long int mortonSpreadBits(unsigned long long int v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+// calcMortonKeyD :
+// Calculate the Morton (Z-order) key of the grid cell of each marker from its linear cell hash.
+__global__ void calcMortonKeyD(unsigned long long int* mortonKeyD,  // output: Morton key of the marker's cell
+                               uint* gridMarkerHashD                // input: grid hash of each marker
+                               ) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= numObjectsD.numAllMarkers)
+        return;
+
+    uint hash = gridMarkerHashD[index];
+    uint x = hash % paramsD.gridSize.x;
+    uint y = (hash / paramsD.gridSize.x) % paramsD.gridSize.y;
+    uint z = hash / (paramsD.gridSize.x * paramsD.gridSize.y);
+
+    mortonKeyD[index] = mortonSpreadBits(x) | (mortonSpreadBits(y) << 1) | (mortonSpreadBits(z) << 2);
+}
+#endif
 // ------------------------------------------------------------------------------
 __global__ void reorderDataD(uint* gridMarkerIndexD,     // input: sorted particle indices
                              uint* extendedActivityIdD,  // input: particles in an extended active sub-domain
@@ -340,7 +391,7 @@ void ChCollisionSystemFsi::calcHash() {
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
 
     // Execute Kernel
-    calcHashD<<<numBlocks, numThreads>>>(U1CAST(markersProximityD->gridMarkerHashD),
+    CH_FSI_LAUNCH(calcHashD, numBlocks, numThreads, U1CAST(markersProximityD->gridMarkerHashD),
         U1CAST(markersProximityD->gridMarkerIndexD), mR4CAST(sphMarkersD->posRadD), isErrorD);
 
     // Check for errors in kernel execution
@@ -375,22 +426,27 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
 
-    uint smemSize = sizeof(uint) * (numThreads + 1);
     // Find the start index and the end index of the sorted array in each cell
+#ifdef CHRONO_FSI_USE_CUDA
+    uint smemSize = sizeof(uint) * (numThreads + 1);
     findCellStartEndD<<<numBlocks, numThreads, smemSize>>>(
         U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD),          
         U1CAST(markersProximityD->gridMarkerHashD), U1CAST(markersProximityD->gridMarkerIndexD));
+#else
+    findCellStartEndH(U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD),
+                      U1CAST(markersProximityD->gridMarkerHashD), (int)numObjectsH->numAllMarkers);
+#endif
     cudaDeviceSynchronize();
     cudaCheckError();
 
     // Launch a kernel to find the location of original particles in the sorted arrays.
     // This is faster than using thrust::sort_by_key()
-    OriginalToSortedD<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(OriginalToSortedD, numBlocks, numThreads,
         U1CAST(markersProximityD->mapOriginalToSorted),
         U1CAST(markersProximityD->gridMarkerIndexD));
 
     // Reorder the arrays according to the sorted index of all particles
-    reorderDataD<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(reorderDataD, numBlocks, numThreads,
         U1CAST(markersProximityD->gridMarkerIndexD),
         U1CAST(fsiGeneralData->extendedActivityIdD),
         U1CAST(markersProximityD->mapOriginalToSorted),
@@ -409,9 +465,27 @@ void ChCollisionSystemFsi::ArrangeData(std::shared_ptr<SphMarkerDataD> otherSphM
     int numCells = cellsDim.x * cellsDim.y * cellsDim.z;
     ResetCellSize(numCells);
     calcHash();
+#ifdef CHRONO_FSI_USE_CUDA
     thrust::sort_by_key(markersProximityD->gridMarkerHashD.begin(), 
         markersProximityD->gridMarkerHashD.end(),
         markersProximityD->gridMarkerIndexD.begin());
+#else
+    // On the CPU, sort the markers along a Morton (Z-order) curve through the grid cells, so that markers in
+    // neighboring cells are also close in memory and the neighbor loops of the SPH kernels stay in cache.
+    // The markers of a cell are still contiguous, so the cell start/end arrays are indexed by the linear hash as before.
+    uint numThreads, numBlocks;
+    computeGridSize((uint)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
+
+    thrust::device_vector<unsigned long long int> mortonKeyD(numObjectsH->numAllMarkers);
+    CH_FSI_LAUNCH(calcMortonKeyD, numBlocks, numThreads, TCAST(mortonKeyD),
+                  U1CAST(markersProximityD->gridMarkerHashD));
+    thrust::sort_by_key(mortonKeyD.begin(), mortonKeyD.end(), markersProximityD->gridMarkerIndexD.begin());
+
+    // Bring the grid hashes in the same (sorted) order
+    thrust::device_vector<uint> gridMarkerHashD = markersProximityD->gridMarkerHashD;
+    thrust::gather(markersProximityD->gridMarkerIndexD.begin(), markersProximityD->gridMarkerIndexD.end(),
+                   gridMarkerHashD.begin(), markersProximityD->gridMarkerHashD.begin());
+#endif
     reorderDataAndFindCellStart();
 }
 
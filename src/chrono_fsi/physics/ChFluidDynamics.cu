@@ -15,6 +15,8 @@
 // Class for performing time integration in fluid system.
 // =============================================================================
 
+#include <iostream>
+
 #include "chrono_fsi/physics/ChFluidDynamics.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 
@@ -593,6 +595,7 @@ ChFluidDynamics::ChFluidDynamics(std::shared_ptr<ChBce> otherBceWorker,
       integrator_type(type),
       verbose(verb) {
     switch (integrator_type) {
+#ifdef CHRONO_FSI_USE_CUDA
         case TimeIntegrator::I2SPH:
             forceSystem = chrono_types::make_shared<ChFsiForceI2SPH>(
                 otherBceWorker, fsiSystem.sortedSphMarkersD, fsiSystem.markersProximityD, 
@@ -610,6 +613,12 @@ ChFluidDynamics::ChFluidDynamics(std::shared_ptr<ChBce> otherBceWorker,
                 cout << "====== Created an IISPH framework" << endl;
             }
             break;
+#else
+        case TimeIntegrator::I2SPH:
+        case TimeIntegrator::IISPH:
+            throw std::runtime_error(
+                "Chrono::FSI was built without CUDA; only the explicit WCSPH solver is available on the CPU.");
+#endif
 
         case TimeIntegrator::EXPLICITSPH:
             forceSystem = chrono_types::make_shared<ChFsiForceExplicitSPH>(
@@ -679,7 +688,7 @@ void ChFluidDynamics::UpdateActivity(std::shared_ptr<SphMarkerDataD> sphMarkersD
     //------------------------
     uint numBlocks, numThreads;
     computeGridSize(updatePortion.y - updatePortion.x, 256, numBlocks, numThreads);
-    UpdateActivityD<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(UpdateActivityD, numBlocks, numThreads,
         mR4CAST(sphMarkersD2->posRadD), mR3CAST(sphMarkersD1->velMasD), 
         mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
         mR3CAST(fsiMeshD->pos_fsi_fea_D),
@@ -711,7 +720,7 @@ void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, R
     //------------------------
     uint numBlocks, numThreads;
     computeGridSize(updatePortion.y - updatePortion.x, 256, numBlocks, numThreads);
-    UpdateFluidD<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(UpdateFluidD, numBlocks, numThreads,
         mR4CAST(sphMarkersD->posRadD), 
         mR3CAST(sphMarkersD->velMasD), 
         mR4CAST(sphMarkersD->rhoPresMuD), 
@@ -752,7 +761,7 @@ void ChFluidDynamics::UpdateFluid_Implicit(std::shared_ptr<SphMarkerDataD> sphMa
     cudaMalloc((void**)&isErrorD, sizeof(bool));
     *isErrorH = false;
     cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
-    Update_Fluid_State<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(Update_Fluid_State, numBlocks, numThreads,
         mR3CAST(fsiSystem.fsiGeneralData->vel_XSPH_D), 
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD), 
         mR4CAST(sphMarkersD->rhoPresMuD), updatePortion, paramsH->dT, isErrorD);
@@ -772,19 +781,19 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> s
     uint numBlocks, numThreads;
 
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
-    ApplyPeriodicBoundaryXKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(ApplyPeriodicBoundaryXKernel, numBlocks, numThreads,
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryYKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(ApplyPeriodicBoundaryYKernel, numBlocks, numThreads,
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryZKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(ApplyPeriodicBoundaryZKernel, numBlocks, numThreads,
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
@@ -803,20 +812,20 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> s
 void ChFluidDynamics::ApplyModifiedBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> sphMarkersD) {
     uint numBlocks, numThreads;
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
-    ApplyInletBoundaryXKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(ApplyInletBoundaryXKernel, numBlocks, numThreads,
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD),
         mR4CAST(sphMarkersD->rhoPresMuD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
     // these are useful anyway for out of bound particles
-    ApplyPeriodicBoundaryYKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(ApplyPeriodicBoundaryYKernel, numBlocks, numThreads,
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryZKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(ApplyPeriodicBoundaryZKernel, numBlocks, numThreads,
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
@@ -831,7 +840,7 @@ void ChFluidDynamics::DensityReinitialization() {
     thrust::device_vector<Real4> dummySortedRhoPreMu(numObjectsH->numAllMarkers);
     thrust::fill(dummySortedRhoPreMu.begin(), dummySortedRhoPreMu.end(), mR4(0.0));
 
-    ReCalcDensityD_F1<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(ReCalcDensityD_F1, numBlocks, numThreads,
         mR4CAST(dummySortedRhoPreMu), 
         mR4CAST(fsiSystem.sortedSphMarkersD->posRadD),
         mR3CAST(fsiSystem.sortedSphMarkersD->velMasD), 
@@ -59,6 +59,7 @@ void ChFsiForce::Initialize() {
 ChFsiForce::~ChFsiForce() {}
 
 void ChFsiForce::SetLinearSolver(SolverType type) {
+#ifdef CHRONO_FSI_USE_CUDA
     switch (type) {
         case SolverType::BICGSTAB:
             myLinearSolver = chrono_types::make_shared<ChFsiLinearSolverBiCGStab>();
@@ -71,6 +72,10 @@ void ChFsiForce::SetLinearSolver(SolverType type) {
             std::cout << "The ChFsiLinearSolver you chose has not been implemented, reverting back to "
                          "ChFsiLinearSolverBiCGStab\n";
     }
+#else
+    // The linear solvers are only used by the implicit SPH methods and require cuSPARSE and cuBLAS
+    myLinearSolver = nullptr;
+#endif
 }
 //--------------------------------------------------------------------------------------------------------------------------------
 // Use invasive to avoid one extra copy.
@@ -1651,7 +1651,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
 
     // Calculate the kernel support of each particle
     if (paramsH->bceTypeWall == BceVersion::ADAMI || paramsH->bceType == BceVersion::ADAMI){
-        calcKernelSupport<<<numBlocks, numThreads>>>(
+        CH_FSI_LAUNCH(calcKernelSupport, numBlocks, numThreads,
             mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD),
             mR3CAST(sortedKernelSupport), U1CAST(markersProximityD->cellStartD),
             U1CAST(markersProximityD->cellEndD), isErrorD);
@@ -1662,7 +1662,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
     if (density_initialization >= paramsH->densityReinit) {
         thrust::device_vector<Real4> rhoPresMuD_old = sortedSphMarkersD->rhoPresMuD;
         printf("Re-initializing density after %d steps.\n", paramsH->densityReinit);
-        calcRho_kernel<<<numBlocks, numThreads>>>(
+        CH_FSI_LAUNCH(calcRho_kernel, numBlocks, numThreads,
             mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD), 
             mR4CAST(rhoPresMuD_old), U1CAST(markersProximityD->cellStartD), 
             U1CAST(markersProximityD->cellEndD), density_initialization, isErrorD);
@@ -1677,7 +1677,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
         cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
 
         // execute the kernel Navier_Stokes and Shear_Stress_Rate in one kernel
-        NS_SSR<<<numBlocks, numThreads>>>(
+        CH_FSI_LAUNCH(NS_SSR, numBlocks, numThreads,
             U1CAST(fsiGeneralData->activityIdentifierD), mR4CAST(sortedDerivVelRho), 
             mR3CAST(sortedDerivTauXxYyZz), mR3CAST(sortedDerivTauXyXzYz), mR3CAST(sortedXSPHandShift), 
             mR3CAST(sortedKernelSupport), mR4CAST(sortedSphMarkersD->posRadD), 
@@ -1696,13 +1696,13 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
         // Find the index which is related to the wall boundary particle
         thrust::device_vector<uint> indexOfIndex(numObjectsH->numAllMarkers);
         thrust::device_vector<uint> identityOfIndex(numObjectsH->numAllMarkers);
-        calIndexOfIndex<<<numBlocks, numThreads>>>(
+        CH_FSI_LAUNCH(calIndexOfIndex, numBlocks, numThreads,
             U1CAST(indexOfIndex), U1CAST(identityOfIndex), U1CAST(markersProximityD->gridMarkerIndexD));
         thrust::remove_if(indexOfIndex.begin(), indexOfIndex.end(), 
             identityOfIndex.begin(), thrust::identity<int>());
 
         // execute the kernel
-        Navier_Stokes<<<numBlocks1, numThreads1>>>(
+        CH_FSI_LAUNCH(Navier_Stokes, numBlocks1, numThreads1,
             U1CAST(indexOfIndex), mR4CAST(sortedDerivVelRho), mR3CAST(sortedXSPHandShift),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(bceWorker->velMas_ModifiedBCE),
@@ -1713,7 +1713,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
 
     // Launch a kernel to copy data from sorted arrays to original arrays.
     // This is faster than using thrust::sort_by_key()
-    CopySortedToOriginal_D<<<numBlocks, numThreads>>>(
+    CH_FSI_LAUNCH(CopySortedToOriginal_D, numBlocks, numThreads,
         mR4CAST(sortedDerivVelRho), mR3CAST(sortedDerivTauXxYyZz), mR3CAST(sortedDerivTauXyXzYz),
         mR4CAST(fsiGeneralData->derivVelRhoD), mR3CAST(fsiGeneralData->derivTauXxYyZzD),
         mR3CAST(fsiGeneralData->derivTauXyXzYzD), U1CAST(markersProximityD->gridMarkerIndexD),
@@ -1753,7 +1753,7 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
     //------------------------------------------------------------------------
     if (paramsH->elastic_SPH) {
         // The XSPH vector already included in the shifting vector
-        CopySortedToOriginal_XSPH_D<<<numBlocks, numThreads>>>(
+        CH_FSI_LAUNCH(CopySortedToOriginal_XSPH_D, numBlocks, numThreads,
             mR3CAST(sortedXSPHandShift), mR3CAST(fsiGeneralData->vel_XSPH_D),
             U1CAST(markersProximityD->gridMarkerIndexD), 
             U1CAST(fsiGeneralData->activityIdentifierD),
@@ -1768,14 +1768,14 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
         // Find the index which is related to the wall boundary particle
         thrust::device_vector<uint> indexOfIndex(numObjectsH->numAllMarkers);
         thrust::device_vector<uint> identityOfIndex(numObjectsH->numAllMarkers);
-        calIndexOfIndex<<<numBlocks, numThreads>>>(
+        CH_FSI_LAUNCH(calIndexOfIndex, numBlocks, numThreads,
             U1CAST(indexOfIndex), U1CAST(identityOfIndex), 
             U1CAST(markersProximityD->gridMarkerIndexD));
         thrust::remove_if(indexOfIndex.begin(), indexOfIndex.end(), 
             identityOfIndex.begin(), thrust::identity<int>());
 
         // Execute the kernel
-        CalcVel_XSPH_D<<<numBlocks1, numThreads1>>>(
+        CH_FSI_LAUNCH(CalcVel_XSPH_D, numBlocks1, numThreads1,
             U1CAST(indexOfIndex), mR3CAST(vel_XSPH_Sorted_D),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(sortedXSPHandShift),
@@ -1783,7 +1783,7 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
             U1CAST(markersProximityD->cellEndD), isErrorD);
         ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "CalcVel_XSPH_D");
 
-        CopySortedToOriginal_XSPH_D<<<numBlocks, numThreads>>>(
+        CH_FSI_LAUNCH(CopySortedToOriginal_XSPH_D, numBlocks, numThreads,
             mR3CAST(vel_XSPH_Sorted_D), mR3CAST(fsiGeneralData->vel_XSPH_D),
             U1CAST(markersProximityD->gridMarkerIndexD), 
             U1CAST(fsiGeneralData->activityIdentifierD),
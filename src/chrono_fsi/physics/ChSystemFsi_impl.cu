@@ -17,6 +17,9 @@
 //
 // =============================================================================
 
+#include <cassert>
+#include <iostream>
+
 #include <thrust/copy.h>
 #include <thrust/gather.h>
 #include <thrust/for_each.h>
@@ -18,7 +18,13 @@
 #ifndef CH_UTILS_DEVICE_H
 #define CH_UTILS_DEVICE_H
 
-#include <cuda_runtime.h>
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <cuda_runtime.h>
+#else
+    #include "chrono_gpu/utils/ChCudaHostKernel.h"
+#endif
 
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
@@ -85,6 +91,19 @@ typedef unsigned int uint;
     #define CUDA_KERNEL_DIM(...) << <__VA_ARGS__>>>
 #endif
 
+// ----------------------------------------------------------------------------
+// Kernel launch
+// ----------------------------------------------------------------------------
+
+/// Launch a kernel over a grid of numBlocks x numThreads threads.
+/// Without CUDA, the grid is executed on the host with OpenMP (see ChCudaHostRuntime.h).
+#ifdef CHRONO_FSI_USE_CUDA
+    #define CH_FSI_LAUNCH(kernel, numBlocks, numThreads, ...) kernel<<<numBlocks, numThreads>>>(__VA_ARGS__)
+#else
+    #define CH_FSI_LAUNCH(kernel, numBlocks, numThreads, ...) \
+        chrono::cuda_host::LaunchKernel(numBlocks, numThreads, [&]() { kernel(__VA_ARGS__); })
+#endif
+
 // ----------------------------------------------------------------------------
 // Values
 // ----------------------------------------------------------------------------
@@ -15,19 +15,34 @@
 #pragma once
 
 #include <climits>
-#include <cuda_runtime.h>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
 
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cuda_runtime.h>
+#else
+    #include "chrono_gpu/utils/ChCudaHostRuntime.h"
+#endif
+
 namespace chrono {
 namespace gpu {
 
+#ifndef CHRONO_GPU_USE_CUDA
+// Without CUDA, the vector types used in the public API are provided by the host runtime. Only these types are made
+// visible here (with CUDA, they are declared in the global namespace); the runtime functions must be qualified.
+using chrono::cuda_host::double3;
+using chrono::cuda_host::float3;
+using chrono::cuda_host::int3;
+#endif
+
 /// Used to compute position as a function of time.
 typedef std::function<double3(float)> GranPositionFunction;
 
 /// Position function representing no motion or offset as a funtion of time.
-const GranPositionFunction GranPosFunction_default = [](float t) { return make_double3(0, 0, 0); };
+const GranPositionFunction GranPosFunction_default = [](float t) { return double3{0, 0, 0}; };
 
 /// Verbosity level of the system.
 enum class CHGPU_VERBOSITY { QUIET = 0, INFO = 1, METRICS = 2 };
@@ -58,7 +73,11 @@ enum CHGPU_OUTPUT_FLAGS { ABSV = 1, VEL_COMPONENTS = 2, FIXITY = 4, ANG_VEL_COMP
 }  // namespace gpu
 }  // namespace chrono
 
+#ifdef CHRONO_GPU_USE_CUDA
 typedef longlong3 int64_t3;
+#else
+typedef chrono::cuda_host::longlong3 int64_t3;
+#endif
 
 constexpr size_t BD_WALL_ID_X_BOT = 0;
 constexpr size_t BD_WALL_ID_X_TOP = 1;
@@ -103,7 +122,12 @@ constexpr int warp_size = 32;
 ///  Some nice suggestions for how to use the mechanism are provided at the above link.
 ///
 #define gpuErrchk(ans) \
-    { gpuAssert((ans), __FILE__, __LINE__); }
+    { chrono::gpu::gpuAssert((ans), __FILE__, __LINE__); }
+
+namespace chrono {
+namespace gpu {
+
+#ifdef CHRONO_GPU_USE_CUDA
 inline void gpuAssert(cudaError_t code, const char* file, int line, bool abort = true) {
     if (code != cudaSuccess) {
         fprintf(stderr, "GPUassert: %s %s %d\n", cudaGetErrorString(code), file, line);
@@ -111,6 +135,18 @@ inline void gpuAssert(cudaError_t code, const char* file, int line, bool abort =
             exit(code);
     }
 }
+#else
+inline void gpuAssert(cuda_host::cudaError_t code, const char* file, int line, bool abort = true) {
+    if (code != cuda_host::cudaSuccess) {
+        fprintf(stderr, "GPUassert: %s %s %d\n", cuda_host::cudaGetErrorString(code), file, line);
+        if (abort)
+            exit(code);
+    }
+}
+#endif
+
+}  // namespace gpu
+}  // namespace chrono
 
 // Add verbose checks easily
 #define INFO_PRINTF(...)                                                               \
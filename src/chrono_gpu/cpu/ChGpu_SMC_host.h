@@ -0,0 +1,227 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Host implementations of the block-level kernels in ChGpu_SMC.cuh.
+//
+// On the GPU, these kernels are launched with one block per subdomain (SD):
+// the threads of a block first cache the data of the spheres touching the SD
+// in shared memory and then each thread processes one of these spheres. Here,
+// each SD is processed by one OpenMP thread which caches the sphere data in a
+// thread-private buffer and then loops over the SD spheres. All per-sphere
+// computations are done with the same device functions as the CUDA kernels.
+//
+// =============================================================================
+
+#pragma once
+
+#include "chrono_gpu/cuda/ChGpu_SMC.cuh"
+
+/// @addtogroup gpu_cuda
+/// @{
+
+/// Data of the spheres touching a subdomain, with positions relative to that subdomain.
+struct SDSphereCache {
+    unsigned int count;                              ///< number of spheres touching the SD
+    unsigned int IDs[MAX_COUNT_OF_SPHERES_PER_SD];   ///< global sphere IDs
+    int3 pos[MAX_COUNT_OF_SPHERES_PER_SD];           ///< positions relative to the SD
+    float3 vel[MAX_COUNT_OF_SPHERES_PER_SD];         ///< linear velocities
+    float3 omega[MAX_COUNT_OF_SPHERES_PER_SD];       ///< angular velocities (only with friction)
+    not_stupid_bool fixed[MAX_COUNT_OF_SPHERES_PER_SD];  ///< fixity flags
+};
+
+/// Load the data of the spheres touching the given SD. Return false if no sphere touches this SD.
+inline bool loadSDSpheres(unsigned int thisSD,
+                          ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                          ChSystemGpu_impl::GranParamsPtr gran_params,
+                          SDSphereCache& cache) {
+    unsigned int spheresTouchingThisSD = sphere_data->SD_NumSpheresTouching[thisSD];
+    cache.count = spheresTouchingThisSD;
+    if (spheresTouchingThisSD == 0) {
+        return false;  // no spheres here, move along
+    }
+
+    // If we overran, we have a major issue, time to crash before we make illegal memory accesses
+    if (spheresTouchingThisSD > MAX_COUNT_OF_SPHERES_PER_SD) {
+        ABORTABORTABORT("TOO MANY SPHERES! SD %u has %u spheres\n", thisSD, spheresTouchingThisSD);
+    }
+
+    bool load_omega = gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS;
+    size_t SD_composite_offset = sphere_data->SD_SphereCompositeOffsets[thisSD];
+
+    for (unsigned int i = 0; i < spheresTouchingThisSD; i++) {
+        unsigned int mySphereID = sphere_data->spheres_in_SD_composite[SD_composite_offset + i];
+        cache.IDs[i] = mySphereID;
+        cache.pos[i] = make_int3(sphere_data->sphere_local_pos_X[mySphereID], sphere_data->sphere_local_pos_Y[mySphereID],
+                                 sphere_data->sphere_local_pos_Z[mySphereID]);
+
+        // if this SD doesn't own that sphere, add an offset to account
+        unsigned int sphere_owner_SD = sphere_data->sphere_owner_SDs[mySphereID];
+        if (sphere_owner_SD != thisSD) {
+            cache.pos[i] = cache.pos[i] + getOffsetFromSDs(thisSD, sphere_owner_SD, gran_params);
+        }
+
+        cache.vel[i] = make_float3(sphere_data->pos_X_dt[mySphereID], sphere_data->pos_Y_dt[mySphereID],
+                                   sphere_data->pos_Z_dt[mySphereID]);
+        if (load_omega) {
+            cache.omega[i] = make_float3(sphere_data->sphere_Omega_X[mySphereID], sphere_data->sphere_Omega_Y[mySphereID],
+                                         sphere_data->sphere_Omega_Z[mySphereID]);
+        }
+        cache.fixed[i] = sphere_data->sphere_fixed[mySphereID];
+    }
+
+    return true;
+}
+
+/// Collect the spheres in the SD cache that are in contact with sphere 'bodyA'. Return the number of contacts.
+inline unsigned int findSDContacts(unsigned int thisSD,
+                                   const SDSphereCache& cache,
+                                   unsigned int bodyA,
+                                   ChSystemGpu_impl::GranParamsPtr gran_params,
+                                   unsigned char bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE]) {
+    unsigned int ncontacts = 0;
+    for (unsigned int bodyB = 0; bodyB < cache.count; bodyB++) {
+        if (bodyA == bodyB || (cache.fixed[bodyA] && cache.fixed[bodyB])) {
+            continue;
+        }
+
+        if (checkSpheresContacting_int(cache.pos[bodyA], cache.pos[bodyB], thisSD, gran_params)) {
+            if (ncontacts >= MAX_SPHERES_TOUCHED_BY_SPHERE) {
+                ABORTABORTABORT("Sphere %u is touching 12 spheres already and we just found another!!!\n",
+                                cache.IDs[bodyA]);
+            }
+            bodyB_list[ncontacts] = (unsigned char)bodyB;  // Save the collision pair
+            ncontacts++;                                   // Increment the contact counter
+        }
+    }
+    return ncontacts;
+}
+
+/// Count the number of spheres touching each SD (host version of getNumberOfSpheresTouchingEachSD).
+inline void countSpheresTouchingEachSD_host(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                            unsigned int nSpheres,
+                                            ChSystemGpu_impl::GranParamsPtr gran_params) {
+#pragma omp parallel for
+    for (int mySphereID = 0; mySphereID < (int)nSpheres; mySphereID++) {
+        unsigned int SDsTouched[MAX_SDs_TOUCHED_BY_SPHERE] = {NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
+                                                              NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
+                                                              NULL_CHGPU_ID, NULL_CHGPU_ID};
+        int3 ownerSD_triplet = SDIDTriplet(sphere_data->sphere_owner_SDs[mySphereID], gran_params);
+        figureOutTouchedSD(sphere_data->sphere_local_pos_X[mySphereID], sphere_data->sphere_local_pos_Y[mySphereID],
+                           sphere_data->sphere_local_pos_Z[mySphereID], ownerSD_triplet, SDsTouched, gran_params);
+
+        for (unsigned int i = 0; i < MAX_SDs_TOUCHED_BY_SPHERE; i++) {
+            if (SDsTouched[i] != NULL_CHGPU_ID) {
+                atomicAdd(sphere_data->SD_NumSpheresTouching + SDsTouched[i], 1u);
+            }
+        }
+    }
+}
+
+/// Mark all sphere-sphere contacts in the contact map (host version of determineContactPairs).
+inline void determineContactPairs_host(unsigned int nSDs,
+                                       ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                       ChSystemGpu_impl::GranParamsPtr gran_params) {
+#pragma omp parallel
+    {
+        SDSphereCache cache;
+        unsigned char bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
+
+#pragma omp for schedule(dynamic, 16)
+        for (int thisSD = 0; thisSD < (int)nSDs; thisSD++) {
+            if (!loadSDSpheres(thisSD, sphere_data, gran_params, cache))
+                continue;
+
+            for (unsigned int bodyA = 0; bodyA < cache.count; bodyA++) {
+                unsigned int ncontacts = findSDContacts(thisSD, cache, bodyA, gran_params, bodyB_list);
+                // for each contact we just found, mark it in the global map
+                for (unsigned int contact_id = 0; contact_id < ncontacts; contact_id++) {
+                    findContactPairInfo(sphere_data, gran_params, cache.IDs[bodyA],
+                                        cache.IDs[bodyB_list[contact_id]]);
+                }
+            }
+        }
+    }
+}
+
+/// Compute frictionless sphere-sphere and sphere-boundary forces (host version of computeSphereForces_frictionless
+/// and, if MAT_BASED, of computeSphereForces_frictionless_matBased).
+template <bool MAT_BASED>
+void computeSphereForces_frictionless_host(unsigned int nSDs,
+                                           ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                           ChSystemGpu_impl::GranParamsPtr gran_params,
+                                           BC_type* bc_type_list,
+                                           BC_params_t<int64_t, int64_t3>* bc_params_list,
+                                           unsigned int nBCs) {
+#pragma omp parallel
+    {
+        SDSphereCache cache;
+        unsigned char bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
+
+#pragma omp for schedule(dynamic, 16)
+        for (int thisSD = 0; thisSD < (int)nSDs; thisSD++) {
+            if (!loadSDSpheres(thisSD, sphere_data, gran_params, cache))
+                continue;
+
+            // Each body looks at each other body and computes the force that the other body exerts on it
+            for (unsigned int bodyA = 0; bodyA < cache.count; bodyA++) {
+                unsigned int mySphereID = cache.IDs[bodyA];
+                unsigned int ncontacts = findSDContacts(thisSD, cache, bodyA, gran_params, bodyB_list);
+
+                // Force generated on this sphere
+                float3 bodyA_force = {0.f, 0.f, 0.f};
+
+                for (unsigned int idx = 0; idx < ncontacts; idx++) {
+                    // who am I colliding with?
+                    unsigned char bodyB = bodyB_list[idx];
+
+                    float3 vrel_t;  // unused but needed for function signature
+                    float3 force_accum;
+                    if (MAT_BASED) {
+                        float sqrt_Rd;  // unused but needed for function signature
+                        float beta;
+                        float3 contact_normal;
+                        force_accum = computeSphereNormalForces_matBased(
+                            vrel_t, contact_normal, sqrt_Rd, beta, cache.pos[bodyA], cache.pos[bodyB],
+                            cache.vel[bodyA], cache.vel[bodyB], gran_params);
+                        // Add cohesion term
+                        force_accum =
+                            force_accum - gran_params->sphere_mass_SU * gran_params->cohesionAcc_s2s * contact_normal;
+                    } else {
+                        float reciplength;  // used to compute contact normal
+                        float3 delta_r;     // used for contact normal
+                        force_accum =
+                            computeSphereNormalForces(reciplength, vrel_t, delta_r, cache.pos[bodyA], cache.pos[bodyB],
+                                                      cache.vel[bodyA], cache.vel[bodyB], gran_params);
+                        // Add cohesion term
+                        force_accum = force_accum - gran_params->sphere_mass_SU * gran_params->cohesionAcc_s2s *
+                                                        delta_r * reciplength;
+                    }
+                    bodyA_force = bodyA_force + force_accum;
+                }
+
+                // If this SD owns the body, add its wall, BC, and grav forces (avoid double counting)
+                unsigned int myOwnerSD = sphere_data->sphere_owner_SDs[mySphereID];
+                if (myOwnerSD == (unsigned int)thisSD) {
+                    applyExternalForces_frictionless(myOwnerSD, cache.pos[bodyA], cache.vel[bodyA], bodyA_force,
+                                                     gran_params, sphere_data, bc_type_list, bc_params_list, nBCs);
+                }
+
+                // Spheres touching several SDs receive contributions from several OpenMP threads
+                atomicAdd(sphere_data->sphere_acc_X + mySphereID, bodyA_force.x / gran_params->sphere_mass_SU);
+                atomicAdd(sphere_data->sphere_acc_Y + mySphereID, bodyA_force.y / gran_params->sphere_mass_SU);
+                atomicAdd(sphere_data->sphere_acc_Z + mySphereID, bodyA_force.z / gran_params->sphere_mass_SU);
+            }
+        }
+    }
+}
+
+/// @} gpu_cuda
@@ -0,0 +1,253 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Host implementation of the block-level sphere-triangle interaction kernels in
+// ChGpu_SMC_trimesh.cu (see ChGpu_SMC_host.h).
+//
+// =============================================================================
+
+#pragma once
+
+#include "chrono_gpu/cuda/ChGpu_SMC_trimesh.cuh"
+#include "chrono_gpu/cpu/ChGpu_SMC_host.h"
+
+/// @addtogroup gpu_cuda
+/// @{
+
+/// Triangles touching a subdomain, with node positions in the global frame (SU).
+struct SDTriangleCache {
+    unsigned int IDs[MAX_TRIANGLE_COUNT_PER_SD];  ///< global triangle IDs
+    double3 node1[MAX_TRIANGLE_COUNT_PER_SD];     ///< coordinates of the 1st node of the triangle
+    double3 node2[MAX_TRIANGLE_COUNT_PER_SD];     ///< coordinates of the 2nd node of the triangle
+    double3 node3[MAX_TRIANGLE_COUNT_PER_SD];     ///< coordinates of the 3rd node of the triangle
+};
+
+/// Host version of the interactionGranMat_TriangleSoup kernels (interactionGranMat_TriangleSoup_matBased if
+/// MAT_BASED). Each SD is processed by one OpenMP thread; the contact force computation follows the CUDA kernels.
+template <bool MAT_BASED>
+void interactionGranMat_TriangleSoup_host(unsigned int nSDs,
+                                          ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                          ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                          const unsigned int* SD_trianglesInEachSD_composite,
+                                          const unsigned int* SD_numTrianglesTouching,
+                                          const unsigned int* SD_TrianglesCompositeOffsets,
+                                          ChSystemGpu_impl::GranParamsPtr gran_params,
+                                          ChSystemGpuMesh_impl::MeshParamsPtr mesh_params,
+                                          unsigned int triangleFamilyHistmapOffset) {
+    bool friction = gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS;
+
+#pragma omp parallel
+    {
+        SDSphereCache spheres;
+        SDTriangleCache triangles;
+
+#pragma omp for schedule(dynamic, 16)
+        for (int thisSD = 0; thisSD < (int)nSDs; thisSD++) {
+            unsigned int numSDTriangles = SD_numTrianglesTouching[thisSD];
+            if (numSDTriangles == 0)
+                continue;  // no triangle touches this SD
+            if (!loadSDSpheres(thisSD, sphere_data, gran_params, spheres))
+                continue;  // no sphere touches this SD
+
+            // Getting here means that there are both triangles and DEs in this SD.
+            size_t SD_composite_offset = SD_TrianglesCompositeOffsets[thisSD];
+            for (unsigned int local_ID = 0; local_ID < numSDTriangles; local_ID++) {
+                unsigned int globalID = SD_trianglesInEachSD_composite[SD_composite_offset + local_ID];
+                triangles.IDs[local_ID] = globalID;
+
+                unsigned int fam = d_triangleSoup->triangleFamily_ID[globalID];
+                triangles.node1[local_ID] = apply_frame_transform<double, float3, double3>(
+                    d_triangleSoup->node1[globalID], mesh_params->fam_frame_narrow[fam].pos,
+                    mesh_params->fam_frame_narrow[fam].rot_mat);
+                triangles.node2[local_ID] = apply_frame_transform<double, float3, double3>(
+                    d_triangleSoup->node2[globalID], mesh_params->fam_frame_narrow[fam].pos,
+                    mesh_params->fam_frame_narrow[fam].rot_mat);
+                triangles.node3[local_ID] = apply_frame_transform<double, float3, double3>(
+                    d_triangleSoup->node3[globalID], mesh_params->fam_frame_narrow[fam].pos,
+                    mesh_params->fam_frame_narrow[fam].rot_mat);
+
+                convert_pos_UU2SU<double3>(triangles.node1[local_ID], gran_params);
+                convert_pos_UU2SU<double3>(triangles.node2[local_ID], gran_params);
+                convert_pos_UU2SU<double3>(triangles.node3[local_ID], gran_params);
+            }
+
+            for (unsigned int sphereIDLocal = 0; sphereIDLocal < spheres.count; sphereIDLocal++) {
+                unsigned int sphereIDGlobal = spheres.IDs[sphereIDLocal];
+                float3 sphere_force = {0.f, 0.f, 0.f};
+                float3 sphere_AngAcc = {0.f, 0.f, 0.f};
+
+                // NOTE sphere position is relative to THIS SD, not its owner SD
+                double3 sphCntr =
+                    int64_t3_to_double3(convertPosLocalToGlobal(thisSD, spheres.pos[sphereIDLocal], gran_params));
+
+                for (unsigned int triangleLocalID = 0; triangleLocalID < numSDTriangles; triangleLocalID++) {
+                    float3 normal;  // Unit normal from pt2 to pt1 (triangle contact point to sphere contact point)
+                    float depth;    // Negative in overlap
+                    double3 pt1;    // Contact point on triangle
+
+                    bool valid_contact =
+                        face_sphere_cd(triangles.node1[triangleLocalID], triangles.node2[triangleLocalID],
+                                       triangles.node3[triangleLocalID], sphCntr, gran_params->sphereRadius_SU, normal,
+                                       depth, pt1);
+                    valid_contact = valid_contact && SDTripletID(pointSDTriplet(pt1.x, pt1.y, pt1.z, gran_params),
+                                                                 gran_params) == (unsigned int)thisSD;
+                    if (!valid_contact)
+                        continue;
+
+                    const unsigned int fam = d_triangleSoup->triangleFamily_ID[triangles.IDs[triangleLocalID]];
+                    float3 pt1_float = make_float3((float)pt1.x, (float)pt1.y, (float)pt1.z);
+
+                    // vector from center of mesh body to contact point, assume this can be held in a float
+                    double3 meshCenter_double =
+                        make_double3(mesh_params->fam_frame_narrow[fam].pos[0], mesh_params->fam_frame_narrow[fam].pos[1],
+                                     mesh_params->fam_frame_narrow[fam].pos[2]);
+                    convert_pos_UU2SU<double3>(meshCenter_double, gran_params);
+                    double3 fromCenter_double = pt1 - meshCenter_double;
+                    float3 fromCenter =
+                        make_float3((float)fromCenter_double.x, (float)fromCenter_double.y, (float)fromCenter_double.z);
+
+                    // Use the CD information to compute the force on the grElement
+                    // normal points from triangle to sphere
+                    float3 delta = -depth * normal;
+
+                    // effective mass = mass_mesh * mass_sphere / (m_mesh + mass_sphere)
+                    float fam_mass_SU = d_triangleSoup->familyMass_SU[fam];
+                    const float sphere_mass_SU = gran_params->sphere_mass_SU;
+                    float m_eff = sphere_mass_SU * fam_mass_SU / (sphere_mass_SU + fam_mass_SU);
+
+                    // relative velocity = v_sphere - v_mesh
+                    float3 v_rel = spheres.vel[sphereIDLocal] - d_triangleSoup->vel[fam];
+
+                    // assumes pos is the center of mass of the mesh
+                    float3 meshCenter =
+                        make_float3(mesh_params->fam_frame_broad[fam].pos[0], mesh_params->fam_frame_broad[fam].pos[1],
+                                    mesh_params->fam_frame_broad[fam].pos[2]);
+                    convert_pos_UU2SU<float3>(meshCenter, gran_params);
+
+                    // NOTE depth is negative and normal points from triangle to sphere center
+                    float3 r = pt1_float + normal * (depth / 2) - meshCenter;
+
+                    // Add angular velocity contribution from mesh
+                    v_rel = v_rel - Cross(d_triangleSoup->omega[fam], r);
+
+                    // add tangential components if they exist
+                    if (friction) {
+                        // Vector from the center of sphere to center of contact volume
+                        float3 r_A = -(gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                        v_rel = v_rel + Cross(spheres.omega[sphereIDLocal], r_A);
+                    }
+
+                    float3 force_accum;
+                    float3 vrel_t;
+                    float sqrt_Rd = 0;
+                    float beta = 0;
+                    float hertz_force_factor = 0;
+                    if (MAT_BASED) {
+                        sqrt_Rd = sqrt(abs(depth) * gran_params->sphereRadius_SU);
+                        float Sn = 2.f * mesh_params->E_eff_s2m_SU * sqrt_Rd;
+
+                        float loge = (mesh_params->COR_s2m_SU < EPSILON) ? log(EPSILON) : log(mesh_params->COR_s2m_SU);
+                        beta = loge / sqrt(loge * loge + CUDART_PI_F * CUDART_PI_F);
+
+                        // stiffness and damping coefficient
+                        float kn = (2.0f / 3.0f) * Sn;
+                        float gn = 2 * sqrt(5.0f / 6.0f) * beta * sqrt(Sn * m_eff);
+
+                        // normal and tangential components of relative velocity
+                        float projection = Dot(v_rel, normal);
+                        vrel_t = v_rel - projection * normal;
+
+                        // normal force magnitude
+                        float forceN_mag = -kn * depth + gn * projection;
+                        force_accum = forceN_mag * normal;
+                    } else {
+                        // effective radius is just sphere radius -- assume meshes are locally flat
+                        hertz_force_factor = sqrt(abs(depth) / gran_params->sphereRadius_SU);
+                        force_accum = hertz_force_factor * mesh_params->K_n_s2m_SU * delta;
+
+                        float3 vrel_n = Dot(v_rel, normal) * normal;
+                        vrel_t = v_rel - vrel_n;
+
+                        // Add normal damping term
+                        force_accum = force_accum - hertz_force_factor * mesh_params->Gamma_n_s2m_SU * m_eff * vrel_n;
+                    }
+
+                    // Compute force updates for adhesion term, opposite the spring term
+                    // NOTE ratio is wrt the weight of a sphere of mass 1
+                    // NOTE the cancelation of two negatives
+                    force_accum = force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
+
+                    // tangential component
+                    if (friction) {
+                        // radius pointing from the contact point to the center of particle
+                        float3 Rc = (gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                        float3 roll_ang_acc = computeRollingAngAcc(
+                            sphere_data, gran_params, mesh_params->rolling_coeff_s2m_SU,
+                            mesh_params->spinning_coeff_s2m_SU, force_accum, spheres.omega[sphereIDLocal],
+                            d_triangleSoup->omega[fam], Rc);
+
+                        sphere_AngAcc = sphere_AngAcc + roll_ang_acc;
+
+                        unsigned int BC_histmap_label = triangleFamilyHistmapOffset + fam;
+
+                        // compute tangent force
+                        float3 tangent_force;
+                        if (MAT_BASED) {
+                            tangent_force = computeFrictionForces_matBased(
+                                gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
+                                mesh_params->static_friction_coeff_s2m, mesh_params->E_eff_s2m_SU,
+                                mesh_params->G_eff_s2m_SU, sqrt_Rd, beta, force_accum, vrel_t, normal, m_eff);
+                        } else {
+                            tangent_force = computeFrictionForces(
+                                gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
+                                mesh_params->static_friction_coeff_s2m, mesh_params->K_t_s2m_SU,
+                                mesh_params->Gamma_t_s2m_SU, hertz_force_factor, m_eff, force_accum, vrel_t, normal);
+                        }
+
+                        force_accum = force_accum + tangent_force;
+                        sphere_AngAcc =
+                            sphere_AngAcc + Cross(-1.f * normal, tangent_force) / gran_params->sphereInertia_by_r;
+                    }
+
+                    // Use the CD information to compute the force and torque on the family of this triangle
+                    sphere_force = sphere_force + force_accum;
+
+                    // Force on the mesh is opposite the force on the sphere
+                    float3 force_total = -1.f * force_accum;
+                    float3 torque = Cross(fromCenter, force_total);
+
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 0, force_total.x);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 1, force_total.y);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 2, force_total.z);
+
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 3, torque.x);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 4, torque.y);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 5, torque.z);
+                }  // end of per-triangle loop
+
+                // write back sphere forces
+                atomicAdd(sphere_data->sphere_acc_X + sphereIDGlobal, sphere_force.x / gran_params->sphere_mass_SU);
+                atomicAdd(sphere_data->sphere_acc_Y + sphereIDGlobal, sphere_force.y / gran_params->sphere_mass_SU);
+                atomicAdd(sphere_data->sphere_acc_Z + sphereIDGlobal, sphere_force.z / gran_params->sphere_mass_SU);
+
+                if (friction) {
+                    // write back torques for later
+                    atomicAdd(sphere_data->sphere_ang_acc_X + sphereIDGlobal, sphere_AngAcc.x);
+                    atomicAdd(sphere_data->sphere_ang_acc_Y + sphereIDGlobal, sphere_AngAcc.y);
+                    atomicAdd(sphere_data->sphere_ang_acc_Z + sphereIDGlobal, sphere_AngAcc.z);
+                }
+            }  // end of per-sphere loop
+        }
+    }
+}
+
+/// @} gpu_cuda
@@ -15,6 +15,14 @@
 #pragma once
 #include <cmath>
 
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifndef CHRONO_GPU_USE_CUDA
+    #include "chrono_gpu/utils/ChCudaHostKernel.h"
+// The kernels and device functions are defined in the global namespace, where CUDA provides its vector types
+using namespace chrono::cuda_host;
+#endif
+
 #define MIN(a, b) ((a < b) ? a : b)
 #define MAX(a, b) ((a > b) ? a : b)
 #define EPSILON 1e-7
@@ -58,6 +66,13 @@ inline __device__ float3 Normalize(const float3& v){
     return make_float3(v.x * ratio, v.y * ratio, v.z * ratio);
 }
 
+#ifndef CHRONO_GPU_USE_CUDA
+// The operators are declared along with the host vector types, so that they are also found (through argument-dependent
+// lookup) from code in other namespaces
+namespace chrono {
+namespace cuda_host {
+#endif
+
 // Multiply a * v
 inline __device__ double3 operator*(const double& a, const double3& v) {
     return make_double3(a * v.x, a * v.y, a * v.z);
@@ -132,6 +147,11 @@ inline __device__ int64_t3 operator+(const int64_t3& v1, const int64_t3& v2) {
     return make_longlong3(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z);
 }
 
+#ifndef CHRONO_GPU_USE_CUDA
+}  // end namespace cuda_host
+}  // end namespace chrono
+#endif
+
 inline __device__ double3 int3_to_double3(const int3& v) {
     return make_double3(v.x, v.y, v.z);
 }
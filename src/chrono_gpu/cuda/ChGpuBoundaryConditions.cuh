@@ -20,7 +20,10 @@
 #include "chrono_gpu/cuda/ChCudaMathUtils.cuh"
 #include "chrono_gpu/cuda/ChGpuHelpers.cuh"
 //#include "chrono/core/ChMathematics.h"
-#include <math_constants.h>
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <math_constants.h>
+#endif
+
 using chrono::gpu::CHGPU_TIME_INTEGRATOR;
 using chrono::gpu::CHGPU_FRICTION_MODE;
 using chrono::gpu::CHGPU_ROLLING_MODE;
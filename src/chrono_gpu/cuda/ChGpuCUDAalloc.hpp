@@ -18,7 +18,14 @@
 #ifndef CUDALLOC_HPP
 #define CUDALLOC_HPP
 
-#include <cuda_runtime_api.h>
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cuda_runtime_api.h>
+#else
+    #include "chrono_gpu/utils/ChCudaHostRuntime.h"
+#endif
+
 #include <climits>
 #include <iostream>
 #include <memory>
@@ -83,6 +90,9 @@ class cudallocator {
 ////#endif
 
     pointer allocate(size_type n, std::allocator<void>::const_pointer hint = 0) {
+#ifndef CHRONO_GPU_USE_CUDA
+        using namespace chrono::cuda_host;
+#endif
         void* vptr;
         cudaError_t err = cudaMallocManaged(&vptr, n * sizeof(T), cudaMemAttachGlobal);
         if (err == cudaErrorMemoryAllocation || err == cudaErrorNotSupported) {
@@ -91,7 +101,12 @@ class cudallocator {
         return (T*)vptr;
     }
 
-    void deallocate(pointer p, size_type n) { cudaFree(p); }
+    void deallocate(pointer p, size_type n) {
+#ifndef CHRONO_GPU_USE_CUDA
+        using namespace chrono::cuda_host;
+#endif
+        cudaFree(p);
+    }
 
     bool operator==(const cudallocator& other) const { return true; }
     bool operator!=(const cudallocator& other) const { return false; }
@@ -20,7 +20,15 @@
 #include "chrono_gpu/cuda/ChCudaMathUtils.cuh"
 #include "chrono_gpu/ChGpuDefines.h"
 
-#include <cub/cub.cuh>
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cub/cub.cuh>
+#else
+namespace cub {
+inline void ThreadTrap() {
+    std::abort();
+}
+}  // namespace cub
+#endif
 
 using chrono::gpu::ChSystemGpu_impl;
 using chrono::gpu::CHGPU_TIME_INTEGRATOR;
@@ -37,6 +45,15 @@ using chrono::gpu::CHGPU_ROLLING_MODE;
 
 #define CHGPU_DEBUG_PRINTF(...) printf(__VA_ARGS__)
 
+// Launch a kernel over a grid of numBlocks x numThreads threads.
+// Without CUDA, the grid is executed on the host with OpenMP (see ChCudaHostRuntime.h).
+#ifdef CHRONO_GPU_USE_CUDA
+    #define CH_GPU_LAUNCH(kernel, numBlocks, numThreads, ...) kernel<<<numBlocks, numThreads>>>(__VA_ARGS__)
+#else
+    #define CH_GPU_LAUNCH(kernel, numBlocks, numThreads, ...) \
+        chrono::cuda_host::LaunchKernel(numBlocks, numThreads, [&]() { kernel(__VA_ARGS__); })
+#endif
+
 // Decide which SD owns this point in space
 // Pass it the Center of Mass location for a DE to get its owner, also used to get contact point
 inline __device__ int3 pointSDTriplet(int64_t sphCenter_X,
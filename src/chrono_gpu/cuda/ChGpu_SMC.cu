@@ -14,11 +14,16 @@
 
 #include <cmath>
 #include <numeric>
+#include <algorithm>
 #include <fstream>
 
 #include "chrono_gpu/cuda/ChGpu_SMC.cuh"
 #include "chrono_gpu/utils/ChGpuUtilities.h"
 
+#ifndef CHRONO_GPU_USE_CUDA
+    #include "chrono_gpu/cpu/ChGpu_SMC_host.h"
+#endif
+
 namespace chrono {
 namespace gpu {
 
@@ -28,10 +33,11 @@ __host__ float ChSystemGpu_impl::computeArray3SquaredSum(std::vector<float, cuda
                                                          size_t nSpheres) {
     const unsigned int threadsPerBlock = 1024;
     unsigned int nBlocks = (nSpheres + threadsPerBlock - 1) / threadsPerBlock;
-    elementalArray3Squared<float><<<nBlocks, threadsPerBlock>>>(sphere_data->sphere_stats_buffer, arrX.data(),
-                                                                arrY.data(), arrZ.data(), nSpheres);
+    CH_GPU_LAUNCH(elementalArray3Squared<float>, nBlocks, threadsPerBlock, sphere_data->sphere_stats_buffer,
+                  arrX.data(), arrY.data(), arrZ.data(), nSpheres);
     gpuErrchk(cudaDeviceSynchronize());
 
+#ifdef CHRONO_GPU_USE_CUDA
     // Use CUB to reduce. And put the reduced result at the last element of sphere_stats_buffer array.
     size_t temp_storage_bytes = 0;
     cub::DeviceReduce::Sum(NULL, temp_storage_bytes, sphere_data->sphere_stats_buffer,
@@ -41,6 +47,14 @@ __host__ float ChSystemGpu_impl::computeArray3SquaredSum(std::vector<float, cuda
                            sphere_data->sphere_stats_buffer + nSpheres, nSpheres);
     gpuErrchk(cudaDeviceSynchronize());
     gpuErrchk(cudaPeekAtLastError());
+#else
+    // Reduce and put the result at the last element of sphere_stats_buffer array
+    float sum = 0;
+#pragma omp parallel for reduction(+ : sum)
+    for (int i = 0; i < (int)nSpheres; i++)
+        sum += sphere_data->sphere_stats_buffer[i];
+    sphere_data->sphere_stats_buffer[nSpheres] = sum;
+#endif
     return *(sphere_data->sphere_stats_buffer + nSpheres);
 }
 
@@ -51,10 +65,11 @@ __host__ double ChSystemGpu_impl::GetMaxParticleZ(bool getMax) {
 
     const unsigned int threadsPerBlock = 1024;
     unsigned int nBlocks = (nSpheres + threadsPerBlock - 1) / threadsPerBlock;
-    elementalZLocalToGlobal<<<nBlocks, threadsPerBlock>>>(sphere_data->sphere_stats_buffer, sphere_data, nSpheres,
-                                                          gran_params);
+    CH_GPU_LAUNCH(elementalZLocalToGlobal, nBlocks, threadsPerBlock, sphere_data->sphere_stats_buffer, sphere_data,
+                  nSpheres, gran_params);
     gpuErrchk(cudaDeviceSynchronize());
 
+#ifdef CHRONO_GPU_USE_CUDA
     // Use CUB to find the max or min Z.
     size_t temp_storage_bytes = 0;
     if (getMax) {
@@ -72,6 +87,12 @@ __host__ double ChSystemGpu_impl::GetMaxParticleZ(bool getMax) {
     }
     gpuErrchk(cudaDeviceSynchronize());
     gpuErrchk(cudaPeekAtLastError());
+#else
+    // Find the max or min Z
+    float* first = sphere_data->sphere_stats_buffer;
+    float* last = sphere_data->sphere_stats_buffer + nSpheres;
+    *last = getMax ? *std::max_element(first, last) : *std::min_element(first, last);
+#endif
     return *(sphere_data->sphere_stats_buffer + nSpheres);
 }
 
@@ -82,10 +103,11 @@ __host__ unsigned int ChSystemGpu_impl::GetNumParticleAboveZ(float ZValue) {
 
     const unsigned int threadsPerBlock = 1024;
     unsigned int nBlocks = (nSpheres + threadsPerBlock - 1) / threadsPerBlock;
-    elementalZAboveValue<<<nBlocks, threadsPerBlock>>>(sphere_data->sphere_stats_buffer_int, sphere_data, nSpheres,
-                                                       gran_params, ZValue);
+    CH_GPU_LAUNCH(elementalZAboveValue, nBlocks, threadsPerBlock, sphere_data->sphere_stats_buffer_int, sphere_data,
+                  nSpheres, gran_params, ZValue);
     gpuErrchk(cudaDeviceSynchronize());
 
+#ifdef CHRONO_GPU_USE_CUDA
     // Use CUB to find the max or min Z.
     size_t temp_storage_bytes = 0;
     cub::DeviceReduce::Sum(NULL, temp_storage_bytes, sphere_data->sphere_stats_buffer_int,
@@ -95,6 +117,11 @@ __host__ unsigned int ChSystemGpu_impl::GetNumParticleAboveZ(float ZValue) {
                            sphere_data->sphere_stats_buffer_int + nSpheres, nSpheres);
     gpuErrchk(cudaDeviceSynchronize());
     gpuErrchk(cudaPeekAtLastError());
+#else
+    unsigned int* first = sphere_data->sphere_stats_buffer_int;
+    unsigned int* last = sphere_data->sphere_stats_buffer_int + nSpheres;
+    *last = std::accumulate(first, last, 0u);
+#endif
     return *(sphere_data->sphere_stats_buffer_int + nSpheres);
 }
 
@@ -105,10 +132,11 @@ __host__ unsigned int ChSystemGpu_impl::GetNumParticleAboveX(float XValue) {
 
     const unsigned int threadsPerBlock = 1024;
     unsigned int nBlocks = (nSpheres + threadsPerBlock - 1) / threadsPerBlock;
-    elementalXAboveValue<<<nBlocks, threadsPerBlock>>>(sphere_data->sphere_stats_buffer_int, sphere_data, nSpheres,
-                                                       gran_params, XValue);
+    CH_GPU_LAUNCH(elementalXAboveValue, nBlocks, threadsPerBlock, sphere_data->sphere_stats_buffer_int, sphere_data,
+                  nSpheres, gran_params, XValue);
     gpuErrchk(cudaDeviceSynchronize());
 
+#ifdef CHRONO_GPU_USE_CUDA
     // Use CUB to find the max or min X.
     size_t temp_storage_bytes = 0;
     cub::DeviceReduce::Sum(NULL, temp_storage_bytes, sphere_data->sphere_stats_buffer_int,
@@ -118,6 +146,11 @@ __host__ unsigned int ChSystemGpu_impl::GetNumParticleAboveX(float XValue) {
                            sphere_data->sphere_stats_buffer_int + nSpheres, nSpheres);
     gpuErrchk(cudaDeviceSynchronize());
     gpuErrchk(cudaPeekAtLastError());
+#else
+    unsigned int* first = sphere_data->sphere_stats_buffer_int;
+    unsigned int* last = sphere_data->sphere_stats_buffer_int + nSpheres;
+    *last = std::accumulate(first, last, 0u);
+#endif
     return *(sphere_data->sphere_stats_buffer_int + nSpheres);
 }
 
@@ -167,6 +200,7 @@ void ChSystemGpu_impl::resetSphereAccelerations() {
     }
 }
 
+#ifdef CHRONO_GPU_USE_CUDA
 __global__ void compute_absv(const unsigned int nSpheres,
                              const float* velX,
                              const float* velY,
@@ -200,6 +234,16 @@ __host__ float ChSystemGpu_impl::get_max_vel() const {
 
     return h_max_vel;
 }
+#else
+__host__ float ChSystemGpu_impl::get_max_vel() const {
+    float max_vel2 = 0;
+    for (unsigned int i = 0; i < nSpheres; i++) {
+        float v2 = pos_X_dt[i] * pos_X_dt[i] + pos_Y_dt[i] * pos_Y_dt[i] + pos_Z_dt[i] * pos_Z_dt[i];
+        max_vel2 = std::max(max_vel2, v2);
+    }
+    return std::sqrt(max_vel2);
+}
+#endif
 
 __host__ int3 ChSystemGpu_impl::getSDTripletFromID(unsigned int SD_ID) const {
     return SDIDTriplet(SD_ID, gran_params);
@@ -386,9 +430,9 @@ __host__ void ChSystemGpu_impl::setupSphereDataStructures() {
         packSphereDataPointers();
         // Figure our the number of blocks that need to be launched to cover the box
         unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
-        initializeLocalPositions<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
-            sphere_data, sphere_global_pos_X.data(), sphere_global_pos_Y.data(), sphere_global_pos_Z.data(), nSpheres,
-            gran_params);
+        CH_GPU_LAUNCH(initializeLocalPositions, nBlocks, CUDA_THREADS_PER_BLOCK, sphere_data,
+                      sphere_global_pos_X.data(), sphere_global_pos_Y.data(), sphere_global_pos_Z.data(), nSpheres,
+                      gran_params);
 
         gpuErrchk(cudaDeviceSynchronize());
         gpuErrchk(cudaPeekAtLastError());
@@ -559,14 +603,19 @@ __host__ void ChSystemGpu_impl::runSphereBroadphase() {
 
     // Frist stage of the computation in this function: Figure out the how many spheres touch each SD.
     unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+#ifdef CHRONO_GPU_USE_CUDA
     getNumberOfSpheresTouchingEachSD<CUDA_THREADS_PER_BLOCK>
         <<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(sphere_data, nSpheres, gran_params);
+#else
+    countSpheresTouchingEachSD_host(sphere_data, nSpheres, gran_params);
+#endif
     gpuErrchk(cudaDeviceSynchronize());
     gpuErrchk(cudaPeekAtLastError());
 
     // Starting the second stage of this function call - the prefix scan operation
     unsigned int* out_ptr = SD_SphereCompositeOffsets.data();
     unsigned int* in_ptr = SD_NumSpheresTouching.data();
+#ifdef CHRONO_GPU_USE_CUDA
     gpuErrchk(cudaMemcpy(out_ptr, in_ptr, nSDs * sizeof(unsigned int), cudaMemcpyDeviceToDevice));
 
     // cold run; CUB determines the amount of storage it needs (since first argument is NULL pointer)
@@ -581,6 +630,10 @@ __host__ void ChSystemGpu_impl::runSphereBroadphase() {
     cub::DeviceScan::ExclusiveSum(d_scratch_space, temp_storage_bytes, in_ptr, out_ptr, nSDs);
     gpuErrchk(cudaDeviceSynchronize());
     gpuErrchk(cudaPeekAtLastError());
+#else
+    std::partial_sum(in_ptr, in_ptr + nSDs - 1, out_ptr + 1);
+    out_ptr[0] = 0;
+#endif
 
     // Beginning of the last stage of computation in this function: assembling the big composite array.
     // num_entries: total number of sphere entries to record in the big fat composite array
@@ -595,7 +648,7 @@ __host__ void ChSystemGpu_impl::runSphereBroadphase() {
     // nBlocks = (MAX_SDs_TOUCHED_BY_SPHERE * nSpheres + 2*CUDA_THREADS_PER_BLOCK - 1) / (2*CUDA_THREADS_PER_BLOCK);
     // populateSpheresInEachSD<<<nBlocks, 2*CUDA_THREADS_PER_BLOCK>>>(sphere_data, nSpheres, gran_params);
     nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / (CUDA_THREADS_PER_BLOCK);
-    populateSpheresInEachSD<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(sphere_data, nSpheres, gran_params);
+    CH_GPU_LAUNCH(populateSpheresInEachSD, nBlocks, CUDA_THREADS_PER_BLOCK, sphere_data, nSpheres, gran_params);
     gpuErrchk(cudaDeviceSynchronize());
     gpuErrchk(cudaPeekAtLastError());
 }
@@ -634,11 +687,10 @@ __host__ void ChSystemGpu_impl::updateBCPositions() {
         offset_delta.y = old_frame_Y - gran_params->BD_frame_Y;
         offset_delta.z = old_frame_Z - gran_params->BD_frame_Z;
 
-        // printf("offset is %lld, %lld, %lld\n", offset_delta.x, offset_delta.y, offset_delta.z);
-
         packSphereDataPointers();
 
-        applyBDFrameChange<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(offset_delta, sphere_data, nSpheres, gran_params);
+        CH_GPU_LAUNCH(applyBDFrameChange, nBlocks, CUDA_THREADS_PER_BLOCK, offset_delta, sphere_data, nSpheres,
+                      gran_params);
 
         gpuErrchk(cudaPeekAtLastError());
         gpuErrchk(cudaDeviceSynchronize());
@@ -668,27 +720,37 @@ __host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
 
         if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
             // Compute sphere-sphere forces
+#ifdef CHRONO_GPU_USE_CUDA
             computeSphereForces_frictionless_matBased<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(
                 sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
                 (unsigned int)BC_params_list_SU.size());
+#else
+            computeSphereForces_frictionless_host<true>(nSDs, sphere_data, gran_params, BC_type_list.data(),
+                                                        BC_params_list_SU.data(),
+                                                        (unsigned int)BC_params_list_SU.size());
+#endif
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
         } else if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP ||
                    gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
             // figure out who is contacting
+#ifdef CHRONO_GPU_USE_CUDA
             determineContactPairs<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(sphere_data, gran_params);
+#else
+            determineContactPairs_host(nSDs, sphere_data, gran_params);
+#endif
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
 
             if (gran_params->use_mat_based == true) {
-                computeSphereContactForces_matBased<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
-                    sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
-                    (unsigned int)BC_params_list_SU.size(), nSpheres);
+                CH_GPU_LAUNCH(computeSphereContactForces_matBased, nBlocks, CUDA_THREADS_PER_BLOCK, sphere_data,
+                              gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                              (unsigned int)BC_params_list_SU.size(), nSpheres);
 
             } else {
-                computeSphereContactForces<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
-                    sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
-                    (unsigned int)BC_params_list_SU.size(), nSpheres);
+                CH_GPU_LAUNCH(computeSphereContactForces, nBlocks, CUDA_THREADS_PER_BLOCK, sphere_data, gran_params,
+                              BC_type_list.data(), BC_params_list_SU.data(), (unsigned int)BC_params_list_SU.size(),
+                              nSpheres);
             }
 
             gpuErrchk(cudaPeekAtLastError());
@@ -696,7 +758,8 @@ __host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
         }
 
         METRICS_PRINTF("Starting integrateSpheres!\n");
-        integrateSpheres<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+        CH_GPU_LAUNCH(integrateSpheres, nBlocks, CUDA_THREADS_PER_BLOCK, stepSize_SU, sphere_data, nSpheres,
+                      gran_params);
         gpuErrchk(cudaPeekAtLastError());
         gpuErrchk(cudaDeviceSynchronize());
 
@@ -707,13 +770,14 @@ __host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
 
             METRICS_PRINTF("Update Friction Data!\n");
 
-            updateFrictionData<<<nBlocksFricHistoryPostProcess, nThreadsUpdateHist>>>(fricMapSize, sphere_data,
-                                                                                      gran_params);
+            CH_GPU_LAUNCH(updateFrictionData, nBlocksFricHistoryPostProcess, nThreadsUpdateHist, fricMapSize,
+                          sphere_data, gran_params);
 
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
             METRICS_PRINTF("Update angular velocity.\n");
-            updateAngVels<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+            CH_GPU_LAUNCH(updateAngVels, nBlocks, CUDA_THREADS_PER_BLOCK, stepSize_SU, sphere_data, nSpheres,
+                          gran_params);
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
         }
@@ -16,9 +16,6 @@
 
 #pragma once
 
-#include <cub/cub.cuh>
-
-#include <cuda.h>
 #include <cassert>
 #include <cstdio>
 #include <fstream>
@@ -34,6 +31,11 @@
 #include "chrono_gpu/cuda/ChCudaMathUtils.cuh"
 #include "chrono_gpu/cuda/ChGpuHelpers.cuh"
 #include "chrono_gpu/cuda/ChGpuBoundaryConditions.cuh"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cuda.h>
+    #include <cub/cub.cuh>
+#endif
 //#include <math_constants.h>
 
 #define PI_F 3.1415926
@@ -174,6 +176,10 @@ static __global__ void elementalXAboveValue(unsigned int* YorN,
     }
 }
 
+// The block-level kernels below rely on shared memory and block synchronization and are only available when
+// compiling with CUDA. The CPU backend provides its own implementation of these kernels (see cpu/ChGpu_SMC_host.h).
+#ifdef __CUDACC__
+
 /**
  * Template arguments:
  *   - CUB_THREADS: the number of threads used in this kernel, comes into play when invoking CUB block collectives
@@ -267,6 +273,8 @@ __global__ void getNumberOfSpheresTouchingEachSD(ChSystemGpu_impl::GranSphereDat
     }
 }
 
+#endif
+
 /// <summary>
 /// Kernel figures out whether a sphere touches an SD. Since a sphere can touch at most 8 SDs, the number of threads
 /// launched in conjunction with this kernel is eight times the number of spheres.
@@ -537,6 +545,8 @@ inline __device__ void applyExternalForces(unsigned int currSphereID,
     applyGravity(sphere_force, gran_params);
 }
 
+#ifdef __CUDACC__
+
 static __global__ void determineContactPairs(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                              ChSystemGpu_impl::GranParamsPtr gran_params) {
     // Cache positions of spheres local to this SD
@@ -614,6 +624,8 @@ static __global__ void determineContactPairs(ChSystemGpu_impl::GranSphereDataPtr
     }
 }
 
+#endif
+
 /// Compute normal forces for a contacting pair
 // returns the normal force and sets the reciplength, tangent velocity, and delta_r
 // delta_r is direction of normal force on me
@@ -1101,6 +1113,8 @@ static __global__ void computeSphereContactForces_matBased(ChSystemGpu_impl::Gra
     }
 }
 
+#ifdef __CUDACC__
+
 static __global__ void computeSphereForces_frictionless(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                         ChSystemGpu_impl::GranParamsPtr gran_params,
                                                         BC_type* bc_type_list,
@@ -1329,6 +1343,8 @@ static __global__ void computeSphereForces_frictionless_matBased(ChSystemGpu_imp
     }
 }
 
+#endif
+
 /// Compute update for a quantity using Forward Euler integrator
 inline __device__ float integrateForwardEuler(float stepsize_SU, float val_dt) {
     return stepsize_SU * val_dt;
@@ -16,7 +16,15 @@
 #include "chrono_gpu/cuda/ChGpu_SMC.cuh"
 #include "chrono_gpu/physics/ChSystemGpuMesh_impl.h"
 #include "chrono_gpu/utils/ChGpuUtilities.h"
-#include <math_constants.h>
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <math_constants.h>
+#else
+    #include <algorithm>
+    #include <numeric>
+    #include <vector>
+    #include "chrono_gpu/cpu/ChGpu_SMC_trimesh_host.h"
+#endif
 
 namespace chrono {
 namespace gpu {
@@ -26,16 +34,17 @@ __host__ void ChSystemGpuMesh_impl::runTriangleBroadphase() {
 
     unsigned int numTriangles = meshSoup->nTrianglesInSoup;
     unsigned int nblocks = (numTriangles + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
-    determineCountOfSDsTouchedByEachTriangle<<<nblocks, CUDA_THREADS_PER_BLOCK>>>(
-        meshSoup, Triangle_NumSDsTouching.data(), gran_params, tri_params);
+    CH_GPU_LAUNCH(determineCountOfSDsTouchedByEachTriangle, nblocks, CUDA_THREADS_PER_BLOCK, meshSoup,
+                  Triangle_NumSDsTouching.data(), gran_params, tri_params);
 
     gpuErrchk(cudaDeviceSynchronize());
     gpuErrchk(cudaPeekAtLastError());
 
     // do prefix scan
-    size_t temp_storage_bytes = 0;
     unsigned int* out_ptr = Triangle_SDsCompositeOffsets.data();
     unsigned int* in_ptr = Triangle_NumSDsTouching.data();
+#ifdef CHRONO_GPU_USE_CUDA
+    size_t temp_storage_bytes = 0;
 
     // copy data into the tmp array
     gpuErrchk(cudaMemcpy(out_ptr, in_ptr, numTriangles * sizeof(unsigned int), cudaMemcpyDeviceToDevice));
@@ -47,6 +56,10 @@ __host__ void ChSystemGpuMesh_impl::runTriangleBroadphase() {
     // Run exclusive prefix sum
     cub::DeviceScan::ExclusiveSum(d_scratch_space, temp_storage_bytes, in_ptr, out_ptr, numTriangles);
     gpuErrchk(cudaDeviceSynchronize());
+#else
+    std::partial_sum(in_ptr, in_ptr + numTriangles - 1, out_ptr + 1);
+    out_ptr[0] = 0;
+#endif
     unsigned int numOfTriangleTouchingSD_instances;  // total number of instances in which a triangle touches an SD
     numOfTriangleTouchingSD_instances = out_ptr[numTriangles - 1] + in_ptr[numTriangles - 1];
 
@@ -57,11 +70,14 @@ __host__ void ChSystemGpuMesh_impl::runTriangleBroadphase() {
     TriangleIDS_ByMultiplicity.resize(numOfTriangleTouchingSD_instances, NULL_CHGPU_ID);
 
     // sort key-value where the key is SD id, value is triangle ID in composite array
-    storeSDsTouchedByEachTriangle<<<nblocks, CUDA_THREADS_PER_BLOCK>>>(
-        meshSoup, Triangle_NumSDsTouching.data(), Triangle_SDsCompositeOffsets.data(),
-        SDsTouchedByEachTriangle_composite.data(), TriangleIDS_ByMultiplicity.data(), gran_params, tri_params);
+    CH_GPU_LAUNCH(storeSDsTouchedByEachTriangle, nblocks, CUDA_THREADS_PER_BLOCK, meshSoup,
+                  Triangle_NumSDsTouching.data(), Triangle_SDsCompositeOffsets.data(),
+                  SDsTouchedByEachTriangle_composite.data(), TriangleIDS_ByMultiplicity.data(), gran_params,
+                  tri_params);
     gpuErrchk(cudaDeviceSynchronize());
 
+#ifdef CHRONO_GPU_USE_CUDA
+
     unsigned int* d_keys_in = SDsTouchedByEachTriangle_composite.data();
     unsigned int* d_keys_out = SDsTouchedByEachTriangle_composite_out.data();
     unsigned int* d_values_in = TriangleIDS_ByMultiplicity.data();
@@ -153,8 +169,45 @@ __host__ void ChSystemGpuMesh_impl::runTriangleBroadphase() {
     // Run CUB exclusive prefix sum
     cub::DeviceScan::ExclusiveSum(d_scratch_space, temp_storage_bytes, in_ptr, out_ptr, nSDs);
     gpuErrchk(cudaDeviceSynchronize());
+#else
+    // Instead of the key-value radix sort and run-length encoding, the triangles are binned by SD with a stable
+    // counting sort, which directly produces the per-SD counts and the offsets in the composite array.
+    const unsigned int* SD_keys = SDsTouchedByEachTriangle_composite.data();
+    const unsigned int* triangle_values = TriangleIDS_ByMultiplicity.data();
+
+    // count the triangles touching each SD
+    unsigned int* numTriangles_SD = SD_numTrianglesTouching.data();
+    std::fill(numTriangles_SD, numTriangles_SD + nSDs, 0u);
+    for (unsigned int i = 0; i < numOfTriangleTouchingSD_instances; i++)
+        numTriangles_SD[SD_keys[i]]++;
+
+    // Now assert that no SD has over max amount of triangles
+    // If there is one, exit graciously
+    unsigned int maxTriCount = *std::max_element(numTriangles_SD, numTriangles_SD + nSDs);
+    if (maxTriCount > MAX_TRIANGLE_COUNT_PER_SD)
+        CHGPU_ERROR("ERROR! %u triangles are found in one of the SDs! The max allowance is %u.\n", maxTriCount,
+                    MAX_TRIANGLE_COUNT_PER_SD);
+
+    // prefix scan to get the offsets in the big composite array
+    unsigned int* offsets_SD = SD_TrianglesCompositeOffsets.data();
+    unsigned int offset = 0;
+    for (unsigned int sd = 0; sd < nSDs; sd++) {
+        offsets_SD[sd] = offset;
+        offset += numTriangles_SD[sd];
+    }
+
+    // Scatter the triangles SD by SD, preserving the triangle order within an SD (as the GPU radix sort does)
+    SD_trianglesInEachSD_composite.resize(numOfTriangleTouchingSD_instances);
+    std::vector<unsigned int> cursor(offsets_SD, offsets_SD + nSDs);
+    for (unsigned int i = 0; i < numOfTriangleTouchingSD_instances; i++)
+        SD_trianglesInEachSD_composite[cursor[SD_keys[i]]++] = triangle_values[i];
+#endif
 }
 
+// The block-level kernels below rely on shared memory and block synchronization and are only available when
+// compiling with CUDA. The CPU backend provides its own implementation (see cpu/ChGpu_SMC_trimesh_host.h).
+#ifdef CHRONO_GPU_USE_CUDA
+
 __global__ void interactionGranMat_TriangleSoup_matBased(ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
                                                          ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                          const unsigned int* SD_trianglesInEachSD_composite,
@@ -690,6 +743,7 @@ __global__ void interactionGranMat_TriangleSoup(ChSystemGpuMesh_impl::TriangleSo
         }
     }  // end sphere id check
 }  // end kernel
+#endif
 
 __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
     // Figure our the number of blocks that need to be launched to cover the box
@@ -732,15 +786,27 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
             // Compute sphere-sphere forces
             if (gran_params->use_mat_based == true) {
                 METRICS_PRINTF("use material based model\n");
+#ifdef CHRONO_GPU_USE_CUDA
                 computeSphereForces_frictionless_matBased<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(
                     sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
                     (unsigned int)BC_params_list_SU.size());
+#else
+                computeSphereForces_frictionless_host<true>(nSDs, sphere_data, gran_params, BC_type_list.data(),
+                                                            BC_params_list_SU.data(),
+                                                            (unsigned int)BC_params_list_SU.size());
+#endif
 
             } else {
                 METRICS_PRINTF("use user defined model\n");
+#ifdef CHRONO_GPU_USE_CUDA
                 computeSphereForces_frictionless<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(
                     sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
                     (unsigned int)BC_params_list_SU.size());
+#else
+                computeSphereForces_frictionless_host<false>(nSDs, sphere_data, gran_params, BC_type_list.data(),
+                                                             BC_params_list_SU.data(),
+                                                             (unsigned int)BC_params_list_SU.size());
+#endif
             }
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
@@ -749,20 +815,24 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
         else if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP ||
                  gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
             // figure out who is contacting
+#ifdef CHRONO_GPU_USE_CUDA
             determineContactPairs<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(sphere_data, gran_params);
+#else
+            determineContactPairs_host(nSDs, sphere_data, gran_params);
+#endif
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
             METRICS_PRINTF("Frictional case.\n");
             if (gran_params->use_mat_based == true) {
                 METRICS_PRINTF("compute sphere-sphere and sphere-bc mat based\n");
-                computeSphereContactForces_matBased<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
-                    sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
-                    (unsigned int)BC_params_list_SU.size(), nSpheres);
+                CH_GPU_LAUNCH(computeSphereContactForces_matBased, nBlocks, CUDA_THREADS_PER_BLOCK, sphere_data,
+                              gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                              (unsigned int)BC_params_list_SU.size(), nSpheres);
             } else {
                 METRICS_PRINTF("compute sphere-sphere and sphere-bc user defined\n");
-                computeSphereContactForces<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
-                    sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
-                    (unsigned int)BC_params_list_SU.size(), nSpheres);
+                CH_GPU_LAUNCH(computeSphereContactForces, nBlocks, CUDA_THREADS_PER_BLOCK, sphere_data, gran_params,
+                              BC_type_list.data(), BC_params_list_SU.data(), (unsigned int)BC_params_list_SU.size(),
+                              nSpheres);
             }
         }
         gpuErrchk(cudaPeekAtLastError());
@@ -775,15 +845,27 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
                 gran_params->nSpheres + 1 + (unsigned int)BC_params_list_SU.size() + 1;
             // compute sphere-triangle forces
             if (tri_params->use_mat_based == true) {
+#ifdef CHRONO_GPU_USE_CUDA
                 interactionGranMat_TriangleSoup_matBased<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(
                     meshSoup, sphere_data, SD_trianglesInEachSD_composite.data(), SD_numTrianglesTouching.data(),
                     SD_TrianglesCompositeOffsets.data(), gran_params, tri_params, triangleFamilyHistmapOffset);
+#else
+                interactionGranMat_TriangleSoup_host<true>(
+                    nSDs, meshSoup, sphere_data, SD_trianglesInEachSD_composite.data(), SD_numTrianglesTouching.data(),
+                    SD_TrianglesCompositeOffsets.data(), gran_params, tri_params, triangleFamilyHistmapOffset);
+#endif
             } else {
                 //   //              printf("compute sphere-mesh user defined\n");
 
+#ifdef CHRONO_GPU_USE_CUDA
                 interactionGranMat_TriangleSoup<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(
                     meshSoup, sphere_data, SD_trianglesInEachSD_composite.data(), SD_numTrianglesTouching.data(),
                     SD_TrianglesCompositeOffsets.data(), gran_params, tri_params, triangleFamilyHistmapOffset);
+#else
+                interactionGranMat_TriangleSoup_host<false>(
+                    nSDs, meshSoup, sphere_data, SD_trianglesInEachSD_composite.data(), SD_numTrianglesTouching.data(),
+                    SD_TrianglesCompositeOffsets.data(), gran_params, tri_params, triangleFamilyHistmapOffset);
+#endif
             }
         }
 
@@ -791,7 +873,8 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
         gpuErrchk(cudaDeviceSynchronize());
 
         METRICS_PRINTF("Starting integrateSpheres!\n");
-        integrateSpheres<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+        CH_GPU_LAUNCH(integrateSpheres, nBlocks, CUDA_THREADS_PER_BLOCK, stepSize_SU, sphere_data, nSpheres,
+                      gran_params);
         gpuErrchk(cudaPeekAtLastError());
         gpuErrchk(cudaDeviceSynchronize());
 
@@ -799,11 +882,12 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
             const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
             unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
             unsigned int nBlocksFricHistoryPostProcess = (fricMapSize + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
-            updateFrictionData<<<nBlocksFricHistoryPostProcess, nThreadsUpdateHist>>>(fricMapSize, sphere_data,
-                                                                                      gran_params);
+            CH_GPU_LAUNCH(updateFrictionData, nBlocksFricHistoryPostProcess, nThreadsUpdateHist, fricMapSize,
+                          sphere_data, gran_params);
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
-            updateAngVels<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+            CH_GPU_LAUNCH(updateAngVels, nBlocks, CUDA_THREADS_PER_BLOCK, stepSize_SU, sphere_data, nSpheres,
+                          gran_params);
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
         }
@@ -26,6 +26,11 @@
 #include "chrono_gpu/physics/ChSystemGpuMesh_impl.h"
 #include "chrono_gpu/utils/ChGpuUtilities.h"
 
+#ifndef CHRONO_GPU_USE_CUDA
+// Without CUDA, the runtime functions are provided by the host runtime
+using namespace chrono::cuda_host;
+#endif
+
 namespace chrono {
 namespace gpu {
 
@@ -12,8 +12,6 @@
 // Authors: Conlain Kelly, Nic Olsen, Dan Negrut, Luning Fang, Radu Serban
 // =============================================================================
 
-#include <cuda.h>
-#include <cuda_runtime.h>
 #include <cmath>
 #include <vector>
 #include <algorithm>
@@ -55,10 +55,18 @@ class ChSolverStateData {
     float crntSimTime_SU;   // DN: needs to be brought here from GranParams
   public:
     ChSolverStateData() {
+#ifndef CHRONO_GPU_USE_CUDA
+        using namespace chrono::cuda_host;
+#endif
         cudaMallocManaged(&pMaxNumberSpheresInAnySD, sizeof(unsigned int));
         largestMaxNumberSpheresInAnySD_thusFar = 0;
     }
-    ~ChSolverStateData() { cudaFree(pMaxNumberSpheresInAnySD); }
+    ~ChSolverStateData() {
+#ifndef CHRONO_GPU_USE_CUDA
+        using namespace chrono::cuda_host;
+#endif
+        cudaFree(pMaxNumberSpheresInAnySD);
+    }
     inline unsigned int* pMM_maxNumberSpheresInAnySD() {
         return pMaxNumberSpheresInAnySD;  ///< returns pointer to managed memory
     }
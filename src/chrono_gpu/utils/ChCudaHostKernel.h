@@ -0,0 +1,63 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Compilation of CUDA kernel sources on the host.
+//
+// In addition to the host runtime in ChCudaHostRuntime.h, this header defines
+// the CUDA function and variable qualifiers (as no-ops) and the built-in
+// variables threadIdx, blockIdx, blockDim, and gridDim (set by
+// chrono::cuda_host::LaunchKernel for each emulated GPU thread). As these are
+// macros, this header is meant to be included only by kernel sources and the
+// device-side headers they use, never by public API headers.
+//
+// =============================================================================
+
+#ifndef CH_CUDA_HOST_KERNEL_H
+#define CH_CUDA_HOST_KERNEL_H
+
+#include "chrono_gpu/utils/ChCudaHostRuntime.h"
+
+// -----------------------------------------------------------------------------
+// Function and variable qualifiers
+// -----------------------------------------------------------------------------
+
+#ifndef __host__
+    #define __host__
+#endif
+#ifndef __device__
+    #define __device__
+#endif
+#ifndef __global__
+    #define __global__
+#endif
+#ifndef __constant__
+    #define __constant__
+#endif
+#ifndef __forceinline__
+    #define __forceinline__ inline
+#endif
+#if defined(_MSC_VER) && !defined(__inline__)
+    #define __inline__ inline
+#endif
+
+// -----------------------------------------------------------------------------
+// Built-in variables and constants
+// -----------------------------------------------------------------------------
+
+#define threadIdx (chrono::cuda_host::CurrentKernelThread().threadIdx)
+#define blockIdx (chrono::cuda_host::CurrentKernelThread().blockIdx)
+#define blockDim (chrono::cuda_host::CurrentKernelThread().blockDim)
+#define gridDim (chrono::cuda_host::CurrentKernelThread().gridDim)
+
+#define CUDART_PI_F 3.141592654f
+
+#endif
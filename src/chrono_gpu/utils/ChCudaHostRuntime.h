@@ -0,0 +1,402 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Host replacement for the subset of the CUDA runtime used by the Chrono GPU
+// modules (Chrono::GPU and Chrono::FSI).
+//
+// When these modules are built without CUDA, this header stands in for the
+// CUDA runtime headers: it provides the CUDA vector types, the memory
+// management, symbol copy and event functions (implemented on the host), the
+// device intrinsics and atomics used by the kernels, and a launcher that
+// executes a kernel grid with OpenMP. This allows the kernels to be shared
+// between the CUDA and the CPU backends.
+//
+// Everything is declared in the chrono::cuda_host namespace, so this header can
+// be included from public headers. Kernel sources must include
+// ChCudaHostKernel.h instead, which also provides the CUDA function qualifiers
+// and built-in variables.
+//
+// =============================================================================
+
+#ifndef CH_CUDA_HOST_RUNTIME_H
+#define CH_CUDA_HOST_RUNTIME_H
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace chrono {
+
+/// Namespace with the host replacement of the CUDA runtime (see ChCudaHostRuntime.h).
+namespace cuda_host {
+
+// -----------------------------------------------------------------------------
+// Vector types
+// -----------------------------------------------------------------------------
+
+struct alignas(8) float2 {
+    float x, y;
+};
+struct float3 {
+    float x, y, z;
+};
+struct alignas(16) float4 {
+    float x, y, z, w;
+};
+struct alignas(16) double2 {
+    double x, y;
+};
+struct double3 {
+    double x, y, z;
+};
+struct alignas(16) double4 {
+    double x, y, z, w;
+};
+struct alignas(8) int2 {
+    int x, y;
+};
+struct int3 {
+    int x, y, z;
+};
+struct alignas(16) int4 {
+    int x, y, z, w;
+};
+struct alignas(8) uint2 {
+    unsigned int x, y;
+};
+struct uint3 {
+    unsigned int x, y, z;
+};
+struct alignas(16) uint4 {
+    unsigned int x, y, z, w;
+};
+struct longlong3 {
+    long long int x, y, z;
+};
+/// Grid and block dimensions (as in CUDA, unspecified components default to 1).
+struct dim3 {
+    dim3(unsigned int vx = 1, unsigned int vy = 1, unsigned int vz = 1) : x(vx), y(vy), z(vz) {}
+    unsigned int x, y, z;
+};
+
+inline float2 make_float2(float x, float y) {
+    return float2{x, y};
+}
+inline float3 make_float3(float x, float y, float z) {
+    return float3{x, y, z};
+}
+inline float4 make_float4(float x, float y, float z, float w) {
+    return float4{x, y, z, w};
+}
+inline double2 make_double2(double x, double y) {
+    return double2{x, y};
+}
+inline double3 make_double3(double x, double y, double z) {
+    return double3{x, y, z};
+}
+inline double4 make_double4(double x, double y, double z, double w) {
+    return double4{x, y, z, w};
+}
+inline int2 make_int2(int x, int y) {
+    return int2{x, y};
+}
+inline int3 make_int3(int x, int y, int z) {
+    return int3{x, y, z};
+}
+inline int4 make_int4(int x, int y, int z, int w) {
+    return int4{x, y, z, w};
+}
+inline uint2 make_uint2(unsigned int x, unsigned int y) {
+    return uint2{x, y};
+}
+inline uint3 make_uint3(unsigned int x, unsigned int y, unsigned int z) {
+    return uint3{x, y, z};
+}
+inline uint4 make_uint4(unsigned int x, unsigned int y, unsigned int z, unsigned int w) {
+    return uint4{x, y, z, w};
+}
+inline longlong3 make_longlong3(long long int x, long long int y, long long int z) {
+    return longlong3{x, y, z};
+}
+
+// -----------------------------------------------------------------------------
+// Runtime API (errors, memory management, symbols, and events)
+// -----------------------------------------------------------------------------
+
+enum cudaError_t { cudaSuccess = 0, cudaErrorMemoryAllocation = 2, cudaErrorNotSupported = 801 };
+
+enum cudaMemcpyKind {
+    cudaMemcpyHostToHost = 0,
+    cudaMemcpyHostToDevice = 1,
+    cudaMemcpyDeviceToHost = 2,
+    cudaMemcpyDeviceToDevice = 3,
+    cudaMemcpyDefault = 4
+};
+
+enum cudaMemoryAdvise {
+    cudaMemAdviseSetReadMostly = 1,
+    cudaMemAdviseUnsetReadMostly = 2,
+    cudaMemAdviseSetPreferredLocation = 3,
+    cudaMemAdviseUnsetPreferredLocation = 4
+};
+
+const unsigned int cudaMemAttachGlobal = 0x01;
+
+inline const char* cudaGetErrorString(cudaError_t code) {
+    switch (code) {
+        case cudaSuccess:
+            return "no error";
+        case cudaErrorMemoryAllocation:
+            return "out of memory";
+        default:
+            return "operation not supported";
+    }
+}
+
+inline cudaError_t cudaGetLastError() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaPeekAtLastError() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaDeviceSynchronize() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaGetDevice(int* device) {
+    *device = 0;
+    return cudaSuccess;
+}
+
+// Memory handed out by the CUDA driver is zero-filled; some of the data structures rely on this
+template <typename T>
+cudaError_t cudaMallocManaged(T** ptr, size_t size, unsigned int /*flags*/ = cudaMemAttachGlobal) {
+    *ptr = static_cast<T*>(std::calloc(size > 0 ? size : 1, 1));
+    return *ptr ? cudaSuccess : cudaErrorMemoryAllocation;
+}
+
+template <typename T>
+cudaError_t cudaMalloc(T** ptr, size_t size) {
+    return cudaMallocManaged(ptr, size);
+}
+
+inline cudaError_t cudaFree(void* ptr) {
+    std::free(ptr);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemset(void* ptr, int value, size_t count) {
+    std::memset(ptr, value, count);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemcpy(void* dst, const void* src, size_t count, cudaMemcpyKind /*kind*/) {
+    std::memmove(dst, src, count);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemAdvise(const void* /*ptr*/, size_t /*count*/, cudaMemoryAdvise /*advice*/, int /*device*/) {
+    return cudaSuccess;
+}
+
+/// Copy data to a __constant__ variable (these are regular static variables on the host).
+template <typename T>
+cudaError_t cudaMemcpyToSymbolAsync(T& symbol, const void* src, size_t count) {
+    std::memcpy(&symbol, src, count);
+    return cudaSuccess;
+}
+
+/// Copy data from a __constant__ variable.
+template <typename T>
+cudaError_t cudaMemcpyFromSymbol(void* dst, const T& symbol, size_t count) {
+    std::memcpy(dst, &symbol, count);
+    return cudaSuccess;
+}
+
+// All work is done synchronously on the host, so streams are placeholders and events are plain time stamps
+typedef struct CUstream_st* cudaStream_t;
+
+struct CUevent_st {
+    std::chrono::steady_clock::time_point time;
+};
+typedef CUevent_st* cudaEvent_t;
+
+inline cudaError_t cudaEventCreate(cudaEvent_t* event) {
+    *event = new CUevent_st;
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventDestroy(cudaEvent_t event) {
+    delete event;
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventRecord(cudaEvent_t event, cudaStream_t /*stream*/ = 0) {
+    event->time = std::chrono::steady_clock::now();
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventSynchronize(cudaEvent_t /*event*/) {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventElapsedTime(float* ms, cudaEvent_t start, cudaEvent_t end) {
+    *ms = std::chrono::duration<float, std::milli>(end->time - start->time).count();
+    return cudaSuccess;
+}
+
+// -----------------------------------------------------------------------------
+// Device intrinsics and math functions
+// -----------------------------------------------------------------------------
+
+// CUDA provides the float overloads of the math functions along with the double ones
+using std::abs;
+using std::ceil;
+using std::exp;
+using std::fabs;
+using std::floor;
+using std::isfinite;
+using std::log;
+using std::pow;
+using std::round;
+using std::sqrt;
+
+inline float rsqrt(float x) {
+    return 1.0f / std::sqrt(x);
+}
+inline double rsqrt(double x) {
+    return 1.0 / std::sqrt(x);
+}
+
+// Directed rounding is not needed on the host
+inline double __drcp_ru(double x) {
+    return 1.0 / x;
+}
+inline double __dmul_ru(double x, double y) {
+    return x * y;
+}
+
+inline double __longlong_as_double(long long int x) {
+    double d;
+    std::memcpy(&d, &x, sizeof(double));
+    return d;
+}
+
+inline long long int __double_as_longlong(double x) {
+    long long int i;
+    std::memcpy(&i, &x, sizeof(double));
+    return i;
+}
+
+inline void __threadfence() {}
+
+/// Atomically replace the value at 'address' with 'val' if it equals 'compare'; return the old value.
+inline unsigned int atomicCAS(unsigned int* address, unsigned int compare, unsigned int val) {
+#ifdef _MSC_VER
+    return (unsigned int)_InterlockedCompareExchange((volatile long*)address, (long)val, (long)compare);
+#else
+    return __sync_val_compare_and_swap(address, compare, val);
+#endif
+}
+
+/// Atomically replace the value at 'address' with 'val' if it equals 'compare'; return the old value.
+inline unsigned long long int atomicCAS(unsigned long long int* address,
+                                        unsigned long long int compare,
+                                        unsigned long long int val) {
+#ifdef _MSC_VER
+    return (unsigned long long int)_InterlockedCompareExchange64((volatile long long*)address, (long long)val,
+                                                                 (long long)compare);
+#else
+    return __sync_val_compare_and_swap(address, compare, val);
+#endif
+}
+
+/// Atomically add 'val' to the value at 'address' and return the old value.
+/// Implemented with a compare-and-swap loop on the bit pattern of the value, for both integer and floating point
+/// types. Unlike '#pragma omp atomic capture', this does not require OpenMP 3.1 (MSVC only supports OpenMP 2.0).
+template <typename T>
+inline T atomicAdd(T* address, typename std::common_type<T>::type val) {
+    static_assert(sizeof(T) == sizeof(unsigned int) || sizeof(T) == sizeof(unsigned long long int),
+                  "atomicAdd only supports 32-bit and 64-bit types");
+    typedef typename std::conditional<sizeof(T) == sizeof(unsigned int), unsigned int, unsigned long long int>::type
+        Word;
+
+    Word* word = reinterpret_cast<Word*>(address);
+    Word expected;
+    std::memcpy(&expected, address, sizeof(T));
+    while (true) {
+        T old_val;
+        std::memcpy(&old_val, &expected, sizeof(T));
+        T new_val = old_val + val;
+        Word desired;
+        std::memcpy(&desired, &new_val, sizeof(T));
+        Word current = atomicCAS(word, expected, desired);
+        if (current == expected)
+            return old_val;
+        expected = current;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Kernel launch emulation
+// -----------------------------------------------------------------------------
+
+/// Built-in variables of an emulated GPU thread.
+struct KernelThread {
+    uint3 threadIdx;
+    uint3 blockIdx;
+    dim3 blockDim;
+    dim3 gridDim;
+};
+
+/// Return the built-in variables of the GPU thread currently emulated by the calling host thread.
+inline KernelThread& CurrentKernelThread() {
+    static thread_local KernelThread thread;
+    return thread;
+}
+
+/// Execute a kernel over a grid of 'nBlocks' x 'nThreads' threads (the equivalent of kernel<<<nBlocks, nThreads>>>).
+/// 'kernel_call' invokes the kernel with its arguments. Only kernels in which threads do not communicate through shared
+/// memory can be run this way. The cost of a kernel may vary between threads, so the threads of the grid are handed out
+/// to the OpenMP threads in small chunks.
+template <typename KernelCall>
+void LaunchKernel(unsigned int nBlocks, unsigned int nThreads, const KernelCall& kernel_call) {
+    // The grid size may exceed the range of int; the loop index is signed for OpenMP 2.0 (MSVC)
+    size_t n = (size_t)nBlocks * nThreads;
+#pragma omp parallel for schedule(dynamic, 256)
+    for (long long i = 0; i < (long long)n; i++) {
+        KernelThread& thread = CurrentKernelThread();
+        thread.gridDim = dim3(nBlocks);
+        thread.blockDim = dim3(nThreads);
+        thread.blockIdx = uint3{(unsigned int)(i / nThreads), 0, 0};
+        thread.threadIdx = uint3{(unsigned int)(i % nThreads), 0, 0};
+        kernel_call();
+    }
+}
+
+}  // end namespace cuda_host
+}  // end namespace chrono
+
+#endif
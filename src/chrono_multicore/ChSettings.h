@@ -43,7 +43,9 @@ class collision_settings {
           bin_size(real3(1, 1, 1)),
           grid_density(5),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
-          narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
+          broadphase_incremental(false),
+          narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID),
+          narrowphase_batch_mpr(false) {}
 
     /// For stability of NSC contact, the envelope should be set to 5-10% of the smallest collision shape size (too
     /// large a value will slow down the narrowphase collision detection). The envelope is the amount by which each
@@ -79,11 +81,21 @@ class collision_settings {
     /// `broadphase_grid` type is set to FIXED_DENSITY.
     real grid_density;
 
+    /// Flag controlling the use of the incremental broadphase (default: false).
+    /// If enabled, the shapes of static bodies (fixed or sleeping) are kept in a separate persistent grid, rebuilt only
+    /// when these shapes change, and the broadphase grid is rebuilt at each step with the moving shapes only.
+    bool broadphase_incremental;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     ChNarrowphase::Algorithm narrowphase_algorithm;
+
+    /// Flag controlling batched processing of the MPR narrowphase (default: false).
+    /// If enabled, the pairs handled by the MPR algorithm are grouped by shape types and processed several at a time,
+    /// using SIMD instructions.
+    bool narrowphase_batch_mpr;
 };
 
 /// Chrono::Multicore solver_settings.
@@ -74,7 +74,9 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    broadphase.incremental = settings.broadphase_incremental;
     narrowphase.algorithm = settings.narrowphase_algorithm;
+    narrowphase.batch_mpr = settings.narrowphase_batch_mpr;
 }
 
 void ChCollisionSystemChronoMulticore::PostProcess() {
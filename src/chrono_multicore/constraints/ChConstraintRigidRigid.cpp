@@ -23,10 +23,16 @@
 #include "chrono_multicore/constraints/ChConstraintRigidRigid.h"
 #include "chrono_multicore/constraints/ChConstraintUtils.h"
 
+#include "chrono/multicore_math/real3_batch.h"
+
 #include <thrust/iterator/constant_iterator.h>
 
 using namespace chrono;
 
+// Number of contacts processed at once by the SIMD batch kernels
+static const int project_block_size = 1024;
+static const int jacobian_block_size = 64;
+
 // -----------------------------------------------------------------------------
 
 ChConstraintRigidRigid::ChConstraintRigidRigid()
@@ -242,16 +248,13 @@ void ChConstraintRigidRigid::Project(real* gamma) {
         } break;
 
         case SolverMode::SLIDING: {
-#pragma omp parallel for
-            for (int index = 0; index < (signed)num_rigid_contacts; index++) {
-                func_Project_sliding(index, bids.data(), friction.data(), cohesion.data(), gamma);
-            }
+            Project_Sliding(gamma);
         } break;
 
         case SolverMode::SPINNING: {
+            Project_Sliding(gamma);
 #pragma omp parallel for
             for (int index = 0; index < (signed)num_rigid_contacts; index++) {
-                func_Project_sliding(index, bids.data(), friction.data(), cohesion.data(), gamma);
                 func_Project_spinning(index, bids.data(), friction.data(), gamma);
             }
         } break;
@@ -260,6 +263,20 @@ void ChConstraintRigidRigid::Project(real* gamma) {
     }
 }
 
+void ChConstraintRigidRigid::Project_Sliding(real* gamma) {
+    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
+    const custom_vector<real3>& friction = data_manager->host_data.fric_rigid_rigid;
+    const custom_vector<real>& cohesion = data_manager->host_data.coh_rigid_rigid;
+
+    // Project blocks of contacts with the SIMD batch kernels (equivalent to func_Project_sliding)
+#pragma omp parallel for
+    for (int start = 0; start < (signed)num_rigid_contacts; start += project_block_size) {
+        int count = std::min(project_block_size, (int)num_rigid_contacts - start);
+        ProjectFrictionCones(count, gamma + start, gamma + num_rigid_contacts + 2 * start, friction.data() + start,
+                             cohesion.data() + start);
+    }
+}
+
 void ChConstraintRigidRigid::Project_Single(int index, real* gamma) {
     custom_vector<vec2>& bids = data_manager->cd_data->bids_rigid_rigid;
     custom_vector<real3>& friction = data_manager->host_data.fric_rigid_rigid;
@@ -407,71 +424,93 @@ void ChConstraintRigidRigid::Build_D() {
         return;
 
     real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
-    vec2* ids = data_manager->cd_data->bids_rigid_rigid.data();
 
     CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
 
     SolverMode solver_mode = data_manager->settings.solver.solver_mode;
+    bool tangential = (solver_mode == SolverMode::SLIDING || solver_mode == SolverMode::SPINNING);
+
+    // The contact frames and the Jacobian entries are calculated for blocks of contacts, using the SIMD batch
+    // kernels, and then loaded into D_T one contact at a time.
+    int num_blocks = (num_rigid_contacts + jacobian_block_size - 1) / jacobian_block_size;
+
+#pragma omp parallel
+    {
+        real3_batch U, V, W;
+        real3_batch sbar_a, sbar_b;
+        quaternion_batch q_a, q_b;
+        real3_batch U_A, V_A, W_A, U_B, V_B, W_B;
+        real3_batch T3, T4, T5, T6, T7, T8;
+
+#pragma omp for
+        for (int block = 0; block < num_blocks; block++) {
+            int start = block * jacobian_block_size;
+            int count = std::min(jacobian_block_size, (int)num_rigid_contacts - start);
+
+            U.load(norm + start, count);
+            q_a.load(quat_a.data() + start, count);
+            q_b.load(quat_b.data() + start, count);
+            sbar_a.resize(count);
+            sbar_b.resize(count);
+            for (int k = 0; k < count; k++) {
+                sbar_a.set(k, rotated_point_a[start + k].v);
+                sbar_b.set(k, rotated_point_b[start + k].v);
+            }
 
-#pragma omp parallel for
-    for (int index = 0; index < (signed)num_rigid_contacts; index++) {
-        const real3& U = norm[index];
-        real3 V, W;
-        Orthogonalize(U, V, W);
-        vec2 body_id = ids[index];
-        int off = 0;
-        int row = index;
-        // The position is subtracted here now instead of performing it in the narrowphase
+            // Normal jacobian entries
+            Rotate(U, q_a, U_A);
+            Cross(U_A, sbar_a, T3);
+            Rotate(U, q_b, U_B);
+            Cross(U_B, sbar_b, T6);
+
+            // Tangential jacobian entries
+            if (tangential) {
+                Orthogonalize(U, V, W);
+
+                Rotate(V, q_a, V_A);
+                Rotate(W, q_a, W_A);
+                Cross(V_A, sbar_a, T4);
+                Cross(W_A, sbar_a, T5);
+
+                Rotate(V, q_b, V_B);
+                Rotate(W, q_b, W_B);
+                Cross(V_B, sbar_b, T7);
+                Cross(W_B, sbar_b, T8);
+            }
 
-        real3 T3, T4, T5, T6, T7, T8;
-        real3 TA, TB, TC;
-        real3 TD, TE, TF;
-
-        // Normal jacobian entries
-        const real3_int& sbar_a = rotated_point_a[index];
-        const real3_int& sbar_b = rotated_point_b[index];
-        body_id.x = sbar_a.i;
-        body_id.y = sbar_b.i;
-        const quaternion& q_a = quat_a[index];
-        const quaternion& q_b = quat_b[index];
-
-        real3 U_A = Rotate(U, q_a);
-        T3 = Cross(U_A, sbar_a.v);
-        real3 U_B = Rotate(U, q_b);
-        T6 = Cross(U_B, sbar_b.v);
-
-        SetRow6Check(D_T, off + row * 1 + 0, body_id.x * 6, -U, T3);
-        SetRow6Check(D_T, off + row * 1 + 0, body_id.y * 6, U, -T6);
-
-        if (solver_mode == SolverMode::SLIDING || solver_mode == SolverMode::SPINNING) {
-            off = num_rigid_contacts;
-
-            real3 V_A = Rotate(V, q_a);
-            real3 W_A = Rotate(W, q_a);
-            T4 = Cross(V_A, sbar_a.v);
-            T5 = Cross(W_A, sbar_a.v);
-
-            real3 V_B = Rotate(V, q_b);
-            real3 W_B = Rotate(W, q_b);
-            T7 = Cross(V_B, sbar_b.v);
-            T8 = Cross(W_B, sbar_b.v);
-
-            SetRow6Check(D_T, off + row * 2 + 0, body_id.x * 6, -V, T4);
-            SetRow6Check(D_T, off + row * 2 + 1, body_id.x * 6, -W, T5);
-
-            SetRow6Check(D_T, off + row * 2 + 0, body_id.y * 6, V, -T7);
-            SetRow6Check(D_T, off + row * 2 + 1, body_id.y * 6, W, -T8);
-
-            if (solver_mode == SolverMode::SPINNING) {
-                off = 3 * num_rigid_contacts;
-
-                SetRow3Check(D_T, off + row * 3 + 0, body_id.x * 6 + 3, -U_A);
-                SetRow3Check(D_T, off + row * 3 + 1, body_id.x * 6 + 3, -V_A);
-                SetRow3Check(D_T, off + row * 3 + 2, body_id.x * 6 + 3, -W_A);
-
-                SetRow3Check(D_T, off + row * 3 + 0, body_id.y * 6 + 3, U_B);
-                SetRow3Check(D_T, off + row * 3 + 1, body_id.y * 6 + 3, V_B);
-                SetRow3Check(D_T, off + row * 3 + 2, body_id.y * 6 + 3, W_B);
+            for (int k = 0; k < count; k++) {
+                int row = start + k;
+                int body_a = rotated_point_a[row].i;
+                int body_b = rotated_point_b[row].i;
+                const real3& U_k = norm[row];
+
+                SetRow6Check(D_T, row * 1 + 0, body_a * 6, -U_k, T3.get(k));
+                SetRow6Check(D_T, row * 1 + 0, body_b * 6, U_k, -T6.get(k));
+
+                if (!tangential)
+                    continue;
+
+                int off = num_rigid_contacts;
+                real3 V_k = V.get(k);
+                real3 W_k = W.get(k);
+
+                SetRow6Check(D_T, off + row * 2 + 0, body_a * 6, -V_k, T4.get(k));
+                SetRow6Check(D_T, off + row * 2 + 1, body_a * 6, -W_k, T5.get(k));
+
+                SetRow6Check(D_T, off + row * 2 + 0, body_b * 6, V_k, -T7.get(k));
+                SetRow6Check(D_T, off + row * 2 + 1, body_b * 6, W_k, -T8.get(k));
+
+                if (solver_mode == SolverMode::SPINNING) {
+                    off = 3 * num_rigid_contacts;
+
+                    SetRow3Check(D_T, off + row * 3 + 0, body_a * 6 + 3, -U_A.get(k));
+                    SetRow3Check(D_T, off + row * 3 + 1, body_a * 6 + 3, -V_A.get(k));
+                    SetRow3Check(D_T, off + row * 3 + 2, body_a * 6 + 3, -W_A.get(k));
+
+                    SetRow3Check(D_T, off + row * 3 + 0, body_b * 6 + 3, U_B.get(k));
+                    SetRow3Check(D_T, off + row * 3 + 1, body_b * 6 + 3, V_B.get(k));
+                    SetRow3Check(D_T, off + row * 3 + 2, body_b * 6 + 3, W_B.get(k));
+                }
             }
         }
     }
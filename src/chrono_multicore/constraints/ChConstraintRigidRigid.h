@@ -35,6 +35,8 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     void Setup(ChMulticoreDataManager* dm);
     void Project(real* gamma);
     void Project_Single(int index, real* gamma);
+    /// Project the normal and sliding friction impulses of all contacts onto their friction cones.
+    void Project_Sliding(real* gamma);
     void host_Project_single(int index, vec2* ids, real3* friction, real* cohesion, real* gamma);
 
     void func_Project_normal(int index, const vec2* ids, const real* cohesion, real* gam);
@@ -27,6 +27,11 @@ bool ChSolverPardisoMKL::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverPardisoMKL::RefactorizeMatrix() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverPardisoMKL::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
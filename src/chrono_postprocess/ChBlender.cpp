@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
@@ -88,6 +89,7 @@ ChBlender::ChBlender(ChSystem* system) : ChPostProcessBase(system) {
     contacts_vector_tip = true;
     wireframe_thickness = 0.001;
     single_asset_file = true;
+    binary_data = false;
     rank = -1;
 
     SetBlenderUp_is_ChronoY();
@@ -356,6 +358,16 @@ void ChBlender::ExportScript(const std::string& filename) {
         }
     }
 
+    // Start a new object table, populated by ExportData() when items are exported the first time
+    m_object_table.clear();
+    m_object_ids.clear();
+    m_object_keys.clear();
+    if (binary_data) {
+        ChStreamOutAsciiFile table_file(base_path + out_script_filename + ".objects.dat");
+        table_file << "# Object table for the binary state files in output/, loaded by the chrono_import.py add-on.\n";
+        table_file << "# Entries: (first frame, object index, name, type, shapes or settings)\n";
+    }
+
     // This forces saving the non-mutable assets in the assets_file, at initial state.
     ExportData();
 
@@ -984,6 +996,97 @@ void ChBlender::ExportMaterials(ChStreamOutAsciiFile& mfile,
     }
 }
 
+// Scale of the unit Blender mesh used for a shape (zero if the shape geometry is exported as is).
+// Corner cases for performance reason: in case of multiple sphere assets with different radii, one Blender mesh asset
+// is used anyway, then use scale here.
+static ChVector<> ShapeScale(const std::shared_ptr<ChVisualShape>& shape) {
+    if (auto mshpere = std::dynamic_pointer_cast<ChVisualShapeSphere>(shape))
+        return ChVector<>(mshpere->GetRadius());
+    if (auto mellipsoid = std::dynamic_pointer_cast<ChVisualShapeEllipsoid>(shape))
+        return mellipsoid->GetSemiaxes();
+    if (auto mbox = std::dynamic_pointer_cast<ChVisualShapeBox>(shape))
+        return mbox->GetLengths();
+    if (auto mcone = std::dynamic_pointer_cast<ChVisualShapeCone>(shape))
+        return ChVector<>(mcone->GetRadius(), mcone->GetRadius(), mcone->GetHeight());
+    if (auto mcyl = std::dynamic_pointer_cast<ChVisualShapeCylinder>(shape))
+        return ChVector<>(mcyl->GetRadius(), mcyl->GetRadius(), mcyl->GetHeight());
+    return ChVector<>(0, 0, 0);
+}
+
+// Collect in 'key' the raw data that ExportShapeList() formats for a physics item (name, shapes, frames, materials and
+// scales), so that a change in the list of shapes can be detected without formatting it
+void ChBlender::ShapeListKey(std::shared_ptr<ChPhysicsItem> item, std::string& key) {
+    auto append = [&key](const void* data, size_t size) { key.append(static_cast<const char*>(data), size); };
+
+    key = item->GetName();
+    key.push_back('\0');
+    for (const auto& shape_instance : item->GetVisualModel()->GetShapes()) {
+        const auto& shape = shape_instance.first;
+        size_t shape_id = (size_t)shape.get();
+        if ((m_blender_shapes.find(shape_id) == m_blender_shapes.end()) &&
+            (m_blender_frame_shapes.find(shape_id) == m_blender_frame_shapes.end()))
+            continue;
+
+        const auto& shape_frame = shape_instance.second;
+        ChVector<> scale = ShapeScale(shape);
+        double data[10] = {shape_frame.GetPos().x(),  shape_frame.GetPos().y(),  shape_frame.GetPos().z(),
+                           shape_frame.GetRot().e0(), shape_frame.GetRot().e1(), shape_frame.GetRot().e2(),
+                           shape_frame.GetRot().e3(), scale.x(),                 scale.y(),
+                           scale.z()};
+        append(&shape_id, sizeof(shape_id));
+        append(data, sizeof(data));
+        for (int im = 0; im < shape->GetNumMaterials(); ++im) {
+            size_t mat_id = (size_t)shape->GetMaterial(im).get();
+            append(&mat_id, sizeof(mat_id));
+        }
+        key.push_back('\0');
+    }
+}
+
+// Write the list of visual shapes of a physics item (with their frames, materials and scales) as a Python list
+void ChBlender::ExportShapeList(ChStreamOutAscii& mfile, std::shared_ptr<ChPhysicsItem> item) {
+    auto vis_model = item->GetVisualModel();
+
+    mfile << "[\n";
+    for (const auto& shape_instance : vis_model->GetShapes()) {
+        const auto& shape = shape_instance.first;
+
+        // Process only "known" shapes (i.e., shapes that were included in the assets file)
+        if ((m_blender_shapes.find((size_t)shape.get()) != m_blender_shapes.end()) ||
+            (m_blender_frame_shapes.find((size_t)shape.get()) != m_blender_frame_shapes.end())) {
+            std::string shapename("shape_" + unique_bl_id((size_t)shape.get()));
+            const auto& shape_frame = shape_instance.second;
+
+            ChVector<> aux_scale = ShapeScale(shape);
+
+            mfile << " [";
+            mfile << "'" << shapename << "',(" << shape_frame.GetPos().x() << "," << shape_frame.GetPos().y()
+                  << "," << shape_frame.GetPos().z() << "),";
+            mfile << "(" << shape_frame.GetRot().e0() << "," << shape_frame.GetRot().e1() << ","
+                  << shape_frame.GetRot().e2() << "," << shape_frame.GetRot().e3() << "),";
+            mfile << "[";
+            if (shape->GetNumMaterials() && (!std::dynamic_pointer_cast<ChVisualShapeLine>(shape)) &&
+                (!std::dynamic_pointer_cast<ChVisualShapePath>(shape))) {
+                for (int im = 0; im < shape->GetNumMaterials(); ++im) {
+                    mfile << "'";
+                    auto mat = shape->GetMaterial(im);
+                    std::string matname("material_" + unique_bl_id((size_t)mat.get()));
+                    mfile << matname;
+                    mfile << "',";
+                }
+            }
+            mfile << "],";
+            if (aux_scale != VNULL) {
+                mfile << "(" << aux_scale.x() << "," << aux_scale.y() << "," << aux_scale.z() << ")";
+            }
+            mfile << "],\n";
+        }
+
+    }  // end loop on shape instances
+
+    mfile << "]";
+}
+
 void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
                                 std::shared_ptr<ChPhysicsItem> item,
                                 const ChFrame<>& parentframe) {
@@ -1009,7 +1112,13 @@ void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
         }
     }
 
-    if (has_stored_assets) {
+    // In binary mode, poses of bodies and particle clouds go in the binary frame file
+    bool binary_item = binary_data && (std::dynamic_pointer_cast<ChBody>(item) ||
+                                       std::dynamic_pointer_cast<ChParticleCloud>(item));
+
+    if (has_stored_assets && binary_item) {
+        ExportItemBinary(item, parentframe);
+    } else if (has_stored_assets) {
         if (auto particleclones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
             state_file << "make_chrono_object_clones('" << item->GetName() << "',"
                        << "(" << parentframe.GetPos().x() << "," << parentframe.GetPos().y() << ","
@@ -1025,59 +1134,8 @@ void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
         }
 
         // List visual shapes to use as children of the Blender object (parent)
-
-        state_file << "[\n";
-        for (const auto& shape_instance : vis_model->GetShapes()) {
-            const auto& shape = shape_instance.first;
-
-            // Process only "known" shapes (i.e., shapes that were included in the assets file)
-            if ((m_blender_shapes.find((size_t)shape.get()) != m_blender_shapes.end()) ||
-                (m_blender_frame_shapes.find((size_t)shape.get()) != m_blender_frame_shapes.end())) {
-                ChVector<> aux_scale(0, 0, 0);
-
-                std::string shapename("shape_" + unique_bl_id((size_t)shape.get()));
-                const auto& shape_frame = shape_instance.second;
-
-                // corner cases for performance reason (in case of multipe sphere asset with different radii, one
-                // blender mesh asset is used anyway, then use scale here)
-                if (auto mshpere = std::dynamic_pointer_cast<ChVisualShapeSphere>(shape))
-                    aux_scale = ChVector<>(mshpere->GetRadius());
-                else if (auto mellipsoid = std::dynamic_pointer_cast<ChVisualShapeEllipsoid>(shape))
-                    aux_scale = mellipsoid->GetSemiaxes();
-                else if (auto mbox = std::dynamic_pointer_cast<ChVisualShapeBox>(shape))
-                    aux_scale = mbox->GetLengths();
-                else if (auto mcone = std::dynamic_pointer_cast<ChVisualShapeCone>(shape))
-                    aux_scale = ChVector<>(mcone->GetRadius(), mcone->GetRadius(), mcone->GetHeight());
-                else if (auto mcyl = std::dynamic_pointer_cast<ChVisualShapeCylinder>(shape)) {
-                    aux_scale = ChVector<>(mcyl->GetRadius(), mcyl->GetRadius(), mcyl->GetHeight());
-                }
-
-                state_file << " [";
-                state_file << "'" << shapename << "',(" << shape_frame.GetPos().x() << "," << shape_frame.GetPos().y()
-                           << "," << shape_frame.GetPos().z() << "),";
-                state_file << "(" << shape_frame.GetRot().e0() << "," << shape_frame.GetRot().e1() << ","
-                           << shape_frame.GetRot().e2() << "," << shape_frame.GetRot().e3() << "),";
-                state_file << "[";
-                if (shape->GetNumMaterials() && (!std::dynamic_pointer_cast<ChVisualShapeLine>(shape)) &&
-                    (!std::dynamic_pointer_cast<ChVisualShapePath>(shape))) {
-                    for (int im = 0; im < shape->GetNumMaterials(); ++im) {
-                        state_file << "'";
-                        auto mat = shape->GetMaterial(im);
-                        std::string matname("material_" + unique_bl_id((size_t)mat.get()));
-                        state_file << matname;
-                        state_file << "',";
-                    }
-                }
-                state_file << "],";
-                if (aux_scale != VNULL) {
-                    state_file << "(" << aux_scale.x() << "," << aux_scale.y() << "," << aux_scale.z() << ")";
-                }
-                state_file << "],\n";
-            }
-
-        }  // end loop on shape instances
-
-        state_file << "],\n";
+        ExportShapeList(state_file, item);
+        state_file << ",\n";
 
         // in case of particle clones, add array of positions&rotations of particles
 
@@ -1125,6 +1183,118 @@ void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
     }
 }
 
+// Store the pose of a body or particle cloud in the binary frame data, and its list of shapes in the object table
+void ChBlender::ExportItemBinary(std::shared_ptr<ChPhysicsItem> item, const ChFrame<>& parentframe) {
+    auto particleclones = std::dynamic_pointer_cast<ChParticleCloud>(item);
+
+    auto id_it = m_object_ids.find((size_t)item.get());
+    int id = (id_it != m_object_ids.end()) ? id_it->second : (int)m_object_ids.size();
+    m_object_ids[(size_t)item.get()] = id;
+
+    // Format the object table entry only if the shape list changed since the item was last exported
+    ShapeListKey(item, m_shape_key);
+    auto& key = m_object_keys[(size_t)item.get()];
+    if (key != m_shape_key) {
+        key = m_shape_key;
+        std::vector<char> entry;
+        ChStreamOutAsciiVector entry_stream(&entry);
+        entry_stream << "'" << item->GetName() << "', '" << (particleclones ? "CLONES" : "ASSETLIST") << "', ";
+        ExportShapeList(entry_stream, item);
+        UpdateObjectTable((size_t)item.get(), id, std::string(entry.begin(), entry.end()));
+    }
+
+    const ChVector<>& pos = parentframe.GetPos();
+    const ChQuaternion<>& rot = parentframe.GetRot();
+    float pose[7] = {(float)pos.x(),  (float)pos.y(),  (float)pos.z(), (float)rot.e0(),
+                     (float)rot.e1(), (float)rot.e2(), (float)rot.e3()};
+
+    if (particleclones) {
+        m_bin_cloud_ids.push_back(id);
+        m_bin_cloud_sizes.push_back((uint32_t)particleclones->GetNparticles());
+        m_bin_cloud_poses.insert(m_bin_cloud_poses.end(), pose, pose + 7);
+        for (unsigned int m = 0; m < particleclones->GetNparticles(); ++m) {
+            ChCoordsys<> partframe = particleclones->GetParticle(m).GetCoord();
+            float partpose[7] = {(float)partframe.pos.x(),  (float)partframe.pos.y(),  (float)partframe.pos.z(),
+                                 (float)partframe.rot.e0(), (float)partframe.rot.e1(), (float)partframe.rot.e2(),
+                                 (float)partframe.rot.e3()};
+            m_bin_particle_poses.insert(m_bin_particle_poses.end(), partpose, partpose + 7);
+        }
+    } else {
+        m_bin_object_ids.push_back(id);
+        m_bin_object_poses.insert(m_bin_object_poses.end(), pose, pose + 7);
+    }
+}
+
+// Store the contacts in the binary frame data, and the settings of the contact symbols in the object table
+void ChBlender::ExportContactsBinary() {
+    class _reporter_class : public ChContactContainer::ReportContactCallback {
+      public:
+        virtual bool OnReportContact(const ChVector<>& pA,
+                                     const ChVector<>& pB,
+                                     const ChMatrix33<>& plane_coord,
+                                     const double& distance,
+                                     const double& eff_radius,
+                                     const ChVector<>& react_forces,
+                                     const ChVector<>& react_torques,
+                                     ChContactable* contactobjA,
+                                     ChContactable* contactobjB) override {
+            if (fabs(react_forces.x()) > 1e-8 || fabs(react_forces.y()) > 1e-8 || fabs(react_forces.z()) > 1e-8) {
+                ChQuaternion<> q = plane_coord.Get_A_quaternion();
+                float contact[10] = {(float)pA.x(),           (float)pA.y(),           (float)pA.z(), (float)q.e0(),
+                                     (float)q.e1(),           (float)q.e2(),           (float)q.e3(),
+                                     (float)react_forces.x(), (float)react_forces.y(), (float)react_forces.z()};
+                contacts->insert(contacts->end(), contact, contact + 10);
+            }
+            return true;  // to continue scanning contacts
+        }
+        // Data
+        std::vector<float>* contacts;
+    };
+
+    auto my_contact_reporter = chrono_types::make_shared<_reporter_class>();
+    my_contact_reporter->contacts = &m_bin_contacts;
+    mSystem->GetContactContainer()->ReportAllContacts(my_contact_reporter);
+
+    // Settings of the contact glyphs, see the text version in ExportData()
+    std::vector<char> entry;
+    ChStreamOutAsciiVector entry_stream(&entry);
+    entry_stream << "'contacts', 'CONTACTS', {'glyph': {";
+    entry_stream << "'glyph_type': 'VECTOR LOCAL', 'dir_type': 'PROPERTY', 'property_index_dir': 0, ";
+    entry_stream << "'property_index_basis': 1, ";
+    if (this->contacts_vector_length_type == ContactSymbolVectorLength::CONSTANT)
+        entry_stream << "'length_type': 'CONST', 'length_scale': " << this->contacts_vector_scalelenght << ", ";
+    if (this->contacts_vector_length_type == ContactSymbolVectorLength::PROPERTY)
+        entry_stream << "'length_type': 'PROPERTY', 'property_index_length': 0, 'length_scale': "
+                     << this->contacts_vector_scalelenght << ", ";
+    if (this->contacts_vector_width_type == ContactSymbolVectorWidth::CONSTANT)
+        entry_stream << "'width_type': 'CONST', 'width_scale': " << this->contacts_vector_scalewidth << ", ";
+    if (this->contacts_vector_width_type == ContactSymbolVectorWidth::PROPERTY)
+        entry_stream << "'width_type': 'PROPERTY', 'property_index_width': 0, 'width_scale': "
+                     << this->contacts_vector_scalewidth << ", ";
+    if (this->contacts_color_type == ContactSymbolColor::CONSTANT)
+        entry_stream << "'color_type': 'CONST', 'const_color': (" << contacts_color_constant.R << ","
+                     << contacts_color_constant.G << "," << contacts_color_constant.B << "), ";
+    if (this->contacts_color_type == ContactSymbolColor::PROPERTY)
+        entry_stream << "'color_type': 'PROPERTY', 'property_index_color': 0, ";
+    entry_stream << "'do_tip': " << (this->contacts_vector_tip ? "True" : "False") << "}, ";
+    entry_stream << "'min': " << this->contacts_colormap_startscale << ", ";
+    entry_stream << "'max': " << this->contacts_colormap_endscale << ", ";
+    entry_stream << "'pos': (" << blender_frame.GetPos().x() << "," << blender_frame.GetPos().y() << ","
+                 << blender_frame.GetPos().z() << "), ";
+    entry_stream << "'rot': (" << blender_frame.GetRot().e0() << "," << blender_frame.GetRot().e1() << ","
+                 << blender_frame.GetRot().e2() << "," << blender_frame.GetRot().e3() << ")}";
+    UpdateObjectTable(0, -1, std::string(entry.begin(), entry.end()));
+}
+
+// Append an entry to the object table, unless it is the same as the current entry for this key
+void ChBlender::UpdateObjectTable(size_t key, int id, const std::string& entry) {
+    auto& current = m_object_table[key];
+    if (current == entry)
+        return;
+    current = entry;
+    m_object_table_update += "(" + std::to_string(framenumber) + ", " + std::to_string(id) + ", " + entry + "),\n";
+}
+
 // This function is used at each timestep to export data formatted in a way that it can be load with the python scripts
 // generated by ExportScript(). The generated filename must be set at the beginning of the animation via
 // SetOutputDataFilebase(), and then a number is automatically appended and incremented at each ExportData(), e.g.,
@@ -1154,6 +1324,16 @@ void ChBlender::ExportData(const std::string& filename) {
         m_blender_frame_shapes.clear();
         m_blender_frame_materials.clear();
 
+        // reset the binary frame data
+        m_object_table_update.clear();
+        m_bin_object_ids.clear();
+        m_bin_object_poses.clear();
+        m_bin_cloud_ids.clear();
+        m_bin_cloud_sizes.clear();
+        m_bin_cloud_poses.clear();
+        m_bin_particle_poses.clear();
+        m_bin_contacts.clear();
+
         // Save assets
         // - non mutable assets will go into assets_file, mutable will go into state_file
         // - in both cases, assets that are already present assets will not be appended
@@ -1221,8 +1401,11 @@ void ChBlender::ExportData(const std::string& filename) {
         }  // end loop on objects
 
         // #) saving contacts ?
-        if (this->mSystem->GetNcontacts() &&
+        if (this->mSystem->GetNcontacts() && binary_data &&
             (this->contacts_show == ContactSymbolType::VECTOR || this->contacts_show == ContactSymbolType::SPHERE)) {
+            ExportContactsBinary();
+        } else if (this->mSystem->GetNcontacts() &&
+                   (this->contacts_show == ContactSymbolType::VECTOR || this->contacts_show == ContactSymbolType::SPHERE)) {
 
             class _reporter_class : public ChContactContainer::ReportContactCallback {
               public:
@@ -1336,8 +1519,41 @@ void ChBlender::ExportData(const std::string& filename) {
             state_file << "\t\t) \n";
         }
 
+        // Write the binary frame file: a header with the array sizes, followed by the arrays
+        if (binary_data) {
+            std::ofstream bin_file(base_path + filename + ".bin", std::ios::binary | std::ios::trunc);
+            if (!bin_file)
+                throw ChException("Can't open binary file");
+
+            uint32_t header[8] = {0,
+                                  1,  // format version
+                                  (uint32_t)m_bin_object_ids.size(),
+                                  (uint32_t)m_bin_cloud_ids.size(),
+                                  (uint32_t)(m_bin_particle_poses.size() / 7),
+                                  (uint32_t)(m_bin_contacts.size() / 10),
+                                  0,
+                                  0};
+            memcpy(header, "CHBL", 4);
+            bin_file.write((const char*)header, sizeof(header));
+            bin_file.write((const char*)m_bin_object_ids.data(), m_bin_object_ids.size() * sizeof(int32_t));
+            bin_file.write((const char*)m_bin_object_poses.data(), m_bin_object_poses.size() * sizeof(float));
+            bin_file.write((const char*)m_bin_cloud_ids.data(), m_bin_cloud_ids.size() * sizeof(int32_t));
+            bin_file.write((const char*)m_bin_cloud_sizes.data(), m_bin_cloud_sizes.size() * sizeof(uint32_t));
+            bin_file.write((const char*)m_bin_cloud_poses.data(), m_bin_cloud_poses.size() * sizeof(float));
+            bin_file.write((const char*)m_bin_particle_poses.data(), m_bin_particle_poses.size() * sizeof(float));
+            bin_file.write((const char*)m_bin_contacts.data(), m_bin_contacts.size() * sizeof(float));
+            if (!bin_file)
+                throw ChException("Can't write binary file");
+
+            // Append the new or changed entries of the object table
+            if (!m_object_table_update.empty()) {
+                ChStreamOutAsciiFile table_file(base_path + out_script_filename + ".objects.dat", std::ios::app);
+                table_file << m_object_table_update;
+            }
+        }
+
     } catch (const ChException&) {
-        std::string err = "Can't save data into file " + filename + ".py (or .dat)";
+        std::string err = "Can't save data into file " + filename + ".py (or .dat, .bin)";
         throw(ChException(err));
     }
 
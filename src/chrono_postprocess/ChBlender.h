@@ -20,6 +20,8 @@
 #include <string>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
+#include <cstdint>
 
 #include "chrono/assets/ChVisualShape.h"
 #include "chrono/physics/ChSystem.h"
@@ -233,6 +235,14 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
     /// would allow assets whose settings change during time (ex time-changing colors)
     void SetUseSingleAssetFile(bool use) { single_asset_file = use; }
 
+    /// Set if the poses of bodies and particle clouds, and the contacts, must be saved in binary files
+    ///    state00001.bin, state00002.bin, etc.
+    /// instead of Python text (default: false). Each binary file holds packed single-precision arrays that the
+    /// chrono_import.py add-on maps directly in memory. The list of visual shapes of each exported item is written
+    /// only when the item is first exported (or if its shapes change) in the object table "exported.objects.dat", next
+    /// to the assets file. Mutable assets, cameras, links and FEA meshes are still written in the stateNNNNN.py files.
+    void SetUseBinaryData(bool use) { binary_data = use; }
+
     /// Se the rank of this process. This is useful when doing parallel simulations on multiple computing
     /// nodes, each with its own ChBlender exporter, each generating .py files in different directories, and later
     /// you want to load all them in a single Blender project: this is possible tanks to the "Merge" mode
@@ -258,6 +268,11 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
     void ExportItemState(ChStreamOutAsciiFile& state_file,
                          std::shared_ptr<ChPhysicsItem> item,
                          const ChFrame<>& parentframe);
+    void ExportShapeList(ChStreamOutAscii& mfile, std::shared_ptr<ChPhysicsItem> item);
+    void ShapeListKey(std::shared_ptr<ChPhysicsItem> item, std::string& key);
+    void ExportItemBinary(std::shared_ptr<ChPhysicsItem> item, const ChFrame<>& parentframe);
+    void ExportContactsBinary();
+    void UpdateObjectTable(size_t key, int id, const std::string& entry);
 
     const std::string unique_bl_id(size_t mpointer) const;
 
@@ -338,6 +353,21 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
 
     bool single_asset_file;
 
+    bool binary_data;
+    std::unordered_map<size_t, std::string> m_object_table;  ///< current object table entries, by physics item
+    std::unordered_map<size_t, int> m_object_ids;            ///< object table indices, by physics item
+    std::unordered_map<size_t, std::string> m_object_keys;   ///< shape list keys of the current entries, by physics item
+    std::string m_shape_key;                                 ///< shape list key of the item being exported
+    std::string m_object_table_update;                       ///< object table entries added in the current frame
+
+    std::vector<int32_t> m_bin_object_ids;    ///< binary frame: object table index of each item
+    std::vector<float> m_bin_object_poses;    ///< binary frame: item poses (x, y, z, e0, e1, e2, e3)
+    std::vector<int32_t> m_bin_cloud_ids;     ///< binary frame: object table index of each particle cloud
+    std::vector<uint32_t> m_bin_cloud_sizes;  ///< binary frame: number of particles in each cloud
+    std::vector<float> m_bin_cloud_poses;     ///< binary frame: particle cloud poses
+    std::vector<float> m_bin_particle_poses;  ///< binary frame: particle poses, in the frame of their cloud
+    std::vector<float> m_bin_contacts;        ///< binary frame: contacts (point, plane rotation, force)
+
     int rank;
 };
 
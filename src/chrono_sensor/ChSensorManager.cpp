@@ -18,7 +18,10 @@
 
 #include "chrono_sensor/ChSensorManager.h"
 
-#include "chrono_sensor/sensors/ChOptixSensor.h"
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include "chrono_sensor/sensors/ChOptixSensor.h"
+#endif
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 
@@ -28,20 +31,25 @@ namespace sensor {
 CH_SENSOR_API ChSensorManager::ChSensorManager(ChSystem* chrono_system) : m_verbose(false), m_optix_reflections(9) {
     // save the chrono system handle
     m_system = chrono_system;
+#ifdef CHRONO_SENSOR_USE_OPTIX
     scene = chrono_types::make_shared<ChScene>();
+#endif
     m_device_list = {0};
 }
 
 CH_SENSOR_API ChSensorManager::~ChSensorManager() {}
 
+#ifdef CHRONO_SENSOR_USE_OPTIX
 CH_SENSOR_API std::shared_ptr<ChOptixEngine> ChSensorManager::GetEngine(int context_id) {
     if (context_id < m_engines.size())
         return m_engines[context_id];
     std::cerr << "ERROR: index out of render group vector bounds\n";
     return NULL;
 }
+#endif
 
 CH_SENSOR_API void ChSensorManager::Update() {
+#ifdef CHRONO_SENSOR_USE_OPTIX
     // update the scene
     // scene->PackFrame(m_system);
     //
@@ -49,6 +57,7 @@ CH_SENSOR_API void ChSensorManager::Update() {
     for (auto pEngine : m_engines) {
         pEngine->UpdateSensors(scene);
     }
+#endif
 
     // have the sensormanager update all of the non-optix sensor (IMU and GPS).
     // TODO: perhaps create a thread that takes care of this? Tradeoff since IMU should require some data from EVERY
@@ -66,11 +75,13 @@ CH_SENSOR_API std::vector<unsigned int> ChSensorManager::GetDeviceList() {
     return m_device_list;
 }
 
+#ifdef CHRONO_SENSOR_USE_OPTIX
 CH_SENSOR_API void ChSensorManager::ReconstructScenes() {
     for (auto eng : m_engines) {
         eng->ConstructScene();
     }
 }
+#endif
 
 CH_SENSOR_API void ChSensorManager::SetMaxEngines(int num_groups) {
     if (num_groups > 0 && num_groups < 1000) {
@@ -91,6 +102,7 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
     }
     m_sensor_list.push_back(sensor);
 
+#ifdef CHRONO_SENSOR_USE_OPTIX
     if (auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(sensor)) {
         m_render_sensor.push_back(sensor);
         //******** give each render group all sensor with same update rate *************//
@@ -135,14 +147,16 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
             std::cerr << "Failed to create a ChOptixEngine, with error:\n" << e.what() << "\n";
             exit(1);
         }
-    } else {
-        if (!m_dynamics_manager) {
-            m_dynamics_manager = chrono_types::make_shared<ChDynamicsManager>(m_system);
-        }
+        return;
+    }
+#endif
 
-        // add pure dynamic sensor to dynamic manager
-        m_dynamics_manager->AssignSensor(sensor);
+    if (!m_dynamics_manager) {
+        m_dynamics_manager = chrono_types::make_shared<ChDynamicsManager>(m_system);
     }
+
+    // add pure dynamic sensor to dynamic manager
+    m_dynamics_manager->AssignSensor(sensor);
 }
 
 }  // namespace sensor
@@ -16,13 +16,20 @@
 
 #include "chrono_sensor/filters/ChFilterAccess.h"
 #include "chrono_sensor/sensors/ChSensor.h"
-#include "chrono_sensor/utils/CudaMallocHelper.h"
 
-#include <cuda.h>
+#include <cstring>
+
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include "chrono_sensor/utils/CudaMallocHelper.h"
+
+    #include <cuda.h>
+#endif
 
 namespace chrono {
 namespace sensor {
 
+#ifdef CHRONO_SENSOR_USE_OPTIX
+
 template <>
 CH_SENSOR_API void ChFilterAccess<SensorHostR8Buffer, UserR8BufferPtr>::Apply() {
     // create a new buffer to push to the lag buffer list
@@ -137,6 +144,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostSemanticBuffer, UserSemanticBufferPt
     }
 }
 
+#endif
+
 
 template <>
 CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Apply() {
@@ -147,9 +156,15 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostXYZIBuffer>();
-        std::shared_ptr<PixelXYZI[]> b(cudaHostMallocHelper<PixelXYZI>(m_bufferIn->Width * m_bufferIn->Height),
-                                       cudaHostFreeHelper<PixelXYZI>);
-        tmp_buffer->Buffer = std::move(b);
+        if (m_host_data) {
+            tmp_buffer->Buffer = std::make_unique<PixelXYZI[]>(m_bufferIn->Width * m_bufferIn->Height);
+        } else {
+#ifdef CHRONO_SENSOR_USE_OPTIX
+            std::shared_ptr<PixelXYZI[]> b(cudaHostMallocHelper<PixelXYZI>(m_bufferIn->Width * m_bufferIn->Height),
+                                           cudaHostFreeHelper<PixelXYZI>);
+            tmp_buffer->Buffer = std::move(b);
+#endif
+        }
     }
 
     tmp_buffer->Width = m_bufferIn->Beam_return_count;
@@ -157,8 +172,16 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI), cudaMemcpyDeviceToHost, m_cuda_stream);
+    if (m_host_data) {
+        memcpy(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+               m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI));
+    } else {
+#ifdef CHRONO_SENSOR_USE_OPTIX
+        cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                        m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI), cudaMemcpyDeviceToHost,
+                        m_cuda_stream);
+#endif
+    }
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -171,8 +194,11 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
                 m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
             m_lag_buffers.pop();
         }
+#ifdef CHRONO_SENSOR_USE_OPTIX
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_data)
+            cudaStreamSynchronize(m_cuda_stream);
+#endif
     }
 }
 
@@ -185,9 +211,15 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostDIBuffer>();
-        std::shared_ptr<PixelDI[]> b(cudaHostMallocHelper<PixelDI>(m_bufferIn->Width * m_bufferIn->Height),
-                                     cudaHostFreeHelper<PixelDI>);
-        tmp_buffer->Buffer = std::move(b);
+        if (m_host_data) {
+            tmp_buffer->Buffer = std::make_unique<PixelDI[]>(m_bufferIn->Width * m_bufferIn->Height);
+        } else {
+#ifdef CHRONO_SENSOR_USE_OPTIX
+            std::shared_ptr<PixelDI[]> b(cudaHostMallocHelper<PixelDI>(m_bufferIn->Width * m_bufferIn->Height),
+                                         cudaHostFreeHelper<PixelDI>);
+            tmp_buffer->Buffer = std::move(b);
+#endif
+        }
     }
 
     tmp_buffer->Width = m_bufferIn->Width;
@@ -195,8 +227,16 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI), cudaMemcpyDeviceToHost, m_cuda_stream);
+    if (m_host_data) {
+        memcpy(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+               m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI));
+    } else {
+#ifdef CHRONO_SENSOR_USE_OPTIX
+        cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                        m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI), cudaMemcpyDeviceToHost,
+                        m_cuda_stream);
+#endif
+    }
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -209,11 +249,16 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
                 m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
             m_lag_buffers.pop();
         }
+#ifdef CHRONO_SENSOR_USE_OPTIX
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_data)
+            cudaStreamSynchronize(m_cuda_stream);
+#endif
     }
 }
 
+#ifdef CHRONO_SENSOR_USE_OPTIX
+
 template <>
 CH_SENSOR_API void ChFilterAccess<SensorHostRadarBuffer, UserRadarBufferPtr>::Apply() {
     // create a new buffer to push to the lag buffer list
@@ -292,6 +337,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRadarXYZBuffer, UserRadarXYZBufferPt
     }
 }
 
+#endif
+
 template <>
 CH_SENSOR_API void ChFilterAccess<SensorHostAccelBuffer, UserAccelBufferPtr>::Apply() {
     // create a new buffer to push to the lag buffer list
@@ -22,9 +22,13 @@
 #include <queue>
 #include <stack>
 #include <mutex>
+#include "chrono_sensor/ChConfigSensor.h"
 #include "chrono_sensor/sensors/ChSensorBuffer.h"
 #include "chrono_sensor/filters/ChFilter.h"
-#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/sensors/ChRaycastSensor.h"
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include "chrono_sensor/sensors/ChOptixSensor.h"
+#endif
 #include "chrono/physics/ChSystem.h"
 
 #include <typeinfo>
@@ -72,8 +76,12 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
             InvalidFilterGraphBufferTypeMismatch(pSensor);
         }
 
-        if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
+        if (std::dynamic_pointer_cast<ChRaycastSensor>(pSensor)) {
+            m_host_data = true;
+#ifdef CHRONO_SENSOR_USE_OPTIX
+        } else if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
             m_cuda_stream = pOpx->GetCudaStream();
+#endif
         }
 
         m_sensor = pSensor;  // save handle to the parent sensor (weak ptr to not cause loop dependency)
@@ -124,7 +132,10 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
     UserBufferType m_user_buffer;            ///< buffer that can be returned
     std::weak_ptr<ChSensor> m_sensor;        ///< pointer to the sensor to which this filter is attached
     std::shared_ptr<BufferType> m_bufferIn;  ///< shared pointer to the buffer coming in
+#ifdef CHRONO_SENSOR_USE_OPTIX
     CUstream m_cuda_stream;                  ///< reference to the cuda stream for device-side buffers
+#endif
+    bool m_host_data = false;                ///< incoming lidar data is in host memory (ray-cast sensor)
 
     std::queue<std::shared_ptr<BufferType>>
         m_lag_buffers;  ///< buffers that are time stamped and held until past their lag time
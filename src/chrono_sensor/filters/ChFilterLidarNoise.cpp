@@ -15,11 +15,16 @@
 // =============================================================================
 
 #include "chrono_sensor/filters/ChFilterLidarNoise.h"
-#include "chrono_sensor/sensors/ChOptixSensor.h"
-#include "chrono_sensor/cuda/lidar_noise.cuh"
-#include "chrono_sensor/cuda/curand_utils.cuh"
-#include "chrono_sensor/utils/CudaMallocHelper.h"
+#include "chrono_sensor/sensors/ChRaycastSensor.h"
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include "chrono_sensor/sensors/ChOptixSensor.h"
+    #include "chrono_sensor/cuda/lidar_noise.cuh"
+    #include "chrono_sensor/cuda/curand_utils.cuh"
+    #include "chrono_sensor/utils/CudaMallocHelper.h"
+#endif
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 
 namespace chrono {
 namespace sensor {
@@ -45,6 +50,13 @@ void ChFilterLidarNoiseXYZI::Initialize(std::shared_ptr<ChSensor> pSensor, std::
     }
     m_bufferInOut = pXYZI;
 
+    if (std::dynamic_pointer_cast<ChRaycastSensor>(pSensor)) {
+        m_host_data = true;
+        m_generator.seed((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+        return;
+    }
+
+#ifdef CHRONO_SENSOR_USE_OPTIX
     if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
     } else {
@@ -55,12 +67,44 @@ void ChFilterLidarNoiseXYZI::Initialize(std::shared_ptr<ChSensor> pSensor, std::
         cudaMallocHelper<curandState_t>(m_bufferInOut->Width * m_bufferInOut->Height), cudaFreeHelper<curandState_t>);
     init_cuda_rng((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()), m_rng.get(),
                   m_bufferInOut->Width * m_bufferInOut->Height);
+#else
+    InvalidFilterGraphSensorTypeMismatch(pSensor);
+#endif
 }
 
 void ChFilterLidarNoiseXYZI::Apply() {
+    if (m_host_data) {
+        // same noise model as the device kernel, applied to the points with a return
+        std::normal_distribution<float> normal(0.f, 1.f);
+        for (unsigned int k = 0; k < m_bufferInOut->Beam_return_count; k++) {
+            PixelXYZI& p = m_bufferInOut->Buffer[k];
+            float range = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+            if (p.intensity <= 1e-6f || range <= 1e-6f)
+                continue;
+            float phi = std::asin(p.z / (range + 1e-6f));
+            float c = p.x / ((range + 1e-6f) * std::cos(phi));
+            float theta = std::acos(std::max(-1.f, std::min(1.f, c)));
+            if (p.y < 0)
+                theta = -theta;
+
+            range += normal(m_generator) * m_stdev_range;
+            theta += normal(m_generator) * m_stdev_h_angle;
+            phi += normal(m_generator) * m_stdev_v_angle;
+            float i = p.intensity + normal(m_generator) * m_stdev_intensity;
+
+            p.x = std::cos(theta) * std::cos(phi) * range;
+            p.y = std::sin(theta) * std::cos(phi) * range;
+            p.z = std::sin(phi) * range;
+            p.intensity = i > 0 ? i : 0;
+        }
+        return;
+    }
+
+#ifdef CHRONO_SENSOR_USE_OPTIX
     cuda_lidar_noise_normal((float*)m_bufferInOut->Buffer.get(), (int)m_bufferInOut->Width, (int)m_bufferInOut->Height,
                             m_stdev_range, m_stdev_v_angle, m_stdev_h_angle, m_stdev_intensity, m_rng.get(),
                             m_cuda_stream);
+#endif
 }
 
 }  // namespace sensor
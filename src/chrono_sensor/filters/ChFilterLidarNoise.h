@@ -17,11 +17,15 @@
 #ifndef CHFILTERLIDARNOISE_H
 #define CHFILTERLIDARNOISE_H
 
+#include "chrono_sensor/ChConfigSensor.h"
 #include "chrono_sensor/filters/ChFilter.h"
 
-#include <cuda.h>
-#include <curand.h>
-#include <curand_kernel.h>
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include <cuda.h>
+    #include <curand.h>
+    #include <curand_kernel.h>
+#endif
+#include <random>
 
 namespace chrono {
 namespace sensor {
@@ -29,7 +33,8 @@ namespace sensor {
 /// @addtogroup sensor_filters
 /// @{
 
-/// A filter that adds noise based on depth and intensity given data in point cloud format
+/// A filter that adds noise based on depth and intensity given data in point cloud format. For a ray-cast sensor
+/// (ChRaycastSensor), the noise is applied in host memory.
 class CH_SENSOR_API ChFilterLidarNoiseXYZI : public ChFilter {
   public:
     /// Class constructor
@@ -57,9 +62,13 @@ class CH_SENSOR_API ChFilterLidarNoiseXYZI : public ChFilter {
     float m_stdev_v_angle;    ///< Standard deviation of the normal distribution applied to the vertical angle
     float m_stdev_h_angle;    ///< Standard deviation of the normal distribution applied to the horizontal angle
     float m_stdev_intensity;  ///< Standard deviation of the normal distribution applied to the intensity measurement
+#ifdef CHRONO_SENSOR_USE_OPTIX
     std::shared_ptr<curandState_t> m_rng;                   ///< cuda random number generator
-    std::shared_ptr<SensorDeviceXYZIBuffer> m_bufferInOut;  ///< buffer for applying noise to point cloud
     CUstream m_cuda_stream;                                 ///< reference to the cuda stream
+#endif
+    std::shared_ptr<SensorDeviceXYZIBuffer> m_bufferInOut;  ///< buffer for applying noise to point cloud
+    bool m_host_data = false;                               ///< buffer is in host memory (ray-cast sensor)
+    std::minstd_rand m_generator;                           ///< random number generator for host data
 };
 
 /// @}
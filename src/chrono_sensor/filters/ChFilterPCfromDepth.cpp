@@ -15,9 +15,12 @@
 // =============================================================================
 
 #include "chrono_sensor/filters/ChFilterPCfromDepth.h"
-#include "chrono_sensor/sensors/ChLidarSensor.h"
-#include "chrono_sensor/cuda/pointcloud.cuh"
-#include "chrono_sensor/utils/CudaMallocHelper.h"
+#include "chrono_sensor/sensors/ChRaycastSensor.h"
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include "chrono_sensor/sensors/ChLidarSensor.h"
+    #include "chrono_sensor/cuda/pointcloud.cuh"
+    #include "chrono_sensor/utils/CudaMallocHelper.h"
+#endif
 
 // #include <cuda_runtime_api.h>
 
@@ -32,21 +35,31 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
         InvalidFilterGraphNullBuffer(pSensor);
     if (!(m_buffer_in = std::dynamic_pointer_cast<SensorDeviceDIBuffer>(bufferInOut)))
         InvalidFilterGraphBufferTypeMismatch(pSensor);
-    if (auto pLidar = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
+    if (auto pRaycast = std::dynamic_pointer_cast<ChRaycastSensor>(pSensor)) {
+        m_beam_dirs = pRaycast->GetBeamDirections();
+        m_host_data = true;
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    } else if (auto pLidar = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
         m_hFOV = pLidar->GetHFOV();
         m_min_vert_angle = pLidar->GetMinVertAngle();
         m_max_vert_angle = pLidar->GetMaxVertAngle();
         m_cuda_stream = pLidar->GetCudaStream();
+#endif
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
     // allocate output buffer
     m_buffer_out = chrono_types::make_shared<SensorDeviceXYZIBuffer>();
-    DeviceXYZIBufferPtr b(
-        cudaMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
-        cudaFreeHelper<PixelXYZI>);
-    m_buffer_out->Buffer = std::move(b);
+    unsigned int size = m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1);
+    if (m_host_data) {
+        m_buffer_out->Buffer = std::make_unique<PixelXYZI[]>(size);
+    } else {
+#ifdef CHRONO_SENSOR_USE_OPTIX
+        DeviceXYZIBufferPtr b(cudaMallocHelper<PixelXYZI>(size), cudaFreeHelper<PixelXYZI>);
+        m_buffer_out->Buffer = std::move(b);
+#endif
+    }
     m_buffer_out->Width = m_buffer_in->Width;
     m_buffer_out->Height = m_buffer_in->Height;
     m_buffer_out->Dual_return = m_buffer_in->Dual_return;
@@ -54,6 +67,23 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
 }
 
 CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
+    if (m_host_data) {
+        // ray-cast sensor: convert and keep only the beams with a return, directly in host memory
+        m_buffer_out->Beam_return_count = 0;
+        for (unsigned int i = 0; i < m_buffer_in->Width * m_buffer_in->Height; i++) {
+            const PixelDI& p = m_buffer_in->Buffer[i];
+            if (p.intensity > 0) {
+                ChVector<float> pos = m_beam_dirs[i] * p.range;
+                m_buffer_out->Buffer[m_buffer_out->Beam_return_count] = {pos.x(), pos.y(), pos.z(), p.intensity};
+                m_buffer_out->Beam_return_count++;
+            }
+        }
+        m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+        return;
+    }
+
+#ifdef CHRONO_SENSOR_USE_OPTIX
     // carry out the conversion from depth to point cloud
     if (m_buffer_in->Dual_return) {
         cuda_pointcloud_from_depth_dual_return(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
@@ -83,6 +113,7 @@ CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
 
     m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
     m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+#endif
 }
 }  // namespace sensor
 }  // namespace chrono
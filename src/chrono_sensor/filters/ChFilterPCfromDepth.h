@@ -17,8 +17,13 @@
 #ifndef CHFILTERPCFROMDEPTH_H
 #define CHFILTERPCFROMDEPTH_H
 
+#include "chrono_sensor/ChConfigSensor.h"
 #include "chrono_sensor/filters/ChFilter.h"
-#include <cuda.h>
+#include "chrono/core/ChVector.h"
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include <cuda.h>
+#endif
+#include <vector>
 
 namespace chrono {
 namespace sensor {
@@ -29,7 +34,8 @@ class ChSensor;
 /// @addtogroup sensor_filters
 /// @{
 
-/// A filter that, when applied to a sensor, generates point cloud data from depth values
+/// A filter that, when applied to a sensor, generates point cloud data from depth values. For a ray-cast sensor
+/// (ChRaycastSensor), the conversion uses the beam directions of the sensor and is done in host memory.
 class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
   public:
     /// Class constructor
@@ -48,7 +54,11 @@ class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
     float m_hFOV;                                          ///< field of view of the parent lidar
     float m_min_vert_angle;                                ///< mimimum vertical angle of parent lidar
     float m_max_vert_angle;                                ///< maximum vetical angle of parent lidar
+#ifdef CHRONO_SENSOR_USE_OPTIX
     CUstream m_cuda_stream;                                ///< reference to the cuda stream
+#endif
+    bool m_host_data = false;                              ///< buffers are in host memory (ray-cast sensor)
+    std::vector<ChVector<float>> m_beam_dirs;              ///< beam directions of a ray-cast sensor
     std::shared_ptr<SensorDeviceDIBuffer> m_buffer_in;     ///< holder of the input buffer
     std::shared_ptr<SensorDeviceXYZIBuffer> m_buffer_out;  ///< holder of the output buffer
 };
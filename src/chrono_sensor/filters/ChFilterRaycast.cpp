@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Filter that traces the beams of a ray-cast sensor against the collision
+// system and generates depth/intensity data in host memory
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono_sensor/filters/ChFilterRaycast.h"
+#include "chrono_sensor/sensors/ChRaycastSensor.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace sensor {
+
+ChFilterRaycast::ChFilterRaycast(std::string name) : ChFilter(name) {}
+
+CH_SENSOR_API void ChFilterRaycast::Apply() {
+    const auto& dirs = m_raySensor->GetBeamDirections();
+    unsigned int w = m_raySensor->GetWidth();
+    unsigned int h = m_raySensor->GetHeight();
+    double clip_near = m_raySensor->GetClipNear();
+    double max_distance = m_raySensor->GetMaxDistance();
+
+    // sensor poses at the start and at the end of the collection window
+    if (m_raySensor->m_keyframes.empty())
+        m_raySensor->PushKeyFrame();
+    const auto& frame0 = m_raySensor->m_keyframes.front();
+    const auto& frame1 = m_raySensor->m_keyframes.back();
+    ChQuaternion<> rot1 = frame1.GetRot();
+    if ((frame0.GetRot() ^ rot1) < 0)
+        rot1 = -rot1;
+
+    // each column of beams is traced from the sensor pose at the time the column is swept in the collection window
+    std::vector<ChVector<>> col_pos(w);
+    std::vector<ChQuaternion<>> col_rot(w);
+    for (unsigned int i = 0; i < w; i++) {
+        double t = i / (double)w;
+        col_pos[i] = frame0.GetPos() * (1 - t) + frame1.GetPos() * t;
+        col_rot[i] = frame0.GetRot() * (1 - t) + rot1 * t;
+        col_rot[i].Normalize();
+    }
+
+    // beams are generated row by row, so that consecutive rays (traced as a packet) are close to each other
+    for (unsigned int j = 0; j < h; j++) {
+        for (unsigned int i = 0; i < w; i++) {
+            unsigned int k = j * w + i;
+            ChVector<> dir = col_rot[i].Rotate(ChVector<>(dirs[k]));
+            m_rays[k].from = col_pos[i] + dir * clip_near;
+            m_rays[k].to = col_pos[i] + dir * max_distance;
+        }
+    }
+
+    auto sys = m_raySensor->GetParent()->GetSystem();
+    sys->GetCollisionSystem()->RayHitBatch(m_rays, m_hits, m_raySensor->GetNumThreads());
+
+    // range along the beam and intensity of a diffuse reflection (no return if nothing was hit)
+    for (unsigned int k = 0; k < w * h; k++) {
+        const auto& hit = m_hits[k];
+        if (hit.hit) {
+            ChVector<> dir = m_rays[k].to - m_rays[k].from;
+            double length = dir.Length();
+            m_bufferOut->Buffer[k].range = (float)(clip_near + hit.dist_factor * length);
+            m_bufferOut->Buffer[k].intensity = (float)std::abs(Vdot(hit.abs_hitNormal, dir) / length);
+        } else {
+            m_bufferOut->Buffer[k].range = 0.f;
+            m_bufferOut->Buffer[k].intensity = 0.f;
+        }
+    }
+
+    m_bufferOut->LaunchedCount = m_raySensor->GetNumLaunches();
+    m_bufferOut->TimeStamp = (float)sys->GetChTime();
+}
+
+CH_SENSOR_API void ChFilterRaycast::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                               std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (bufferInOut) {
+        throw std::runtime_error("Raycast update filter must be applied first in filter graph");
+    }
+    m_raySensor = std::dynamic_pointer_cast<ChRaycastSensor>(pSensor);
+    if (!m_raySensor) {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+    if (!m_raySensor->GetParent()->GetSystem()->GetCollisionSystem()) {
+        throw std::runtime_error("Raycast sensors require a collision system in the Chrono system");
+    }
+
+    unsigned int num_beams = m_raySensor->GetWidth() * m_raySensor->GetHeight();
+    m_rays.resize(num_beams);
+    m_hits.resize(num_beams);
+
+    m_bufferOut = chrono_types::make_shared<SensorHostDIBuffer>();
+    m_bufferOut->Buffer = std::make_unique<PixelDI[]>(num_beams);
+    m_bufferOut->Width = m_raySensor->GetWidth();
+    m_bufferOut->Height = m_raySensor->GetHeight();
+    m_bufferOut->Dual_return = false;
+    m_bufferOut->LaunchedCount = m_raySensor->GetNumLaunches();
+    m_bufferOut->TimeStamp = 0.f;
+
+    bufferInOut = m_bufferOut;
+}
+
+}  // namespace sensor
+}  // namespace chrono
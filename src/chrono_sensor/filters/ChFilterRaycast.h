@@ -0,0 +1,65 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Filter that traces the beams of a ray-cast sensor against the collision
+// system and generates depth/intensity data in host memory
+//
+// =============================================================================
+
+#ifndef CHFILTERRAYCAST_H
+#define CHFILTERRAYCAST_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_sensor/filters/ChFilter.h"
+#include "chrono/collision/ChCollisionSystem.h"
+
+namespace chrono {
+namespace sensor {
+
+// forward declaration
+class ChSensor;
+class ChRaycastSensor;
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// A filter that generates the depth/intensity data of a ray-cast sensor. This filter is added automatically as the
+/// first filter of a ChRaycastSensor.
+class CH_SENSOR_API ChFilterRaycast : public ChFilter {
+  public:
+    /// Class constructor
+    /// @param name String name of the filter
+    ChFilterRaycast(std::string name = "Raycast Updater");
+
+    /// Apply function. Traces all beams of the sensor and fills the depth/intensity buffer.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter access apply function.
+    /// @param pSensor A pointer to the sensor on which the filter is attached.
+    /// @param bufferInOut A buffer that is passed into the filter.
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+  private:
+    std::shared_ptr<ChRaycastSensor> m_raySensor;           ///< sensor on which the filter is attached
+    std::shared_ptr<SensorHostDIBuffer> m_bufferOut;        ///< generated depth/intensity data
+    std::vector<ChCollisionSystem::ChRay> m_rays;           ///< beams, in absolute coordinates
+    std::vector<ChCollisionSystem::ChRayhitResult> m_hits;  ///< ray-hit results
+};
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
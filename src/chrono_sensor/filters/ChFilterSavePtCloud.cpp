@@ -16,7 +16,10 @@
 // =============================================================================
 
 #include "chrono_sensor/filters/ChFilterSavePtCloud.h"
-#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/sensors/ChRaycastSensor.h"
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include "chrono_sensor/sensors/ChOptixSensor.h"
+#endif
 
 #include "chrono_thirdparty/filesystem/path.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
@@ -24,7 +27,9 @@
 #include <vector>
 #include <sstream>
 
-#include <cuda_runtime_api.h>
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include <cuda_runtime_api.h>
+#endif
 
 namespace chrono {
 namespace sensor {
@@ -36,14 +41,22 @@ CH_SENSOR_API ChFilterSavePtCloud::ChFilterSavePtCloud(std::string data_path, st
 CH_SENSOR_API ChFilterSavePtCloud::~ChFilterSavePtCloud() {}
 
 CH_SENSOR_API void ChFilterSavePtCloud::Apply() {
-    cudaMemcpyAsync(m_host_buffer->Buffer.get(), m_buffer_in->Buffer.get(),
-                    sizeof(PixelXYZI) * m_host_buffer->Width * m_host_buffer->Height * (m_host_buffer->Dual_return + 1),
-                    cudaMemcpyDeviceToHost, m_cuda_stream);
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    if (!m_host_data) {
+        cudaMemcpyAsync(
+            m_host_buffer->Buffer.get(), m_buffer_in->Buffer.get(),
+            sizeof(PixelXYZI) * m_host_buffer->Width * m_host_buffer->Height * (m_host_buffer->Dual_return + 1),
+            cudaMemcpyDeviceToHost, m_cuda_stream);
+    }
+#endif
 
     std::string filename = m_path + "frame_" + std::to_string(m_frame_number) + ".csv";
     m_frame_number++;
     utils::CSV_writer csv_writer(",");
-    cudaStreamSynchronize(m_cuda_stream);
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    if (!m_host_data)
+        cudaStreamSynchronize(m_cuda_stream);
+#endif
     std::cout << "Beam count: " << m_buffer_in->Beam_return_count << std::endl;
     for (unsigned int i = 0; i < m_buffer_in->Beam_return_count; i++) {
         csv_writer << m_host_buffer->Buffer[i].x << m_host_buffer->Buffer[i].y << m_host_buffer->Buffer[i].z
@@ -61,19 +74,30 @@ CH_SENSOR_API void ChFilterSavePtCloud::Initialize(std::shared_ptr<ChSensor> pSe
     if (!m_buffer_in)
         InvalidFilterGraphBufferTypeMismatch(pSensor);
 
-    if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
+    if (std::dynamic_pointer_cast<ChRaycastSensor>(pSensor)) {
+        m_host_data = true;
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    } else if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
+#endif
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
-    m_host_buffer = chrono_types::make_shared<SensorHostXYZIBuffer>();
-    std::shared_ptr<PixelXYZI[]> b(
-        cudaHostMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
-        cudaHostFreeHelper<PixelXYZI>);
-    m_host_buffer->Buffer = std::move(b);
-    m_host_buffer->Width = m_buffer_in->Width;
-    m_host_buffer->Height = m_buffer_in->Height;
+    if (m_host_data) {
+        // the points of a ray-cast sensor are already in host memory
+        m_host_buffer = m_buffer_in;
+    } else {
+#ifdef CHRONO_SENSOR_USE_OPTIX
+        m_host_buffer = chrono_types::make_shared<SensorHostXYZIBuffer>();
+        std::shared_ptr<PixelXYZI[]> b(
+            cudaHostMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
+            cudaHostFreeHelper<PixelXYZI>);
+        m_host_buffer->Buffer = std::move(b);
+        m_host_buffer->Width = m_buffer_in->Width;
+        m_host_buffer->Height = m_buffer_in->Height;
+#endif
+    }
 
     std::vector<std::string> split_string;
 #ifdef _WIN32
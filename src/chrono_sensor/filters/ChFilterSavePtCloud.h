@@ -18,8 +18,11 @@
 #ifndef CHFILTERSAVEPTCLOUD_H
 #define CHFILTERSAVEPTCLOUD_H
 
+#include "chrono_sensor/ChConfigSensor.h"
 #include "chrono_sensor/filters/ChFilter.h"
-#include "chrono_sensor/utils/CudaMallocHelper.h"
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include "chrono_sensor/utils/CudaMallocHelper.h"
+#endif
 
 namespace chrono {
 namespace sensor {
@@ -55,7 +58,10 @@ class CH_SENSOR_API ChFilterSavePtCloud : public ChFilter {
     unsigned int m_frame_number = 0;                      ///< frame counter for saving sequential frames
     std::shared_ptr<SensorDeviceXYZIBuffer> m_buffer_in;  ///< input buffer for point cloud
     std::shared_ptr<SensorHostXYZIBuffer> m_host_buffer;  ///< input buffer for point cloud
+#ifdef CHRONO_SENSOR_USE_OPTIX
     CUstream m_cuda_stream;
+#endif
+    bool m_host_data = false;                             ///< input buffer is in host memory (ray-cast sensor)
 };
 
 /// @}
@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Lidar and depth camera sensors that trace their beams on the CPU against the
+// collision models of the Chrono system
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono_sensor/sensors/ChRaycastSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+CH_SENSOR_API ChRaycastSensor::ChRaycastSensor(std::shared_ptr<chrono::ChBody> parent,
+                                               float updateRate,
+                                               chrono::ChFrame<double> offsetPose,
+                                               unsigned int w,
+                                               unsigned int h,
+                                               float max_distance,
+                                               float clip_near)
+    : ChDynamicSensor(parent, updateRate, offsetPose),
+      m_width(w),
+      m_height(h),
+      m_max_distance(max_distance),
+      m_clip_near(clip_near),
+      m_nthreads(1) {
+    m_filters.push_front(chrono_types::make_shared<ChFilterRaycast>());
+}
+
+CH_SENSOR_API void ChRaycastSensor::PushKeyFrame() {
+    ChFrame<double> frame;
+    m_parent->ChFrame<double>::TransformLocalToParent(m_offsetPose, frame);
+    m_keyframes.push_back(frame);
+}
+
+CH_SENSOR_API void ChRaycastSensor::ClearKeyFrames() {
+    m_keyframes.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+CH_SENSOR_API ChRaycastLidarSensor::ChRaycastLidarSensor(std::shared_ptr<chrono::ChBody> parent,
+                                                         float updateRate,
+                                                         chrono::ChFrame<double> offsetPose,
+                                                         unsigned int w,
+                                                         unsigned int h,
+                                                         float hfov,
+                                                         float max_vertical_angle,
+                                                         float min_vertical_angle,
+                                                         float max_distance,
+                                                         float clip_near)
+    : ChRaycastSensor(parent, updateRate, offsetPose, w, h, max_distance, clip_near),
+      m_hFOV(hfov),
+      m_max_vert_angle(max_vertical_angle),
+      m_min_vert_angle(min_vertical_angle) {
+    // same beam angles as the OptiX lidar (and as assumed by ChFilterPCfromDepth)
+    m_beam_dirs.resize(w * h);
+    for (unsigned int j = 0; j < h; j++) {
+        float v_angle =
+            (j / (float)std::max(1u, h - 1)) * (max_vertical_angle - min_vertical_angle) + min_vertical_angle;
+        for (unsigned int i = 0; i < w; i++) {
+            float h_angle = (i / (float)std::max(1u, w - 1)) * hfov - hfov / 2;
+            m_beam_dirs[j * w + i] = ChVector<float>(std::cos(v_angle) * std::cos(h_angle),
+                                                     std::cos(v_angle) * std::sin(h_angle), std::sin(v_angle));
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+CH_SENSOR_API ChRaycastDepthCamera::ChRaycastDepthCamera(std::shared_ptr<chrono::ChBody> parent,
+                                                         float updateRate,
+                                                         chrono::ChFrame<double> offsetPose,
+                                                         unsigned int w,
+                                                         unsigned int h,
+                                                         float hfov,
+                                                         float max_distance,
+                                                         float clip_near)
+    : ChRaycastSensor(parent, updateRate, offsetPose, w, h, max_distance, clip_near), m_hFOV(hfov) {
+    // pinhole camera with the pixel layout of the OptiX camera (x forward, y left, z up, first row at the bottom)
+    float h_factor = std::tan(hfov / 2);
+    m_beam_dirs.resize(w * h);
+    for (unsigned int j = 0; j < h; j++) {
+        float dy = ((j + 0.5f) / h * 2 - 1) * h / (float)w;
+        for (unsigned int i = 0; i < w; i++) {
+            float dx = (i + 0.5f) / w * 2 - 1;
+            ChVector<float> dir(1, -dx * h_factor, dy * h_factor);
+            m_beam_dirs[j * w + i] = dir.GetNormalized();
+        }
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,180 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Lidar and depth camera sensors that trace their beams on the CPU against the
+// collision models of the Chrono system (no GPU or OptiX required)
+//
+// =============================================================================
+
+#ifndef CHRAYCASTSENSOR_H
+#define CHRAYCASTSENSOR_H
+
+#include <vector>
+
+#include "chrono_sensor/sensors/ChSensor.h"
+#include "chrono_sensor/filters/ChFilterRaycast.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_sensors
+/// @{
+
+/// Base class for sensors that trace a grid of beams against the collision system of the Chrono system. The beams are
+/// traced on the CPU (see ChCollisionSystem::RayHitBatch), in packets of neighboring beams distributed over multiple
+/// threads. The first filter of such a sensor generates a depth/intensity buffer with one entry per beam, in host
+/// memory, which can be processed by the same filters as the data of a ChLidarSensor (ChFilterPCfromDepth,
+/// ChFilterLidarNoiseXYZI, ChFilterSavePtCloud, ChFilterDIAccess, ChFilterXYZIAccess). Only objects with collision
+/// models are visible to these sensors. This sensor operates in lock-step with the Chrono simulation.
+class CH_SENSOR_API ChRaycastSensor : public ChDynamicSensor {
+  public:
+    /// Class destructor
+    ~ChRaycastSensor() {}
+
+    /// Set the number of threads used for tracing the beams (default: 1).
+    void SetNumThreads(int nthreads) { m_nthreads = nthreads > 0 ? nthreads : 1; }
+
+    /// Returns the number of threads used for tracing the beams
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Returns the number of beams in a row of the beam grid
+    unsigned int GetWidth() const { return m_width; }
+
+    /// Returns the number of rows of the beam grid
+    unsigned int GetHeight() const { return m_height; }
+
+    /// Returns the maximum range of the sensor
+    float GetMaxDistance() const { return m_max_distance; }
+
+    /// Returns the near clipping distance
+    float GetClipNear() const { return m_clip_near; }
+
+    /// Returns the unit direction of each beam, in the sensor frame, ordered row by row
+    const std::vector<ChVector<float>>& GetBeamDirections() const { return m_beam_dirs; }
+
+    virtual void PushKeyFrame() override;
+    virtual void ClearKeyFrames() override;
+
+  protected:
+    /// Constructor for the ray-cast sensors. Derived classes must set the beam directions.
+    /// @param parent Body to which the sensor is attached.
+    /// @param updateRate Rate at which the sensor should update.
+    /// @param offsetPose Relative position and orientation of the sensor with respect to its parent object.
+    /// @param w Number of beams in a row
+    /// @param h Number of rows of beams
+    /// @param max_distance Maximum measurable distance
+    /// @param clip_near Near clipping distance so that the sensor can be placed inside a collision shape
+    ChRaycastSensor(std::shared_ptr<chrono::ChBody> parent,
+                    float updateRate,
+                    chrono::ChFrame<double> offsetPose,
+                    unsigned int w,
+                    unsigned int h,
+                    float max_distance,
+                    float clip_near);
+
+    std::vector<ChVector<float>> m_beam_dirs;  ///< unit beam directions in the sensor frame, row by row
+
+  private:
+    unsigned int m_width;                      ///< number of beams in a row
+    unsigned int m_height;                     ///< number of rows of beams
+    float m_max_distance;                      ///< maximum distance of the sensor
+    float m_clip_near;                         ///< near clipping distance
+    int m_nthreads;                            ///< number of threads for tracing the beams
+    std::vector<ChFrame<double>> m_keyframes;  ///< absolute sensor frames collected over the collection window
+    friend class ChFilterRaycast;
+};
+
+/// Lidar traced on the CPU against the collision system. The beam pattern is that of ChLidarSensor (single ray per
+/// beam). When a collection window is set, the beam columns are traced from the sensor poses at the corresponding
+/// times in the window, as for a spinning lidar. The intensity of a return is the cosine of the incidence angle.
+class CH_SENSOR_API ChRaycastLidarSensor : public ChRaycastSensor {
+  public:
+    /// Class constructor
+    /// @param parent Body to which the sensor is attached.
+    /// @param updateRate Rate at which the sensor should update.
+    /// @param offsetPose Relative position and orientation of the sensor with respect to its parent object.
+    /// @param w Width in number of samples of a lidar scan
+    /// @param h Height in number of sample of a lidar scan (typical the same as laser channels)
+    /// @param hfov Horizontal field of view of the lidar
+    /// @param max_vertical_angle Maximum vertical angle of the lidar
+    /// @param min_vertical_angle Minimum vertical angle of the lidar
+    /// @param max_distance The maximum measurable distance for the lidar
+    /// @param clip_near Near clipping distance so that lidar sensor can be placed inside a collision shape
+    ChRaycastLidarSensor(std::shared_ptr<chrono::ChBody> parent,
+                         float updateRate,
+                         chrono::ChFrame<double> offsetPose,
+                         unsigned int w,
+                         unsigned int h,
+                         float hfov,
+                         float max_vertical_angle,
+                         float min_vertical_angle,
+                         float max_distance,
+                         float clip_near = 1e-3f);
+
+    /// Class destructor
+    ~ChRaycastLidarSensor() {}
+
+    /// Returns the horizontal field of view of the lidar
+    float GetHFOV() const { return m_hFOV; }
+
+    /// Returns the highest vertical angle of any ray in the lidar
+    float GetMaxVertAngle() const { return m_max_vert_angle; }
+
+    /// Returns the lowest vertical angle of any ray in the lidar
+    float GetMinVertAngle() const { return m_min_vert_angle; }
+
+  private:
+    float m_hFOV;            ///< the horizontal field of view of the sensor
+    float m_max_vert_angle;  ///< maximum vertical angle of the rays
+    float m_min_vert_angle;  ///< minimum vertical angle of the rays
+};
+
+/// Depth camera traced on the CPU against the collision system. The beams go through the pixel centers of a pinhole
+/// camera looking along the x axis of the sensor frame (z up), with the pixel layout of ChCameraSensor. The range of a
+/// pixel is the distance along its beam (not the depth along the optical axis), so that the same filters as for a lidar
+/// apply.
+class CH_SENSOR_API ChRaycastDepthCamera : public ChRaycastSensor {
+  public:
+    /// Class constructor
+    /// @param parent Body to which the sensor is attached.
+    /// @param updateRate Rate at which the sensor should update.
+    /// @param offsetPose Relative position and orientation of the sensor with respect to its parent object.
+    /// @param w Width of the image in pixels
+    /// @param h Height of the image in pixels
+    /// @param hfov Horizontal field of view of the camera
+    /// @param max_distance The maximum measurable distance
+    /// @param clip_near Near clipping distance
+    ChRaycastDepthCamera(std::shared_ptr<chrono::ChBody> parent,
+                         float updateRate,
+                         chrono::ChFrame<double> offsetPose,
+                         unsigned int w,
+                         unsigned int h,
+                         float hfov,
+                         float max_distance,
+                         float clip_near = 1e-3f);
+
+    /// Class destructor
+    ~ChRaycastDepthCamera() {}
+
+    /// Returns the horizontal field of view of the camera
+    float GetHFOV() const { return m_hFOV; }
+
+  private:
+    float m_hFOV;  ///< the horizontal field of view of the sensor
+};
+
+/// @} sensor_sensors
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -71,6 +71,8 @@ CH_SENSOR_API void ChSensor::PushFilterFront(std::shared_ptr<ChFilter> filter) {
     }
 }
 
+#ifdef CHRONO_SENSOR_USE_OPTIX
+
 // -----------------------------------------------------------------------------
 // retriever function for image data in greyscale 8-bit format
 // -----------------------------------------------------------------------------
@@ -89,6 +91,8 @@ CH_SENSOR_API UserRGBA8BufferPtr ChSensor::GetMostRecentBuffer() {
     return GetMostRecentBufferHelper<UserRGBA8BufferPtr, ChFilterRGBA8Access, ChFilterRGBA8AccessName>();
 }
 
+#endif
+
 // -----------------------------------------------------------------------------
 // retriever function for lidar data in range/depth,intensity format
 // -----------------------------------------------------------------------------
@@ -107,6 +111,8 @@ CH_SENSOR_API UserXYZIBufferPtr ChSensor::GetMostRecentBuffer() {
     return GetMostRecentBufferHelper<UserXYZIBufferPtr, ChFilterXYZIAccess, ChFilterXYZIAccessName>();
 }
 
+#ifdef CHRONO_SENSOR_USE_OPTIX
+
 // --------------------------------------------------------------------------
 // retriever function for radar data
 // --------------------------------------------------------------------------
@@ -123,6 +129,8 @@ CH_SENSOR_API UserRadarXYZBufferPtr ChSensor::GetMostRecentBuffer() {
                                      ChFilterRadarXYZAccessName>();
 }
 
+#endif
+
 template <>
 CH_SENSOR_API UserAccelBufferPtr ChSensor::GetMostRecentBuffer() {
     // call the templated helper function
@@ -20,6 +20,7 @@
 #define CHSENSOR_H
 
 #include "chrono_sensor/ChApiSensor.h"
+#include "chrono_sensor/ChConfigSensor.h"
 
 #include <list>
 #include <mutex>
@@ -27,7 +28,9 @@
 #include "chrono_sensor/sensors/ChSensorBuffer.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono_sensor/filters/ChFilter.h"
-#include "chrono_sensor/optix/ChOptixUtils.h"
+#ifdef CHRONO_SENSOR_USE_OPTIX
+    #include "chrono_sensor/optix/ChOptixUtils.h"
+#endif
 
 namespace chrono {
 namespace sensor {
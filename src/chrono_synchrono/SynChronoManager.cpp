@@ -54,7 +54,13 @@ SynChronoManager::SynChronoManager(int node_id, int num_nodes, std::shared_ptr<S
       m_time_update(0),
       m_time_msg_gather(0),
       m_time_communication(0),
-      m_time_msg_process(0) {
+      m_time_msg_process(0),
+      m_step_msg_received(0),
+      m_num_msg_received(0),
+      m_bytes_sent(0),
+      m_bytes_received(0),
+      m_num_syncs(0),
+      m_zombie_timeout(10) {
     if (communicator)
         SetCommunicator(communicator);
 
@@ -198,6 +204,15 @@ void SynChronoManager::Synchronize(double time) {
     m_communicator->AddOutgoingMessages(messages);
     m_timer_msg_gather.stop();
 
+    // Pass the areas of interest of the agents on this node to the communicator
+    std::vector<SynAreaOfInterest> areas;
+    for (auto& agent_pair : m_agents) {
+        ChVector<> pos;
+        if (agent_pair.second->GetPosition(pos))
+            areas.push_back({pos, agent_pair.second->GetInterestRadius()});
+    }
+    m_communicator->SetAreasOfInterest(areas);
+
     // Send the messages out to each node and receive any other messages
     m_timer_communication.start();
     m_communicator->Synchronize();
@@ -209,6 +224,7 @@ void SynChronoManager::Synchronize(double time) {
     m_timer_msg_process.start();
     ProcessReceivedMessages();
     DistributeMessages();
+    UpdateZombieStatus();
     m_timer_msg_process.stop();
 
     // Accumulate timers
@@ -217,10 +233,16 @@ void SynChronoManager::Synchronize(double time) {
     m_time_communication += m_timer_communication();
     m_time_msg_process += m_timer_msg_process();
 
+    // Accumulate message statistics
+    m_bytes_sent += m_communicator->GetNumBytesSent();
+    m_bytes_received += m_communicator->GetNumBytesReceived();
+    m_num_msg_received += m_step_msg_received;
+
     // Reset
     m_communicator->Reset();     // Reset the communicator
     m_messages.clear();          // clean the message map
     m_next_sync += m_heartbeat;  // Set next sync to a point in the future
+    m_num_syncs++;
 }
 
 void SynChronoManager::UpdateAgents() {
@@ -242,6 +264,14 @@ void SynChronoManager::PrintStepStatistics(std::ostream& os) const {
     os << "   Msg. generation: " << 1e3 * m_timer_msg_gather() << "  [" << m_time_msg_gather << "]" << std::endl;
     os << "   Communication:   " << 1e3 * m_timer_communication() << "  [" << m_time_communication << "]" << std::endl;
     os << "   Msg. processing: " << 1e3 * m_timer_msg_process() << "  [" << m_time_msg_process << "]" << std::endl;
+    os << " Messages (last step [cumulative]):" << std::endl;
+    os << "   Received:        " << m_step_msg_received << "  [" << m_num_msg_received << "]" << std::endl;
+    os << "   Bytes sent:      " << m_communicator->GetNumBytesSent() << "  [" << m_bytes_sent << "]"
+       << std::endl;
+    os << "   Bytes received:  " << m_communicator->GetNumBytesReceived() << "  [" << m_bytes_received << "]"
+       << std::endl;
+    os << "   Nodes sent to:   " << m_communicator->GetNumPeersSent() << std::endl;
+    os << "   Nodes recv from: " << m_communicator->GetNumPeersReceived() << std::endl;
 }
 
 // --------------------------------------------------------------------------------------------------------------
@@ -269,6 +299,7 @@ SynMessageList SynChronoManager::GatherDescriptionMessages() {
 void SynChronoManager::ProcessReceivedMessages() {
     // get the message buffer from the underlying communicator
     SynMessageList messages = m_communicator->GetMessages();
+    m_step_msg_received = (int)messages.size();
 
     for (auto& message : messages) {
         if (message->GetMessageType() == SynFlatBuffers::Type_Simulation_State) {
@@ -300,10 +331,22 @@ void SynChronoManager::DistributeMessages() {
 
             from_zombie->SynchronizeZombie(message);
             to_agent->ProcessMessage(message);
+            m_zombie_last_sync[message->GetSourceKey()] = m_num_syncs;
         }
     }
 }
 
+void SynChronoManager::UpdateZombieStatus() {
+    for (auto& zombie_pair : m_zombies) {
+        if (!zombie_pair.second)
+            continue;
+        // Zombies which never received a state message are timed from the initialization
+        auto last_sync = m_zombie_last_sync.find(zombie_pair.first);
+        int num_missed = m_num_syncs - (last_sync == m_zombie_last_sync.end() ? 0 : last_sync->second);
+        zombie_pair.second->SetZombieStale(m_zombie_timeout > 0 && num_missed >= m_zombie_timeout);
+    }
+}
+
 void SynChronoManager::CreateAgentsFromDescriptions() {
     for (auto& message_agent_pair : m_messages) {
         // For readibility
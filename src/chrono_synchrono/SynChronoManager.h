@@ -79,10 +79,22 @@ class SYN_API SynChronoManager {
     ///
     void SetHeartbeat(double heartbeat) { m_heartbeat = heartbeat; }
 
+    ///@brief Get the zombies (agents on other nodes) known to this node
+    ///
+    std::map<AgentKey, std::shared_ptr<SynAgent>>& GetZombies() { return m_zombies; }
+
+    ///@brief Set the number of synchronizations after which a zombie that received no message is marked as stale
+    /// (default: 10). With interest management, messages from nodes outside the areas of interest of this node are not
+    /// received, so their zombies remain frozen at their last known state. Such zombies are marked as stale (see
+    /// SynAgent::SetZombieStale and SynAgent::IsZombieStale) until a new message is received. A value of 0 disables
+    /// this.
+    ///
+    void SetZombieTimeout(int num_syncs) { m_zombie_timeout = num_syncs; }
+
     /// @brief Should the simulation still be running?
     bool IsOk() { return m_is_ok; }
 
-    /// @brief Print timing information (over last step and cumulative)
+    /// @brief Print timing and message information (over last step and cumulative)
     void PrintStepStatistics(std::ostream& os) const;
 
   private:
@@ -131,6 +143,11 @@ class SYN_API SynChronoManager {
     ///
     void CreateAgentsFromDescriptions();
 
+    ///@brief Mark the zombies which did not receive a message during the last m_zombie_timeout synchronizations as
+    /// stale, and all other zombies as current (all zombies are current if the timeout is disabled)
+    ///
+    void UpdateZombieStatus();
+
     // --------------------------------------------------------------------------------------------------------------
 
     bool m_is_ok;
@@ -152,11 +169,20 @@ class SYN_API SynChronoManager {
     double m_time_communication;  ///< cummulative time for communication
     double m_time_msg_process;    ///< cumulative time for processing received messages
 
+    int m_step_msg_received;   ///< number of messages received at the last synchronization
+    size_t m_num_msg_received;  ///< cumulative number of messages received
+    size_t m_bytes_sent;        ///< cumulative number of bytes sent
+    size_t m_bytes_received;    ///< cumulative number of bytes received
+
     int m_num_managed_agents = 0;  ///< Number of agents managed by this node
     std::map<AgentKey, std::shared_ptr<SynAgent>> m_agents;          ///< Agents in the SynChrono world on this node
     std::map<AgentKey, std::shared_ptr<SynAgent>> m_zombies;         ///< Agents in the SynChrono world not on this node
     std::map<std::shared_ptr<SynAgent>, SynMessageList> m_messages;  ///< Messages associated with each agent
 
+    int m_num_syncs;                             ///< number of synchronizations since initialization
+    int m_zombie_timeout;                        ///< synchronizations without messages before a zombie is stale
+    std::map<AgentKey, int> m_zombie_last_sync;  ///< last synchronization at which each zombie received a message
+
     std::shared_ptr<SynCommunicator> m_communicator;  ///< Underlying communicator used for inter-node comm
 };
 
@@ -20,12 +20,15 @@
 //
 // =============================================================================
 
+#include <limits>
+
 #include "chrono_synchrono/agent/SynAgent.h"
 
 namespace chrono {
 namespace synchrono {
 
-SynAgent::SynAgent(AgentKey agent_key) : m_agent_key(agent_key) {}
+SynAgent::SynAgent(AgentKey agent_key)
+    : m_agent_key(agent_key), m_interest_radius(std::numeric_limits<double>::infinity()), m_zombie_stale(false) {}
 
 SynAgent::~SynAgent() {}
 
@@ -40,5 +43,19 @@ void SynAgent::SetProcessMessageCallback(std::function<void(std::shared_ptr<SynM
     m_process_message_callback = callback;
 }
 
+void SynAgent::SetZombieStale(bool stale) {
+    if (stale == m_zombie_stale)
+        return;
+    m_zombie_stale = stale;
+    SetZombieVisible(!stale);
+}
+
+void SynAgent::SetVisualShapesVisible(ChPhysicsItem& item, bool visible) {
+    if (!item.GetVisualModel())
+        return;
+    for (auto& shape_instance : item.GetVisualModel()->GetShapes())
+        shape_instance.first->SetVisible(visible);
+}
+
 }  // namespace synchrono
 }  // namespace chrono
\ No newline at end of file
@@ -91,6 +91,39 @@ class SYN_API SynAgent {
 
     void SetProcessMessageCallback(std::function<void(std::shared_ptr<SynMessage>)> callback);
 
+    ///@brief Set the radius of the area of interest of this agent (default: unbounded)
+    /// With a communicator implementing interest management, only messages from nodes with at least one agent
+    /// within this distance of an agent on this node are received.
+    ///
+    ///@param radius the radius of the area of interest, centered at the agent position
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
+    ///@brief Get the radius of the area of interest of this agent
+    ///
+    double GetInterestRadius() const { return m_interest_radius; }
+
+    ///@brief Get the current position of this agent, used for interest management
+    /// Agents without a position (e.g. terrain or environment agents) return false and are not considered in the
+    /// interest management.
+    ///
+    ///@param pos the current position of the agent
+    ///@return whether the agent has a position
+    virtual bool GetPosition(ChVector<>& pos) const { return false; }
+
+    ///@brief Mark the zombie of this agent as stale or current
+    /// The manager marks a zombie as stale when no message was received from it during the last synchronizations (see
+    /// SynChronoManager::SetZombieTimeout), e.g. because its node is no longer within the areas of interest of this
+    /// node, and as current again when it receives a new message. The visual shapes of a stale zombie are flagged as
+    /// invisible; note that visualization systems only honor this flag when creating the visual assets of a body, so
+    /// applications rendering at run time should query IsZombieStale to treat stale zombies.
+    ///
+    ///@param stale whether the zombie is stale
+    void SetZombieStale(bool stale);
+
+    ///@brief Is the zombie of this agent stale (i.e., not updated during the last synchronizations)?
+    ///
+    bool IsZombieStale() const { return m_zombie_stale; }
+
     // -------------------------------------------------------------------------
 
     int GetID() { return m_agent_key.GetAgentID(); }
@@ -99,7 +132,18 @@ class SYN_API SynAgent {
     virtual void SetKey(AgentKey agent_key) { m_agent_key = agent_key; }
 
   protected:
+    ///@brief Show or hide the zombie representation of this agent (default: do nothing)
+    ///
+    virtual void SetZombieVisible(bool visible) {}
+
+    ///@brief Show or hide all visual shapes of the given zombie component
+    /// Visualization systems honor the visibility of a shape when binding the associated physics item.
+    ///
+    static void SetVisualShapesVisible(ChPhysicsItem& item, bool visible);
+
     AgentKey m_agent_key;
+    double m_interest_radius;  ///< radius of the area of interest of this agent
+    bool m_zombie_stale;       ///< whether the zombie of this agent was not updated during the last synchronizations
 
     std::function<void(std::shared_ptr<SynMessage>)> m_process_message_callback;
 };
@@ -61,6 +61,14 @@ void SynCopterAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     }
 }
 
+void SynCopterAgent::SetZombieVisible(bool visible) {
+    if (!m_zombie_body)
+        return;
+    SetVisualShapesVisible(*m_zombie_body, visible);
+    for (auto& prop : m_prop_list)
+        SetVisualShapesVisible(*prop, visible);
+}
+
 void SynCopterAgent::Update() {
     if (!m_copter)
         return;
@@ -88,6 +96,13 @@ void SynCopterAgent::Update() {
 
 // ------------------------------------------------------------------------
 
+bool SynCopterAgent::GetPosition(ChVector<>& pos) const {
+    if (!m_copter)
+        return false;
+    pos = m_copter->GetChassis()->GetPos();
+    return true;
+}
+
 void SynCopterAgent::SetKey(AgentKey agent_key) {
     m_description->SetSourceKey(agent_key);
     m_state->SetSourceKey(agent_key);
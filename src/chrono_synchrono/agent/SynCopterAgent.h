@@ -95,9 +95,17 @@ class SYN_API SynCopterAgent : public SynAgent {
     ///
     virtual void SetKey(AgentKey agent_key) override;
 
+    ///@brief Get the current position of this agent (false if the agent is a zombie)
+    ///
+    virtual bool GetPosition(ChVector<>& pos) const override;
+
     // ------------------------------------------------------------------------
 
   protected:
+    ///@brief Show or hide the zombie bodies of this agent
+    ///
+    virtual void SetZombieVisible(bool visible) override;
+
     ///@brief Helper method used to create a ChVisualShapeTriangleMesh to be used on as a zombie body
     ///
     ///@param filename the file to generate a ChVisualShapeTriangleMesh from
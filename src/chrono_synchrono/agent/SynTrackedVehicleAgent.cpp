@@ -32,7 +32,7 @@ namespace chrono {
 namespace synchrono {
 
 SynTrackedVehicleAgent::SynTrackedVehicleAgent(ChTrackedVehicle* vehicle, const std::string& filename)
-    : SynAgent(), m_vehicle(vehicle) {
+    : SynAgent(), m_vehicle(vehicle), m_compact_state(false) {
     m_state = chrono_types::make_shared<SynTrackedVehicleStateMessage>();
     m_description = chrono_types::make_shared<SynTrackedVehicleDescriptionMessage>();
 
@@ -66,6 +66,24 @@ void SynTrackedVehicleAgent::InitializeZombie(ChSystem* system) {
 
 void SynTrackedVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message)) {
+        if (!state->compact.empty()) {
+            // Reconstruct the poses; until a key frame is received, the zombie keeps its last state
+            std::vector<SynPose> poses;
+            size_t num_poses = 1 + m_track_shoe_list.size() + m_sprocket_list.size() + m_idler_list.size() +
+                               m_road_wheel_list.size();
+            if (!m_codec.Decode(state->compact, poses) || poses.size() != num_poses)
+                return;
+            auto first = poses.begin() + 1;
+            state->chassis = poses[0];
+            state->track_shoes.assign(first, first + m_track_shoe_list.size());
+            first += m_track_shoe_list.size();
+            state->sprockets.assign(first, first + m_sprocket_list.size());
+            first += m_sprocket_list.size();
+            state->idlers.assign(first, first + m_idler_list.size());
+            first += m_idler_list.size();
+            state->road_wheels.assign(first, poses.end());
+        }
+
         m_zombie_body->SetFrame_REF_to_abs(state->chassis.GetFrame());
         for (int i = 0; i < state->track_shoes.size(); i++)
             m_track_shoe_list[i]->SetFrame_REF_to_abs(state->track_shoes[i].GetFrame());
@@ -78,6 +96,16 @@ void SynTrackedVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> messa
     }
 }
 
+void SynTrackedVehicleAgent::SetZombieVisible(bool visible) {
+    if (!m_zombie_body)
+        return;
+    SetVisualShapesVisible(*m_zombie_body, visible);
+    for (auto list : {&m_track_shoe_list, &m_sprocket_list, &m_idler_list, &m_road_wheel_list}) {
+        for (auto& body : *list)
+            SetVisualShapesVisible(*body, visible);
+    }
+}
+
 void SynTrackedVehicleAgent::Update() {
     if (!m_vehicle)
         return;
@@ -114,6 +142,19 @@ void SynTrackedVehicleAgent::Update() {
 
     auto time = m_vehicle->GetSystem()->GetChTime();
     m_state->SetState(time, chassis, track_shoes, sprockets, idlers, road_wheels);
+
+    if (m_compact_state) {
+        std::vector<SynPose> poses;
+        poses.reserve(1 + track_shoes.size() + sprockets.size() + idlers.size() + road_wheels.size());
+        poses.push_back(chassis);
+        poses.insert(poses.end(), track_shoes.begin(), track_shoes.end());
+        poses.insert(poses.end(), sprockets.begin(), sprockets.end());
+        poses.insert(poses.end(), idlers.begin(), idlers.end());
+        poses.insert(poses.end(), road_wheels.begin(), road_wheels.end());
+        m_codec.Encode(poses, m_state->compact);
+    } else {
+        m_state->compact.clear();
+    }
 }
 
 // ------------------------------------------------------------------------
@@ -122,6 +163,13 @@ void SynTrackedVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::stri
     m_description->SetZombieVisualizationFilesFromJSON(filename);
 }
 
+bool SynTrackedVehicleAgent::GetPosition(ChVector<>& pos) const {
+    if (!m_vehicle)
+        return false;
+    pos = m_vehicle->GetPos();
+    return true;
+}
+
 void SynTrackedVehicleAgent::SetKey(AgentKey agent_key) {
     m_description->SetSourceKey(agent_key);
     m_state->SetSourceKey(agent_key);
@@ -25,6 +25,7 @@
 #include "chrono_synchrono/SynApi.h"
 #include "chrono_synchrono/agent/SynAgent.h"
 #include "chrono_synchrono/flatbuffer/message/SynTrackedVehicleMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynPoseCodec.h"
 
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 
@@ -123,9 +124,28 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
     ///
     virtual void SetKey(AgentKey agent_key) override;
 
+    ///@brief Get the current position of this agent (false if the agent is a zombie)
+    ///
+    virtual bool GetPosition(ChVector<>& pos) const override;
+
+    ///@brief Enable compact state messages (default: disabled)
+    /// Poses are quantized, relative to the chassis, and sent as deltas against periodic key frames. Zombies of this
+    /// agent decode the compact state on receipt. See SynPoseCodec.
+    ///
+    ///@param val whether to send compact state messages
+    void SetCompactState(bool val) { m_compact_state = val; }
+
+    ///@brief Get the codec used for compact state messages (e.g., to change its resolution)
+    ///
+    SynPoseCodec& GetPoseCodec() { return m_codec; }
+
     // ------------------------------------------------------------------------
 
   private:
+    ///@brief Show or hide the zombie bodies of this agent
+    ///
+    virtual void SetZombieVisible(bool visible) override;
+
     ///@brief Helper method used to create a ChVisualShapeTriangleMesh to be used on as a zombie body
     ///
     ///@param filename the file to generate a ChVisualShapeTriangleMesh from
@@ -173,6 +193,9 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_sprocket_list;    ///< vector of this agent's zombie sprockets
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_idler_list;       ///< vector of this agent's zombie idlers
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_road_wheel_list;  ///< vector of this agent's zombie road wheels
+
+    bool m_compact_state;  ///< send compact state messages?
+    SynPoseCodec m_codec;  ///< encoder of the agent state, or decoder of the zombie state
 };
 
 /// @} synchrono_agent
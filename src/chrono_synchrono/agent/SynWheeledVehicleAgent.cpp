@@ -33,7 +33,7 @@ namespace chrono {
 namespace synchrono {
 
 SynWheeledVehicleAgent::SynWheeledVehicleAgent(ChWheeledVehicle* vehicle, const std::string& filename)
-    : SynAgent(), m_vehicle(vehicle) {
+    : SynAgent(), m_vehicle(vehicle), m_compact_state(false) {
     m_state = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(), AgentKey());
     m_description = chrono_types::make_shared<SynWheeledVehicleDescriptionMessage>();
 
@@ -80,12 +80,29 @@ void SynWheeledVehicleAgent::InitializeZombie(ChSystem* system) {
 
 void SynWheeledVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
+        if (!state->compact.empty()) {
+            // Reconstruct the poses; until a key frame is received, the zombie keeps its last state
+            std::vector<SynPose> poses;
+            if (!m_codec.Decode(state->compact, poses) || poses.size() != m_wheel_list.size() + 1)
+                return;
+            state->chassis = poses[0];
+            state->wheels.assign(poses.begin() + 1, poses.end());
+        }
+
         m_zombie_body->SetFrame_REF_to_abs(state->chassis.GetFrame());
         for (int i = 0; i < state->wheels.size(); i++)
             m_wheel_list[i]->SetFrame_REF_to_abs(state->wheels[i].GetFrame());
     }
 }
 
+void SynWheeledVehicleAgent::SetZombieVisible(bool visible) {
+    if (!m_zombie_body)
+        return;
+    SetVisualShapesVisible(*m_zombie_body, visible);
+    for (auto& wheel : m_wheel_list)
+        SetVisualShapesVisible(*wheel, visible);
+}
+
 void SynWheeledVehicleAgent::Update() {
     if (!m_vehicle)
         return;
@@ -113,6 +130,16 @@ void SynWheeledVehicleAgent::Update() {
 
     auto time = m_vehicle->GetSystem()->GetChTime();
     m_state->SetState(time, chassis, wheels);
+
+    if (m_compact_state) {
+        std::vector<SynPose> poses;
+        poses.reserve(wheels.size() + 1);
+        poses.push_back(chassis);
+        poses.insert(poses.end(), wheels.begin(), wheels.end());
+        m_codec.Encode(poses, m_state->compact);
+    } else {
+        m_state->compact.clear();
+    }
 }
 
 // ------------------------------------------------------------------------
@@ -121,6 +148,13 @@ void SynWheeledVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::stri
     m_description->SetZombieVisualizationFilesFromJSON(filename);
 }
 
+bool SynWheeledVehicleAgent::GetPosition(ChVector<>& pos) const {
+    if (!m_vehicle)
+        return false;
+    pos = m_vehicle->GetPos();
+    return true;
+}
+
 void SynWheeledVehicleAgent::SetKey(AgentKey agent_key) {
     m_description->SetSourceKey(agent_key);
     m_state->SetSourceKey(agent_key);
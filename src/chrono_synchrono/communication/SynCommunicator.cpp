@@ -27,7 +27,15 @@
 namespace chrono {
 namespace synchrono {
 
-SynCommunicator::SynCommunicator() : m_initialized(false) {}
+SynCommunicator::SynCommunicator()
+    : m_initialized(false),
+      m_quit(false),
+      m_bytes_sent(0),
+      m_bytes_received(0),
+      m_peers_sent(0),
+      m_peers_received(0),
+      m_bytes_processed(0),
+      m_buffers_processed(0) {}
 
 SynCommunicator::~SynCommunicator() {}
 
@@ -50,6 +58,7 @@ void SynCommunicator::AddQuitMessage() {
     // Source and destination are meaningless in this case
     auto message = chrono_types::make_shared<SynSimulationMessage>(AgentKey(), AgentKey(), true);
     m_flatbuffers_manager.AddMessage(message);
+    m_quit = true;
 }
 
 void SynCommunicator::AddIncomingMessages(SynMessageList& messages) {
@@ -59,6 +68,8 @@ void SynCommunicator::AddIncomingMessages(SynMessageList& messages) {
 
 void SynCommunicator::ProcessBuffer(std::vector<uint8_t>& data) {
     m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
+    m_bytes_processed += data.size();
+    m_buffers_processed++;
 }
 
 // -----------------------------------------------------------------------------------------------
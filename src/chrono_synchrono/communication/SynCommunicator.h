@@ -29,6 +29,8 @@
 #include "chrono_synchrono/flatbuffer/SynFlatBuffersManager.h"
 #include "chrono_synchrono/flatbuffer/message/SynMessage.h"
 
+#include "chrono/core/ChVector.h"
+
 #include <vector>
 #include <functional>
 
@@ -38,6 +40,13 @@ namespace synchrono {
 /// @addtogroup synchrono_communication
 /// @{
 
+/// Area of interest of an agent, used for interest management.
+/// The center of the area is the current position of the agent.
+struct SynAreaOfInterest {
+    ChVector<> center;  ///< position of the agent
+    double radius;      ///< only messages from agents within this distance are of interest
+};
+
 /// Base class communicator used to establish and facilitate communication between nodes
 class SYN_API SynCommunicator {
   public:
@@ -99,10 +108,49 @@ class SYN_API SynCommunicator {
     ///@return SynMessageList the received messages
     virtual SynMessageList& GetMessages() { return m_incoming_messages; }
 
+    ///@brief Set the areas of interest of the agents on this node, for the next synchronization.
+    /// A communicator implementing interest management only delivers to this node messages from nodes with at least
+    /// one agent within one of these areas. A node without areas of interest receives all messages, and its own
+    /// messages are delivered to all other nodes. Communicators without interest management (e.g., SynDDSCommunicator)
+    /// ignore these areas.
+    ///
+    ///@param areas the areas of interest of the agents on this node
+    void SetAreasOfInterest(const std::vector<SynAreaOfInterest>& areas) { m_areas = areas; }
+
+    ///@brief Get the number of bytes sent during the last synchronization
+    /// With the MPI communicator, bytes and nodes are counted per destination rank. With the DDS communicator, which
+    /// does not implement interest management, data is counted once per published topic (independent of the number of
+    /// subscribers) and received data is counted per buffer processed since the previous synchronization.
+    ///
+    size_t GetNumBytesSent() const { return m_bytes_sent; }
+
+    ///@brief Get the number of bytes received during the last synchronization
+    ///
+    size_t GetNumBytesReceived() const { return m_bytes_received; }
+
+    ///@brief Get the number of nodes messages were sent to during the last synchronization
+    ///
+    int GetNumPeersSent() const { return m_peers_sent; }
+
+    ///@brief Get the number of nodes messages were received from during the last synchronization
+    ///
+    int GetNumPeersReceived() const { return m_peers_received; }
+
     // -----------------------------------------------------------------------------------------------
 
   protected:
     bool m_initialized;  ///< whether the communicator has been initialized
+    bool m_quit;         ///< whether a quit message was added for the next synchronization
+
+    std::vector<SynAreaOfInterest> m_areas;  ///< areas of interest of the agents on this node
+
+    size_t m_bytes_sent;      ///< number of bytes sent during the last synchronization
+    size_t m_bytes_received;  ///< number of bytes received during the last synchronization
+    int m_peers_sent;         ///< number of nodes messages were sent to during the last synchronization
+    int m_peers_received;     ///< number of nodes messages were received from during the last synchronization
+
+    size_t m_bytes_processed;  ///< number of bytes passed to ProcessBuffer since the last synchronization
+    int m_buffers_processed;   ///< number of buffers passed to ProcessBuffer since the last synchronization
 
     SynMessageList m_incoming_messages;           ///< Incoming messages
     SynFlatBuffersManager m_flatbuffers_manager;  ///< flatbuffer manager for this rank
@@ -131,6 +131,12 @@ void SynDDSCommunicator::Synchronize() {
 
     // Blocking wait for a message to be received
     Listen();
+
+    // Data received since the previous synchronization (including asynchronous subscribers)
+    m_bytes_received = m_bytes_processed;
+    m_peers_received = m_buffers_processed;
+    m_bytes_processed = 0;
+    m_buffers_processed = 0;
 }
 
 void SynDDSCommunicator::Barrier() {
@@ -320,6 +326,9 @@ void SynDDSCommunicator::Publish() {
     for (auto publisher : m_publishers)
         publisher->Publish(&msg);
 
+    m_bytes_sent = msg.data().size() * m_publishers.size();
+    m_peers_sent = (int)m_publishers.size();
+
     m_flatbuffers_manager.Reset();
 }
 
@@ -26,7 +26,7 @@
 namespace chrono {
 namespace synchrono {
 
-SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
+SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) : m_interest_management(false) {
     // mpi initialization
     MPI_Init(&argc, &argv);
     // set rank
@@ -38,6 +38,10 @@ SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
 
     m_msg_lengths = new int[m_num_ranks];
     m_msg_displs = new int[m_num_ranks];
+
+    m_num_areas.resize(m_num_ranks);
+    m_area_displs.resize(m_num_ranks);
+    m_quit_flags.resize(m_num_ranks);
 }
 
 SynMPICommunicator::~SynMPICommunicator() {
@@ -52,6 +56,16 @@ void SynMPICommunicator::Synchronize() {
 
     int msg_length = m_flatbuffers_manager.GetSize();
 
+    if (m_interest_management)
+        SynchronizeInterest(msg_length);
+    else
+        SynchronizeAll(msg_length);
+
+    m_flatbuffers_manager.Reset();
+    m_quit = false;
+}
+
+void SynMPICommunicator::SynchronizeAll(int msg_length) {
     // Get the length of message from each agent
     MPI_Allgather(&msg_length, 1, MPI_INT,    // Sending pointer, length, type
                   m_msg_lengths, 1, MPI_INT,  // Receiving pointer, length, type
@@ -70,19 +84,117 @@ void SynMPICommunicator::Synchronize() {
     // if (m_rank == 0)
     //     std::cout << m_rank << " message length: " << m_total_length << std::endl;
 
-    m_all_data.reserve(m_total_length);
+    m_all_data.resize(m_total_length);
 
     MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
                    m_all_data.data(), m_msg_lengths, m_msg_displs,
                    MPI_BYTE,  // Receiving pointer, lengths, displacements, type
                    MPI_COMM_WORLD);
 
-    m_flatbuffers_manager.Reset();
+    m_bytes_sent = (size_t)msg_length * (m_num_ranks - 1);
+    m_bytes_received = (size_t)(m_total_length - msg_length);
+    m_peers_sent = m_num_ranks - 1;
+    m_peers_received = m_num_ranks - 1;
+}
+
+void SynMPICommunicator::SynchronizeInterest(int msg_length) {
+    // Exchange the number of areas of interest of each rank and whether it is sending a quit message
+    int info[2] = {(int)m_areas.size(), m_quit ? 1 : 0};
+    std::vector<int> all_info(2 * m_num_ranks);
+    MPI_Allgather(info, 2, MPI_INT, all_info.data(), 2, MPI_INT, MPI_COMM_WORLD);
+
+    std::vector<int> counts(m_num_ranks);
+    std::vector<int> displs(m_num_ranks);
+    int num_areas = 0;
+    for (int i = 0; i < m_num_ranks; i++) {
+        m_num_areas[i] = all_info[2 * i + 0];
+        m_quit_flags[i] = all_info[2 * i + 1];
+        m_area_displs[i] = num_areas;
+        counts[i] = 4 * m_num_areas[i];
+        displs[i] = 4 * m_area_displs[i];
+        num_areas += m_num_areas[i];
+    }
+
+    // Exchange the areas of interest of all ranks
+    std::vector<double> areas;
+    areas.reserve(4 * m_areas.size());
+    for (const auto& area : m_areas) {
+        areas.push_back(area.center.x());
+        areas.push_back(area.center.y());
+        areas.push_back(area.center.z());
+        areas.push_back(area.radius);
+    }
+    m_area_data.resize(4 * num_areas);
+    MPI_Allgatherv(areas.data(), (int)areas.size(), MPI_DOUBLE,                     // Sending pointer, length, type
+                   m_area_data.data(), counts.data(), displs.data(), MPI_DOUBLE,  // Receiving pointer, lengths, displs
+                   MPI_COMM_WORLD);
+
+    // Send the messages of this rank to all interested ranks.
+    // Every rank evaluates the same criteria, so it knows exactly which ranks it receives messages from.
+    std::vector<MPI_Request> requests;
+    m_bytes_sent = 0;
+    m_peers_sent = 0;
+    for (int i = 0; i < m_num_ranks; i++) {
+        if (i == m_rank || !IsInterested(i, m_rank))
+            continue;
+        requests.emplace_back();
+        MPI_Isend(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE, i, 0, MPI_COMM_WORLD,
+                  &requests.back());
+        m_bytes_sent += msg_length;
+        m_peers_sent++;
+    }
+
+    // Receive the messages from all ranks this rank is interested in
+    m_total_length = 0;
+    m_peers_received = 0;
+    for (int i = 0; i < m_num_ranks; i++) {
+        m_msg_displs[i] = m_total_length;
+        m_msg_lengths[i] = 0;
+        if (i == m_rank || !IsInterested(m_rank, i))
+            continue;
+
+        MPI_Status status;
+        MPI_Probe(i, 0, MPI_COMM_WORLD, &status);
+        MPI_Get_count(&status, MPI_BYTE, &m_msg_lengths[i]);
+
+        m_all_data.resize(m_total_length + m_msg_lengths[i]);
+        MPI_Recv(m_all_data.data() + m_total_length, m_msg_lengths[i], MPI_BYTE, i, 0, MPI_COMM_WORLD,
+                 MPI_STATUS_IGNORE);
+        m_total_length += m_msg_lengths[i];
+        m_peers_received++;
+    }
+    m_bytes_received = m_total_length;
+
+    MPI_Waitall((int)requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+bool SynMPICommunicator::IsInterested(int receiver, int sender) const {
+    // Ranks without areas of interest (e.g., with no agents with a position) receive and send all messages.
+    // Quit messages are sent to all ranks.
+    if (m_num_areas[receiver] == 0 || m_num_areas[sender] == 0 || m_quit_flags[sender])
+        return true;
+
+    // Check if any agent on the sender rank is within an area of interest of the receiver rank
+    const double* r_areas = m_area_data.data() + 4 * m_area_displs[receiver];
+    const double* s_areas = m_area_data.data() + 4 * m_area_displs[sender];
+    for (int i = 0; i < m_num_areas[receiver]; i++) {
+        const double* r = r_areas + 4 * i;
+        for (int j = 0; j < m_num_areas[sender]; j++) {
+            const double* s = s_areas + 4 * j;
+            double dx = s[0] - r[0];
+            double dy = s[1] - r[1];
+            double dz = s[2] - r[2];
+            if (dx * dx + dy * dy + dz * dz <= r[3] * r[3])
+                return true;
+        }
+    }
+
+    return false;
 }
 
 SynMessageList& SynMPICommunicator::GetMessages() {
     for (int i = 0; i < m_num_ranks; i++) {
-        if (i != m_rank) {
+        if (i != m_rank && m_msg_lengths[i] > 0) {
             std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
                                                              m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
             m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
@@ -93,4 +205,4 @@ SynMessageList& SynMPICommunicator::GetMessages() {
 }
 
 }  // namespace synchrono
-}  // namespace chrono
\ No newline at end of file
+}  // namespace chrono
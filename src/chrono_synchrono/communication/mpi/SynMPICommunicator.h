@@ -83,9 +83,25 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual int GetNumRanks() const { return m_num_ranks; }
 
+    ///@brief Enable or disable interest management (default: disabled)
+    /// If enabled, the areas of interest of all ranks (see SetAreasOfInterest) are exchanged at each synchronization
+    /// and the messages of this rank are sent, point-to-point, only to the ranks interested in them. Otherwise, the
+    /// messages of all ranks are gathered on all ranks. This setting must be the same on all ranks.
+    ///
+    void EnableInterestManagement(bool val) { m_interest_management = val; }
+
     // -----------------------------------------------------------------------------------------------
 
   private:
+    /// Exchange the messages of all ranks with all ranks
+    void SynchronizeAll(int msg_length);
+
+    /// Exchange the messages of this rank only with the ranks interested in them
+    void SynchronizeInterest(int msg_length);
+
+    /// Check whether the receiver rank is interested in the messages of the sender rank
+    bool IsInterested(int receiver, int sender) const;
+
     int m_rank;
     int m_num_ranks;
 
@@ -96,6 +112,12 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
 
     std::vector<uint8_t> m_rank_data;
     std::vector<uint8_t> m_all_data;
+
+    bool m_interest_management;       ///< exchange messages only with interested ranks?
+    std::vector<int> m_num_areas;     ///< number of areas of interest of each rank
+    std::vector<int> m_area_displs;   ///< offset of the areas of each rank in m_area_data
+    std::vector<int> m_quit_flags;    ///< ranks sending a quit message
+    std::vector<double> m_area_data;  ///< areas of interest of all ranks (center and radius)
 };
 
 /// @} synchrono_communication
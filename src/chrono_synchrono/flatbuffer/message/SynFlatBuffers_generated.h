@@ -1070,7 +1070,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_TIME = 4,
     VT_CHASSIS = 6,
-    VT_WHEELS = 8
+    VT_WHEELS = 8,
+    VT_COMPACT = 10
   };
   double time() const {
     return GetField<double>(VT_TIME, 0.0);
@@ -1081,6 +1082,9 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *wheels() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *>(VT_WHEELS);
   }
+  const flatbuffers::Vector<uint8_t> *compact() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_COMPACT);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_TIME) &&
@@ -1089,6 +1093,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_WHEELS) &&
            verifier.VerifyVector(wheels()) &&
            verifier.VerifyVectorOfTables(wheels()) &&
+           VerifyOffset(verifier, VT_COMPACT) &&
+           verifier.VerifyVector(compact()) &&
            verifier.EndTable();
   }
 };
@@ -1106,6 +1112,9 @@ struct StateBuilder {
   void add_wheels(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels) {
     fbb_.AddOffset(State::VT_WHEELS, wheels);
   }
+  void add_compact(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> compact) {
+    fbb_.AddOffset(State::VT_COMPACT, compact);
+  }
   explicit StateBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1121,9 +1130,11 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::FlatBufferBuilder &_fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> compact = 0) {
   StateBuilder builder_(_fbb);
   builder_.add_time(time);
+  builder_.add_compact(compact);
   builder_.add_wheels(wheels);
   builder_.add_chassis(chassis);
   return builder_.Finish();
@@ -1133,13 +1144,16 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *wheels = nullptr,
+    const std::vector<uint8_t> *compact = nullptr) {
   auto wheels__ = wheels ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*wheels) : 0;
+  auto compact__ = compact ? _fbb.CreateVector<uint8_t>(*compact) : 0;
   return SynFlatBuffers::Agent::WheeledVehicle::CreateState(
       _fbb,
       time,
       chassis,
-      wheels__);
+      wheels__,
+      compact__);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -1245,7 +1259,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_TRACK_SHOES = 8,
     VT_SPROCKETS = 10,
     VT_IDLERS = 12,
-    VT_ROAD_WHEELS = 14
+    VT_ROAD_WHEELS = 14,
+    VT_COMPACT = 16
   };
   double time() const {
     return GetField<double>(VT_TIME, 0.0);
@@ -1265,6 +1280,9 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *road_wheels() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *>(VT_ROAD_WHEELS);
   }
+  const flatbuffers::Vector<uint8_t> *compact() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_COMPACT);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_TIME) &&
@@ -1282,6 +1300,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_ROAD_WHEELS) &&
            verifier.VerifyVector(road_wheels()) &&
            verifier.VerifyVectorOfTables(road_wheels()) &&
+           VerifyOffset(verifier, VT_COMPACT) &&
+           verifier.VerifyVector(compact()) &&
            verifier.EndTable();
   }
 };
@@ -1308,6 +1328,9 @@ struct StateBuilder {
   void add_road_wheels(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels) {
     fbb_.AddOffset(State::VT_ROAD_WHEELS, road_wheels);
   }
+  void add_compact(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> compact) {
+    fbb_.AddOffset(State::VT_COMPACT, compact);
+  }
   explicit StateBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1326,9 +1349,11 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> track_shoes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> sprockets = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> idlers = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> compact = 0) {
   StateBuilder builder_(_fbb);
   builder_.add_time(time);
+  builder_.add_compact(compact);
   builder_.add_road_wheels(road_wheels);
   builder_.add_idlers(idlers);
   builder_.add_sprockets(sprockets);
@@ -1344,11 +1369,13 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *track_shoes = nullptr,
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *sprockets = nullptr,
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *idlers = nullptr,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *road_wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> *road_wheels = nullptr,
+    const std::vector<uint8_t> *compact = nullptr) {
   auto track_shoes__ = track_shoes ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*track_shoes) : 0;
   auto sprockets__ = sprockets ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*sprockets) : 0;
   auto idlers__ = idlers ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*idlers) : 0;
   auto road_wheels__ = road_wheels ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*road_wheels) : 0;
+  auto compact__ = compact ? _fbb.CreateVector<uint8_t>(*compact) : 0;
   return SynFlatBuffers::Agent::TrackedVehicle::CreateState(
       _fbb,
       time,
@@ -1356,7 +1383,8 @@ inline flatbuffers::Offset<State> CreateStateDirect(
       track_shoes__,
       sprockets__,
       idlers__,
-      road_wheels__);
+      road_wheels__,
+      compact__);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
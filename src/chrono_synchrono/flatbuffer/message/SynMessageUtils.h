@@ -77,6 +77,7 @@ class SYN_API SynPose {
     flatbuffers::Offset<SynFlatBuffers::Pose> ToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const;
 
     ChFrameMoving<>& GetFrame() { return m_frame; }
+    const ChFrameMoving<>& GetFrame() const { return m_frame; }
 
   private:
     ChFrameMoving<> m_frame;
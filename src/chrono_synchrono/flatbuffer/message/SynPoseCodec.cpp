@@ -0,0 +1,318 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Compact encoding of the poses of an agent made of a chassis and attached
+// bodies (wheels, track shoes, ...), used in the vehicle state messages.
+//
+// Layout of the encoded data:
+//    flags (1 byte), key frame id, number of poses
+//    position and velocity resolutions (2 doubles)
+//    quantized chassis values
+//    quantized attached body values (key frame) or differences from the key frame values
+//
+// The quantized values are, in order:
+//    chassis position (3), rotation (3), linear velocity (3), angular velocity (3)
+//    for each attached body: relative position (3), relative rotation (3)
+//
+// The chassis values are never sent as deltas, so that the chassis pose can be decoded from any message.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "chrono_synchrono/flatbuffer/message/SynPoseCodec.h"
+
+namespace chrono {
+namespace synchrono {
+
+namespace {
+
+const uint8_t FLAG_KEY_FRAME = 0x01;
+
+const int CHASSIS_VALUES = 12;
+const int BODY_VALUES = 6;
+
+// Scale of the quantized quaternion components (the three smallest components are in [-1/sqrt(2), 1/sqrt(2)])
+const double ROT_SCALE = 32767 * CH_C_SQRT_2;
+
+// -----------------------------------------------------------------------------
+
+void PutVarint(std::vector<uint8_t>& data, uint64_t v) {
+    while (v >= 0x80) {
+        data.push_back((uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    data.push_back((uint8_t)v);
+}
+
+bool GetVarint(const std::vector<uint8_t>& data, size_t& pos, uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos >= data.size())
+            return false;
+        uint8_t byte = data[pos++];
+        v |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+// Zigzag encoding maps small signed integers to small unsigned integers
+uint64_t ZigZag(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+int64_t UnZigZag(uint64_t v) {
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+void PutDouble(std::vector<uint8_t>& data, double v) {
+    uint8_t bytes[sizeof(double)];
+    std::memcpy(bytes, &v, sizeof(double));
+    data.insert(data.end(), bytes, bytes + sizeof(double));
+}
+
+bool GetDouble(const std::vector<uint8_t>& data, size_t& pos, double& v) {
+    if (pos + sizeof(double) > data.size())
+        return false;
+    std::memcpy(&v, data.data() + pos, sizeof(double));
+    pos += sizeof(double);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void QuantizeVector(const ChVector<>& v, double resolution, int64_t* values) {
+    values[0] = std::llround(v.x() / resolution);
+    values[1] = std::llround(v.y() / resolution);
+    values[2] = std::llround(v.z() / resolution);
+}
+
+ChVector<> DequantizeVector(const int64_t* values, double resolution) {
+    return ChVector<>(values[0] * resolution, values[1] * resolution, values[2] * resolution);
+}
+
+// Smallest-three compression: the largest component (made positive) is dropped and recovered from the unit norm.
+// Its index is stored in the 2 low bits of the first value.
+void QuantizeRotation(const ChQuaternion<>& q, int64_t* values) {
+    double c[4] = {q.e0(), q.e1(), q.e2(), q.e3()};
+    int largest = 0;
+    for (int i = 1; i < 4; i++) {
+        if (std::abs(c[i]) > std::abs(c[largest]))
+            largest = i;
+    }
+    double sign = c[largest] < 0 ? -1 : 1;
+    for (int i = 0, k = 0; i < 4; i++) {
+        if (i != largest)
+            values[k++] = std::llround(sign * c[i] * ROT_SCALE);
+    }
+    values[0] = values[0] * 4 + largest;
+}
+
+ChQuaternion<> DequantizeRotation(const int64_t* values) {
+    int largest = (int)(((values[0] % 4) + 4) % 4);
+    double s[3] = {((values[0] - largest) / 4) / ROT_SCALE, values[1] / ROT_SCALE, values[2] / ROT_SCALE};
+    double c[4];
+    double sum = s[0] * s[0] + s[1] * s[1] + s[2] * s[2];
+    c[largest] = std::sqrt(std::max(0.0, 1 - sum));
+    for (int i = 0, k = 0; i < 4; i++) {
+        if (i != largest)
+            c[i] = s[k++];
+    }
+    ChQuaternion<> q(c[0], c[1], c[2], c[3]);
+    q.Normalize();
+    return q;
+}
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+SynPoseCodec::SynPoseCodec()
+    : m_pos_res(1e-4), m_vel_res(1e-3), m_key_interval(20), m_num_encoded(0), m_has_key(false), m_key_id(0) {}
+
+void SynPoseCodec::SetPositionResolution(double resolution) {
+    m_pos_res = resolution;
+    m_has_key = false;
+}
+
+void SynPoseCodec::SetVelocityResolution(double resolution) {
+    m_vel_res = resolution;
+    m_has_key = false;
+}
+
+void SynPoseCodec::SetKeyFrameInterval(int interval) {
+    m_key_interval = std::max(interval, 1);
+}
+
+void SynPoseCodec::Quantize(const std::vector<SynPose>& poses, std::vector<int64_t>& values) const {
+    values.resize(CHASSIS_VALUES + BODY_VALUES * (poses.size() - 1));
+
+    // Chassis (absolute)
+    const auto& chassis = poses[0].GetFrame();
+    QuantizeVector(chassis.GetPos(), m_pos_res, &values[0]);
+    QuantizeRotation(chassis.GetRot(), &values[3]);
+    QuantizeVector(chassis.GetPos_dt(), m_vel_res, &values[6]);
+    QuantizeVector(chassis.GetWvel_par(), m_vel_res, &values[9]);
+
+    // Attached bodies, relative to the quantized chassis frame (as seen by the decoder)
+    ChVector<> chassis_pos = DequantizeVector(&values[0], m_pos_res);
+    ChQuaternion<> chassis_rot = DequantizeRotation(&values[3]);
+    ChQuaternion<> chassis_rot_inv = chassis_rot.GetConjugate();
+    for (size_t i = 1; i < poses.size(); i++) {
+        const auto& frame = poses[i].GetFrame();
+        int64_t* v = &values[CHASSIS_VALUES + BODY_VALUES * (i - 1)];
+        QuantizeVector(chassis_rot.RotateBack(frame.GetPos() - chassis_pos), m_pos_res, v);
+        QuantizeRotation(chassis_rot_inv * frame.GetRot(), v + 3);
+    }
+}
+
+void SynPoseCodec::Dequantize(const std::vector<int64_t>& values, std::vector<SynPose>& poses) const {
+    size_t num_poses = 1 + (values.size() - CHASSIS_VALUES) / BODY_VALUES;
+    poses.resize(num_poses);
+
+    ChVector<> chassis_pos = DequantizeVector(&values[0], m_pos_res);
+    ChQuaternion<> chassis_rot = DequantizeRotation(&values[3]);
+    poses[0] = SynPose(chassis_pos, chassis_rot);
+    poses[0].GetFrame().SetPos_dt(DequantizeVector(&values[6], m_vel_res));
+    poses[0].GetFrame().SetWvel_par(DequantizeVector(&values[9], m_vel_res));
+
+    for (size_t i = 1; i < num_poses; i++) {
+        const int64_t* v = &values[CHASSIS_VALUES + BODY_VALUES * (i - 1)];
+        poses[i] = SynPose(chassis_pos + chassis_rot.Rotate(DequantizeVector(v, m_pos_res)),
+                           chassis_rot * DequantizeRotation(v + 3));
+    }
+}
+
+void SynPoseCodec::Encode(const std::vector<SynPose>& poses, std::vector<uint8_t>& data) {
+    data.clear();
+    if (poses.empty())
+        return;
+
+    std::vector<int64_t> values;
+    Quantize(poses, values);
+
+    bool key_frame = !m_has_key || m_num_encoded >= m_key_interval || values.size() != m_key.size();
+    if (key_frame) {
+        m_key = values;
+        m_key_id++;
+        m_has_key = true;
+        m_num_encoded = 0;
+    }
+    m_num_encoded++;
+
+    data.reserve(32 + 3 * values.size());
+    data.push_back(key_frame ? FLAG_KEY_FRAME : 0);
+    PutVarint(data, m_key_id);
+    PutVarint(data, poses.size());
+    PutDouble(data, m_pos_res);
+    PutDouble(data, m_vel_res);
+    for (int i = 0; i < CHASSIS_VALUES; i++)
+        PutVarint(data, ZigZag(values[i]));
+    if (key_frame) {
+        for (size_t i = CHASSIS_VALUES; i < values.size(); i++)
+            PutVarint(data, ZigZag(values[i]));
+    } else {
+        for (size_t i = CHASSIS_VALUES; i < values.size(); i++)
+            PutVarint(data, ZigZag(values[i] - m_key[i]));
+    }
+}
+
+bool SynPoseCodec::DecodeHeader(const std::vector<uint8_t>& data,
+                                size_t& pos,
+                                bool& key_frame,
+                                uint32_t& key_id,
+                                size_t& num_poses,
+                                double& pos_res,
+                                double& vel_res,
+                                std::vector<int64_t>& chassis_values) {
+    uint64_t id;
+    uint64_t num;
+    pos = 0;
+    if (data.empty())
+        return false;
+    key_frame = (data[pos++] & FLAG_KEY_FRAME) != 0;
+    if (!GetVarint(data, pos, id) || !GetVarint(data, pos, num) || num == 0 || num > data.size())
+        return false;
+    if (!GetDouble(data, pos, pos_res) || !GetDouble(data, pos, vel_res))
+        return false;
+    key_id = (uint32_t)id;
+    num_poses = (size_t)num;
+
+    chassis_values.resize(CHASSIS_VALUES);
+    for (auto& v : chassis_values) {
+        uint64_t u;
+        if (!GetVarint(data, pos, u))
+            return false;
+        v = UnZigZag(u);
+    }
+    return true;
+}
+
+bool SynPoseCodec::Decode(const std::vector<uint8_t>& data, std::vector<SynPose>& poses) {
+    size_t pos;
+    bool key_frame;
+    uint32_t key_id;
+    size_t num_poses;
+    double pos_res;
+    double vel_res;
+    std::vector<int64_t> values;
+    if (!DecodeHeader(data, pos, key_frame, key_id, num_poses, pos_res, vel_res, values))
+        return false;
+
+    size_t num_values = CHASSIS_VALUES + BODY_VALUES * (num_poses - 1);
+
+    // Deltas can only be applied to the key frame they were computed against
+    if (!key_frame && (!m_has_key || m_key_id != key_id || m_key.size() != num_values))
+        return false;
+
+    values.resize(num_values);
+    for (size_t i = CHASSIS_VALUES; i < num_values; i++) {
+        uint64_t u;
+        if (!GetVarint(data, pos, u))
+            return false;
+        values[i] = key_frame ? UnZigZag(u) : m_key[i] + UnZigZag(u);
+    }
+
+    m_pos_res = pos_res;
+    m_vel_res = vel_res;
+    if (key_frame) {
+        m_key = values;
+        m_key_id = key_id;
+        m_has_key = true;
+    }
+
+    Dequantize(values, poses);
+    return true;
+}
+
+bool SynPoseCodec::DecodeChassis(const std::vector<uint8_t>& data, SynPose& chassis) {
+    size_t pos;
+    bool key_frame;
+    uint32_t key_id;
+    size_t num_poses;
+    SynPoseCodec codec;
+    std::vector<int64_t> values;
+    if (!DecodeHeader(data, pos, key_frame, key_id, num_poses, codec.m_pos_res, codec.m_vel_res, values))
+        return false;
+
+    std::vector<SynPose> poses;
+    codec.Dequantize(values, poses);
+    chassis = poses[0];
+    return true;
+}
+
+}  // namespace synchrono
+}  // namespace chrono
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Compact encoding of the poses of an agent made of a chassis and attached
+// bodies (wheels, track shoes, ...), used in the vehicle state messages:
+//    - positions are quantized, relative to the chassis for attached bodies
+//    - rotations use the smallest-three quaternion compression
+//    - states are sent as key frames or as deltas against the last key frame
+//    - all integers are zigzag and variable-length encoded
+//
+// =============================================================================
+
+#ifndef SYN_POSE_CODEC_H
+#define SYN_POSE_CODEC_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono_synchrono/SynApi.h"
+#include "chrono_synchrono/flatbuffer/message/SynMessageUtils.h"
+
+namespace chrono {
+namespace synchrono {
+
+/// @addtogroup synchrono_flatbuffer
+/// @{
+
+/// Encoder/decoder for the compact representation of the poses of an agent.
+/// The first pose is that of the chassis. All other poses are encoded relative to the (quantized) chassis frame, so
+/// that they need few bits regardless of where the agent is. Only the chassis linear and angular velocities are
+/// encoded; accelerations and the velocities of attached bodies are not needed for zombie visualization.
+///
+/// Every few states, a key frame is encoded. The other states are encoded as deltas against the last key frame, so
+/// that a lost delta does not affect later ones. The chassis pose is always sent in full (quantized), so that it can be
+/// decoded from any single message. A decoder that did not receive the current key frame (e.g., a node that just
+/// started receiving messages from this agent) ignores the deltas until the next key frame.
+///
+/// An agent uses one codec either to encode its own state or, for a zombie, to decode the received state.
+class SYN_API SynPoseCodec {
+  public:
+    SynPoseCodec();
+
+    ///@brief Set the resolution of quantized positions (default: 1e-4 m).
+    /// Changing the resolution forces a new key frame.
+    ///
+    ///@param resolution position resolution
+    void SetPositionResolution(double resolution);
+
+    ///@brief Set the resolution of quantized chassis velocities (default: 1e-3 m/s and rad/s).
+    /// Changing the resolution forces a new key frame.
+    ///
+    ///@param resolution velocity resolution
+    void SetVelocityResolution(double resolution);
+
+    ///@brief Set the number of encoded states between two key frames (default: 20)
+    ///
+    ///@param interval key frame interval
+    void SetKeyFrameInterval(int interval);
+
+    ///@brief Encode the given poses
+    ///
+    ///@param poses chassis pose, followed by the poses of all attached bodies
+    ///@param data encoded poses
+    void Encode(const std::vector<SynPose>& poses, std::vector<uint8_t>& data);
+
+    ///@brief Decode poses encoded with SynPoseCodec::Encode
+    ///
+    ///@param data encoded poses
+    ///@param poses decoded poses (chassis pose first)
+    ///@return false if the data is a delta against a key frame that was not received (or the data is invalid)
+    bool Decode(const std::vector<uint8_t>& data, std::vector<SynPose>& poses);
+
+    ///@brief Decode only the chassis pose from data encoded with SynPoseCodec::Encode.
+    /// The chassis pose is never delta-encoded, so this does not require any previously received key frame.
+    ///
+    ///@param data encoded poses
+    ///@param chassis decoded chassis pose
+    ///@return false if the data is invalid
+    static bool DecodeChassis(const std::vector<uint8_t>& data, SynPose& chassis);
+
+  private:
+    void Quantize(const std::vector<SynPose>& poses, std::vector<int64_t>& values) const;
+    void Dequantize(const std::vector<int64_t>& values, std::vector<SynPose>& poses) const;
+    static bool DecodeHeader(const std::vector<uint8_t>& data,
+                             size_t& pos,
+                             bool& key_frame,
+                             uint32_t& key_id,
+                             size_t& num_poses,
+                             double& pos_res,
+                             double& vel_res,
+                             std::vector<int64_t>& chassis_values);
+
+    double m_pos_res;            ///< position resolution
+    double m_vel_res;            ///< velocity resolution
+    int m_key_interval;          ///< number of states between key frames
+    int m_num_encoded;           ///< number of states encoded since the last key frame
+    bool m_has_key;              ///< is there a valid key frame?
+    uint32_t m_key_id;           ///< identifier of the last key frame
+    std::vector<int64_t> m_key;  ///< quantized values of the last key frame
+};
+
+/// @} synchrono_flatbuffer
+
+}  // namespace synchrono
+}  // namespace chrono
+
+#endif
@@ -20,6 +20,8 @@
 
 #include "chrono_synchrono/flatbuffer/message/SynTrackedVehicleMessage.h"
 
+#include "chrono_synchrono/flatbuffer/message/SynPoseCodec.h"
+
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
 namespace chrono {
@@ -56,27 +58,49 @@ void SynTrackedVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     auto agent_state = message->message_as_Agent_State();
     auto state = agent_state->message_as_TrackedVehicle_State();
 
-    this->chassis = SynPose(state->chassis());
+    this->time = state->time();
 
     this->track_shoes.clear();
+    this->sprockets.clear();
+    this->idlers.clear();
+    this->road_wheels.clear();
+
+    // Compact state: the chassis pose is decoded here, the attached bodies are decoded by the receiving zombie
+    this->compact.clear();
+    if (state->compact() && state->compact()->size()) {
+        this->compact.assign(state->compact()->begin(), state->compact()->end());
+        if (!SynPoseCodec::DecodeChassis(this->compact, this->chassis))
+            this->chassis = SynPose();
+        return;
+    }
+
+    this->chassis = SynPose(state->chassis());
+
     for (auto track_shoe : (*state->track_shoes()))
         this->track_shoes.emplace_back(track_shoe);
 
-    this->sprockets.clear();
     for (auto sprocket : (*state->sprockets()))
         this->sprockets.emplace_back(sprocket);
 
-    this->idlers.clear();
     for (auto idler : (*state->idlers()))
         this->idlers.emplace_back(idler);
 
-    this->road_wheels.clear();
     for (auto road_wheel : (*state->road_wheels()))
         this->road_wheels.emplace_back(road_wheel);
 }
 
 /// Generate FlatBuffers message from this message's state
 FlatBufferMessage SynTrackedVehicleStateMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
+    auto vehicle_type = Agent::Type_TrackedVehicle_State;
+
+    if (!this->compact.empty()) {
+        auto vehicle_state = TrackedVehicle::CreateStateDirect(builder, this->time, 0, nullptr, nullptr, nullptr,
+                                                               nullptr, &this->compact);
+        auto flatbuffer_state = Agent::CreateState(builder, vehicle_type, vehicle_state.Union());
+        return SynFlatBuffers::CreateMessage(builder, SynFlatBuffers::Type_Agent_State, flatbuffer_state.Union(),
+                                             m_source_key.GetFlatbuffersKey(), m_destination_key.GetFlatbuffersKey());
+    }
+
     auto chassis = this->chassis.ToFlatBuffers(builder);
 
     std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> track_shoes;
@@ -99,7 +123,6 @@ FlatBufferMessage SynTrackedVehicleStateMessage::ConvertToFlatBuffers(flatbuffer
     for (const auto& road_wheel : this->road_wheels)
         road_wheels.push_back(road_wheel.ToFlatBuffers(builder));
 
-    auto vehicle_type = Agent::Type_TrackedVehicle_State;
     auto vehicle_state = TrackedVehicle::CreateStateDirect(builder,        //
                                                            this->time,     //
                                                            chassis,        //
@@ -73,6 +73,10 @@ class SynTrackedVehicleStateMessage : public SynMessage {
     std::vector<SynPose> sprockets;    ///< vector of vehicle's sprockets
     std::vector<SynPose> idlers;       ///< vector of vehicle's idlers
     std::vector<SynPose> road_wheels;  ///< vector of vehicle's road wheels
+
+    /// Compact encoding of all poses (see SynPoseCodec). If set, the attached body poses are not sent and, on receipt,
+    /// only the chassis pose is decoded (the zombie agent decodes the others).
+    std::vector<uint8_t> compact;
 };
 
 /// Description class that holds description information for a SynTrackedVehicle
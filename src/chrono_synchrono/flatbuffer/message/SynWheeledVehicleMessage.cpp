@@ -20,6 +20,8 @@
 
 #include "chrono_synchrono/flatbuffer/message/SynWheeledVehicleMessage.h"
 
+#include "chrono_synchrono/flatbuffer/message/SynPoseCodec.h"
+
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
 namespace chrono {
@@ -49,25 +51,40 @@ void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     auto state = agent_state->message_as_WheeledVehicle_State();
 
     time = state->time();
-    chassis = SynPose(state->chassis());
 
+    // Compact state: the chassis pose is decoded here, the attached bodies are decoded by the receiving zombie
     wheels.clear();
+    compact.clear();
+    if (state->compact() && state->compact()->size()) {
+        compact.assign(state->compact()->begin(), state->compact()->end());
+        if (!SynPoseCodec::DecodeChassis(compact, chassis))
+            chassis = SynPose();
+        return;
+    }
+
+    chassis = SynPose(state->chassis());
     for (auto wheel : (*state->wheels()))
         wheels.emplace_back(wheel);
 }
 
 /// Generate FlatBuffers message from this message's state
 FlatBufferMessage SynWheeledVehicleStateMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
-    auto flatbuffer_chassis = this->chassis.ToFlatBuffers(builder);
+    auto vehicle_type = Agent::Type_WheeledVehicle_State;
+    flatbuffers::Offset<void> vehicle_state;
 
-    std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> flatbuffer_wheels;
-    flatbuffer_wheels.reserve(this->wheels.size());
-    for (const auto& wheel : this->wheels)
-        flatbuffer_wheels.push_back(wheel.ToFlatBuffers(builder));
+    if (!this->compact.empty()) {
+        vehicle_state = WheeledVehicle::CreateStateDirect(builder, this->time, 0, nullptr, &this->compact).Union();
+    } else {
+        auto flatbuffer_chassis = this->chassis.ToFlatBuffers(builder);
 
-    auto vehicle_type = Agent::Type_WheeledVehicle_State;
-    auto vehicle_state =
-        WheeledVehicle::CreateStateDirect(builder, this->time, flatbuffer_chassis, &flatbuffer_wheels).Union();
+        std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> flatbuffer_wheels;
+        flatbuffer_wheels.reserve(this->wheels.size());
+        for (const auto& wheel : this->wheels)
+            flatbuffer_wheels.push_back(wheel.ToFlatBuffers(builder));
+
+        vehicle_state =
+            WheeledVehicle::CreateStateDirect(builder, this->time, flatbuffer_chassis, &flatbuffer_wheels).Union();
+    }
 
     auto flatbuffer_state = Agent::CreateState(builder, vehicle_type, vehicle_state);
     auto flatbuffer_message =
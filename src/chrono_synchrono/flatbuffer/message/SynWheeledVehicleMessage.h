@@ -64,6 +64,10 @@ class SYN_API SynWheeledVehicleStateMessage : public SynMessage {
 
     SynPose chassis;              ///< vehicle's chassis pose
     std::vector<SynPose> wheels;  ///< vector of vehicle's wheels
+
+    /// Compact encoding of all poses (see SynPoseCodec). If set, the attached body poses are not sent and, on receipt,
+    /// only the chassis pose is decoded (the zombie agent decodes the others).
+    std::vector<uint8_t> compact;
 };
 
 // ------------------------------------------------------------------------------------
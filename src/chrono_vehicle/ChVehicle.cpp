@@ -124,6 +124,12 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
         case ChVehicleOutput::HDF5:
 #ifdef CHRONO_HAS_HDF5
             m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5");
+#endif
+            break;
+        case ChVehicleOutput::HDF5_CHUNKED:
+#ifdef CHRONO_HAS_HDF5
+            m_output_db =
+                new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5", ChVehicleOutputHDF5::Layout::CHUNKED);
 #endif
             break;
     }
@@ -143,6 +149,7 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
             //// TODO
             break;
         case ChVehicleOutput::HDF5:
+        case ChVehicleOutput::HDF5_CHUNKED:
 #ifdef CHRONO_HAS_HDF5
             //// TODO
 #endif
@@ -44,9 +44,10 @@ namespace vehicle {
 class CH_VEHICLE_API ChVehicleOutput {
   public:
     enum Type {
-        ASCII,  ///< ASCII text
-        JSON,   ///< JSON
-        HDF5    ///< HDF-5
+        ASCII,        ///< ASCII text
+        JSON,         ///< JSON
+        HDF5,         ///< HDF-5, one group per output frame
+        HDF5_CHUNKED  ///< HDF-5, one chunked dataset per subsystem, written by a background thread
     };
 
     ChVehicleOutput() {}
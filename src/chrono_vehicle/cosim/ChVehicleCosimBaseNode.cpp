@@ -37,8 +37,9 @@ namespace vehicle {
 namespace cosim {
 
 static MPI_Comm terrain_comm = MPI_COMM_NULL;
+static std::unique_ptr<ChVehicleCosimTransport> transport;
 
-int InitializeFramework(int num_tires) {
+int InitializeFramework(int num_tires, ChVehicleCosimTransport::Type transport_type, size_t shm_capacity) {
     int world_size;
     MPI_Comm_size(MPI_COMM_WORLD, &world_size);
     if (world_size < 2 + num_tires) {
@@ -62,6 +63,20 @@ int InitializeFramework(int num_tires) {
     // Create and return a communicator from the terrain group
     MPI_Comm_create(MPI_COMM_WORLD, terrain_group, &terrain_comm);
 
+    // Create the transport for inter-node communication
+    if (transport_type == ChVehicleCosimTransport::Type::SHM) {
+        if (ChVehicleCosimTransportSHM::IsSupported(MPI_COMM_WORLD)) {
+            transport = chrono_types::make_unique<ChVehicleCosimTransportSHM>(2 + num_tires, shm_capacity);
+        } else {
+            int rank;
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            if (rank == 0)
+                cout << "WARNING: shared-memory transport requires all ranks on the same host. Using MPI." << endl;
+        }
+    }
+    if (!transport)
+        transport = chrono_types::make_unique<ChVehicleCosimTransportMPI>();
+
     return MPI_SUCCESS;
 }
 
@@ -73,6 +88,12 @@ MPI_Comm GetTerrainIntracommunicator() {
     return terrain_comm;
 }
 
+ChVehicleCosimTransport& GetTransport() {
+    if (!transport)
+        transport = chrono_types::make_unique<ChVehicleCosimTransportMPI>();
+    return *transport;
+}
+
 }  // end namespace cosim
 
 // -----------------------------------------------------------------------------
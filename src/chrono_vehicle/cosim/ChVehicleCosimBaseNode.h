@@ -32,6 +32,7 @@
 
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChVehicleGeometry.h"
+#include "chrono_vehicle/cosim/ChVehicleCosimTransport.h"
 
 #ifdef CHRONO_POSTPROCESS
     #include "chrono_postprocess/ChBlender.h"
@@ -80,10 +81,17 @@ namespace vehicle {
 namespace cosim {
 
 /// Initialize the co-simulation framework.
-/// This function creates an MPI communicator that includes all nodes designated of type TERRAIN.
+/// This function creates an MPI communicator that includes all nodes designated of type TERRAIN and sets the transport
+/// used for the data exchange between nodes at synchronization times. A shared-memory transport (between the MBS node,
+/// the main TERRAIN node, and the TIRE nodes) can only be used if all ranks run on the same host; otherwise, a warning
+/// is issued and MPI is used. The capacity (in bytes) of each shared-memory ring buffer must be at least twice the size
+/// of the largest message exchanged between nodes (e.g., the mesh data of a deformable tire).
 /// Calling this framework initialization function is optional. If invoked, it *must* be called on all ranks.
 /// Returns MPI_SUCCESS if successful and MPI_ERR_OTHER if there are not enough ranks.
-CH_VEHICLE_API int InitializeFramework(int num_tires);
+CH_VEHICLE_API int InitializeFramework(
+    int num_tires,
+    ChVehicleCosimTransport::Type transport = ChVehicleCosimTransport::Type::MPI,
+    size_t shm_capacity = ChVehicleCosimTransportSHM::DEFAULT_CAPACITY);
 
 /// Return true if the co-simulation framework was initialized and false otherwise.
 CH_VEHICLE_API bool IsFrameworkInitialized();
@@ -93,6 +101,10 @@ CH_VEHICLE_API bool IsFrameworkInitialized();
 /// On a TERRAIN node, the rank within the intra-communicator is accessible through MPI_Comm_rank.
 CH_VEHICLE_API MPI_Comm GetTerrainIntracommunicator();
 
+/// Return the transport used for the data exchange between nodes at synchronization times.
+/// If the framework was not initialized, this is an MPI transport.
+CH_VEHICLE_API ChVehicleCosimTransport& GetTransport();
+
 };  // namespace cosim
 
 // =============================================================================
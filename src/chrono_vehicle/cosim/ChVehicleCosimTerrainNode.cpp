@@ -25,6 +25,8 @@
 #include <algorithm>
 #include <cmath>
 
+#include "chrono/core/ChException.h"
+
 #include "chrono_vehicle/cosim/ChVehicleCosimTerrainNode.h"
 
 #include "chrono_thirdparty/rapidjson/filereadstream.h"
@@ -243,12 +245,13 @@ void ChVehicleCosimTerrainNode::Synchronize(int step_number, double time) {
 }
 
 void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double time) {
+    auto& transport = cosim::GetTransport();
+
     for (int i = 0; i < m_num_objects; i++) {
         if (m_rank == TERRAIN_NODE_RANK) {
             // Receive rigid body state data for this tire
-            MPI_Status status;
             double state_data[13];
-            MPI_Recv(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+            transport.Recv(state_data, 13, TIRE_NODE_RANK(i), step_number);
 
             m_rigid_state[i].pos = ChVector<>(state_data[0], state_data[1], state_data[2]);
             m_rigid_state[i].rot = ChQuaternion<>(state_data[3], state_data[4], state_data[5], state_data[6]);
@@ -274,7 +277,7 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
             double force_data[] = {m_rigid_contact[i].force.x(),  m_rigid_contact[i].force.y(),
                                    m_rigid_contact[i].force.z(),  m_rigid_contact[i].moment.x(),
                                    m_rigid_contact[i].moment.y(), m_rigid_contact[i].moment.z()};
-            MPI_Send(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+            transport.Send(force_data, 6, TIRE_NODE_RANK(i), step_number);
 
             if (m_verbose)
                 cout << "[Terrain node] Send: spindle force (" << i << ") = " << m_rigid_contact[i].force << endl;
@@ -287,14 +290,14 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
 }
 
 void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double time) {
+    auto& transport = cosim::GetTransport();
     std::vector<double> all_states(13 * m_num_objects);
     std::vector<double> all_forces(6 * m_num_objects);
     int start_idx;
 
     // Receive rigid body data for all track shoes
     if (m_rank == TERRAIN_NODE_RANK) {
-        MPI_Status status;
-        MPI_Recv(all_states.data(), 13 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+        transport.Recv(all_states.data(), 13 * m_num_objects, MBS_NODE_RANK, step_number);
 
         // Unpack rigid body data
         start_idx = 0;
@@ -336,7 +339,7 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
             start_idx += 6;
         }
 
-        MPI_Send(all_forces.data(), 6 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+        transport.Send(all_forces.data(), 6 * m_num_objects, MBS_NODE_RANK, step_number);
 
         if (m_verbose)
             cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts() << endl;
@@ -344,15 +347,19 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
 }
 
 void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double time) {
+    auto& transport = cosim::GetTransport();
+
     for (int i = 0; i < m_num_objects; i++) {
         if (m_rank == TERRAIN_NODE_RANK) {
             auto nv = m_geometry[i].m_coll_meshes[0].m_trimesh->getNumVertices();
 
-            // Receive mesh state data
-            MPI_Status status;
-            double* vert_data = new double[2 * 3 * nv];
-            MPI_Recv(vert_data, 2 * 3 * nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD,
-                     &status);
+            // Receive mesh state data (unpacked directly from the transport's message buffer)
+            int count;
+            const double* vert_data = transport.BeginRecv<double>(count, TIRE_NODE_RANK(i), step_number);
+            if (count != 2 * 3 * nv) {
+                transport.EndRecv(TIRE_NODE_RANK(i));
+                throw ChException("Unexpected size of mesh state data for object " + std::to_string(i));
+            }
 
             for (int iv = 0; iv < nv; iv++) {
                 int offset = 3 * iv;
@@ -363,10 +370,10 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
                     ChVector<>(vert_data[offset + 0], vert_data[offset + 1], vert_data[offset + 2]);
             }
 
+            transport.EndRecv(TIRE_NODE_RANK(i));
+
             ////if (m_verbose)
             ////    PrintMeshUpdateData(i);
-
-            delete[] vert_data;
         }
 
         // Set position, rotation, and velocity of proxy bodies.
@@ -384,17 +391,16 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
 
         if (m_rank == TERRAIN_NODE_RANK) {
             // Send vertex indices and forces.
-            MPI_Send(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, MPI_INT, TIRE_NODE_RANK(i), step_number,
-                     MPI_COMM_WORLD);
+            transport.Send(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, TIRE_NODE_RANK(i), step_number);
 
-            double* force_data = new double[3 * m_mesh_contact[i].nv];
+            double* force_data =
+                transport.BeginSend<double>(3 * m_mesh_contact[i].nv, TIRE_NODE_RANK(i), step_number);
             for (int iv = 0; iv < m_mesh_contact[i].nv; iv++) {
                 force_data[3 * iv + 0] = m_mesh_contact[i].vforce[iv].x();
                 force_data[3 * iv + 1] = m_mesh_contact[i].vforce[iv].y();
                 force_data[3 * iv + 2] = m_mesh_contact[i].vforce[iv].z();
             }
-            MPI_Send(force_data, 3 * m_mesh_contact[i].nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
-            delete[] force_data;
+            transport.EndSend(TIRE_NODE_RANK(i));
 
             if (m_verbose)
                 cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts()
@@ -22,6 +22,7 @@
 //// TODO allow changing the collision system
 
 #include "chrono/ChConfig.h"
+#include "chrono/core/ChException.h"
 #include "chrono/solver/ChIterativeSolver.h"
 #include "chrono/solver/ChDirectSolverLS.h"
 
@@ -307,11 +308,11 @@ void ChVehicleCosimTireNode::Synchronize(int step_number, double time) {
 
 void ChVehicleCosimTireNode::SynchronizeBody(int step_number, double time) {
     // Act as a simple counduit between the MBS and TERRAIN nodes
-    MPI_Status status;
+    auto& transport = cosim::GetTransport();
 
     // Receive spindle state data from MBS node
     double state_data[13];
-    MPI_Recv(state_data, 13, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    transport.Recv(state_data, 13, MBS_NODE_RANK, step_number);
 
     BodyState spindle_state;
     spindle_state.pos = ChVector<>(state_data[0], state_data[1], state_data[2]);
@@ -323,13 +324,13 @@ void ChVehicleCosimTireNode::SynchronizeBody(int step_number, double time) {
     ApplySpindleState(spindle_state);
 
     // Send spindle state data to Terrain node
-    MPI_Send(state_data, 13, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    transport.Send(state_data, 13, TERRAIN_NODE_RANK, step_number);
     if (m_verbose)
         cout << "[Tire node " << m_index << " ] Send: spindle position = " << spindle_state.pos << endl;
 
     // Receive spindle force from TERRAIN NODE and send to MBS node
     double force_data[6];
-    MPI_Recv(force_data, 6, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    transport.Recv(force_data, 6, TERRAIN_NODE_RANK, step_number);
 
     TerrainForce spindle_force;
     spindle_force.force = ChVector<>(force_data[0], force_data[1], force_data[2]);
@@ -342,15 +343,15 @@ void ChVehicleCosimTireNode::SynchronizeBody(int step_number, double time) {
     ApplySpindleForce(spindle_force);
 
     // Send spindle force to MBS node
-    MPI_Send(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+    transport.Send(force_data, 6, MBS_NODE_RANK, step_number);
 }
 
 void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
-    MPI_Status status;
+    auto& transport = cosim::GetTransport();
 
     // Receive spindle state data from MBS node
     double state_data[13];
-    MPI_Recv(state_data, 13, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    transport.Recv(state_data, 13, MBS_NODE_RANK, step_number);
 
     BodyState spindle_state;
     spindle_state.pos = ChVector<>(state_data[0], state_data[1], state_data[2]);
@@ -361,11 +362,12 @@ void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
     // Pass it to derived class.
     ApplySpindleState(spindle_state);
 
-    // Send mesh state (vertex locations and velocities) to TERRAIN node
+    // Send mesh state (vertex locations and velocities) to TERRAIN node.
+    // Vertex data is packed directly in the transport's message buffer.
     MeshState mesh_state;
     LoadMeshState(mesh_state);
     unsigned int nvs = (unsigned int)mesh_state.vpos.size();
-    double* vert_data = new double[2 * 3 * nvs];
+    double* vert_data = transport.BeginSend<double>(2 * 3 * nvs, TERRAIN_NODE_RANK, step_number);
     for (unsigned int iv = 0; iv < nvs; iv++) {
         vert_data[3 * iv + 0] = mesh_state.vpos[iv].x();
         vert_data[3 * iv + 1] = mesh_state.vpos[iv].y();
@@ -376,28 +378,30 @@ void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
         vert_data[3 * nvs + 3 * iv + 1] = mesh_state.vvel[iv].y();
         vert_data[3 * nvs + 3 * iv + 2] = mesh_state.vvel[iv].z();
     }
-    MPI_Send(vert_data, 2 * 3 * nvs, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    transport.EndSend(TERRAIN_NODE_RANK);
 
     // Receive mesh forces from TERRAIN node.
-    // Note that we use MPI_Probe to figure out the number of indices and forces received.
+    // Note that the number of indices and forces is given by the size of the received messages.
+    // Contact data is unpacked directly from the transport's message buffers.
     int nvc = 0;
-    MPI_Probe(TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
-    MPI_Get_count(&status, MPI_INT, &nvc);
-    int* index_data = new int[nvc];
-    double* mesh_contact_data = new double[3 * nvc];
-    MPI_Recv(index_data, nvc, MPI_INT, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
-    MPI_Recv(mesh_contact_data, 3 * nvc, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
-
+    const int* index_data = transport.BeginRecv<int>(nvc, TERRAIN_NODE_RANK, step_number);
     MeshContact mesh_contact;
     mesh_contact.nv = nvc;
-    mesh_contact.vidx.resize(nvc);
+    mesh_contact.vidx.assign(index_data, index_data + nvc);
+    transport.EndRecv(TERRAIN_NODE_RANK);
+
+    int nvf = 0;
+    const double* mesh_contact_data = transport.BeginRecv<double>(nvf, TERRAIN_NODE_RANK, step_number);
+    if (nvf != 3 * nvc) {
+        transport.EndRecv(TERRAIN_NODE_RANK);
+        throw ChException("Unexpected size of mesh contact force data");
+    }
     mesh_contact.vforce.resize(nvc);
     for (int iv = 0; iv < nvc; iv++) {
-        int index = index_data[iv];
-        mesh_contact.vidx[iv] = index;
         mesh_contact.vforce[iv] =
             ChVector<>(mesh_contact_data[3 * iv + 0], mesh_contact_data[3 * iv + 1], mesh_contact_data[3 * iv + 2]);
     }
+    transport.EndRecv(TERRAIN_NODE_RANK);
 
     if (m_verbose)
         cout << "[Tire node " << m_index << " ] step number: " << step_number
@@ -411,11 +415,7 @@ void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
     LoadSpindleForce(spindle_force);
     double force_data[] = {spindle_force.force.x(),  spindle_force.force.y(),  spindle_force.force.z(),
                            spindle_force.moment.x(), spindle_force.moment.y(), spindle_force.moment.z()};
-    MPI_Send(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
-
-    delete[] vert_data;
-    delete[] index_data;
-    delete[] mesh_contact_data;
+    transport.Send(force_data, 6, MBS_NODE_RANK, step_number);
 }
 
 void ChVehicleCosimTireNode::OutputData(int frame) {
@@ -267,12 +267,12 @@ void ChVehicleCosimTrackedMBSNode::Synchronize(int step_number, double time) {
     }
 
     // Send track shoe states to the terrain node
-    MPI_Send(all_states.data(), 13 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    auto& transport = cosim::GetTransport();
+    transport.Send(all_states.data(), 13 * num_shoes, TERRAIN_NODE_RANK, step_number);
 
     // Receive track shoe forces as applied to the center of the track shoe body.
     // Note that we assume this is the resultant wrench at the track shoe origin (expressed in absolute frame).
-    MPI_Status status;
-    MPI_Recv(all_forces.data(), 6 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    transport.Recv(all_forces.data(), 6 * num_shoes, TERRAIN_NODE_RANK, step_number);
 
     // Apply track shoe forces on each individual track shoe body
     start_idx = 0;
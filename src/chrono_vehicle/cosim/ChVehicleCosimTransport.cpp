@@ -0,0 +1,414 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Transport layer for the data exchanged between co-simulation nodes at each
+// synchronization time.
+//
+// =============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define CH_COSIM_POSIX_SHM
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/core/ChException.h"
+
+#include "chrono_vehicle/cosim/ChVehicleCosimTransport.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// Default implementation of copying send and receive (through message views)
+// -----------------------------------------------------------------------------
+
+void ChVehicleCosimTransport::SendBytes(const void* data, size_t bytes, int dest, int tag) {
+    void* buffer = AcquireSend(bytes, dest, tag);
+    if (bytes > 0)
+        std::memcpy(buffer, data, bytes);
+    EndSend(dest);
+}
+
+void ChVehicleCosimTransport::RecvBytes(void* data, size_t bytes, int source, int tag) {
+    size_t recv_bytes;
+    const void* buffer = AcquireRecv(recv_bytes, source, tag);
+    if (recv_bytes != bytes) {
+        EndRecv(source);
+        throw ChException("Co-simulation message from rank " + std::to_string(source) + " has size " +
+                          std::to_string(recv_bytes) + " (expected " + std::to_string(bytes) + ")");
+    }
+    if (bytes > 0)
+        std::memcpy(data, buffer, bytes);
+    EndRecv(source);
+}
+
+// -----------------------------------------------------------------------------
+// MPI transport
+// -----------------------------------------------------------------------------
+
+ChVehicleCosimTransportMPI::ChVehicleCosimTransportMPI(MPI_Comm comm) : m_comm(comm) {
+    int size;
+    MPI_Comm_size(comm, &size);
+    m_send.resize(size);
+    m_recv_buffers.resize(size);
+}
+
+void ChVehicleCosimTransportMPI::SendBytes(const void* data, size_t bytes, int dest, int tag) {
+    MPI_Send(data, (int)bytes, MPI_BYTE, dest, tag, m_comm);
+}
+
+void ChVehicleCosimTransportMPI::RecvBytes(void* data, size_t bytes, int source, int tag) {
+    MPI_Status status;
+    MPI_Recv(data, (int)bytes, MPI_BYTE, source, tag, m_comm, &status);
+}
+
+ChVehicleCosimTransportMPI::SendView& ChVehicleCosimTransportMPI::GetSendView(int dest) {
+    if (dest < 0 || dest >= (int)m_send.size())
+        throw ChException("Invalid destination rank " + std::to_string(dest) + " for co-simulation message");
+    return m_send[dest];
+}
+
+void* ChVehicleCosimTransportMPI::AcquireSend(size_t bytes, int dest, int tag) {
+    auto& view = GetSendView(dest);
+    view.buffer.resize(bytes);
+    view.tag = tag;
+    return view.buffer.data();
+}
+
+void ChVehicleCosimTransportMPI::EndSend(int dest) {
+    auto& view = GetSendView(dest);
+    MPI_Send(view.buffer.data(), (int)view.buffer.size(), MPI_BYTE, dest, view.tag, m_comm);
+}
+
+const void* ChVehicleCosimTransportMPI::AcquireRecv(size_t& bytes, int source, int tag) {
+    if (source < 0 || source >= (int)m_recv_buffers.size())
+        throw ChException("Invalid source rank " + std::to_string(source) + " for co-simulation message");
+    auto& buffer = m_recv_buffers[source];
+
+    // Use MPI_Probe to figure out the size of the incoming message
+    MPI_Status status;
+    int count;
+    MPI_Probe(source, tag, m_comm, &status);
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    buffer.resize(count);
+    MPI_Recv(buffer.data(), count, MPI_BYTE, source, tag, m_comm, &status);
+    bytes = (size_t)count;
+    return buffer.data();
+}
+
+// -----------------------------------------------------------------------------
+// Shared-memory transport
+// -----------------------------------------------------------------------------
+
+// Layout of a shared-memory segment: ring header, followed by the ring data.
+// Ring positions increase monotonically; the location in the data buffer is the position modulo capacity.
+// Each message is stored contiguously as a record header followed by the payload, padded to a multiple of 64 bytes.
+// A record with the WRAP flag marks the end of usable data before the end of the buffer.
+struct RingHeader {
+    alignas(64) std::atomic<uint64_t> head;  // write position (modified by producer only)
+    alignas(64) std::atomic<uint64_t> tail;  // read position (modified by consumer only)
+    alignas(64) uint64_t capacity;           // size of data buffer (multiple of 64)
+};
+
+struct RecordHeader {
+    uint64_t bytes;  // payload size
+    int32_t tag;     // message tag
+    uint32_t flags;  // record flags
+};
+
+static const uint32_t RECORD_WRAP = 1;
+static const size_t RING_ALIGN = 64;
+
+static inline uint64_t RecordSize(size_t bytes) {
+    return (sizeof(RecordHeader) + bytes + RING_ALIGN - 1) & ~uint64_t(RING_ALIGN - 1);
+}
+
+static inline size_t SegmentSize(uint64_t capacity) {
+    return sizeof(RingHeader) + capacity;
+}
+
+// Wait strategy: spin for a short while, then yield the CPU, then sleep between checks (co-simulation nodes may
+// oversubscribe the cores and may have to wait for a long time while a peer node advances its simulation).
+// The timeout (if any) is only checked once the waiting rank stops spinning.
+class Waiter {
+  public:
+    Waiter(double timeout) : m_timeout(timeout), m_spins(0) {}
+
+    // Wait before the next check. Return false if the timeout expired.
+    bool Wait() {
+        m_spins++;
+        if (m_spins < 1000)
+            return true;
+        if (m_spins == 1000)
+            m_start = std::chrono::steady_clock::now();
+        if (m_spins < 2000)
+            std::this_thread::yield();
+        else
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        if (m_timeout <= 0 || m_spins % 64 != 0)
+            return true;
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+        return elapsed.count() < m_timeout;
+    }
+
+  private:
+    double m_timeout;
+    int m_spins;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+struct ChVehicleCosimTransportSHM::Channel {
+    std::string name;   // name of the shared-memory segment
+    void* map;          // start of mapped segment
+    RingHeader* ring;   // ring header
+    char* data;         // ring data
+    uint64_t pending;   // ring position after the currently open message view
+};
+
+#ifdef CH_COSIM_POSIX_SHM
+
+static std::string SegmentName(int id, int instance, int src, int dst) {
+    return "/chcosim_" + std::to_string(id) + "_" + std::to_string(instance) + "_" + std::to_string(src) + "_" +
+           std::to_string(dst);
+}
+
+static void* MapSegment(const std::string& name, uint64_t capacity, bool create) {
+    int fd = create ? shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600) : shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0)
+        throw ChException("Cannot open shared-memory segment " + name);
+    if (create && ftruncate(fd, (off_t)SegmentSize(capacity)) != 0) {
+        close(fd);
+        shm_unlink(name.c_str());
+        throw ChException("Cannot allocate shared-memory segment " + name);
+    }
+    void* map = mmap(nullptr, SegmentSize(capacity), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        if (create)
+            shm_unlink(name.c_str());
+        throw ChException("Cannot map shared-memory segment " + name);
+    }
+    return map;
+}
+
+#endif
+
+ChVehicleCosimTransportSHM::ChVehicleCosimTransportSHM(int num_ranks, size_t capacity, MPI_Comm comm)
+    : m_rank(0), m_capacity(0), m_timeout(600) {
+#ifdef CH_COSIM_POSIX_SHM
+    int size;
+    MPI_Comm_rank(comm, &m_rank);
+    MPI_Comm_size(comm, &size);
+    if (num_ranks < 1 || num_ranks > size) {
+        throw ChException("Invalid number of ranks (" + std::to_string(num_ranks) +
+                          ") for shared-memory transport on a communicator of size " + std::to_string(size));
+    }
+    m_out.resize(num_ranks);
+    m_in.resize(num_ranks);
+
+    // Use the process ID of the first rank (and a per-process instance counter) to generate unique segment names
+    static int num_instances = 0;
+    int id = (int)getpid();
+    int instance = num_instances++;
+    MPI_Bcast(&id, 1, MPI_INT, 0, comm);
+
+    uint64_t cap = (capacity + RING_ALIGN - 1) & ~uint64_t(RING_ALIGN - 1);
+    m_capacity = cap;
+    bool active = m_rank < num_ranks;
+
+    // Each rank creates and initializes the segments for its incoming channels
+    if (active) {
+        for (int src = 0; src < num_ranks; src++) {
+            if (src == m_rank)
+                continue;
+            m_in[src] = std::unique_ptr<Channel>(new Channel);
+            auto& ch = *m_in[src];
+            ch.name = SegmentName(id, instance, src, m_rank);
+            ch.map = MapSegment(ch.name, cap, true);
+            ch.ring = new (ch.map) RingHeader;
+            ch.ring->head.store(0);
+            ch.ring->tail.store(0);
+            ch.ring->capacity = cap;
+            ch.data = static_cast<char*>(ch.map) + sizeof(RingHeader);
+            ch.pending = 0;
+        }
+    }
+    MPI_Barrier(comm);
+
+    // Map the segments of the outgoing channels (created by the destination ranks)
+    if (active) {
+        for (int dst = 0; dst < num_ranks; dst++) {
+            if (dst == m_rank)
+                continue;
+            m_out[dst] = std::unique_ptr<Channel>(new Channel);
+            auto& ch = *m_out[dst];
+            ch.name = SegmentName(id, instance, m_rank, dst);
+            ch.map = MapSegment(ch.name, cap, false);
+            ch.ring = static_cast<RingHeader*>(ch.map);
+            ch.data = static_cast<char*>(ch.map) + sizeof(RingHeader);
+            ch.pending = 0;
+        }
+    }
+    MPI_Barrier(comm);
+
+    // All segments are mapped; remove their names so that nothing is left behind when the processes exit
+    for (auto& ch : m_in) {
+        if (ch)
+            shm_unlink(ch->name.c_str());
+    }
+#else
+    throw ChException("Shared-memory co-simulation transport not supported on this platform");
+#endif
+}
+
+ChVehicleCosimTransportSHM::~ChVehicleCosimTransportSHM() {
+#ifdef CH_COSIM_POSIX_SHM
+    for (auto channels : {&m_in, &m_out}) {
+        for (auto& ch : *channels) {
+            if (ch)
+                munmap(ch->map, SegmentSize(ch->ring->capacity));
+        }
+    }
+#endif
+}
+
+size_t ChVehicleCosimTransportSHM::GetMaxMessageSize() const {
+    // A record (header and padded payload) must fit in half the ring
+    uint64_t max_record = (m_capacity / 2) & ~uint64_t(RING_ALIGN - 1);
+    return max_record > sizeof(RecordHeader) ? (size_t)(max_record - sizeof(RecordHeader)) : 0;
+}
+
+bool ChVehicleCosimTransportSHM::IsSupported(MPI_Comm comm) {
+#ifdef CH_COSIM_POSIX_SHM
+    int size;
+    int node_size;
+    MPI_Comm node_comm;
+    MPI_Comm_size(comm, &size);
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+    MPI_Comm_size(node_comm, &node_size);
+    MPI_Comm_free(&node_comm);
+    return node_size == size;
+#else
+    return false;
+#endif
+}
+
+ChVehicleCosimTransportSHM::Channel& ChVehicleCosimTransportSHM::GetChannel(
+    std::vector<std::unique_ptr<Channel>>& channels,
+    int peer) {
+    if (peer < 0 || peer >= (int)channels.size() || !channels[peer]) {
+        throw ChException("No shared-memory channel between ranks " + std::to_string(m_rank) + " and " +
+                          std::to_string(peer));
+    }
+    return *channels[peer];
+}
+
+void* ChVehicleCosimTransportSHM::AcquireSend(size_t bytes, int dest, int tag) {
+    auto& ch = GetChannel(m_out, dest);
+    auto ring = ch.ring;
+    uint64_t cap = ring->capacity;
+    uint64_t rec = RecordSize(bytes);
+    if (2 * rec > cap) {
+        throw ChException("Co-simulation message of size " + std::to_string(bytes) +
+                          " too large for shared-memory transport (maximum size: " +
+                          std::to_string(GetMaxMessageSize()) + "). Increase the ring capacity.");
+    }
+
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    uint64_t off = head % cap;
+
+    // Skip to the start of the buffer if the record does not fit before its end or if the ring is empty.
+    // Since a record is at most half the capacity, the padding and the record always fit in the ring.
+    uint64_t pad = (off + rec > cap || (head == tail && off >= rec)) ? cap - off : 0;
+
+    // Wait for enough free space
+    Waiter waiter(m_timeout);
+    while (cap - (head - tail) < pad + rec) {
+        if (!waiter.Wait())
+            throw ChException("Timeout waiting for rank " + std::to_string(dest) + " to receive co-simulation data");
+        tail = ring->tail.load(std::memory_order_acquire);
+    }
+
+    if (pad > 0) {
+        auto wrap = reinterpret_cast<RecordHeader*>(ch.data + off);
+        wrap->bytes = 0;
+        wrap->tag = 0;
+        wrap->flags = RECORD_WRAP;
+        head += pad;
+        off = 0;
+    }
+
+    auto hdr = reinterpret_cast<RecordHeader*>(ch.data + off);
+    hdr->bytes = bytes;
+    hdr->tag = tag;
+    hdr->flags = 0;
+    ch.pending = head + rec;
+
+    return ch.data + off + sizeof(RecordHeader);
+}
+
+void ChVehicleCosimTransportSHM::EndSend(int dest) {
+    auto& ch = GetChannel(m_out, dest);
+    ch.ring->head.store(ch.pending, std::memory_order_release);
+}
+
+const void* ChVehicleCosimTransportSHM::AcquireRecv(size_t& bytes, int source, int tag) {
+    auto& ch = GetChannel(m_in, source);
+    auto ring = ch.ring;
+    uint64_t cap = ring->capacity;
+
+    // Wait for a message
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    Waiter waiter(m_timeout);
+    while (ring->head.load(std::memory_order_acquire) == tail) {
+        if (!waiter.Wait())
+            throw ChException("Timeout waiting for co-simulation data from rank " + std::to_string(source));
+    }
+
+    // Skip padding at the end of the buffer (always published together with the following record)
+    uint64_t off = tail % cap;
+    auto hdr = reinterpret_cast<const RecordHeader*>(ch.data + off);
+    if (hdr->flags & RECORD_WRAP) {
+        tail += cap - off;
+        off = 0;
+        hdr = reinterpret_cast<const RecordHeader*>(ch.data);
+    }
+
+    if (hdr->tag != tag) {
+        throw ChException("Co-simulation message from rank " + std::to_string(source) + " has tag " +
+                          std::to_string(hdr->tag) + " (expected " + std::to_string(tag) + ")");
+    }
+
+    bytes = (size_t)hdr->bytes;
+    ch.pending = tail + RecordSize(bytes);
+
+    return ch.data + off + sizeof(RecordHeader);
+}
+
+void ChVehicleCosimTransportSHM::EndRecv(int source) {
+    auto& ch = GetChannel(m_in, source);
+    ch.ring->tail.store(ch.pending, std::memory_order_release);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,187 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Transport layer for the data exchanged between co-simulation nodes at each
+// synchronization time.
+//
+// =============================================================================
+
+#ifndef CH_VEHCOSIM_TRANSPORT_H
+#define CH_VEHCOSIM_TRANSPORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <mpi.h>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_cosim
+/// @{
+
+/// Base class for the transport of messages exchanged between co-simulation nodes at synchronization times.
+/// The initial data exchange between nodes (setup and geometry information) is always done through MPI; the transport
+/// is used for all messages exchanged at each co-simulation step. Messages between a given pair of ranks are delivered
+/// in the order they were sent, and each message carries a tag which must match the tag expected by the receiver.\n
+/// A message can be sent or received either by copying from/to a user buffer (Send, Recv) or by working directly on a
+/// view into storage owned by the transport (BeginSend/EndSend, BeginRecv/EndRecv). For a shared-memory transport,
+/// such views point into the ring buffer shared by the two ranks, so that data is packed by the sender and unpacked
+/// by the receiver without any intermediate copy. At most one send and one receive view can be open per peer rank.\n
+/// Errors in the message exchange (a message too large for the transport, a message with unexpected tag or size, or a
+/// timeout while waiting for a peer rank) are reported by throwing a ChException.
+class CH_VEHICLE_API ChVehicleCosimTransport {
+  public:
+    /// Type of transport.
+    enum class Type {
+        MPI,  ///< MPI point-to-point messages
+        SHM   ///< shared-memory ring buffers (all ranks on the same host)
+    };
+
+    virtual ~ChVehicleCosimTransport() {}
+
+    /// Return the transport type.
+    virtual Type GetType() const = 0;
+
+    /// Send a message of 'count' values to the specified rank.
+    template <typename T>
+    void Send(const T* data, int count, int dest, int tag) {
+        SendBytes(data, count * sizeof(T), dest, tag);
+    }
+
+    /// Receive a message of exactly 'count' values from the specified rank.
+    template <typename T>
+    void Recv(T* data, int count, int source, int tag) {
+        RecvBytes(data, count * sizeof(T), source, tag);
+    }
+
+    /// Start sending a message of 'count' values to the specified rank.
+    /// Return a buffer where the caller must write the message data before calling EndSend.
+    template <typename T>
+    T* BeginSend(int count, int dest, int tag) {
+        return static_cast<T*>(AcquireSend(count * sizeof(T), dest, tag));
+    }
+
+    /// Complete the message started with BeginSend.
+    virtual void EndSend(int dest) = 0;
+
+    /// Start receiving the next message from the specified rank.
+    /// Return a read-only view of the message data (valid until EndRecv is called) and set the number of values.
+    template <typename T>
+    const T* BeginRecv(int& count, int source, int tag) {
+        size_t bytes;
+        const void* data = AcquireRecv(bytes, source, tag);
+        count = static_cast<int>(bytes / sizeof(T));
+        return static_cast<const T*>(data);
+    }
+
+    /// Release the message view obtained with BeginRecv.
+    virtual void EndRecv(int source) = 0;
+
+  protected:
+    virtual void SendBytes(const void* data, size_t bytes, int dest, int tag);
+    virtual void RecvBytes(void* data, size_t bytes, int source, int tag);
+    virtual void* AcquireSend(size_t bytes, int dest, int tag) = 0;
+    virtual const void* AcquireRecv(size_t& bytes, int source, int tag) = 0;
+};
+
+/// Transport using MPI point-to-point messages.
+/// Send and receive views are staging buffers which are sent or filled with blocking MPI calls.
+class CH_VEHICLE_API ChVehicleCosimTransportMPI : public ChVehicleCosimTransport {
+  public:
+    ChVehicleCosimTransportMPI(MPI_Comm comm = MPI_COMM_WORLD);
+
+    virtual Type GetType() const override { return Type::MPI; }
+    virtual void EndSend(int dest) override;
+    virtual void EndRecv(int source) override {}
+
+  private:
+    virtual void SendBytes(const void* data, size_t bytes, int dest, int tag) override;
+    virtual void RecvBytes(void* data, size_t bytes, int source, int tag) override;
+    virtual void* AcquireSend(size_t bytes, int dest, int tag) override;
+    virtual const void* AcquireRecv(size_t& bytes, int source, int tag) override;
+
+    /// Staging buffer and tag of the send view for a given destination rank.
+    struct SendView {
+        std::vector<char> buffer;
+        int tag = 0;
+    };
+
+    SendView& GetSendView(int dest);
+
+    MPI_Comm m_comm;
+    std::vector<SendView> m_send;                   ///< send views (indexed by destination rank)
+    std::vector<std::vector<char>> m_recv_buffers;  ///< receive views (indexed by source rank)
+};
+
+/// Transport using shared-memory ring buffers, for co-simulation nodes running on the same host.
+/// A single-producer single-consumer ring buffer, in a POSIX shared-memory segment, is created for each ordered pair of
+/// the first 'num_ranks' ranks. Messages are written in place by the sender and read in place by the receiver, with
+/// lock-free synchronization through the ring positions. A waiting rank spins briefly, then yields its CPU, and then
+/// sleeps between checks of the ring; if no progress is made within the specified timeout, an exception is thrown.\n
+/// A message must not be larger than half the ring capacity (see GetMaxMessageSize). When a ring is found empty, the
+/// sender restarts at the beginning of the buffer, so that channels carrying small messages only touch a few memory
+/// pages.
+class CH_VEHICLE_API ChVehicleCosimTransportSHM : public ChVehicleCosimTransport {
+  public:
+    /// Default capacity of each ring buffer (bytes).
+    static const size_t DEFAULT_CAPACITY = 8 * 1024 * 1024;
+
+    /// Create the shared-memory channels between the first 'num_ranks' ranks of the given communicator.
+    /// The capacity of each ring buffer (in bytes) must be at least twice the size of the largest message exchanged.
+    /// This is a collective operation which must be called on all ranks of the communicator. A ChException is thrown
+    /// if 'num_ranks' exceeds the communicator size or if a shared-memory segment cannot be created or mapped.
+    ChVehicleCosimTransportSHM(int num_ranks, size_t capacity = DEFAULT_CAPACITY, MPI_Comm comm = MPI_COMM_WORLD);
+
+    ~ChVehicleCosimTransportSHM();
+
+    /// Return the largest message size (in bytes) that can be sent through this transport.
+    size_t GetMaxMessageSize() const;
+
+    /// Set the maximum time (in seconds) to wait for a peer rank to send a message or to free space in a ring buffer
+    /// (default: 600). A value of zero disables the timeout.
+    void SetTimeout(double timeout) { m_timeout = timeout; }
+
+    /// Return true if a shared-memory transport can be used for all ranks of the given communicator.
+    /// This requires POSIX shared memory and all ranks running on the same host.
+    /// This is a collective operation which must be called on all ranks of the communicator.
+    static bool IsSupported(MPI_Comm comm = MPI_COMM_WORLD);
+
+    virtual Type GetType() const override { return Type::SHM; }
+    virtual void EndSend(int dest) override;
+    virtual void EndRecv(int source) override;
+
+  private:
+    struct Channel;
+
+    virtual void* AcquireSend(size_t bytes, int dest, int tag) override;
+    virtual const void* AcquireRecv(size_t& bytes, int source, int tag) override;
+
+    Channel& GetChannel(std::vector<std::unique_ptr<Channel>>& channels, int peer);
+
+    int m_rank;
+    uint64_t m_capacity;                          ///< capacity of each ring buffer
+    double m_timeout;                             ///< maximum wait time (seconds)
+    std::vector<std::unique_ptr<Channel>> m_out;  ///< outgoing channels (indexed by destination rank)
+    std::vector<std::unique_ptr<Channel>> m_in;   ///< incoming channels (indexed by source rank)
+};
+
+/// @} vehicle_cosim
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
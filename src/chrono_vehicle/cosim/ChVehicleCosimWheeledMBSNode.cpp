@@ -263,7 +263,7 @@ void ChVehicleCosimWheeledMBSNode::InitializeSystem() {
 // - receive and apply vertex contact forces
 // -----------------------------------------------------------------------------
 void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
-    MPI_Status status;
+    auto& transport = cosim::GetTransport();
 
     for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
         // Send wheel state to the tire node
@@ -275,7 +275,7 @@ void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
             state.ang_vel.x(), state.ang_vel.y(), state.ang_vel.z()                   //
         };
 
-        MPI_Send(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+        transport.Send(state_data, 13, TIRE_NODE_RANK(i), step_number);
 
         if (m_verbose)
             cout << "[MBS node    ] Send: spindle position (" << i << ") = " << state.pos << endl;
@@ -283,7 +283,7 @@ void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
         // Receive spindle force as applied to the center of the spindle/wheel.
         // Note that we assume this is the resultant wrench at the wheel origin (expressed in absolute frame).
         double force_data[6];
-        MPI_Recv(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+        transport.Recv(force_data, 6, TIRE_NODE_RANK(i), step_number);
 
         TerrainForce spindle_force;
         spindle_force.point = GetSpindleBody(i)->GetPos();
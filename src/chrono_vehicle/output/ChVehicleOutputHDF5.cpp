@@ -20,9 +20,11 @@
 #include <iomanip>
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 
 #include "chrono/physics/ChLinkLock.h"
 #include "chrono/physics/ChLinkUniversal.h"
+#include "chrono/core/ChException.h"
 
 #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 
@@ -101,192 +103,225 @@ struct bodyload_info {
     double tx, ty, tz;  // joint reaction torque
 };
 
-H5::CompType* ChVehicleOutputHDF5::m_body_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_bodyaux_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_shaft_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_marker_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_joint_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_couple_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_linspring_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_rotspring_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_bodyload_type = nullptr;
-
-const H5::CompType& ChVehicleOutputHDF5::getBodyType() {
-    if (!m_body_type) {
-        struct Initializer {
-            Initializer() {
-                m_body_type = new H5::CompType(sizeof(body_info));
-                m_body_type->insertMember("id", HOFFSET(body_info, id), H5::PredType::NATIVE_INT);
-                m_body_type->insertMember("x", HOFFSET(body_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("y", HOFFSET(body_info, y), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("z", HOFFSET(body_info, z), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("e0", HOFFSET(body_info, e0), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("e1", HOFFSET(body_info, e1), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("e2", HOFFSET(body_info, e2), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("e3", HOFFSET(body_info, e3), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_body_type;
+static H5::CompType CreateBodyType() {
+    H5::CompType type(sizeof(body_info));
+    type.insertMember("id", HOFFSET(body_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(body_info, x), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("y", HOFFSET(body_info, y), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("z", HOFFSET(body_info, z), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("e0", HOFFSET(body_info, e0), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("e1", HOFFSET(body_info, e1), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("e2", HOFFSET(body_info, e2), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("e3", HOFFSET(body_info, e3), H5::PredType::NATIVE_DOUBLE);
+    return type;
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getBodyAuxType() {
-    if (!m_bodyaux_type) {
-        struct Initializer {
-            Initializer() {
-                m_bodyaux_type = new H5::CompType(sizeof(bodyaux_info));
-                m_bodyaux_type->insertMember("id", HOFFSET(bodyaux_info, id), H5::PredType::NATIVE_INT);
-                m_bodyaux_type->insertMember("x", HOFFSET(bodyaux_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("y", HOFFSET(bodyaux_info, y), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("z", HOFFSET(bodyaux_info, z), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("e0", HOFFSET(bodyaux_info, e0), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("e1", HOFFSET(bodyaux_info, e1), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("e2", HOFFSET(bodyaux_info, e2), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("e3", HOFFSET(bodyaux_info, e3), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_bodyaux_type;
+static H5::CompType CreateBodyAuxType() {
+    H5::CompType type(sizeof(bodyaux_info));
+    type.insertMember("id", HOFFSET(bodyaux_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(bodyaux_info, x), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("y", HOFFSET(bodyaux_info, y), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("z", HOFFSET(bodyaux_info, z), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("e0", HOFFSET(bodyaux_info, e0), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("e1", HOFFSET(bodyaux_info, e1), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("e2", HOFFSET(bodyaux_info, e2), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("e3", HOFFSET(bodyaux_info, e3), H5::PredType::NATIVE_DOUBLE);
+    return type;
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getShaftType() {
-    if (!m_shaft_type) {
-        struct Initializer {
-            Initializer() {
-                m_shaft_type = new H5::CompType(sizeof(shaft_info));
-                m_shaft_type->insertMember("id", HOFFSET(shaft_info, id), H5::PredType::NATIVE_INT);
-                m_shaft_type->insertMember("x", HOFFSET(shaft_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_shaft_type->insertMember("xd", HOFFSET(shaft_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_shaft_type->insertMember("xdd", HOFFSET(shaft_info, xdd), H5::PredType::NATIVE_DOUBLE);
-                m_shaft_type->insertMember("torque", HOFFSET(shaft_info, t), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_shaft_type;
+static H5::CompType CreateShaftType() {
+    H5::CompType type(sizeof(shaft_info));
+    type.insertMember("id", HOFFSET(shaft_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(shaft_info, x), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("xd", HOFFSET(shaft_info, xd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("xdd", HOFFSET(shaft_info, xdd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("torque", HOFFSET(shaft_info, t), H5::PredType::NATIVE_DOUBLE);
+    return type;
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getMarkerType() {
-    if (!m_marker_type) {
-        struct Initializer {
-            Initializer() {
-                m_marker_type = new H5::CompType(sizeof(marker_info));
-                m_marker_type->insertMember("id", HOFFSET(marker_info, id), H5::PredType::NATIVE_INT);
-                m_marker_type->insertMember("x", HOFFSET(marker_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("y", HOFFSET(marker_info, y), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("z", HOFFSET(marker_info, z), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("xd", HOFFSET(marker_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("yd", HOFFSET(marker_info, yd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("zd", HOFFSET(marker_info, zd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("xdd", HOFFSET(marker_info, xdd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("ydd", HOFFSET(marker_info, ydd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("zdd", HOFFSET(marker_info, zdd), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_marker_type;
+static H5::CompType CreateMarkerType() {
+    H5::CompType type(sizeof(marker_info));
+    type.insertMember("id", HOFFSET(marker_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(marker_info, x), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("y", HOFFSET(marker_info, y), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("z", HOFFSET(marker_info, z), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("xd", HOFFSET(marker_info, xd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("yd", HOFFSET(marker_info, yd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("zd", HOFFSET(marker_info, zd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("xdd", HOFFSET(marker_info, xdd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("ydd", HOFFSET(marker_info, ydd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("zdd", HOFFSET(marker_info, zdd), H5::PredType::NATIVE_DOUBLE);
+    return type;
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getJointType() {
-    if (!m_joint_type) {
-        struct Initializer {
-            Initializer() {
-                m_joint_type = new H5::CompType(sizeof(joint_info));
-                m_joint_type->insertMember("id", HOFFSET(joint_info, id), H5::PredType::NATIVE_INT);
-                m_joint_type->insertMember("Fx", HOFFSET(joint_info, fx), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Fy", HOFFSET(joint_info, fy), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Fz", HOFFSET(joint_info, fz), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Tx", HOFFSET(joint_info, tx), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Ty", HOFFSET(joint_info, ty), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Tz", HOFFSET(joint_info, tz), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_joint_type;
+static H5::CompType CreateJointType() {
+    H5::CompType type(sizeof(joint_info));
+    type.insertMember("id", HOFFSET(joint_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("Fx", HOFFSET(joint_info, fx), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Fy", HOFFSET(joint_info, fy), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Fz", HOFFSET(joint_info, fz), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Tx", HOFFSET(joint_info, tx), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Ty", HOFFSET(joint_info, ty), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Tz", HOFFSET(joint_info, tz), H5::PredType::NATIVE_DOUBLE);
+    return type;
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getCoupleType() {
-    if (!m_couple_type) {
-        struct Initializer {
-            Initializer() {
-                m_couple_type = new H5::CompType(sizeof(couple_info));
-                m_couple_type->insertMember("id", HOFFSET(couple_info, id), H5::PredType::NATIVE_INT);
-                m_couple_type->insertMember("x", HOFFSET(couple_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("xd", HOFFSET(couple_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("xdd", HOFFSET(couple_info, xdd), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("torque1", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("torque2", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_couple_type;
+static H5::CompType CreateCoupleType() {
+    H5::CompType type(sizeof(couple_info));
+    type.insertMember("id", HOFFSET(couple_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(couple_info, x), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("xd", HOFFSET(couple_info, xd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("xdd", HOFFSET(couple_info, xdd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("torque1", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("torque2", HOFFSET(couple_info, t2), H5::PredType::NATIVE_DOUBLE);
+    return type;
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getLinSpringType() {
-    if (!m_linspring_type) {
-        struct Initializer {
-            Initializer() {
-                m_linspring_type = new H5::CompType(sizeof(linspring_info));
-                m_linspring_type->insertMember("id", HOFFSET(linspring_info, id), H5::PredType::NATIVE_INT);
-                m_linspring_type->insertMember("x", HOFFSET(linspring_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_linspring_type->insertMember("xd", HOFFSET(linspring_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_linspring_type->insertMember("force", HOFFSET(linspring_info, f), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_linspring_type;
+static H5::CompType CreateLinSpringType() {
+    H5::CompType type(sizeof(linspring_info));
+    type.insertMember("id", HOFFSET(linspring_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(linspring_info, x), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("xd", HOFFSET(linspring_info, xd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("force", HOFFSET(linspring_info, f), H5::PredType::NATIVE_DOUBLE);
+    return type;
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getRotSpringType() {
-    if (!m_rotspring_type) {
-        struct Initializer {
-            Initializer() {
-                m_rotspring_type = new H5::CompType(sizeof(rotspring_info));
-                m_rotspring_type->insertMember("id", HOFFSET(rotspring_info, id), H5::PredType::NATIVE_INT);
-                m_rotspring_type->insertMember("x", HOFFSET(rotspring_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_rotspring_type->insertMember("xd", HOFFSET(rotspring_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_rotspring_type->insertMember("force", HOFFSET(rotspring_info, t), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_rotspring_type;
+static H5::CompType CreateRotSpringType() {
+    H5::CompType type(sizeof(rotspring_info));
+    type.insertMember("id", HOFFSET(rotspring_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(rotspring_info, x), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("xd", HOFFSET(rotspring_info, xd), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("force", HOFFSET(rotspring_info, t), H5::PredType::NATIVE_DOUBLE);
+    return type;
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getBodyLoadType() {
-    if (!m_bodyload_type) {
-        struct Initializer {
-            Initializer() {
-                m_bodyload_type = new H5::CompType(sizeof(bodyload_info));
-                m_bodyload_type->insertMember("id", HOFFSET(bodyload_info, id), H5::PredType::NATIVE_INT);
-                m_bodyload_type->insertMember("Fx", HOFFSET(bodyload_info, fx), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Fy", HOFFSET(bodyload_info, fy), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Fz", HOFFSET(bodyload_info, fz), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Tx", HOFFSET(bodyload_info, tx), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Ty", HOFFSET(bodyload_info, ty), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Tz", HOFFSET(bodyload_info, tz), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
+static H5::CompType CreateBodyLoadType() {
+    H5::CompType type(sizeof(bodyload_info));
+    type.insertMember("id", HOFFSET(bodyload_info, id), H5::PredType::NATIVE_INT);
+    type.insertMember("Fx", HOFFSET(bodyload_info, fx), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Fy", HOFFSET(bodyload_info, fy), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Fz", HOFFSET(bodyload_info, fz), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Tx", HOFFSET(bodyload_info, tx), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Ty", HOFFSET(bodyload_info, ty), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("Tz", HOFFSET(bodyload_info, tz), H5::PredType::NATIVE_DOUBLE);
+    return type;
+}
+
+// -----------------------------------------------------------------------------
+
+// The HDF5 library is not thread safe. All HDF5 calls, made by the simulation threads (FRAMES layout) and by the writer
+// threads (CHUNKED layout) of all output databases, are serialized with this lock.
+static std::mutex& HDF5Mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// -----------------------------------------------------------------------------
+
+// Create an extendable dataset with one row per frame, each with 'count' records (a 1D dataset if count = 0).
+static H5::DataSet CreateChunkedDataSet(H5::H5File& file,
+                                        const std::string& path,
+                                        const H5::DataType& type,
+                                        hsize_t count,
+                                        hsize_t chunk_frames,
+                                        int compression) {
+    int rank = count > 0 ? 2 : 1;
+    hsize_t dims[] = {0, count};
+    hsize_t maxdims[] = {H5S_UNLIMITED, count};
+    hsize_t chunk[] = {chunk_frames, count};
+    H5::DataSpace dataspace(rank, dims, maxdims);
+
+    H5::DSetCreatPropList plist;
+    plist.setChunk(rank, chunk);
+    if (compression > 0)
+        plist.setDeflate(compression);
+
+    return file.createDataSet(path, type, dataspace, plist);
+}
+
+// Write the records of the specified frame (row) in a dataset created with CreateChunkedDataSet.
+// Rows of frames not written to this dataset are left at the default fill value (zero).
+static void WriteChunkedRow(H5::DataSet& set, hsize_t row, hsize_t count, const H5::DataType& type, const void* data) {
+    int rank = count > 0 ? 2 : 1;
+    hsize_t dims[2];
+    set.getSpace().getSimpleExtentDims(dims);
+    if (dims[0] <= row) {
+        dims[0] = row + 1;
+        set.extend(dims);
     }
-    return *m_bodyload_type;
+
+    hsize_t offset[] = {row, 0};
+    hsize_t size[] = {1, count};
+    H5::DataSpace filespace = set.getSpace();
+    filespace.selectHyperslab(H5S_SELECT_SET, size, offset);
+    H5::DataSpace memspace(rank, size);
+    set.write(data, type, memspace, filespace);
 }
 
 // -----------------------------------------------------------------------------
 
-ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename)
-    : m_frame_group(nullptr), m_section_group(nullptr) {
+ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename,
+                                         Layout layout,
+                                         int num_buffers,
+                                         int chunk_frames,
+                                         int compression)
+    : m_layout(layout),
+      m_frame_group(nullptr),
+      m_section_group(nullptr),
+      m_chunk_frames(std::max(chunk_frames, 1)),
+      m_compression(compression),
+      m_current(-1),
+      m_stop(false),
+      m_num_frames(0) {
+    std::lock_guard<std::mutex> h5_lock(HDF5Mutex());
+
     m_fileHDF5 = new H5::H5File(filename, H5F_ACC_TRUNC);
-    H5::Group frames_group(m_fileHDF5->createGroup("/Frames"));
+
+    // Create all record types here, so that the simulation thread does not make any HDF5 calls in the CHUNKED layout
+    m_body_type = CreateBodyType();
+    m_bodyaux_type = CreateBodyAuxType();
+    m_shaft_type = CreateShaftType();
+    m_marker_type = CreateMarkerType();
+    m_joint_type = CreateJointType();
+    m_couple_type = CreateCoupleType();
+    m_linspring_type = CreateLinSpringType();
+    m_rotspring_type = CreateRotSpringType();
+    m_bodyload_type = CreateBodyLoadType();
+
+    if (m_layout == Layout::FRAMES) {
+        H5::Group frames_group(m_fileHDF5->createGroup("/Frames"));
+        return;
+    }
+
+    m_h5_frame = CreateChunkedDataSet(*m_fileHDF5, "/Frame", H5::PredType::NATIVE_INT, 0, m_chunk_frames, 0);
+    m_h5_time = CreateChunkedDataSet(*m_fileHDF5, "/Time", H5::PredType::NATIVE_DOUBLE, 0, m_chunk_frames, 0);
+
+    m_buffers.resize(std::max(num_buffers, 2));
+    for (int i = 0; i < (int)m_buffers.size(); i++)
+        m_free.push_back(i);
+
+    m_writer = std::thread(&ChVehicleOutputHDF5::WriterLoop, this);
 }
 
 ChVehicleOutputHDF5::~ChVehicleOutputHDF5() {
+    if (m_writer.joinable()) {
+        // Write the last frame and wait for the writer thread to finish
+        if (m_current >= 0)
+            SubmitFrame();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv_full.notify_one();
+        m_writer.join();
+    }
+
+    std::lock_guard<std::mutex> h5_lock(HDF5Mutex());
+
+    m_h5_datasets.clear();
+    m_h5_frame.close();
+    m_h5_time.close();
+
     if (m_section_group)
         m_section_group->close();
     if (m_frame_group)
@@ -296,15 +331,17 @@ ChVehicleOutputHDF5::~ChVehicleOutputHDF5() {
     delete m_section_group;
     delete m_frame_group;
     delete m_fileHDF5;
-    
-    delete m_body_type;
-    delete m_bodyaux_type;
-    delete m_shaft_type;
-    delete m_marker_type;
-    delete m_joint_type;
-    delete m_couple_type;
-    delete m_linspring_type;
-    delete m_rotspring_type;
+
+    // Release the record types while holding the HDF5 lock (their destructors would do so without it)
+    m_body_type.close();
+    m_bodyaux_type.close();
+    m_shaft_type.close();
+    m_marker_type.close();
+    m_joint_type.close();
+    m_couple_type.close();
+    m_linspring_type.close();
+    m_rotspring_type.close();
+    m_bodyload_type.close();
 }
 
 // -----------------------------------------------------------------------------
@@ -318,6 +355,33 @@ std::string format_number(int num, int precision) {
 // -----------------------------------------------------------------------------
 
 void ChVehicleOutputHDF5::WriteTime(int frame, double time) {
+    if (m_layout == Layout::CHUNKED) {
+        // Hand the previous frame over to the writer thread and acquire a free frame buffer
+        if (m_current >= 0)
+            SubmitFrame();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_error) {
+            auto error = m_error;
+            m_error = nullptr;
+            std::rethrow_exception(error);
+        }
+        m_cv_free.wait(lock, [this]() { return !m_free.empty(); });
+        m_current = m_free.front();
+        m_free.pop_front();
+        lock.unlock();
+
+        auto& buffer = m_buffers[m_current];
+        buffer.frame = frame;
+        buffer.time = time;
+        buffer.blocks.clear();
+        buffer.data.clear();
+        m_section.clear();
+        return;
+    }
+
+    std::lock_guard<std::mutex> h5_lock(HDF5Mutex());
+
     // Close the currently open section group
     if (m_section_group) {
         m_section_group->close();
@@ -346,6 +410,13 @@ void ChVehicleOutputHDF5::WriteTime(int frame, double time) {
 }
 
 void ChVehicleOutputHDF5::WriteSection(const std::string& name) {
+    if (m_layout == Layout::CHUNKED) {
+        m_section = name;
+        return;
+    }
+
+    std::lock_guard<std::mutex> h5_lock(HDF5Mutex());
+
     // Close the currently open section group
     if (m_section_group) {
         m_section_group->close();
@@ -357,164 +428,238 @@ void ChVehicleOutputHDF5::WriteSection(const std::string& name) {
     m_section_group = new H5::Group(m_frame_group->createGroup(name));
 }
 
+// -----------------------------------------------------------------------------
+
+void* ChVehicleOutputHDF5::Reserve(const std::string& name, const H5::CompType& type, size_t count, size_t size) {
+    if (m_layout == Layout::FRAMES) {
+        m_records.resize(count * size);
+        return m_records.data();
+    }
+
+    if (m_current < 0)
+        throw ChException("ChVehicleOutputHDF5: output records written before the output time");
+
+    // Find the dataset for this section and data type, or register a new one
+    std::string path = m_section + "/" + name;
+    auto it = m_dataset_id.find(path);
+    int id;
+    if (it == m_dataset_id.end()) {
+        id = (int)m_datasets.size();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_datasets.push_back({m_section, name, &type, count, size});
+        }
+        m_dataset_id.insert({path, id});
+    } else {
+        id = it->second;
+        if (m_datasets[id].count != count)
+            throw ChException("ChVehicleOutputHDF5: number of records in '" + path + "' changed");
+    }
+
+    // Append the records at the end of the current frame buffer
+    auto& buffer = m_buffers[m_current];
+    size_t offset = buffer.data.size();
+    buffer.data.resize(offset + count * size);
+    buffer.blocks.push_back({id, offset});
+    return buffer.data.data() + offset;
+}
+
+template <typename T, typename F>
+void ChVehicleOutputHDF5::Write(const std::string& name, const H5::CompType& type, size_t count, F&& fill) {
+    // Records of different types are packed in the same frame buffer
+    static_assert(sizeof(T) % alignof(double) == 0, "record size must preserve the alignment of the next record");
+
+    T* records = static_cast<T*>(Reserve(name, type, count, sizeof(T)));
+    for (size_t i = 0; i < count; i++)
+        records[i] = fill(i);
+
+    if (m_layout == Layout::FRAMES) {
+        std::lock_guard<std::mutex> h5_lock(HDF5Mutex());
+        hsize_t dim[] = {count};
+        H5::DataSpace dataspace(1, dim);
+        H5::DataSet set = m_section_group->createDataSet(name, type, dataspace);
+        set.write(records, type);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputHDF5::SubmitFrame() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_full.push_back(m_current);
+    }
+    m_current = -1;
+    m_cv_full.notify_one();
+}
+
+void ChVehicleOutputHDF5::WriterLoop() {
+    bool failed = false;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv_full.wait(lock, [this]() { return m_stop || !m_full.empty(); });
+        if (m_full.empty())
+            break;
+        int current = m_full.front();
+        m_full.pop_front();
+
+        // Pick up the datasets registered since the last frame
+        m_h5_info.insert(m_h5_info.end(), m_datasets.begin() + m_h5_info.size(), m_datasets.end());
+        lock.unlock();
+
+        // Stop writing after an error, but keep releasing the frame buffers
+        if (!failed) {
+            try {
+                std::lock_guard<std::mutex> h5_lock(HDF5Mutex());
+                WriteFrame(m_buffers[current]);
+            } catch (...) {
+                lock.lock();
+                m_error = std::current_exception();
+                lock.unlock();
+                failed = true;
+            }
+        }
+
+        lock.lock();
+        m_free.push_back(current);
+        m_cv_free.notify_one();
+    }
+    lock.unlock();
+
+    // Extend all datasets to the number of frames written
+    try {
+        std::lock_guard<std::mutex> h5_lock(HDF5Mutex());
+        for (auto& set : m_h5_datasets) {
+            hsize_t dims[2];
+            set.getSpace().getSimpleExtentDims(dims);
+            dims[0] = m_num_frames;
+            set.extend(dims);
+        }
+    } catch (...) {
+    }
+}
+
+void ChVehicleOutputHDF5::WriteFrame(const FrameBuffer& buffer) {
+    // Create the datasets registered since the last frame
+    while (m_h5_datasets.size() < m_h5_info.size()) {
+        const auto& info = m_h5_info[m_h5_datasets.size()];
+        std::string path = "/" + info.name;
+        if (!info.section.empty()) {
+            if (m_h5_groups.insert(info.section).second)
+                m_fileHDF5->createGroup("/" + info.section);
+            path = "/" + info.section + path;
+        }
+        m_h5_datasets.push_back(
+            CreateChunkedDataSet(*m_fileHDF5, path, *info.type, info.count, m_chunk_frames, m_compression));
+    }
+
+    hsize_t row = m_num_frames;
+    WriteChunkedRow(m_h5_frame, row, 0, H5::PredType::NATIVE_INT, &buffer.frame);
+    WriteChunkedRow(m_h5_time, row, 0, H5::PredType::NATIVE_DOUBLE, &buffer.time);
+    for (const auto& block : buffer.blocks) {
+        const auto& info = m_h5_info[block.dataset];
+        WriteChunkedRow(m_h5_datasets[block.dataset], row, info.count, *info.type, buffer.data.data() + block.offset);
+    }
+    m_num_frames++;
+}
+
+// -----------------------------------------------------------------------------
+
 void ChVehicleOutputHDF5::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
     if (bodies.empty())
         return;
 
-    auto nbodies = bodies.size();
-    hsize_t dim[] = {nbodies};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<body_info> info(nbodies);
-    for (auto i = 0; i < nbodies; i++) {
+    Write<body_info>("Bodies", m_body_type, bodies.size(), [&](size_t i) -> body_info {
         const ChVector<>& p = bodies[i]->GetPos();
         const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Bodies", getBodyType(), dataspace);
-    set.write(info.data(), getBodyType());
+        return {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+    });
 }
 
 void ChVehicleOutputHDF5::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
     if (bodies.empty())
         return;
 
-    auto nbodies = bodies.size();
-    hsize_t dim[] = { nbodies };
-    H5::DataSpace dataspace(1, dim);
-    std::vector<bodyaux_info> info(nbodies);
-    for (auto i = 0; i < nbodies; i++) {
+    Write<bodyaux_info>("Bodies AuxRef", m_bodyaux_type, bodies.size(), [&](size_t i) -> bodyaux_info {
         const ChVector<>& p = bodies[i]->GetPos();
         const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = { bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3() };
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Bodies AuxRef", getBodyAuxType(), dataspace);
-    set.write(info.data(), getBodyAuxType());
+        return {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+    });
 }
 
 void ChVehicleOutputHDF5::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
     if (markers.empty())
         return;
 
-    auto nmarkers = markers.size();
-    hsize_t dim[] = {nmarkers};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<marker_info> info(nmarkers);
-    for (auto i = 0; i < nmarkers; i++) {
+    Write<marker_info>("Markers", m_marker_type, markers.size(), [&](size_t i) -> marker_info {
         const ChVector<>& p = markers[i]->GetAbsCoord().pos;
         const ChVector<>& pd = markers[i]->GetAbsCoord_dt().pos;
         const ChVector<>& pdd = markers[i]->GetAbsCoord_dtdt().pos;
-        info[i] = {markers[i]->GetIdentifier(), p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Markers", getMarkerType(), dataspace);
-    set.write(info.data(), getMarkerType());
+        return {markers[i]->GetIdentifier(), p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
+    });
 }
 
 void ChVehicleOutputHDF5::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
     if (shafts.empty())
         return;
 
-    auto nshafts = shafts.size();
-    hsize_t dim[] = {nshafts};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<shaft_info> info(nshafts);
-    for (auto i = 0; i < nshafts; i++) {
-        info[i] = {shafts[i]->GetIdentifier(), shafts[i]->GetPos(), shafts[i]->GetPos_dt(), shafts[i]->GetPos_dtdt(),
-                   shafts[i]->GetAppliedTorque()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Shafts", getShaftType(), dataspace);
-    set.write(info.data(), getShaftType());
+    Write<shaft_info>("Shafts", m_shaft_type, shafts.size(), [&](size_t i) -> shaft_info {
+        return {shafts[i]->GetIdentifier(), shafts[i]->GetPos(), shafts[i]->GetPos_dt(), shafts[i]->GetPos_dtdt(),
+                shafts[i]->GetAppliedTorque()};
+    });
 }
 
 void ChVehicleOutputHDF5::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
     if (joints.empty())
         return;
 
-    auto njoints = joints.size();
-    hsize_t dim[] = { njoints };
-    H5::DataSpace dataspace(1, dim);
-    std::vector<joint_info> info(njoints);
-    for (auto i = 0; i < njoints; i++) {
+    Write<joint_info>("Joints", m_joint_type, joints.size(), [&](size_t i) -> joint_info {
         const ChVector<>& f = joints[i]->Get_react_force();
         const ChVector<>& t = joints[i]->Get_react_torque();
-        info[i] = { joints[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z() };
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Joints", getJointType(), dataspace);
-    set.write(info.data(), getJointType());
+        return {joints[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
+    });
 }
 
 void ChVehicleOutputHDF5::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
     if (couples.empty())
         return;
 
-    auto ncouples = couples.size();
-    hsize_t dim[] = {ncouples};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<couple_info> info(ncouples);
-    for (auto i = 0; i < ncouples; i++) {
-        info[i] = {couples[i]->GetIdentifier(),          couples[i]->GetRelativeRotation(),
-                   couples[i]->GetRelativeRotation_dt(), couples[i]->GetRelativeRotation_dtdt(),
-                   couples[i]->GetTorqueReactionOn1(),   couples[i]->GetTorqueReactionOn2()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Couples", getCoupleType(), dataspace);
-    set.write(info.data(), getCoupleType());
+    Write<couple_info>("Couples", m_couple_type, couples.size(), [&](size_t i) -> couple_info {
+        return {couples[i]->GetIdentifier(),          couples[i]->GetRelativeRotation(),
+                couples[i]->GetRelativeRotation_dt(), couples[i]->GetRelativeRotation_dtdt(),
+                couples[i]->GetTorqueReactionOn1(),   couples[i]->GetTorqueReactionOn2()};
+    });
 }
 
 void ChVehicleOutputHDF5::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
     if (springs.empty())
         return;
 
-    auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<linspring_info> info(nsprings);
-    for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetLength(), springs[i]->GetVelocity(),
-                   springs[i]->GetForce()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Lin Springs", getLinSpringType(), dataspace);
-    set.write(info.data(), getLinSpringType());
+    Write<linspring_info>("Lin Springs", m_linspring_type, springs.size(), [&](size_t i) -> linspring_info {
+        return {springs[i]->GetIdentifier(), springs[i]->GetLength(), springs[i]->GetVelocity(),
+                springs[i]->GetForce()};
+    });
 }
 
 void ChVehicleOutputHDF5::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
     if (springs.empty())
         return;
 
-    auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<rotspring_info> info(nsprings);
-    for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetAngle(), springs[i]->GetVelocity(),
-                   springs[i]->GetTorque()};
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Rot Springs", getRotSpringType(), dataspace);
-    set.write(info.data(), getRotSpringType());
+    Write<rotspring_info>("Rot Springs", m_rotspring_type, springs.size(), [&](size_t i) -> rotspring_info {
+        return {springs[i]->GetIdentifier(), springs[i]->GetAngle(), springs[i]->GetVelocity(),
+                springs[i]->GetTorque()};
+    });
 }
 
 void ChVehicleOutputHDF5::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
     if (loads.empty())
         return;
 
-    auto nloads = loads.size();
-    hsize_t dim[] = { nloads };
-    H5::DataSpace dataspace(1, dim);
-    std::vector<bodyload_info> info(nloads);
-    for (auto i = 0; i < nloads; i++) {
+    Write<bodyload_info>("Body-body Loads", m_bodyload_type, loads.size(), [&](size_t i) -> bodyload_info {
         ChVector<> f = loads[i]->GetForce();
         ChVector<> t = loads[i]->GetTorque();
-        info[i] = { loads[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z() };
-    }
-
-    H5::DataSet set = m_section_group->createDataSet("Body-body Loads", getBodyLoadType(), dataspace);
-    set.write(info.data(), getBodyLoadType());
+        return {loads[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
+    });
 }
 
 }  // end namespace vehicle
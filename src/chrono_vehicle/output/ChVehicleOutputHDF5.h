@@ -21,6 +21,14 @@
 
 #include <string>
 #include <fstream>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 #include "chrono_vehicle/ChVehicleOutput.h"
 
@@ -33,9 +41,28 @@ namespace vehicle {
 /// @{
 
 /// HDF5 vehicle output database.
+/// Two file layouts are supported:
+/// - FRAMES: one group per output frame (/Frames/Frame_NNNNNN/<section>/<data>), written from the simulation thread.
+/// - CHUNKED: one extendable 2D dataset (frame x record) per section and data type (/<section>/<data>), with the output
+///   frames and times in /Frame and /Time. The simulation thread only copies the output records in one of a set of
+///   preallocated frame buffers; a background thread appends them to chunked (and optionally compressed) datasets.
+///   The number of records of a given dataset cannot change during the simulation.
+/// The HDF5 calls of all instances (including their writer threads) are serialized with a process-wide lock, so that
+/// several output databases can be used concurrently.
 class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
   public:
-    ChVehicleOutputHDF5(const std::string& filename);
+    /// Layout of the HDF5 output file.
+    enum class Layout {
+        FRAMES,  ///< one group per output frame, written synchronously
+        CHUNKED  ///< one chunked dataset per section and data type, written asynchronously
+    };
+
+    ChVehicleOutputHDF5(const std::string& filename,     ///< [in] name of the output file
+                        Layout layout = Layout::FRAMES,  ///< [in] file layout
+                        int num_buffers = 2,             ///< [in] number of frame buffers (CHUNKED layout, min. 2)
+                        int chunk_frames = 64,           ///< [in] number of frames per chunk (CHUNKED layout)
+                        int compression = 0              ///< [in] deflate level, 0 for none (CHUNKED layout)
+    );
     ~ChVehicleOutputHDF5();
 
   private:
@@ -52,29 +79,81 @@ class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
     virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
     virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
 
+    /// Return storage for the output records of the specified data type in the current section.
+    void* Reserve(const std::string& name, const H5::CompType& type, size_t count, size_t size);
+
+    /// Fill and write the output records of the specified data type in the current section.
+    template <typename T, typename F>
+    void Write(const std::string& name, const H5::CompType& type, size_t count, F&& fill);
+
+    /// Output records of one dataset in a frame buffer.
+    struct Block {
+        int dataset;    ///< dataset index
+        size_t offset;  ///< offset of the first record in the frame buffer data
+    };
+
+    /// Output records of one frame (CHUNKED layout).
+    struct FrameBuffer {
+        int frame;                  ///< output frame
+        double time;                ///< output time
+        std::vector<Block> blocks;  ///< record blocks, one per dataset written in this frame
+        std::vector<char> data;     ///< record data (reused from frame to frame)
+    };
+
+    /// Chunked dataset (CHUNKED layout).
+    struct Dataset {
+        std::string section;       ///< section (group) name
+        std::string name;          ///< dataset name
+        const H5::CompType* type;  ///< record type
+        size_t count;              ///< number of records per frame
+        size_t size;               ///< record size
+    };
+
+    void SubmitFrame();
+    void WriterLoop();
+    void WriteFrame(const FrameBuffer& buffer);
+
+    Layout m_layout;  ///< file layout
+
     H5::H5File* m_fileHDF5;
     H5::Group* m_frame_group;
     H5::Group* m_section_group;
 
-    static H5::CompType* m_body_type;
-    static H5::CompType* m_bodyaux_type;
-    static H5::CompType* m_shaft_type;
-    static H5::CompType* m_marker_type;
-    static H5::CompType* m_joint_type;
-    static H5::CompType* m_couple_type;
-    static H5::CompType* m_linspring_type;
-    static H5::CompType* m_rotspring_type;
-    static H5::CompType* m_bodyload_type;
-
-    static const H5::CompType& getBodyType();
-    static const H5::CompType& getBodyAuxType();
-    static const H5::CompType& getShaftType();
-    static const H5::CompType& getMarkerType();
-    static const H5::CompType& getJointType();
-    static const H5::CompType& getCoupleType();
-    static const H5::CompType& getLinSpringType();
-    static const H5::CompType& getRotSpringType();
-    static const H5::CompType& getBodyLoadType();
+    std::vector<char> m_records;  ///< record storage (FRAMES layout)
+
+    std::string m_section;                    ///< current section (CHUNKED layout)
+    std::map<std::string, int> m_dataset_id;  ///< dataset index by path (CHUNKED layout)
+    std::vector<Dataset> m_datasets;          ///< registered datasets (CHUNKED layout)
+    int m_chunk_frames;                       ///< number of frames per chunk
+    int m_compression;                        ///< deflate level
+
+    std::vector<FrameBuffer> m_buffers;  ///< preallocated frame buffers
+    int m_current;                       ///< buffer of the frame being recorded (-1 if none)
+    std::deque<int> m_free;              ///< buffers available to the simulation thread
+    std::deque<int> m_full;              ///< buffers waiting to be written
+    bool m_stop;                         ///< signal the writer thread to exit once all buffers are written
+    std::exception_ptr m_error;          ///< exception thrown in the writer thread
+    std::mutex m_mutex;
+    std::condition_variable m_cv_free;
+    std::condition_variable m_cv_full;
+    std::thread m_writer;
+
+    std::vector<Dataset> m_h5_info;          ///< copy of the registered datasets (writer thread)
+    std::vector<H5::DataSet> m_h5_datasets;  ///< created datasets (writer thread)
+    std::set<std::string> m_h5_groups;       ///< created section groups (writer thread)
+    H5::DataSet m_h5_frame;                  ///< output frames (writer thread)
+    H5::DataSet m_h5_time;                   ///< output times (writer thread)
+    hsize_t m_num_frames;                    ///< number of frames written (writer thread)
+
+    H5::CompType m_body_type;
+    H5::CompType m_bodyaux_type;
+    H5::CompType m_shaft_type;
+    H5::CompType m_marker_type;
+    H5::CompType m_joint_type;
+    H5::CompType m_couple_type;
+    H5::CompType m_linspring_type;
+    H5::CompType m_rotspring_type;
+    H5::CompType m_bodyload_type;
 };
 
 /// @} vehicle
@@ -720,16 +720,15 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector<>& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2<int> ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid map
+    if (const auto* nr = m_grid_map.Find(ij)) {
+        ni.sinkage = nr->sinkage;
+        ni.sinkage_plastic = nr->sinkage_plastic;
+        ni.sinkage_elastic = nr->sinkage_elastic;
+        ni.sigma = nr->sigma;
+        ni.sigma_yield = nr->sigma_yield;
+        ni.kshear = nr->kshear;
+        ni.tau = nr->tau;
         return ni;
     }
 
@@ -813,10 +812,9 @@ ChVector<> SCMLoader::GetInitNormal(const ChVector2<int>& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2<int>& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid map
+    if (const auto* nr = m_grid_map.Find(loc))
+        return nr->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -1031,10 +1029,6 @@ static const std::vector<ChVector2<int>> neighbors4{
     ChVector2<int>(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
-////#define RAY_CASTING_WITH_CRITICAL_SECTION
-
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMLoader::ComputeInternalForces() {
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
@@ -1043,8 +1037,7 @@ void SCMLoader::ComputeInternalForces() {
 
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
-    for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+    m_grid_map.ForEachModified([&](const ChVector2<int>& ij, NodeRecord& nr) {
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1057,9 +1050,9 @@ void SCMLoader::ComputeInternalForces() {
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);
         }
-    }
+    });
 
-    m_modified_nodes.clear();
+    m_grid_map.ClearModified();
 
     // Reset timers
     m_timer_moving_patches.reset();
@@ -1114,74 +1107,25 @@ void SCMLoader::ComputeInternalForces() {
 
     m_timer_ray_casting.start();
 
-#ifdef RAY_CASTING_WITH_CRITICAL_SECTION
-
-    int nthreads = GetSystem()->GetNumThreadsChrono();
-
-    // Loop through all moving patches (user-defined or default one)
-    for (auto& p : m_patches) {
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            ChVector2<int> ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z;
-    #pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
-
-            ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
-
-            // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
-
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-    #pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
-
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
-                }
-            }
-        }
-        m_num_ray_casts += num_ray_casts;
-    }
-
-#else
-
-    // Map-reduce approach (to eliminate critical section)
-
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2<int>, HitRecord, CoordHash>> t_hits(nthreads);
+
+    // Rays cast from the grid nodes in the current patch range, with the corresponding node indices.
+    // All rays in a patch are traced together, in the (spatially coherent) order of the patch range.
+    std::vector<ChCollisionSystem::ChRay> rays;
+    std::vector<ChCollisionSystem::ChRayhitResult> ray_results;
+    std::vector<ChVector2<int>> ray_nodes;
+    std::vector<char> ray_active;
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
+        // Create rays at all vertices in the patch range
+        int num_nodes = (int)p.m_range.size();
+        rays.resize(num_nodes);
+        ray_active.resize(num_nodes);
+    #pragma omp parallel for num_threads(nthreads)
+        for (int k = 0; k < num_nodes; k++) {
             ChVector2<int> ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
@@ -1192,48 +1136,51 @@ void SCMLoader::ComputeInternalForces() {
             ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
 
             // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
+            rays[k].to = vertex_abs + m_Z * m_test_offset_up;
+            rays[k].from = rays[k].to - m_Z * m_test_offset_down;
 
             // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+            ray_active[k] = !m_moving_patch || RayOBBtest(p, rays[k].from, m_Z);
+        }
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
-            }
+        // Compact the list of rays which passed the quick rejection test
+        int num_ray_casts = 0;
+        ray_nodes.clear();
+        for (int k = 0; k < num_nodes; k++) {
+            if (!ray_active[k])
+                continue;
+            rays[num_ray_casts++] = rays[k];
+            ray_nodes.push_back(p.m_range[k]);
         }
+        rays.resize(num_ray_casts);
+
+        // Cast all rays into collision system
+        GetSystem()->GetCollisionSystem()->RayHitBatch(rays, ray_results, nthreads);
 
         m_timer_ray_testing.stop();
 
         m_num_ray_casts += num_ray_casts;
 
         // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
-                }
-                ////hits.insert(h);
+        for (int k = 0; k < num_ray_casts; k++) {
+            if (!ray_results[k].hit)
+                continue;
+
+            const auto& ij = ray_nodes[k];
+
+            // If this is the first hit from this node, initialize the node record
+            if (!m_grid_map.Find(ij)) {
+                double z = GetInitHeight(ij);
+                m_grid_map.Insert(ij, NodeRecord(z, z, GetInitNormal(ij)));
             }
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+            // Add to our map of hits to process
+            HitRecord record = {ray_results[k].hitModel->GetContactable(), ray_results[k].abs_hitPoint, -1};
+            hits.insert(std::make_pair(ij, record));
         }
         m_num_ray_hits = (int)hits.size();
     }
 
-#endif
-
     m_timer_ray_casting.stop();
 
     // --------------------
@@ -1364,7 +1311,7 @@ void SCMLoader::ComputeInternalForces() {
         }
 
         // Mark current node as modified
-        m_modified_nodes.push_back(ij);
+        m_grid_map.SetModified(ij);
 
         // Calculate velocity at touched grid node
         ChVector<> point_local(ij.x() * m_delta, ij.y() * m_delta, nr.level);
@@ -1533,9 +1480,10 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
+                    const auto* nbr_nr = m_grid_map.Find(nbr_ij);     //     neighbor record
+                    if (!nbr_nr)                                      //     if neighbor not yet recorded
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
+                    else if (nbr_nr->sigma <= 0)                      //     if neighbor not touched
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
                 }
             }
@@ -1545,17 +1493,16 @@ void SCMLoader::ComputeInternalForces() {
             double diff = m_flow_factor * tot_step_flow / p_boundary.size();
 
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
-            for (const auto& ij : p_boundary) {                                  // for each node in bndry
-                m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
-                    double z = GetInitHeight(ij);                                //     undeformed height
-                    const ChVector<>& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
-                    m_modified_nodes.push_back(ij);                              //     mark as modified
-                }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
-                nr.erosion = true;                                               //   add to erosion domain
-                AddMaterialToNode(diff, nr);                                     //   add raise amount
+            for (const auto& ij : p_boundary) {                   // for each node in bndry
+                if (!m_grid_map.Find(ij)) {                       //   if not yet recorded
+                    double z = GetInitHeight(ij);                 //     undeformed height
+                    const ChVector<>& n = GetInitNormal(ij);      //     terrain normal
+                    m_grid_map.Insert(ij, NodeRecord(z, z, n));   //     add new node record
+                }                                                 //
+                m_grid_map.SetModified(ij);                       //   mark as modified
+                auto& nr = m_grid_map.at(ij);                     //   node record
+                nr.erosion = true;                                //   add to erosion domain
+                AddMaterialToNode(diff, nr);                      //   add raise amount
             }
 
             // Accumulate boundary
@@ -1577,20 +1524,21 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    NodeRecord* rec = m_grid_map.Find(nbr_ij);          //   neighbor record
+                    if (!rec) {                                         //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector<>& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid_map.Insert(nbr_ij, nr);                  //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
-                        m_modified_nodes.push_back(nbr_ij);             //     mark as modified
+                        m_grid_map.SetModified(nbr_ij);                 //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = *rec;                          //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
-                            m_modified_nodes.push_back(nbr_ij);         //       mark as modified
+                            m_grid_map.SetModified(nbr_ij);             //       mark as modified
                         }
                     }
                 }
@@ -1610,10 +1558,10 @@ void SCMLoader::ComputeInternalForces() {
                 auto& nr = m_grid_map.at(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid_map.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1655,16 +1603,15 @@ void SCMLoader::ComputeInternalForces() {
     if (m_trimesh_shape) {
         // Loop over list of modified nodes and adjust corresponding mesh vertices.
         // If not rendering a wireframe mesh, also update normals.
-        for (const auto& ij : m_modified_nodes) {
+        m_grid_map.ForEachModified([&](const ChVector2<int>& ij, const NodeRecord& nr) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
-                continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+                return;                               //   do nothing
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
             if (!m_trimesh_shape->IsWireframe())      // if not wireframe
                 UpdateMeshVertexNormal(ij, iv);       // update vertex normal
-        }
+        });
 
         m_trimesh_shape->SetModifiedVertices(modified_vertices);
     }
@@ -1780,16 +1727,14 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2<int> ij, int iv) {
 // Get the heights of modified grid nodes.
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
+    auto add_node = [&nodes](const ChVector2<int>& ij, const NodeRecord& nr) {
+        nodes.push_back(std::make_pair(ij, nr.level));
+    };
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        nodes.reserve(m_grid_map.size());
+        m_grid_map.ForEach(add_node);
     } else {
-        for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
-        }
+        m_grid_map.ForEachModified(add_node);
     }
     return nodes;
 }
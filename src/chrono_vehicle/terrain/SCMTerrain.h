@@ -36,6 +36,7 @@
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/terrain/SCMTiledGrid.h"
 #include "chrono_vehicle/ChWorldFrame.h"
 
 namespace chrono {
@@ -546,8 +547,7 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     ChMatrixDynamic<> m_heights;  ///< (base) grid heights (when initializing from height-field map)
     double m_base_height;         ///< default height for vertices outside the projection of input mesh
 
-    std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_grid_map;  ///< modified grid nodes (persistent)
-    std::vector<ChVector2<int>> m_modified_nodes;                          ///< modified grid nodes (current)
+    SCMTiledGrid<NodeRecord> m_grid_map;  ///< modified grid nodes (persistent), flagging nodes modified over last step
 
     std::vector<MovingPatchInfo> m_patches;  ///< set of active moving patches
     bool m_moving_patch;                     ///< user-specified moving patches?
@@ -0,0 +1,267 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Sparse storage for records attached to the nodes of an unbounded 2D integer
+// grid, organized in dense square tiles allocated on demand.
+//
+// =============================================================================
+
+#ifndef SCM_TILED_GRID_H
+#define SCM_TILED_GRID_H
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChVector2.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_terrain
+/// @{
+
+/// Sparse tiled storage for records of type T at the nodes of an unbounded 2D integer grid.
+/// The grid is partitioned in square tiles of 2^LOG2_TILE x 2^LOG2_TILE nodes. A tile is created the first time one of
+/// its nodes is inserted, and tiles are addressed through a compact index obtained from a hash map with one entry per
+/// tile (instead of one entry per node). Within a tile, per-node occupancy is tracked with a bit mask and records are
+/// stored contiguously, in order of insertion, with a small per-node slot index. As such, a tile only stores records
+/// for its inserted nodes, and the memory overhead per tile is 2 bytes per node (plus the bit masks).\n
+/// Inserting a node may relocate the records of the other nodes in the same tile: pointers and references to records
+/// are invalidated by insertions (but not by lookups or modification flags).\n
+/// In addition, the grid maintains a set of "modified" nodes (again as per-tile bit masks, plus the list of tiles with
+/// at least one modified node), which can be traversed and cleared without touching the rest of the grid.\n
+/// Concurrent read-only access (Find, ForEach) is thread safe; insertions are not.
+template <typename T, int LOG2_TILE = 4>
+class SCMTiledGrid {
+    static_assert(LOG2_TILE > 0 && LOG2_TILE <= 8, "SCMTiledGrid: tile slot indices are 16-bit");
+
+  public:
+    SCMTiledGrid() : m_num_nodes(0) {}
+
+    /// Return the number of nodes with a record in the grid.
+    size_t size() const { return m_num_nodes; }
+
+    /// Return the number of allocated tiles.
+    size_t GetNumTiles() const { return m_tiles.size(); }
+
+    /// Remove all records and release all tiles.
+    void clear() {
+        m_tiles.clear();
+        m_tile_index.clear();
+        m_modified_tiles.clear();
+        m_num_nodes = 0;
+    }
+
+    /// Return a pointer to the record at the specified node, or nullptr if the node was not recorded.
+    T* Find(const ChVector2<int>& ij) {
+        Tile* tile = FindTile(ij);
+        if (!tile)
+            return nullptr;
+        int k = LocalIndex(ij);
+        return tile->IsSet(tile->occupied, k) ? &tile->data[tile->slot[k]] : nullptr;
+    }
+
+    const T* Find(const ChVector2<int>& ij) const { return const_cast<SCMTiledGrid*>(this)->Find(ij); }
+
+    /// Return a reference to the record at the specified node. Throws an exception if the node was not recorded.
+    T& at(const ChVector2<int>& ij) {
+        T* rec = Find(ij);
+        if (!rec)
+            throw std::out_of_range("SCMTiledGrid::at");
+        return *rec;
+    }
+
+    const T& at(const ChVector2<int>& ij) const { return const_cast<SCMTiledGrid*>(this)->at(ij); }
+
+    /// Insert the given record at the specified node, if the node was not already recorded.
+    /// Return a reference to the record at that node and a flag indicating whether insertion took place.
+    std::pair<T*, bool> Insert(const ChVector2<int>& ij, const T& rec) {
+        Tile* tile = GetTile(ij);
+        int k = LocalIndex(ij);
+        if (tile->IsSet(tile->occupied, k))
+            return std::make_pair(&tile->data[tile->slot[k]], false);
+        tile->Set(tile->occupied, k);
+        tile->slot[k] = static_cast<uint16_t>(tile->data.size());
+        tile->data.push_back(rec);
+        m_num_nodes++;
+        return std::make_pair(&tile->data.back(), true);
+    }
+
+    /// Return a reference to the record at the specified node, inserting a default record if not already recorded.
+    T& operator[](const ChVector2<int>& ij) { return *Insert(ij, T()).first; }
+
+    /// Apply the given function, with signature f(const ChVector2<int>&, T&), to all recorded nodes.
+    /// Nodes are visited tile by tile, in order of tile allocation.
+    template <typename Func>
+    void ForEach(Func f) {
+        for (auto& tile : m_tiles)
+            tile->Visit(tile->occupied, f);
+    }
+
+    /// Apply the given function, with signature f(const ChVector2<int>&, const T&), to all recorded nodes.
+    template <typename Func>
+    void ForEach(Func f) const {
+        for (const auto& tile : m_tiles)
+            static_cast<const Tile&>(*tile).Visit(tile->occupied, f);
+    }
+
+    /// Mark the specified node as modified. The node must already have a record in the grid.
+    /// Marking a node multiple times has no additional effect.
+    void SetModified(const ChVector2<int>& ij) {
+        Tile* tile = FindTile(ij);
+        if (!tile)
+            throw std::out_of_range("SCMTiledGrid::SetModified");
+        int k = LocalIndex(ij);
+        if (!tile->any_modified) {
+            tile->any_modified = true;
+            m_modified_tiles.push_back(tile);
+        }
+        tile->Set(tile->modified, k);
+    }
+
+    /// Apply the given function, with signature f(const ChVector2<int>&, T&), to all modified nodes.
+    template <typename Func>
+    void ForEachModified(Func f) {
+        for (auto tile : m_modified_tiles)
+            tile->Visit(tile->modified, f);
+    }
+
+    /// Apply the given function, with signature f(const ChVector2<int>&, const T&), to all modified nodes.
+    template <typename Func>
+    void ForEachModified(Func f) const {
+        for (auto tile : m_modified_tiles)
+            static_cast<const Tile*>(tile)->Visit(tile->modified, f);
+    }
+
+    /// Return the number of modified nodes.
+    size_t GetNumModified() const {
+        size_t n = 0;
+        for (auto tile : m_modified_tiles) {
+            for (int w = 0; w < mask_words; w++)
+                n += PopCount(tile->modified[w]);
+        }
+        return n;
+    }
+
+    /// Unmark all modified nodes.
+    void ClearModified() {
+        for (auto tile : m_modified_tiles) {
+            for (int w = 0; w < mask_words; w++)
+                tile->modified[w] = 0;
+            tile->any_modified = false;
+        }
+        m_modified_tiles.clear();
+    }
+
+  private:
+    static constexpr int tile_size = 1 << LOG2_TILE;
+    static constexpr int tile_nodes = tile_size * tile_size;
+    static constexpr int mask_words = (tile_nodes + 63) / 64;
+
+    struct Tile {
+        Tile(int ti, int tj) : ti(ti), tj(tj), any_modified(false) {
+            for (int w = 0; w < mask_words; w++) {
+                occupied[w] = 0;
+                modified[w] = 0;
+            }
+        }
+
+        static bool IsSet(const uint64_t* mask, int k) { return (mask[k >> 6] >> (k & 63)) & 1; }
+        static void Set(uint64_t* mask, int k) { mask[k >> 6] |= uint64_t(1) << (k & 63); }
+
+        template <typename Func>
+        void Visit(const uint64_t* mask, Func& f) {
+            for (int w = 0; w < mask_words; w++) {
+                for (uint64_t bits = mask[w]; bits; bits &= bits - 1) {
+                    int k = 64 * w + TrailingZeros(bits);
+                    f(ChVector2<int>(ti * tile_size + (k & (tile_size - 1)), tj * tile_size + (k >> LOG2_TILE)),
+                      data[slot[k]]);
+                }
+            }
+        }
+
+        template <typename Func>
+        void Visit(const uint64_t* mask, Func& f) const {
+            for (int w = 0; w < mask_words; w++) {
+                for (uint64_t bits = mask[w]; bits; bits &= bits - 1) {
+                    int k = 64 * w + TrailingZeros(bits);
+                    f(ChVector2<int>(ti * tile_size + (k & (tile_size - 1)), tj * tile_size + (k >> LOG2_TILE)),
+                      data[slot[k]]);
+                }
+            }
+        }
+
+        int ti;                         // tile coordinates
+        int tj;                         //
+        bool any_modified;              // true if the tile is in the list of modified tiles
+        uint64_t occupied[mask_words];  // per-node occupancy bits
+        uint64_t modified[mask_words];  // per-node modification bits
+        uint16_t slot[tile_nodes];      // per-node index in the record list (valid only for occupied nodes)
+        std::vector<T> data;            // records of the occupied nodes, in order of insertion
+    };
+
+    // Tile coordinates and local index within the tile of a given node (row-major, x index varying fastest).
+    // Arithmetic shifts and masks give floor division and non-negative remainders also for negative indices.
+    static uint64_t TileKey(const ChVector2<int>& ij) {
+        return (uint64_t(uint32_t(ij.x() >> LOG2_TILE)) << 32) | uint32_t(ij.y() >> LOG2_TILE);
+    }
+    static int LocalIndex(const ChVector2<int>& ij) {
+        return (ij.x() & (tile_size - 1)) + ((ij.y() & (tile_size - 1)) << LOG2_TILE);
+    }
+
+    static int TrailingZeros(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(bits);
+#else
+        int n = 0;
+        while (!(bits & 1)) {
+            bits >>= 1;
+            n++;
+        }
+        return n;
+#endif
+    }
+
+    static int PopCount(uint64_t bits) {
+        int n = 0;
+        for (; bits; bits &= bits - 1)
+            n++;
+        return n;
+    }
+
+    Tile* FindTile(const ChVector2<int>& ij) const {
+        auto it = m_tile_index.find(TileKey(ij));
+        return it == m_tile_index.end() ? nullptr : m_tiles[it->second].get();
+    }
+
+    Tile* GetTile(const ChVector2<int>& ij) {
+        auto it = m_tile_index.insert(std::make_pair(TileKey(ij), (unsigned int)m_tiles.size()));
+        if (it.second)
+            m_tiles.push_back(std::unique_ptr<Tile>(new Tile(ij.x() >> LOG2_TILE, ij.y() >> LOG2_TILE)));
+        return m_tiles[it.first->second].get();
+    }
+
+    std::vector<std::unique_ptr<Tile>> m_tiles;               // allocated tiles
+    std::unordered_map<uint64_t, unsigned int> m_tile_index;  // tile coordinates -> index in tile list
+    std::vector<Tile*> m_modified_tiles;                      // tiles with at least one modified node
+    size_t m_num_nodes;                                       // number of recorded nodes
+};
+
+/// @} vehicle_terrain
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -46,6 +46,10 @@
 #endif
 
 #ifdef CHRONO_SENSOR
+    #include "chrono_sensor/ChConfigSensor.h"
+#endif
+
+#ifdef CHRONO_SENSOR_USE_OPTIX
     #include "chrono_sensor/ChSensorManager.h"
     #include "chrono_sensor/sensors/ChCameraSensor.h"
     #include "chrono_sensor/filters/ChFilterAccess.h"
@@ -99,7 +103,7 @@ int main(int argc, char* argv[]) {
     auto size_x = cli.GetAsType<double>("sizeX");
     auto size_y = cli.GetAsType<double>("sizeY");
     auto dpu = cli.GetAsType<double>("dpu");
-#ifdef CHRONO_SENSOR
+#ifdef CHRONO_SENSOR_USE_OPTIX
     auto cam_x = cli.GetAsType<std::vector<double>>("c_pos")[0];
     auto cam_y = cli.GetAsType<std::vector<double>>("c_pos")[1];
     auto cam_res_width = cli.GetAsType<std::vector<int>>("res")[0];
@@ -243,7 +247,7 @@ int main(int argc, char* argv[]) {
     int render_steps = (int)std::ceil(render_step_size / step_size);
 #endif
 
-#ifdef CHRONO_SENSOR
+#ifdef CHRONO_SENSOR_USE_OPTIX
     ChSensorManager sensor_manager(m113.GetSystem());
     if (cli.HasValueInVector<int>("sens", node_id)) {
         // Give the camera a fixed place to live
@@ -350,7 +354,7 @@ int main(int argc, char* argv[]) {
             app->Advance(step_size);
 #endif
 
-#ifdef CHRONO_SENSOR
+#ifdef CHRONO_SENSOR_USE_OPTIX
         sensor_manager.Update();
 #endif
 
@@ -73,6 +73,7 @@ bool GetProblemSpecs(int argc,
                      double& toe_angle,
                      double& dbp_filter_window,
                      bool& use_checkpoint,
+                     bool& use_shm,
                      double& output_fps,
                      double& vis_output_fps,
                      double& render_fps,
@@ -127,6 +128,7 @@ int main(int argc, char** argv) {
     double base_vel = 1.0;
     double slip = 0;
     bool use_checkpoint = false;
+    bool use_shm = false;
     double output_fps = 100;
     double vis_output_fps = 100;
     double render_fps = 0;
@@ -143,8 +145,9 @@ int main(int argc, char** argv) {
     bool verbose = true;
     if (!GetProblemSpecs(argc, argv, rank, terrain_specfile, tire_specfile, nthreads_tire, nthreads_terrain, step_size,
                          fixed_settling_time, KE_threshold, settling_time, sim_time, act_type, base_vel, slip,
-                         total_mass, toe_angle, dbp_filter_window, use_checkpoint, output_fps, vis_output_fps,
-                         render_fps, sim_output, settling_output, vis_output, renderRT, verbose, suffix)) {
+                         total_mass, toe_angle, dbp_filter_window, use_checkpoint, use_shm, output_fps,
+                         vis_output_fps, render_fps, sim_output, settling_output, vis_output, renderRT, verbose,
+                         suffix)) {
         MPI_Finalize();
         return 1;
     }
@@ -220,8 +223,8 @@ int main(int argc, char** argv) {
     int output_steps = (int)std::ceil(1 / (output_fps * step_size));
     int vis_output_steps = (int)std::ceil(1 / (vis_output_fps * step_size));
 
-    // Initialize co-simulation framework (specify 1 tire node).
-    cosim::InitializeFramework(1);
+    // Initialize co-simulation framework (specify 1 tire node and the inter-node transport).
+    cosim::InitializeFramework(1, use_shm ? ChVehicleCosimTransport::Type::SHM : ChVehicleCosimTransport::Type::MPI);
 
     // Create the node (a rig, tire, or terrain node, depending on rank).
     ChVehicleCosimBaseNode* node = nullptr;
@@ -492,6 +495,7 @@ bool GetProblemSpecs(int argc,
                      double& toe_angle,
                      double& dbp_filter_window,
                      bool& use_checkpoint,
+                     bool& use_shm,
                      double& output_fps,
                      double& vis_output_fps,
                      double& render_fps,
@@ -528,6 +532,7 @@ bool GetProblemSpecs(int argc,
                        std::to_string(nthreads_terrain));
 
     cli.AddOption<bool>("Simulation", "use_checkpoint", "Initialize from checkpoint file");
+    cli.AddOption<bool>("Simulation", "shm", "Use shared-memory transport for inter-node communication");
 
     cli.AddOption<bool>("Output", "quiet", "Disable verbose messages");
     cli.AddOption<bool>("Output", "no_output", "Disable generation of simulation output files");
@@ -617,6 +622,7 @@ bool GetProblemSpecs(int argc,
     render_fps = cli.GetAsType<double>("render_fps");
 
     use_checkpoint = cli.GetAsType<bool>("use_checkpoint");
+    use_shm = cli.GetAsType<bool>("shm");
 
     nthreads_tire = cli.GetAsType<int>("threads_tire");
     nthreads_terrain = cli.GetAsType<int>("threads_terrain");
@@ -33,6 +33,10 @@
 #include "chrono_models/vehicle/hmmwv/HMMWV.h"
 
 #ifdef CHRONO_SENSOR
+    #include "chrono_sensor/ChConfigSensor.h"
+#endif
+
+#ifdef CHRONO_SENSOR_USE_OPTIX
     #include "chrono_sensor/ChSensorManager.h"
     #include "chrono_sensor/sensors/ChCameraSensor.h"
     #include "chrono_sensor/filters/ChFilterAccess.h"
@@ -54,7 +58,7 @@ using namespace chrono::vehicle::hmmwv;
 
 using namespace rapidjson;
 
-#ifdef CHRONO_SENSOR
+#ifdef CHRONO_SENSOR_USE_OPTIX
 using namespace chrono::sensor;
 #endif
 
@@ -173,7 +177,7 @@ class ChDriverInputs_DataParserFunctor : public ChExternalDriver::DataParserFunc
     ChDriver& m_driver;
 };
 
-#ifdef CHRONO_SENSOR
+#ifdef CHRONO_SENSOR_USE_OPTIX
 
 // Create a data generator to add to the external driver
 // This will send the camera image the external control stack
@@ -376,7 +380,7 @@ int main(int argc, char* argv[]) {
     // Create the sensor system (if Chrono::Sensor is available)
     // ---------------------------------------------------------
 
-#ifdef CHRONO_SENSOR
+#ifdef CHRONO_SENSOR_USE_OPTIX
     auto manager = chrono_types::make_shared<ChSensorManager>(hmmwv.GetSystem());
     manager->scene->AddPointLight({100, 100, 100}, {2, 2, 2}, 500);
     manager->scene->SetAmbientLight({0.1f, 0.1f, 0.1f});
@@ -544,7 +548,7 @@ int main(int argc, char* argv[]) {
         vis->Advance(step_size);
 #endif
 
-#ifdef CHRONO_SENSOR
+#ifdef CHRONO_SENSOR_USE_OPTIX
         // Update the sensor manager
         manager->Update();
 #endif
@@ -18,6 +18,9 @@
 #   in the while() simulation loop). See demo_POST_blender1.cpp for an example.
 # - run the chrono app,  this will generate files on disk: a single
 #   xxx.assets.py file and many state00001.py, state00002.py, ..., in an output/ dir.
+#   If the exporter is set with my_blender_exporter.SetUseBinaryData(true), the poses of
+#   bodies and particles and the contacts are saved in state00001.bin, state00002.bin, ...
+#   binary files instead, with a xxx.objects.dat table of the shapes of each object.
 # - Open Blender, use menu "File/Import/Chrono import" to load the xxx.assets.py file.
 #
 # Tips:
@@ -47,7 +50,7 @@ bl_info = {
     "location": "File > Import-Export",
     "description": "Import ProjectChrono simulations",
     "author": "Alessandro Tasora",
-    "version": (0, 0, 3),
+    "version": (0, 0, 4),
     "wiki_url": "https://api.projectchrono.org/development/introduction_chrono_blender.html",
     "doc_url": "https://api.projectchrono.org/development/introduction_chrono_blender.html",
 }
@@ -58,6 +61,7 @@ import numpy as np
 import mathutils
 import os
 import math
+import ast
 from enum import Enum
 from bpy.types import (Operator,
                        Panel,
@@ -707,6 +711,21 @@ def make_chrono_object_assetlist(mname,mpos,mrot, masset_list):
             print("not found asset: ",masset_list[m][0])
     
     
+# Same instancing faces as in make_chrono_object_clones(), computed with numpy for a (n,7) array of poses
+def make_clones_faces(poses):
+    ncl = len(poses)
+    pos = poses[:,0:3].astype(np.float64)
+    w = poses[:,3].astype(np.float64)[:,None]
+    qv = poses[:,4:7].astype(np.float64)
+    verts = np.empty((ncl,4,3))
+    for ic, corner in enumerate(((-0.1,-0.1,0), (0.1,-0.1,0), (0.1,0.1,0), (-0.1,0.1,0))):
+        v = np.broadcast_to(np.array(corner), (ncl,3))
+        t = 2.0 * np.cross(qv, v)
+        verts[:,ic,:] = pos + v + w * t + np.cross(qv, t)
+    faces = np.arange(4*ncl).reshape(ncl,4)
+    return verts.reshape(4*ncl,3).tolist(), faces.tolist()
+
+
 def make_chrono_object_clones(mname,mpos,mrot, 
                                 masset_list, 
                                 list_clones_posrot):
@@ -753,18 +772,22 @@ def make_chrono_object_clones(mname,mpos,mrot,
         else:
             print("not found asset: ",masset_list[m][0])
         
-    ncl = len(list_clones_posrot)
-    verts = [(0,0,0)] * (4*ncl)
-    faces = [(0,0,0,0)] * ncl
     edges = []
-    for ic in range(ncl):
-        mpos = mathutils.Vector(list_clones_posrot[ic][0])
-        mrot = mathutils.Quaternion(list_clones_posrot[ic][1])
-        verts[4*ic]   = (mpos + mrot @ mathutils.Vector((-0.1,-0.1,0)))[:]
-        verts[4*ic+1] = (mpos + mrot @ mathutils.Vector(( 0.1,-0.1,0)))[:]
-        verts[4*ic+2] = (mpos + mrot @ mathutils.Vector(( 0.1, 0.1,0)))[:]
-        verts[4*ic+3] = (mpos + mrot @ mathutils.Vector((-0.1, 0.1,0)))[:]
-        faces[ic] = (4*ic, 4*ic+1, 4*ic+2, 4*ic+3)    
+    if isinstance(list_clones_posrot, np.ndarray):
+        # packed array of poses (x,y,z, e0,e1,e2,e3), as loaded from binary state files
+        verts, faces = make_clones_faces(list_clones_posrot)
+    else:
+        ncl = len(list_clones_posrot)
+        verts = [(0,0,0)] * (4*ncl)
+        faces = [(0,0,0,0)] * ncl
+        for ic in range(ncl):
+            mpos = mathutils.Vector(list_clones_posrot[ic][0])
+            mrot = mathutils.Quaternion(list_clones_posrot[ic][1])
+            verts[4*ic]   = (mpos + mrot @ mathutils.Vector((-0.1,-0.1,0)))[:]
+            verts[4*ic+1] = (mpos + mrot @ mathutils.Vector(( 0.1,-0.1,0)))[:]
+            verts[4*ic+2] = (mpos + mrot @ mathutils.Vector(( 0.1, 0.1,0)))[:]
+            verts[4*ic+3] = (mpos + mrot @ mathutils.Vector((-0.1, 0.1,0)))[:]
+            faces[ic] = (4*ic, 4*ic+1, 4*ic+2, 4*ic+3)    
     new_mesh = bpy.data.meshes.new('mesh_position_clones')
     new_mesh.from_pydata(verts, edges, faces)
     new_mesh.update()
@@ -1302,6 +1325,111 @@ def update_camera_coordinates(mname,mpos,mrot):
     cameraasset.rotation_quaternion = mrot
     cameraasset.location = mpos
 
+#
+# Binary state files, for exporters set with ChBlender::SetUseBinaryData(true)
+#
+
+# cache of loaded object tables: filename -> (file size, table)
+chrono_object_tables = {}
+
+# Load the object table (xxx.objects.dat) written next to the xxx.assets.py file.
+# Returns a dict: object index -> list of (first frame, name, type, shapes or settings), sorted by frame.
+# The table is only appended during the simulation, so it is reloaded only if its size changed.
+def read_chrono_object_table(filename):
+    size = os.path.getsize(filename)
+    cached = chrono_object_tables.get(filename)
+    if cached and cached[0] == size:
+        return cached[1]
+    with open(filename, "r") as f:
+        entries = ast.literal_eval('[' + f.read() + ']')
+    table = {}
+    for entry in entries:
+        table.setdefault(entry[1], []).append((entry[0],) + tuple(entry[2:]))
+    for entries_of_object in table.values():
+        entries_of_object.sort(key=lambda e: e[0])
+    chrono_object_tables[filename] = (size, table)
+    return table
+
+# Return the entry of an object that is valid at the given frame, or None
+def get_chrono_object_entry(table, index, frame):
+    found = None
+    for entry in table.get(index, []):
+        if entry[0] > frame:
+            break
+        found = entry
+    return found
+
+# Memory-map a binary state file (output/stateNNNNN.bin) and return its arrays as numpy views.
+# Layout: 8 uint32 header (b'CHBL', version, number of objects, clouds, particles, contacts, 0, 0) followed by
+# the arrays object_ids, object_poses, cloud_ids, cloud_sizes, cloud_poses, particle_poses, contacts,
+# where poses are (x,y,z, e0,e1,e2,e3) and contacts are (x,y,z, e0,e1,e2,e3, Fx,Fy,Fz), all little-endian.
+def read_chrono_binary_state(filename):
+    raw = np.memmap(filename, dtype=np.uint8, mode='r')
+    if raw[0:4].tobytes() != b'CHBL':
+        raise ValueError("not a Chrono binary state file: " + filename)
+    header = raw[0:32].view('<u4')
+    if header[1] != 1:
+        raise ValueError("unsupported version of Chrono binary state file: " + filename)
+    nobjects, nclouds, nparticles, ncontacts = [int(n) for n in header[2:6]]
+    state = {}
+    offset = 32
+    for name, dtype, count, width in (('object_ids',     '<i4', nobjects,   1),
+                                      ('object_poses',   '<f4', nobjects,   7),
+                                      ('cloud_ids',      '<i4', nclouds,    1),
+                                      ('cloud_sizes',    '<u4', nclouds,    1),
+                                      ('cloud_poses',    '<f4', nclouds,    7),
+                                      ('particle_poses', '<f4', nparticles, 7),
+                                      ('contacts',       '<f4', ncontacts, 10)):
+        nbytes = 4 * count * width
+        array = raw[offset:offset+nbytes].view(dtype)
+        state[name] = array.reshape(count, width) if width > 1 else array
+        offset += nbytes
+    return state
+
+# Create the Blender objects of a binary state file, as done by the make_chrono_object_assetlist(),
+# make_chrono_object_clones() and contact glyph commands in the text stateNNNNN.py files
+def load_chrono_binary_state(chrono_filename, binfilename, cFrame):
+    table_filename = chrono_filename
+    if table_filename.endswith('.assets.py'):
+        table_filename = table_filename[:-len('.assets.py')]
+    table_filename += '.objects.dat'
+    if not os.path.exists(table_filename):
+        print("not found object table: ", table_filename)
+        return
+    table = read_chrono_object_table(table_filename)
+    state = read_chrono_binary_state(binfilename)
+    
+    for index, pose in zip(state['object_ids'], state['object_poses']):
+        entry = get_chrono_object_entry(table, int(index), cFrame)
+        if entry:
+            make_chrono_object_assetlist(entry[1], pose[0:3].tolist(), pose[3:7].tolist(), entry[3])
+    
+    first = 0
+    for index, size, pose in zip(state['cloud_ids'], state['cloud_sizes'], state['cloud_poses']):
+        particles = state['particle_poses'][first:first+int(size)]
+        first += int(size)
+        entry = get_chrono_object_entry(table, int(index), cFrame)
+        if entry:
+            make_chrono_object_clones(entry[1], pose[0:3].tolist(), pose[3:7].tolist(), entry[3], particles)
+    
+    contacts = state['contacts']
+    if chrono_view_contacts and len(contacts):
+        entry = get_chrono_object_entry(table, -1, cFrame)
+        if entry:
+            settings = entry[3]
+            glyphsetting = setup_glyph_setting('contacts', **settings['glyph'])
+            setup_property_vector(glyphsetting, 'F', matname = 'contacts_color_F', mcolormap = 'colormap_cooltowarm', 
+                min=settings['min'], max=settings['max'], per_instance = True)
+            setup_property_quaternion(glyphsetting, 'loc_rot', matname='contacts_color_rot', per_instance=True)
+            update_make_glyphs(glyphsetting, 'contacts', settings['pos'], settings['rot'], 
+                list(map(tuple,contacts[:,0:3])),
+                list_attributes=[ 
+                    ['F', list(map(tuple,contacts[:,7:10]))], 
+                    ['loc_rot', list(map(tuple,contacts[:,3:7]))], 
+                ], 
+            )
+
+
  
     
 #
@@ -1401,6 +1529,10 @@ def callback_post(self):
                 f = open(filename, "rb")
                 exec(compile(f.read(), filename, 'exec'))
                 f.close()
+            
+            binfilename = os.path.join(proj_dir, 'output', 'state'+'{:05d}'.format(cFrame)+'.bin')
+            if os.path.exists(binfilename):
+                load_chrono_binary_state(chrono_filename, binfilename, cFrame)
                 
         # in case something was added to chrono_frame_assets, make it invisible 
         for masset in chrono_frame_assets.objects:
@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark for the batched MPR narrowphase of the multicore collision system.
+//
+// Compares the scalar MPR algorithm (one candidate pair at a time) with the
+// batched version (several pairs with the same shape types at a time, one per
+// SIMD lane) on sets of randomly placed pairs of shapes in near-contact.
+//
+// =============================================================================
+
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "chrono/core/ChMathematics.h"
+#include "chrono/collision/ChCollisionShape.h"
+#include "chrono/collision/multicore/ChNarrowphase.h"
+
+using namespace chrono;
+
+// Convex hull shape with its own list of points
+class ConvexShapeHull : public ConvexBase {
+  public:
+    ConvexShapeHull(const real3& p, const quaternion& q, const std::vector<real3>& points)
+        : position(p), rotation(q), points(points) {}
+    virtual int Type() const override { return ChCollisionShape::Type::CONVEXHULL; }
+    virtual real3 A() const override { return position; }
+    virtual quaternion R() const override { return rotation; }
+    virtual int Size() const override { return (int)points.size(); }
+    virtual const real3* Convex() const override { return points.data(); }
+
+  private:
+    real3 position;
+    quaternion rotation;
+    std::vector<real3> points;
+};
+
+// Benchmarking fixture: create pairs of shapes of the types specified by the benchmark arguments
+class MPRFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        const int num_pairs = 10000;
+        ChSetRandomSeed(1);
+
+        for (int i = 0; i < num_pairs; i++) {
+            real3 dir = Normalize(real3(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5));
+            real dist = 0.5 + 0.5 * ChRandom();
+            shapes.push_back(CreateShape((int)st.range(0), real3(0)));
+            shapes.push_back(CreateShape((int)st.range(1), dist * dir));
+        }
+
+        for (int i = 0; i < num_pairs; i++) {
+            shapesA.push_back(shapes[2 * i]);
+            shapesB.push_back(shapes[2 * i + 1]);
+        }
+
+        norm.resize(num_pairs);
+        pt1.resize(num_pairs);
+        pt2.resize(num_pairs);
+        depth.resize(num_pairs);
+        found.resize(num_pairs);
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        for (auto shape : shapes)
+            delete shape;
+        shapes.clear();
+        shapesA.clear();
+        shapesB.clear();
+    }
+
+    ConvexBase* CreateShape(int type, const real3& pos) {
+        quaternion rot(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5);
+        rot = rot / Sqrt(Dot(rot));
+        if (type == ChCollisionShape::Type::CONVEXHULL) {
+            std::vector<real3> points;
+            for (int i = 0; i < 20; i++)
+                points.push_back(real3(0.5 * (ChRandom() - 0.5), 0.4 * (ChRandom() - 0.5), 0.3 * (ChRandom() - 0.5)));
+            return new ConvexShapeHull(pos, rot, points);
+        }
+        real3 dims(0.3 + 0.2 * ChRandom(), 0.3 + 0.2 * ChRandom(), 0.3 + 0.2 * ChRandom());
+        return new ConvexShapeCustom(type, pos, rot, dims, 0.05);
+    }
+
+    std::vector<ConvexBase*> shapes;
+    std::vector<const ConvexBase*> shapesA;
+    std::vector<const ConvexBase*> shapesB;
+    std::vector<real3> norm;
+    std::vector<real3> pt1;
+    std::vector<real3> pt2;
+    std::vector<real> depth;
+    std::vector<char> found;
+
+    const real envelope = 0.01;
+};
+
+BENCHMARK_DEFINE_F(MPRFixture, Scalar)(benchmark::State& st) {
+    int num_pairs = (int)shapesA.size();
+    for (auto _ : st) {
+        for (int i = 0; i < num_pairs; i++) {
+            found[i] = ChNarrowphase::MPRCollision(shapesA[i], shapesB[i], envelope, norm[i], pt1[i], pt2[i], depth[i]);
+        }
+    }
+    st.SetItemsProcessed(st.iterations() * num_pairs);
+}
+
+BENCHMARK_DEFINE_F(MPRFixture, Batch)(benchmark::State& st) {
+    int num_pairs = (int)shapesA.size();
+    for (auto _ : st) {
+        ChNarrowphase::MPRCollisionBatch(num_pairs, shapesA.data(), shapesB.data(), envelope, norm.data(), pt1.data(),
+                                         pt2.data(), depth.data(), found.data());
+    }
+    st.SetItemsProcessed(st.iterations() * num_pairs);
+}
+
+static void ShapeTypes(benchmark::internal::Benchmark* b) {
+    b->Args({ChCollisionShape::Type::BOX, ChCollisionShape::Type::BOX});
+    b->Args({ChCollisionShape::Type::CYLINDER, ChCollisionShape::Type::BOX});
+    b->Args({ChCollisionShape::Type::CYLINDER, ChCollisionShape::Type::CYLINDER});
+    b->Args({ChCollisionShape::Type::ELLIPSOID, ChCollisionShape::Type::ROUNDEDBOX});
+    b->Args({ChCollisionShape::Type::CONVEXHULL, ChCollisionShape::Type::BOX});
+    b->Args({ChCollisionShape::Type::CONVEXHULL, ChCollisionShape::Type::CONVEXHULL});
+}
+
+BENCHMARK_REGISTER_F(MPRFixture, Scalar)->Apply(ShapeTypes)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(MPRFixture, Batch)->Apply(ShapeTypes)->Unit(benchmark::kMicrosecond);
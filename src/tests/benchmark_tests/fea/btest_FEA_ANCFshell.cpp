@@ -17,6 +17,10 @@
 // Note that the MKL Pardiso and Mumps solvers are set to lock the sparsity
 // pattern, but not to use the sparsity pattern learner.
 //
+// The ANCFshell64_MINRES_T* tests report the scaling with the number of
+// threads used for the (element-colored) evaluation of the mesh internal
+// forces and Jacobians.
+//
 // =============================================================================
 
 #include "chrono/ChConfig.h"
@@ -97,6 +101,12 @@ class ANCFshell_PARDISOPROJECT : public ANCFshell<N> {
     ANCFshell_PARDISOPROJECT() : ANCFshell<N>(SolverType::PARDISO_PROJECT) {}
 };
 
+template <int N, int NTHREADS>
+class ANCFshell_MINRES_threads : public ANCFshell<N> {
+  public:
+    ANCFshell_MINRES_threads() : ANCFshell<N>(SolverType::MINRES) { this->m_system->SetNumThreads(NTHREADS, 1, 1); }
+};
+
 template <int N>
 ANCFshell<N>::ANCFshell(SolverType solver_type) {
     m_system = new ChSystemSMC();
@@ -273,6 +283,18 @@ CH_BM_SIMULATION_LOOP(ANCFshell16_MINRES, ANCFshell_MINRES<16>, NUM_SKIP_STEPS,
 CH_BM_SIMULATION_LOOP(ANCFshell32_MINRES, ANCFshell_MINRES<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell64_MINRES, ANCFshell_MINRES<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+using ANCFshell_MINRES_T01 = ANCFshell_MINRES_threads<64, 1>;
+using ANCFshell_MINRES_T02 = ANCFshell_MINRES_threads<64, 2>;
+using ANCFshell_MINRES_T04 = ANCFshell_MINRES_threads<64, 4>;
+using ANCFshell_MINRES_T08 = ANCFshell_MINRES_threads<64, 8>;
+using ANCFshell_MINRES_T16 = ANCFshell_MINRES_threads<64, 16>;
+
+CH_BM_SIMULATION_LOOP(ANCFshell64_MINRES_T01, ANCFshell_MINRES_T01, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell64_MINRES_T02, ANCFshell_MINRES_T02, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell64_MINRES_T04, ANCFshell_MINRES_T04, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell64_MINRES_T08, ANCFshell_MINRES_T08, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell64_MINRES_T16, ANCFshell_MINRES_T16, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 CH_BM_SIMULATION_LOOP(ANCFshell08_SparseQR, ANCFshell_SparseQR<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell16_SparseQR, ANCFshell_SparseQR<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell32_SparseQR, ANCFshell_SparseQR<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
@@ -14,7 +14,9 @@
 //
 // Benchmark test for sparse matrix setup (assembly of system matrix).
 // This provides a measure of the effect and performance of using the "sparsity
-// learner".
+// learner" and of caching the sparsity pattern and symbolic factorization
+// (the "_cache" tests; compare the LS_Setup times with the "_learner" tests to
+// get the time saved by reusing the symbolic factorization).
 //
 // =============================================================================
 
@@ -109,6 +111,7 @@ class SystemFixture : public ::benchmark::Fixture {
         st.counters["LS_Setup_call"] = solver->GetTimeSetup_SolverCall() * 1e3 / num_it;
         st.counters["LS_Solve_assembly"] = solver->GetTimeSolve_Assembly() * 1e3 / num_it;
         st.counters["LS_Solve_call"] = solver->GetTimeSolve_SolverCall() * 1e3 / num_it;
+        st.counters["LS_Setup_reuse"] = solver->GetNumSetupReuses();
     }
 
   protected:
@@ -175,6 +178,19 @@ class SystemFixture : public ::benchmark::Fixture {
     }                                                                                 \
     BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
 
+#define BM_SOLVER_CACHE(TEST_NAME, SOLVER_TYPE, N)                                    \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        auto solver = chrono_types::make_shared<SOLVER_TYPE>();                       \
+        solver->UseSparsityPatternCache(true);                                        \
+        solver->SetVerbose(false);                                                    \
+        m_system->SetSolver(solver);                                                  \
+        while (st.KeepRunning()) {                                                    \
+            m_system->DoStaticLinear();                                               \
+        }                                                                             \
+        Report(st);                                                                   \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
 #ifdef CHRONO_PARDISO_MKL
 BM_SOLVER_MKL(MKL_learner_500, 500, true)
 BM_SOLVER_MKL(MKL_no_learner_500, 500, false)
@@ -186,6 +202,11 @@ BM_SOLVER_MKL(MKL_learner_4000, 4000, true)
 BM_SOLVER_MKL(MKL_no_learner_4000, 4000, false)
 BM_SOLVER_MKL(MKL_learner_8000, 8000, true)
 BM_SOLVER_MKL(MKL_no_learner_8000, 8000, false)
+BM_SOLVER_CACHE(MKL_cache_500, ChSolverPardisoMKL, 500)
+BM_SOLVER_CACHE(MKL_cache_1000, ChSolverPardisoMKL, 1000)
+BM_SOLVER_CACHE(MKL_cache_2000, ChSolverPardisoMKL, 2000)
+BM_SOLVER_CACHE(MKL_cache_4000, ChSolverPardisoMKL, 4000)
+BM_SOLVER_CACHE(MKL_cache_8000, ChSolverPardisoMKL, 8000)
 #endif
 
 #ifdef CHRONO_MUMPS
@@ -199,6 +220,11 @@ BM_SOLVER_MUMPS(MUMPS_learner_4000, 4000, true)
 BM_SOLVER_MUMPS(MUMPS_no_learner_4000, 4000, false)
 BM_SOLVER_MUMPS(MUMPS_learner_8000, 8000, true)
 BM_SOLVER_MUMPS(MUMPS_no_learner_8000, 8000, false)
+BM_SOLVER_CACHE(MUMPS_cache_500, ChSolverMumps, 500)
+BM_SOLVER_CACHE(MUMPS_cache_1000, ChSolverMumps, 1000)
+BM_SOLVER_CACHE(MUMPS_cache_2000, ChSolverMumps, 2000)
+BM_SOLVER_CACHE(MUMPS_cache_4000, ChSolverMumps, 4000)
+BM_SOLVER_CACHE(MUMPS_cache_8000, ChSolverMumps, 8000)
 #endif
 
 #ifdef CHRONO_PARDISOPROJECT
@@ -224,6 +250,11 @@ BM_SOLVER_QR(QR_learner_4000, 4000, true)
 BM_SOLVER_QR(QR_no_learner_4000, 4000, false)
 BM_SOLVER_QR(QR_learner_8000, 8000, true)
 BM_SOLVER_QR(QR_no_learner_8000, 8000, false)
+BM_SOLVER_CACHE(QR_cache_500, ChSolverSparseQR, 500)
+BM_SOLVER_CACHE(QR_cache_1000, ChSolverSparseQR, 1000)
+BM_SOLVER_CACHE(QR_cache_2000, ChSolverSparseQR, 2000)
+BM_SOLVER_CACHE(QR_cache_4000, ChSolverSparseQR, 4000)
+BM_SOLVER_CACHE(QR_cache_8000, ChSolverSparseQR, 8000)
 
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
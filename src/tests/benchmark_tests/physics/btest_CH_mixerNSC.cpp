@@ -13,6 +13,8 @@
 // =============================================================================
 //
 // Benchmark test for contact simulation using NSC contact.
+// The mixer model is run with the serial PSOR solver and with its parallel,
+// graph-colored variant (ChSolverPSORcolored) using different numbers of threads.
 //
 // =============================================================================
 
@@ -21,7 +23,9 @@
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/solver/ChSolverPSOR.h"
 
 #ifdef CHRONO_IRRLICHT
     #include "chrono_irrlicht/ChVisualSystemIrrlicht.h"
@@ -31,7 +35,7 @@ using namespace chrono;
 
 // =============================================================================
 
-template <int N>
+template <int N, ChSolver::Type SOLVER = ChSolver::Type::PSOR, int NTHREADS = 1>
 class MixerTestNSC : public utils::ChBenchmarkTest {
   public:
     MixerTestNSC();
@@ -42,14 +46,16 @@ class MixerTestNSC : public utils::ChBenchmarkTest {
 
     void SimulateVis();
 
-  private:
+  protected:
     ChSystemNSC* m_system;
     double m_step;
 };
 
-template <int N>
-MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
+template <int N, ChSolver::Type SOLVER, int NTHREADS>
+MixerTestNSC<N, SOLVER, NTHREADS>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
     m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    m_system->SetNumThreads(NTHREADS, 1, 1);
+    m_system->SetSolverType(SOLVER);
 
     auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
 
@@ -104,8 +110,28 @@ MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
     m_system->AddLink(motor);
 }
 
-template <int N>
-void MixerTestNSC<N>::SimulateVis() {
+// Mixer test with a convergence tolerance for the iterative solver.
+// The solver is optionally warm started with the reactions from the contact cache of the contact container.
+template <int N, bool WARM_START>
+class MixerTestNSCtol : public MixerTestNSC<N> {
+  public:
+    MixerTestNSCtol();
+};
+
+template <int N, bool WARM_START>
+MixerTestNSCtol<N, WARM_START>::MixerTestNSCtol() {
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(200);
+    solver->SetTolerance(1e-4);
+    solver->EnableWarmStart(WARM_START);
+    this->m_system->SetSolver(solver);
+
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(this->m_system->GetContactContainer());
+    container->EnableContactCache(WARM_START);
+}
+
+template <int N, ChSolver::Type SOLVER, int NTHREADS>
+void MixerTestNSC<N, SOLVER, NTHREADS>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     // Create the Irrlicht visualization system
     auto vis = chrono_types::make_shared<irrlicht::ChVisualSystemIrrlicht>();
@@ -135,6 +161,20 @@ void MixerTestNSC<N>::SimulateVis() {
 CH_BM_SIMULATION_LOOP(MixerNSC032, MixerTestNSC<32>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(MixerNSC064, MixerTestNSC<64>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+using MixerTestNSCtol064 = MixerTestNSCtol<64, false>;
+using MixerTestNSCwarm064 = MixerTestNSCtol<64, true>;
+CH_BM_SIMULATION_LOOP(MixerNSCtol064, MixerTestNSCtol064, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSCwarm064, MixerTestNSCwarm064, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+using MixerTestNSCcolored064_1 = MixerTestNSC<64, ChSolver::Type::PSOR_COLORED, 1>;
+using MixerTestNSCcolored064_2 = MixerTestNSC<64, ChSolver::Type::PSOR_COLORED, 2>;
+using MixerTestNSCcolored064_4 = MixerTestNSC<64, ChSolver::Type::PSOR_COLORED, 4>;
+using MixerTestNSCcolored064_8 = MixerTestNSC<64, ChSolver::Type::PSOR_COLORED, 8>;
+CH_BM_SIMULATION_LOOP(MixerNSCcolored064_1, MixerTestNSCcolored064_1, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSCcolored064_2, MixerTestNSCcolored064_2, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSCcolored064_4, MixerTestNSCcolored064_4, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSCcolored064_8, MixerTestNSCcolored064_8, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
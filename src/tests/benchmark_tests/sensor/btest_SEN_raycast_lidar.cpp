@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark for the CPU ray-cast lidar, in the scene of btest_SEN_lidar_spin
+// (a lidar moving between two rows of cylinders).
+//
+// Measures the cost of a full scan (beam tracing and point cloud generation)
+// as a function of the number of beams and of the number of threads.
+//
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_sensor/ChSensorManager.h"
+#include "chrono_sensor/sensors/ChRaycastSensor.h"
+#include "chrono_sensor/filters/ChFilterAccess.h"
+#include "chrono_sensor/filters/ChFilterPCfromDepth.h"
+
+using namespace chrono;
+using namespace chrono::sensor;
+
+// Benchmarking fixture: lidar with the number of horizontal samples and threads specified by the benchmark arguments
+class RaycastLidarFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        sys = new ChSystemNSC();
+        sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+        auto floor = chrono_types::make_shared<ChBodyEasyBox>(100, 100, .01, 1000, false, true);
+        floor->SetPos({0, 0, 0});
+        floor->SetBodyFixed(true);
+        sys->Add(floor);
+
+        cart = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, false);
+        cart->SetPos({0, 0, 1});
+        cart->SetBodyFixed(true);
+        sys->Add(cart);
+
+        // create alternating walls on left and right
+        int walls = 1000;
+        double wall_size = .5;
+        for (int i = 0; i < walls; i++) {
+            for (double y : {-4.0, 4.0}) {
+                auto wall_body =
+                    chrono_types::make_shared<ChBodyEasyCylinder>(geometry::ChAxis::Y, wall_size, 1, 1000, false, true);
+                wall_body->SetPos({4 * i * wall_size, y, wall_size / 2});
+                wall_body->SetRot(Q_from_AngX(CH_C_PI / 2));
+                wall_body->SetBodyFixed(true);
+                sys->Add(wall_body);
+            }
+        }
+
+        // one step to initialize the collision system
+        sys->DoStepDynamics(step_size);
+
+        // lidar scanning at every step
+        manager = chrono_types::make_shared<ChSensorManager>(sys);
+        lidar = chrono_types::make_shared<ChRaycastLidarSensor>(
+            cart,                                                              // body lidar is attached to
+            1 / step_size,                                                     // scanning rate in Hz
+            chrono::ChFrame<double>({0, 0, 0}, Q_from_AngAxis(0, {0, 1, 0})),  // offset pose
+            (unsigned int)st.range(0),                                         // number of horizontal samples
+            16,                                                                // number of vertical channels
+            2 * (float)CH_C_PI,                                                // horizontal field of view
+            0.1f, -0.1f, 100.0f                                                // vertical field of view and range
+        );
+        lidar->SetNumThreads((int)st.range(1));
+        lidar->PushFilter(chrono_types::make_shared<ChFilterPCfromDepth>());
+        lidar->PushFilter(chrono_types::make_shared<ChFilterXYZIAccess>());
+        manager->AddSensor(lidar);
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        manager.reset();
+        lidar.reset();
+        cart.reset();
+        delete sys;
+    }
+
+    ChSystemNSC* sys;
+    std::shared_ptr<ChBody> cart;
+    std::shared_ptr<ChRaycastLidarSensor> lidar;
+    std::shared_ptr<ChSensorManager> manager;
+
+    const float step_size = 0.01f;
+    const double speed = 16;
+};
+
+BENCHMARK_DEFINE_F(RaycastLidarFixture, Scan)(benchmark::State& st) {
+    for (auto _ : st) {
+        // move the cart (the walls do not move, so the collision system does not need to be updated)
+        cart->SetPos(cart->GetPos() + ChVector<>(speed * step_size, 0, 0));
+        sys->SetChTime(sys->GetChTime() + step_size);
+        manager->Update();
+    }
+    st.SetItemsProcessed(st.iterations() * lidar->GetWidth() * lidar->GetHeight());
+}
+
+static void BeamsAndThreads(benchmark::internal::Benchmark* b) {
+    for (int samples : {1000, 4000}) {
+        for (int threads : {1, 2, 4, 8})
+            b->Args({samples, threads});
+    }
+}
+
+BENCHMARK_REGISTER_F(RaycastLidarFixture, Scan)->Apply(BeamsAndThreads)->Unit(benchmark::kMillisecond)->UseRealTime();
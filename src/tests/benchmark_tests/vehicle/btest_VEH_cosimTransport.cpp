@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the latency of the co-simulation transports.
+//
+// Must be run on exactly 2 ranks on the same host, e.g.:
+//    mpiexec -n 2 btest_VEH_cosimTransport
+//
+// Rank 0 runs the benchmarks: each iteration sends a message to rank 1 which
+// echoes it back (one exchange). Message sizes correspond to a spindle state
+// (13 values) and to the mesh state of flexible tires of increasing resolution
+// (6 values per vertex). Rank 1 acts as an echo server.
+//
+// =============================================================================
+
+#include <cstring>
+#include <iostream>
+
+#include "benchmark/benchmark.h"
+
+#include "chrono_vehicle/cosim/ChVehicleCosimTransport.h"
+
+using namespace chrono::vehicle;
+
+// Transports (created collectively on both ranks)
+static ChVehicleCosimTransport* transports[2] = {nullptr, nullptr};
+
+// Control messages from the benchmark rank to the echo rank (always over MPI)
+static const int CONTROL_TAG = 1000;
+static const int DATA_TAG = 1;
+
+// -----------------------------------------------------------------------------
+
+static void Exchange(benchmark::State& state, int type) {
+    auto& transport = *transports[type];
+    int count = (int)state.range(0);
+
+    // Tell the echo rank which transport to use
+    MPI_Send(&type, 1, MPI_INT, 1, CONTROL_TAG, MPI_COMM_WORLD);
+
+    for (auto _ : state) {
+        double* out = transport.BeginSend<double>(count, 1, DATA_TAG);
+        for (int i = 0; i < count; i++)
+            out[i] = i;
+        transport.EndSend(1);
+
+        int n;
+        const double* in = transport.BeginRecv<double>(n, 1, DATA_TAG);
+        benchmark::DoNotOptimize(in[n - 1]);
+        transport.EndRecv(1);
+    }
+
+    // An empty message ends the echo loop
+    transport.Send<double>(nullptr, 0, 1, DATA_TAG);
+
+    state.SetBytesProcessed(2 * state.iterations() * count * sizeof(double));
+    state.counters["values"] = count;
+}
+
+static void EchoServer() {
+    while (true) {
+        int type;
+        MPI_Status status;
+        MPI_Recv(&type, 1, MPI_INT, 0, CONTROL_TAG, MPI_COMM_WORLD, &status);
+        if (type < 0)
+            return;
+
+        auto& transport = *transports[type];
+        while (true) {
+            int n;
+            const double* in = transport.BeginRecv<double>(n, 0, DATA_TAG);
+            if (n == 0) {
+                transport.EndRecv(0);
+                break;
+            }
+            double* out = transport.BeginSend<double>(n, 0, DATA_TAG);
+            std::memcpy(out, in, n * sizeof(double));
+            transport.EndSend(0);
+            transport.EndRecv(0);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static void Sizes(benchmark::internal::Benchmark* b) {
+    b->Arg(13);          // spindle state
+    b->Arg(6 * 1000);    // mesh state, 1000 vertices
+    b->Arg(6 * 10000);   // mesh state, 10000 vertices
+    b->Arg(6 * 50000);   // mesh state, 50000 vertices
+}
+
+BENCHMARK_CAPTURE(Exchange, MPI, 0)->Apply(Sizes)->UseRealTime();
+BENCHMARK_CAPTURE(Exchange, SHM, 1)->Apply(Sizes)->UseRealTime();
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+
+    int rank;
+    int size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    if (size != 2) {
+        if (rank == 0)
+            std::cout << "This benchmark must be run on exactly 2 ranks." << std::endl;
+        MPI_Finalize();
+        return 1;
+    }
+
+    if (!ChVehicleCosimTransportSHM::IsSupported()) {
+        if (rank == 0)
+            std::cout << "Both ranks must run on the same host." << std::endl;
+        MPI_Finalize();
+        return 1;
+    }
+
+    ChVehicleCosimTransportMPI transport_mpi;
+    ChVehicleCosimTransportSHM transport_shm(2);
+    transports[0] = &transport_mpi;
+    transports[1] = &transport_shm;
+
+    if (rank == 0) {
+        ::benchmark::Initialize(&argc, argv);
+        ::benchmark::RunSpecifiedBenchmarks();
+
+        // Stop the echo rank
+        int stop = -1;
+        MPI_Send(&stop, 1, MPI_INT, 1, CONTROL_TAG, MPI_COMM_WORLD);
+    } else {
+        EchoServer();
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,188 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the incremental broadphase of the multicore collision system.
+//
+// Spheres are dropped on a grid of fixed tiles. At regular intervals, collision
+// detection is performed with and without the incremental broadphase and the
+// test checks that:
+// - the two methods find the same contacts,
+// - the grid of static shapes is only rebuilt when the fixed bodies change,
+// - ray intersection tests find static shapes, also in a scene with static
+//   shapes only (empty grid of active shapes).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+using namespace chrono;
+
+// Collect the (sorted) list of body pairs in contact
+class ContactPairs : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        int idA = static_cast<ChBody*>(contactobjA)->GetIdentifier();
+        int idB = static_cast<ChBody*>(contactobjB)->GetIdentifier();
+        pairs.push_back(std::make_pair(std::min(idA, idB), std::max(idA, idB)));
+        return true;
+    }
+
+    std::vector<std::pair<int, int>> pairs;
+};
+
+static std::vector<std::pair<int, int>> FindContacts(ChSystemNSC& sys,
+                                                     ChCollisionSystemMulticore& coll,
+                                                     bool incremental) {
+    coll.EnableIncrementalBroadphase(incremental);
+    sys.ComputeCollisions();
+    auto reporter = chrono_types::make_shared<ContactPairs>();
+    sys.GetContactContainer()->ReportAllContacts(reporter);
+    std::sort(reporter->pairs.begin(), reporter->pairs.end());
+    return reporter->pairs;
+}
+
+TEST(ChBroadphase, incremental) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto coll = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    coll->SetBroadphaseGridDensity(2);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    int id = 0;
+
+    // Grid of fixed tiles
+    std::vector<std::shared_ptr<ChBody>> tiles;
+    for (int i = -5; i < 5; i++) {
+        for (int j = -5; j < 5; j++) {
+            auto tile = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 0.2, 1000, false, true, mat);
+            tile->SetIdentifier(id++);
+            tile->SetPos(ChVector<>(i + 0.5, j + 0.5, -0.1));
+            tile->SetBodyFixed(true);
+            sys.AddBody(tile);
+            tiles.push_back(tile);
+        }
+    }
+
+    // Falling spheres
+    for (int i = -4; i < 4; i++) {
+        for (int j = -4; j < 4; j++) {
+            auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+            ball->SetIdentifier(id++);
+            ball->SetPos(ChVector<>(i + 0.3, j + 0.7, 0.25 + 0.05 * (i + j + 8)));
+            sys.AddBody(ball);
+        }
+    }
+
+    // Compare contacts found with the two broadphase methods
+    int num_compared = 0;
+    for (int frame = 0; frame < 500; frame++) {
+        sys.DoStepDynamics(1e-3);
+        if (frame % 50 != 0)
+            continue;
+
+        auto pairs_ref = FindContacts(sys, *coll, false);
+        auto pairs_inc = FindContacts(sys, *coll, true);
+        ASSERT_EQ(pairs_ref.size(), pairs_inc.size());
+        ASSERT_TRUE(pairs_ref == pairs_inc);
+        num_compared += (int)pairs_ref.size();
+    }
+    ASSERT_GT(num_compared, 0);
+
+    // The static grid was built only once, as the fixed tiles did not change
+    ASSERT_EQ(coll->GetNumStaticGridUpdates(), 1);
+
+    // Moving a fixed body triggers an update of the static grid
+    tiles[0]->SetPos(tiles[0]->GetPos() - ChVector<>(0, 0, 0.5));
+    auto pairs_inc = FindContacts(sys, *coll, true);
+    ASSERT_EQ(coll->GetNumStaticGridUpdates(), 2);
+    auto pairs_ref = FindContacts(sys, *coll, false);
+    ASSERT_TRUE(pairs_ref == pairs_inc);
+
+    // Ray tests against a static shape give the same result with both methods
+    coll->EnableIncrementalBroadphase(true);
+    sys.ComputeCollisions();
+    ChCollisionSystem::ChRayhitResult res_inc;
+    ASSERT_TRUE(coll->RayHit(ChVector<>(-4.5, 4.5, 5), ChVector<>(-4.5, 4.5, -5), res_inc));
+
+    coll->EnableIncrementalBroadphase(false);
+    sys.ComputeCollisions();
+    ChCollisionSystem::ChRayhitResult res_ref;
+    ASSERT_TRUE(coll->RayHit(ChVector<>(-4.5, 4.5, 5), ChVector<>(-4.5, 4.5, -5), res_ref));
+
+    ASSERT_EQ(res_inc.hitModel, res_ref.hitModel);
+    ASSERT_NEAR(res_inc.abs_hitPoint.z(), 0.0, 1e-3);
+    ASSERT_NEAR(res_ref.abs_hitPoint.z(), 0.0, 1e-3);
+}
+
+TEST(ChBroadphase, incremental_static_rays) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+
+    auto coll = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    coll->SetBroadphaseGridDensity(2);
+    coll->EnableIncrementalBroadphase(true);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    // Row of fixed tiles (no active shapes)
+    std::vector<std::shared_ptr<ChBody>> tiles;
+    for (int i = 0; i < 4; i++) {
+        auto tile = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 0.2, 1000, false, true, mat);
+        tile->SetPos(ChVector<>(i + 0.5, 0.5, -0.1));
+        tile->SetBodyFixed(true);
+        sys.AddBody(tile);
+        tiles.push_back(tile);
+    }
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(coll->GetNumStaticGridUpdates(), 1);
+
+    // Single rays
+    ChCollisionSystem::ChRayhitResult result;
+    ASSERT_TRUE(coll->RayHit(ChVector<>(2.5, 0.5, 5), ChVector<>(2.5, 0.5, -5), result));
+    ASSERT_EQ(result.hitModel, tiles[2]->GetCollisionModel().get());
+    ASSERT_NEAR(result.abs_hitPoint.z(), 0.0, 1e-3);
+    ASSERT_FALSE(coll->RayHit(ChVector<>(2.5, 2.5, 5), ChVector<>(2.5, 2.5, -5), result));
+
+    // Batch of rays, one per tile and one missing all tiles
+    std::vector<ChCollisionSystem::ChRay> rays(5);
+    for (int i = 0; i < 5; i++) {
+        rays[i].from = ChVector<>(i + 0.5, 0.5, 5);
+        rays[i].to = ChVector<>(i + 0.5, 0.5, -5);
+    }
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    coll->RayHitBatch(rays, results, 1);
+    ASSERT_EQ(results.size(), rays.size());
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(results[i].hit);
+        ASSERT_EQ(results[i].hitModel, tiles[i]->GetCollisionModel().get());
+        ASSERT_NEAR(results[i].abs_hitPoint.z(), 0.0, 1e-3);
+    }
+    ASSERT_FALSE(results[4].hit);
+}
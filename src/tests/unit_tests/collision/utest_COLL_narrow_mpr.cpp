@@ -695,3 +695,180 @@ TEST(ChNarrowphaseMPR, roundedcyl_sphere) {
      }
      */
 }
+
+// =============================================================================
+
+TEST(ChNarrowphaseMPR, batch) {
+    // Random pairs of shapes in near-contact, for several combinations of shape types, processed with the scalar and
+    // the batched MPR algorithms.
+    int types[] = {ChCollisionShape::Type::SPHERE,   ChCollisionShape::Type::BOX,        ChCollisionShape::Type::ELLIPSOID,
+                   ChCollisionShape::Type::CYLINDER, ChCollisionShape::Type::CAPSULE,    ChCollisionShape::Type::CONE,
+                   ChCollisionShape::Type::ROUNDEDBOX, ChCollisionShape::Type::ROUNDEDCYL};
+
+    ChSetRandomSeed(13);
+    auto rand_quat = []() {
+        quaternion q(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5);
+        return q / Sqrt(Dot(q));
+    };
+    auto rand_dims = []() { return real3(0.3 + 0.2 * ChRandom(), 0.3 + 0.2 * ChRandom(), 0.3 + 0.2 * ChRandom()); };
+
+    const int num_pairs = 103;
+    const real env = 0.01;
+
+    for (auto typeA : types) {
+        for (auto typeB : types) {
+            std::vector<ConvexShapeCustom> shapesA;
+            std::vector<ConvexShapeCustom> shapesB;
+            for (int i = 0; i < num_pairs; i++) {
+                real3 dir = Normalize(real3(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5));
+                real dist = 0.5 + 0.5 * ChRandom();
+                shapesA.push_back(ConvexShapeCustom(typeA, real3(0), rand_quat(), rand_dims(), 0.05));
+                shapesB.push_back(ConvexShapeCustom(typeB, dist * dir, rand_quat(), rand_dims(), 0.05));
+            }
+
+            std::vector<const ConvexBase*> ptrA(num_pairs);
+            std::vector<const ConvexBase*> ptrB(num_pairs);
+            for (int i = 0; i < num_pairs; i++) {
+                ptrA[i] = &shapesA[i];
+                ptrB[i] = &shapesB[i];
+            }
+
+            std::vector<real3> norm(num_pairs);
+            std::vector<real3> pt1(num_pairs);
+            std::vector<real3> pt2(num_pairs);
+            std::vector<real> depth(num_pairs);
+            std::vector<char> found(num_pairs);
+            ChNarrowphase::MPRCollisionBatch(num_pairs, ptrA.data(), ptrB.data(), env, norm.data(), pt1.data(),
+                                             pt2.data(), depth.data(), found.data());
+
+            for (int i = 0; i < num_pairs; i++) {
+                real3 norm_s;
+                real3 pt1_s;
+                real3 pt2_s;
+                real depth_s;
+                bool found_s = ChNarrowphase::MPRCollision(ptrA[i], ptrB[i], env, norm_s, pt1_s, pt2_s, depth_s);
+                ASSERT_EQ(found_s, found[i] != 0);
+                if (!found_s)
+                    continue;
+                // Differences in round-off (e.g., fused multiply-add) can change the number of MPR iterations. This
+                // barely affects the normal and depth, but the contact points can slide along flat contact patches.
+                Assert_near(norm[i], norm_s, 1e-4);
+                ASSERT_NEAR(depth[i], depth_s, 1e-5);
+                Assert_near(pt1[i], pt1_s, 2e-2);
+                Assert_near(pt2[i], pt2_s, 2e-2);
+            }
+        }
+    }
+}
+
+// Convex hull contact shape, with the points given in the shape frame.
+class ConvexShapeHull : public ConvexBase {
+  public:
+    ConvexShapeHull(const real3& p, const quaternion& rot, const std::vector<real3>& pts)
+        : position(p), rotation(rot), points(pts) {}
+    inline int Type() const override { return ChCollisionShape::Type::CONVEXHULL; }
+    inline real3 A() const override { return position; }
+    inline quaternion R() const override { return rotation; }
+    inline int Size() const override { return (int)points.size(); }
+    inline const real3* Convex() const override { return points.data(); }
+    real3 position;
+    quaternion rotation;
+    std::vector<real3> points;
+};
+
+TEST(ChNarrowphaseMPR, batch_scalar_support) {
+    // Pairs involving triangles and convex hulls, whose support functions are evaluated one lane at a time by the
+    // batched MPR algorithm. Results must match those of the scalar algorithm.
+    ChSetRandomSeed(17);
+    auto rand_quat = []() {
+        quaternion q(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5);
+        return q / Sqrt(Dot(q));
+    };
+    auto rand_dims = []() { return real3(0.3 + 0.2 * ChRandom(), 0.3 + 0.2 * ChRandom(), 0.3 + 0.2 * ChRandom()); };
+    auto rand_hull = [](const real3& dims) {
+        // Corners of a box, plus random points inside it
+        std::vector<real3> pts;
+        for (int k = 0; k < 8; k++)
+            pts.push_back(real3((k & 1) ? dims.x : -dims.x, (k & 2) ? dims.y : -dims.y, (k & 4) ? dims.z : -dims.z));
+        for (int k = 0; k < 4; k++)
+            pts.push_back(real3(dims.x * (2 * ChRandom() - 1), dims.y * (2 * ChRandom() - 1),
+                                dims.z * (2 * ChRandom() - 1)));
+        return pts;
+    };
+
+    const int num_pairs = 103;
+    const real env = 0.01;
+
+    // Shape type combinations (shape A is a triangle or a hull)
+    struct Combination {
+        int typeA;
+        int typeB;
+    };
+    Combination combinations[] = {{ChCollisionShape::Type::TRIANGLE, ChCollisionShape::Type::SPHERE},
+                                  {ChCollisionShape::Type::TRIANGLE, ChCollisionShape::Type::BOX},
+                                  {ChCollisionShape::Type::TRIANGLE, ChCollisionShape::Type::CONVEXHULL},
+                                  {ChCollisionShape::Type::CONVEXHULL, ChCollisionShape::Type::SPHERE},
+                                  {ChCollisionShape::Type::CONVEXHULL, ChCollisionShape::Type::BOX},
+                                  {ChCollisionShape::Type::CONVEXHULL, ChCollisionShape::Type::CONVEXHULL}};
+
+    for (const auto& comb : combinations) {
+        std::vector<std::unique_ptr<ConvexBase>> shapesA;
+        std::vector<std::unique_ptr<ConvexBase>> shapesB;
+        for (int i = 0; i < num_pairs; i++) {
+            if (comb.typeA == ChCollisionShape::Type::TRIANGLE) {
+                // Triangle in the z=0 plane, around the origin
+                real3 t1(-0.6 - 0.2 * ChRandom(), -0.6 - 0.2 * ChRandom(), 0);
+                real3 t2(+0.6 + 0.2 * ChRandom(), -0.6 - 0.2 * ChRandom(), 0);
+                real3 t3(0.2 * ChRandom() - 0.1, +0.6 + 0.2 * ChRandom(), 0);
+                shapesA.emplace_back(new ConvexShapeTriangle(t1, t2, t3));
+            } else {
+                shapesA.emplace_back(new ConvexShapeHull(real3(0), rand_quat(), rand_hull(rand_dims())));
+            }
+
+            // Second shape above the first one, in near-contact (farther up for a hull, which may extend to z=0.5,
+            // so that some of the pairs are separated)
+            real dz = (comb.typeA == ChCollisionShape::Type::TRIANGLE) ? 0.6 : 1.6;
+            real3 pos(0.6 * ChRandom() - 0.3, 0.6 * ChRandom() - 0.3, 0.2 + dz * ChRandom());
+            if (comb.typeB == ChCollisionShape::Type::CONVEXHULL)
+                shapesB.emplace_back(new ConvexShapeHull(pos, rand_quat(), rand_hull(rand_dims())));
+            else
+                shapesB.emplace_back(new ConvexShapeCustom(comb.typeB, pos, rand_quat(), rand_dims(), 0.05));
+        }
+
+        std::vector<const ConvexBase*> ptrA(num_pairs);
+        std::vector<const ConvexBase*> ptrB(num_pairs);
+        for (int i = 0; i < num_pairs; i++) {
+            ptrA[i] = shapesA[i].get();
+            ptrB[i] = shapesB[i].get();
+        }
+
+        std::vector<real3> norm(num_pairs);
+        std::vector<real3> pt1(num_pairs);
+        std::vector<real3> pt2(num_pairs);
+        std::vector<real> depth(num_pairs);
+        std::vector<char> found(num_pairs);
+        ChNarrowphase::MPRCollisionBatch(num_pairs, ptrA.data(), ptrB.data(), env, norm.data(), pt1.data(),
+                                         pt2.data(), depth.data(), found.data());
+
+        int num_found = 0;
+        for (int i = 0; i < num_pairs; i++) {
+            real3 norm_s;
+            real3 pt1_s;
+            real3 pt2_s;
+            real depth_s;
+            bool found_s = ChNarrowphase::MPRCollision(ptrA[i], ptrB[i], env, norm_s, pt1_s, pt2_s, depth_s);
+            ASSERT_EQ(found_s, found[i] != 0);
+            if (!found_s)
+                continue;
+            num_found++;
+            Assert_near(norm[i], norm_s, 1e-4);
+            ASSERT_NEAR(depth[i], depth_s, 1e-5);
+            Assert_near(pt1[i], pt1_s, 2e-2);
+            Assert_near(pt2[i], pt2_s, 2e-2);
+        }
+
+        // Some, but not all, pairs are in contact
+        ASSERT_GT(num_found, 0);
+        ASSERT_LT(num_found, num_pairs);
+    }
+}
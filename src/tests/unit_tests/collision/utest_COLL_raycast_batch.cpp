@@ -0,0 +1,136 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for batched ray casting (ChCollisionSystem::RayHitBatch).
+//
+// A scene with spheres, boxes, cylinders, and convex hulls (fixed and free,
+// with arbitrary orientations) is traced with a grid of vertical rays and with
+// rays in random directions. For each ray, the result of the batch must match
+// that of RayHit (hit flag, hit model, distance factor, and normal), for
+// several numbers of threads.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+class RayHitBatchTest : public ::testing::TestWithParam<ChCollisionSystem::Type> {
+  protected:
+    RayHitBatchTest() {
+        sys.SetCollisionSystemType(GetParam());
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+        std::vector<ChVector<>> hull_points = {{-0.3, -0.2, -0.1}, {0.3, -0.2, -0.1}, {0.0, 0.35, -0.1},
+                                               {0.0, 0.0, 0.4},    {0.1, 0.1, -0.3},  {-0.2, 0.1, 0.2}};
+
+        // Shapes on a 5x5 grid (without overlaps), cycling over the shape types
+        int n = 0;
+        for (int ix = 0; ix < 5; ix++) {
+            for (int iy = 0; iy < 5; iy++) {
+                std::shared_ptr<ChBody> body;
+                switch (n % 4) {
+                    case 0:
+                        body = chrono_types::make_shared<ChBodyEasySphere>(0.3 + 0.02 * iy, 1000, false, true, mat);
+                        break;
+                    case 1:
+                        body = chrono_types::make_shared<ChBodyEasyBox>(0.6, 0.4, 0.3 + 0.05 * ix, 1000, false, true,
+                                                                        mat);
+                        break;
+                    case 2:
+                        body = chrono_types::make_shared<ChBodyEasyCylinder>(geometry::ChAxis::Y, 0.25, 0.5, 1000,
+                                                                             false, true, mat);
+                        break;
+                    case 3:
+                        body = chrono_types::make_shared<ChBodyEasyConvexHull>(hull_points, 1000, false, true, mat);
+                        break;
+                }
+                body->SetPos(ChVector<>(ix - 2.0, iy - 2.0, 0.2 * ((ix + iy) % 3)));
+                body->SetRot(Q_from_Euler123(ChVector<>(0.3 * ix, -0.2 * iy, 0.1 * n)));
+                body->SetBodyFixed(n % 3 == 0);
+                sys.AddBody(body);
+                n++;
+            }
+        }
+
+        // Bind the collision models and run collision detection to update the collision system data
+        sys.GetCollisionSystem()->Initialize();
+        sys.ComputeCollisions();
+    }
+
+    // Cast the rays in a batch and one by one, and compare the results
+    void CheckRays(const std::vector<ChCollisionSystem::ChRay>& rays) {
+        auto coll = sys.GetCollisionSystem();
+
+        std::vector<ChCollisionSystem::ChRayhitResult> expected(rays.size());
+        int num_hits = 0;
+        for (size_t i = 0; i < rays.size(); i++) {
+            coll->RayHit(rays[i].from, rays[i].to, expected[i]);
+            num_hits += expected[i].hit;
+        }
+        ASSERT_GT(num_hits, 0);
+        ASSERT_LT(num_hits, (int)rays.size());
+
+        for (int nthreads : {1, 4}) {
+            std::vector<ChCollisionSystem::ChRayhitResult> results;
+            coll->RayHitBatch(rays, results, nthreads);
+            ASSERT_EQ(results.size(), rays.size());
+            for (size_t i = 0; i < rays.size(); i++) {
+                ASSERT_EQ(results[i].hit, expected[i].hit) << "ray " << i;
+                if (!expected[i].hit)
+                    continue;
+                ASSERT_EQ(results[i].hitModel, expected[i].hitModel) << "ray " << i;
+                ASSERT_NEAR(results[i].dist_factor, expected[i].dist_factor, 1e-9) << "ray " << i;
+                ASSERT_NEAR((results[i].abs_hitNormal - expected[i].abs_hitNormal).Length(), 0, 1e-6) << "ray " << i;
+                ASSERT_NEAR((results[i].abs_hitPoint - expected[i].abs_hitPoint).Length(), 0, 1e-6) << "ray " << i;
+            }
+        }
+    }
+
+    ChSystemNSC sys;
+};
+
+TEST_P(RayHitBatchTest, grid_rays) {
+    // Vertical rays, ordered along a grid (coherent packets)
+    std::vector<ChCollisionSystem::ChRay> rays;
+    for (int i = 0; i < 60; i++) {
+        for (int j = 0; j < 60; j++) {
+            ChVector<> xy(-3.0 + 0.1 * i, -3.0 + 0.1 * j, 0);
+            rays.push_back({xy + ChVector<>(0, 0, 2), xy + ChVector<>(0, 0, -2)});
+        }
+    }
+    CheckRays(rays);
+}
+
+TEST_P(RayHitBatchTest, random_rays) {
+    // Rays with random start points and directions (incoherent packets), some of them not reaching any shape
+    std::vector<ChCollisionSystem::ChRay> rays;
+    for (int i = 0; i < 1000; i++) {
+        ChVector<> from(6 * ChRandom() - 3, 6 * ChRandom() - 3, 2 * ChRandom() - 1);
+        ChVector<> dir(2 * ChRandom() - 1, 2 * ChRandom() - 1, 2 * ChRandom() - 1);
+        rays.push_back({from, from + dir * (3 * ChRandom())});
+    }
+    CheckRays(rays);
+}
+
+#ifdef CHRONO_COLLISION
+INSTANTIATE_TEST_SUITE_P(ChCollisionSystem,
+                         RayHitBatchTest,
+                         ::testing::Values(ChCollisionSystem::Type::BULLET, ChCollisionSystem::Type::MULTICORE));
+#else
+INSTANTIATE_TEST_SUITE_P(ChCollisionSystem, RayHitBatchTest, ::testing::Values(ChCollisionSystem::Type::BULLET));
+#endif
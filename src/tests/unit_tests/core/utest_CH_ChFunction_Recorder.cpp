@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for ChFunction_Recorder
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "motion_functions/ChFunction_Recorder.h"
+
+using namespace chrono;
+
+// Reference linear interpolation of y = sin(x) sampled at the given (sorted) abscissas
+static double Reference(const std::vector<double>& xs, double x) {
+    if (x <= xs.front())
+        return std::sin(xs.front());
+    if (x >= xs.back())
+        return std::sin(xs.back());
+    size_t i = 0;
+    while (xs[i + 1] < x)
+        i++;
+    double t = (x - xs[i]) / (xs[i + 1] - xs[i]);
+    return (1 - t) * std::sin(xs[i]) + t * std::sin(xs[i + 1]);
+}
+
+static void CheckRandomAccess(const ChFunction_Recorder& fun, const std::vector<double>& xs) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(xs.front() - 0.5, xs.back() + 0.5);
+    for (int k = 0; k < 500; k++) {
+        double x = dist(gen);
+        ASSERT_NEAR(fun.Get_y(x), Reference(xs, x), 1e-12);
+    }
+    // backward sweep
+    for (double x = xs.back() + 0.1; x > xs.front() - 0.1; x -= 0.013)
+        ASSERT_NEAR(fun.Get_y(x), Reference(xs, x), 1e-12);
+    // sample points
+    for (auto x : xs)
+        ASSERT_NEAR(fun.Get_y(x), std::sin(x), 1e-12);
+}
+
+TEST(ChFunctionRecorderTest, random_insertion) {
+    std::vector<double> xs;
+    double x = 0;
+    for (int i = 0; i < 200; i++) {
+        x += 0.01 + 0.1 * std::abs(std::sin(3.0 * i));
+        xs.push_back(x);
+    }
+
+    std::vector<size_t> order(xs.size());
+    for (size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937(1));
+
+    ChFunction_Recorder fun;
+    for (auto i : order)
+        fun.AddPoint(xs[i], std::sin(xs[i]));
+
+    // overwrite an existing point
+    fun.AddPoint(xs[10], 100.0);
+    fun.AddPoint(xs[10], std::sin(xs[10]));
+
+    ASSERT_EQ(fun.GetPoints().size(), xs.size());
+    for (size_t i = 0; i < xs.size(); i++)
+        ASSERT_EQ(fun.GetPoints()[i].x, xs[i]);
+
+    CheckRandomAccess(fun, xs);
+}
+
+TEST(ChFunctionRecorderTest, bulk_load) {
+    std::vector<double> xs;
+    std::vector<double> ys;
+    for (int i = 0; i < 300; i++) {
+        xs.push_back(0.05 * i * i / 300.0 + 0.01 * i);
+        ys.push_back(std::sin(xs.back()));
+    }
+
+    // add in reverse order, with a duplicate whose last value must be kept
+    std::vector<double> xs_r(xs.rbegin(), xs.rend());
+    std::vector<double> ys_r(ys.rbegin(), ys.rend());
+    xs_r.insert(xs_r.begin(), xs[5]);
+    ys_r.insert(ys_r.begin(), -100.0);
+
+    ChFunction_Recorder fun;
+    fun.AddPoints(xs_r, ys_r);
+
+    ASSERT_EQ(fun.GetPoints().size(), xs.size());
+    CheckRandomAccess(fun, xs);
+}
+
+TEST(ChFunctionRecorderTest, uniform_grid) {
+    std::vector<double> xs;
+    std::vector<double> ys;
+    for (int i = 0; i < 1000; i++) {
+        xs.push_back(-1.0 + 0.01 * i);
+        ys.push_back(std::sin(xs.back()));
+    }
+
+    ChFunction_Recorder fun;
+    fun.AddPoints(xs, ys);
+    CheckRandomAccess(fun, xs);
+
+    // adding a point breaks the uniform spacing
+    fun.AddPoint(0.123, std::sin(0.123));
+    xs.insert(std::upper_bound(xs.begin(), xs.end(), 0.123), 0.123);
+    CheckRandomAccess(fun, xs);
+
+    // copies evaluate the same
+    ChFunction_Recorder fun2(fun);
+    CheckRandomAccess(fun2, xs);
+}
+
+TEST(ChFunctionRecorderTest, interleaved_recording) {
+    // Points appended in increasing order while the function is evaluated (e.g. recording during a simulation)
+    std::vector<double> xs;
+    ChFunction_Recorder fun;
+    for (int i = 0; i < 400; i++) {
+        xs.push_back(0.5 + 0.02 * i);
+        fun.AddPoint(xs.back(), std::sin(xs.back()));
+        if (xs.size() > 1) {
+            double x = 0.5 + 0.37 * (xs.back() - 0.5);
+            ASSERT_NEAR(fun.Get_y(x), Reference(xs, x), 1e-12);
+        }
+    }
+    CheckRandomAccess(fun, xs);
+
+    // appending a point off the uniform grid
+    xs.push_back(xs.back() + 0.013);
+    fun.AddPoint(xs.back(), std::sin(xs.back()));
+    CheckRandomAccess(fun, xs);
+
+    // copy assignment
+    ChFunction_Recorder fun2;
+    fun2 = fun;
+    CheckRandomAccess(fun2, xs);
+}
@@ -0,0 +1,356 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test Jacobians obtained by forward-mode automatic differentiation (dual
+// numbers) for loads and beam sections, against numerical differentiation and
+// analytical expressions. Also test the pressure loader, which provides
+// Jacobians by automatic differentiation.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/core/ChDual.h"
+#include "chrono/physics/ChLoad.h"
+#include "chrono/physics/ChLoaderAD.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+#include "chrono/fea/ChTetrahedronFace.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChNodeFEAxyzD.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChBeamSectionEuler.h"
+#include "chrono/fea/ChBeamSectionCosserat.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// -----------------------------------------------------------------------------
+
+// Nonlinear spring-damper pulling a node towards a fixed point.
+// This loader does not opt in to automatic differentiation.
+class SpringLoader : public ChLoaderUVWatomic {
+  public:
+    SpringLoader(std::shared_ptr<ChLoadableUVW> loadable) : ChLoaderUVWatomic(loadable, 0, 0, 0) {}
+
+    virtual void ComputeF(const double U,
+                          const double V,
+                          const double W,
+                          ChVectorDynamic<>& F,
+                          ChVectorDynamic<>* state_x,
+                          ChVectorDynamic<>* state_w) override {
+        ComputeForce(*state_x, *state_w, F);
+    }
+
+    virtual bool IsStiff() override { return true; }
+
+    template <typename Real>
+    void ComputeForce(const ChVectorDynamic<Real>& x, const ChVectorDynamic<Real>& v, ChVectorDynamic<Real>& F) {
+        using std::sqrt;
+        Real dx = x(0) - 1.0;
+        Real dy = x(1) - 0.5;
+        Real dz = x(2) + 0.2;
+        Real len = sqrt(dx * dx + dy * dy + dz * dz);
+        Real vn = (v(0) * dx + v(1) * dy + v(2) * dz) / len;
+        Real f = -1000.0 * (len - 0.3) * len - 20.0 * vn * vn * vn;
+        F(0) = f * dx / len;
+        F(1) = f * dy / len;
+        F(2) = f * dz / len;
+    }
+};
+
+// Same loader, with Jacobians by automatic differentiation.
+class SpringLoaderAD : public SpringLoader {
+  public:
+    SpringLoaderAD(std::shared_ptr<ChLoadableUVW> loadable) : SpringLoader(loadable) {}
+
+    virtual bool ComputeJacobianAD(const ChVectorDynamic<>& state_x,
+                                   const ChVectorDynamic<>& state_w,
+                                   ChMatrixRef K,
+                                   ChMatrixRef R) override {
+        return ChLoaderComputeJacobianAD(*this, state_x, state_w, K, R);
+    }
+
+    // For a node the generalized load is the force itself
+    template <typename Real>
+    bool ComputeQ_AD(const ChVectorDynamic<Real>& state_x,
+                     const ChVectorDynamic<Real>& state_w,
+                     ChVectorDynamic<Real>& Q) {
+        ComputeForce(state_x, state_w, Q);
+        return true;
+    }
+};
+
+TEST(ChLoad, jacobian_AD) {
+    ASSERT_FALSE(ChLoaderHasAD<SpringLoader>::value);
+    ASSERT_TRUE(ChLoaderHasAD<SpringLoaderAD>::value);
+
+    auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0.2, 0.1, 0.4));
+    node->SetPos_dt(ChVector<>(1.5, -2.0, 0.7));
+
+    ChLoad<SpringLoader> load_fd(node);
+    ChLoad<SpringLoaderAD> load_ad(node);
+    load_fd.Update(0);
+    load_ad.Update(0);
+
+    // Loads at current state
+    ASSERT_EQ(load_ad.loader.Q.size(), 3);
+    for (int i = 0; i < 3; i++)
+        ASSERT_NEAR(load_ad.loader.Q(i), load_fd.loader.Q(i), 1e-4 * std::abs(load_fd.loader.Q(i)) + 1e-8);
+
+    // Jacobians
+    const auto& K_fd = load_fd.GetJacobians()->K;
+    const auto& R_fd = load_fd.GetJacobians()->R;
+    const auto& K_ad = load_ad.GetJacobians()->K;
+    const auto& R_ad = load_ad.GetJacobians()->R;
+    double K_norm = K_ad.lpNorm<Eigen::Infinity>();
+    double R_norm = R_ad.lpNorm<Eigen::Infinity>();
+    ASSERT_GT(K_norm, 0);
+    ASSERT_GT(R_norm, 0);
+    // the forward-difference roundoff error scales with |Q| / delta, not with the Jacobian entries
+    double Q_norm = load_ad.loader.Q.lpNorm<Eigen::Infinity>();
+    ASSERT_LT((K_ad - K_fd).lpNorm<Eigen::Infinity>(), 1e-5 * K_norm);
+    ASSERT_LT((R_ad - R_fd).lpNorm<Eigen::Infinity>(), 1e-7 * Q_norm);
+
+    // Check one entry against its analytical value: dQ/dv for a velocity along the spring
+    // (d/dv of -20*vn^3*n is -60*vn^2*n*n')
+    ChVector<> d = node->GetPos() - ChVector<>(1.0, 0.5, -0.2);
+    ChVector<> n = d.GetNormalized();
+    double vn = node->GetPos_dt() ^ n;
+    ASSERT_NEAR(R_ad(0, 1), 60 * vn * vn * n.x() * n.y(), 1e-10 * R_norm);
+}
+
+// -----------------------------------------------------------------------------
+
+static std::shared_ptr<ChElementTetraCorot_4> CreateTetrahedron(std::vector<std::shared_ptr<ChNodeFEAxyz>>& nodes) {
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0.1, 0.0, 0.05)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(1.2, 0.1, -0.1)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0.2, 0.9, 0.2)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0.3, 0.2, 1.1)));
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    auto element = chrono_types::make_shared<ChElementTetraCorot_4>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3]);
+    element->SetMaterial(material);
+    element->ComputeVolume();
+
+    return element;
+}
+
+TEST(ChLoaderPressure, jacobian_AD) {
+    ASSERT_TRUE(ChLoaderHasAD<ChLoaderPressure>::value);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto element = CreateTetrahedron(nodes);
+    auto face = chrono_types::make_shared<ChTetrahedronFace>(element, 3);
+
+    ChLoad<ChLoaderPressure> load(face);
+    load.loader.SetPressure(2.5e3);
+    load.loader.SetStiff(true);
+    load.Update(0);
+
+    // The pressure load is a follower load: its stiffness is obtained by perturbing the node positions.
+    // (ComputeF evaluates the normal at the current node positions, so Q is re-evaluated after moving the nodes)
+    const double delta = 1e-6;
+    ChMatrixDynamic<> K_cd(9, 9);
+    for (int j = 0; j < 9; j++) {
+        auto node = face->GetNodeN(j / 3);
+        ChVector<> pos = node->GetPos();
+        ChVector<> dpos(0, 0, 0);
+        dpos[j % 3] = delta;
+        node->SetPos(pos + dpos);
+        load.loader.ComputeQ(nullptr, nullptr);
+        ChVectorDynamic<> Qp = load.loader.Q;
+        node->SetPos(pos - dpos);
+        load.loader.ComputeQ(nullptr, nullptr);
+        ChVectorDynamic<> Qm = load.loader.Q;
+        node->SetPos(pos);
+        K_cd.col(j) = -(Qp - Qm) / (2 * delta);
+    }
+    load.loader.ComputeQ(nullptr, nullptr);
+
+    const auto& K_ad = load.GetJacobians()->K;
+    const auto& R_ad = load.GetJacobians()->R;
+    double K_norm = K_cd.lpNorm<Eigen::Infinity>();
+    ASSERT_GT(K_norm, 0);
+    ASSERT_LT((K_ad - K_cd).lpNorm<Eigen::Infinity>(), 1e-6 * K_norm);
+    ASSERT_EQ(R_ad.lpNorm<Eigen::Infinity>(), 0);
+
+    // Total force: -p * area * normal
+    ChVector<> p0 = face->GetNodeN(0)->GetPos();
+    ChVector<> p1 = face->GetNodeN(1)->GetPos();
+    ChVector<> p2 = face->GetNodeN(2)->GetPos();
+    ChVector<> f = Vcross(p1 - p0, p2 - p0) * (-0.5 * 2.5e3);
+    for (int k = 0; k < 3; k++)
+        ASSERT_NEAR(load.loader.Q(k) + load.loader.Q(3 + k) + load.loader.Q(6 + k), f[k], 1e-9 * f.Length());
+}
+
+TEST(ChLoaderPressure, jacobian_AD_shell) {
+    // Warped ANCF shell element, loaded on its mid-surface
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(0.0, 0.0, 0.0), ChVector<>(0.0, 0.1, 1.0)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(1.1, 0.1, 0.2), ChVector<>(0.1, 0.0, 1.0)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(1.0, 0.9, -0.1), ChVector<>(0.0, 0.0, 1.0)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(-0.1, 1.0, 0.3), ChVector<>(-0.1, 0.1, 1.0)));
+
+    auto material = chrono_types::make_shared<ChMaterialShellANCF>(1000, 1e7, 0.3);
+    auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3]);
+    element->SetDimensions(1.0, 1.0);
+    element->AddLayer(0.01, 0, material);
+
+    // Let the system set up the element (thickness, layers)
+    ChSystemSMC sys;
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    for (auto& node : nodes)
+        mesh->AddNode(node);
+    mesh->AddElement(element);
+    sys.Add(mesh);
+    sys.Update();
+
+    ChLoad<ChLoaderPressure> load(element);
+    load.loader.SetPressure(2.5e3);
+    load.loader.SetIntegrationPoints(2);
+    load.loader.SetStiff(true);
+    load.Update(0);
+
+    // The loader must not fall back to numerical differentiation for this element
+    ChState x(24, nullptr);
+    ChStateDelta w(24, nullptr);
+    element->LoadableGetStateBlock_x(0, x);
+    element->LoadableGetStateBlock_w(0, w);
+    ChMatrixDynamic<> K(24, 24);
+    ChMatrixDynamic<> R(24, 24);
+    ASSERT_TRUE(load.loader.ComputeJacobianAD(x, w, K, R));
+
+    // Central differences with respect to the node positions and gradients
+    const double delta = 1e-6;
+    ChMatrixDynamic<> K_cd(24, 24);
+    for (int j = 0; j < 24; j++) {
+        auto node = nodes[j / 6];
+        bool is_pos = (j % 6) < 3;
+        ChVector<> val = is_pos ? node->GetPos() : node->GetD();
+        ChVector<> dval(0, 0, 0);
+        dval[j % 3] = delta;
+        is_pos ? node->SetPos(val + dval) : node->SetD(val + dval);
+        load.loader.ComputeQ(nullptr, nullptr);
+        ChVectorDynamic<> Qp = load.loader.Q;
+        is_pos ? node->SetPos(val - dval) : node->SetD(val - dval);
+        load.loader.ComputeQ(nullptr, nullptr);
+        ChVectorDynamic<> Qm = load.loader.Q;
+        is_pos ? node->SetPos(val) : node->SetD(val);
+        K_cd.col(j) = -(Qp - Qm) / (2 * delta);
+    }
+    load.loader.ComputeQ(nullptr, nullptr);
+
+    const auto& K_ad = load.GetJacobians()->K;
+    double K_norm = K_cd.lpNorm<Eigen::Infinity>();
+    ASSERT_GT(K_norm, 0);
+    ASSERT_LT((K_ad - K_cd).lpNorm<Eigen::Infinity>(), 1e-6 * K_norm);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST(ChDual, derivatives) {
+    typedef ChDual<2> Dual;
+    Dual x(0.7, 0);
+    Dual y(-1.3, 1);
+
+    Dual f = sin(x * y) + exp(x) / y - sqrt(x * x + y * y) + atan2(y, x) + pow(x, 3.0);
+
+    double xv = 0.7;
+    double yv = -1.3;
+    double r = std::sqrt(xv * xv + yv * yv);
+    double dfdx = std::cos(xv * yv) * yv + std::exp(xv) / yv - xv / r - yv / (r * r) + 3 * xv * xv;
+    double dfdy = std::cos(xv * yv) * xv - std::exp(xv) / (yv * yv) - yv / r + xv / (r * r);
+
+    ASSERT_NEAR(f.value(), std::sin(xv * yv) + std::exp(xv) / yv - r + std::atan2(yv, xv) + xv * xv * xv, 1e-14);
+    ASSERT_NEAR(f.derivative(0), dfdx, 1e-13);
+    ASSERT_NEAR(f.derivative(1), dfdy, 1e-13);
+}
+
+// -----------------------------------------------------------------------------
+
+// Central-difference derivative of the quadratic terms with respect to the angular velocity
+template <class Section>
+static ChMatrixNM<double, 6, 6> QuadraticTermsJacobian(Section& section, const ChVector<>& w) {
+    const double delta = 1e-5;
+    ChMatrixNM<double, 6, 6> Ri;
+    Ri.setZero();
+    for (int j = 0; j < 3; j++) {
+        ChVector<> dw(0, 0, 0);
+        dw[j] = delta;
+        ChVector<> Fp, Tp, Fm, Tm;
+        section.ComputeQuadraticTerms(Fp, Tp, w + dw);
+        section.ComputeQuadraticTerms(Fm, Tm, w - dw);
+        Ri.block(0, 3 + j, 3, 1) = (Fp - Fm).eigen() / (2 * delta);
+        Ri.block(3, 3 + j, 3, 1) = (Tp - Tm).eigen() / (2 * delta);
+    }
+    return Ri;
+}
+
+TEST(ChBeamSection, inertia_damping_AD) {
+    ChVector<> w(0.3, -1.2, 2.5);
+    ChMatrixNM<double, 6, 6> Ri_analytic;
+    ChMatrixNM<double, 6, 6> Ri_ad;
+
+    // Euler beam section with offset mass center.
+    // With compute_Ri_Ki_by_autodiff, the default implementation in the base class is used, which
+    // differentiates the quadratic terms on dual numbers. Note that the analytical Ri of this section also
+    // accounts for the rotary inertia about the y and z axes, which the quadratic terms neglect.
+    ChBeamSectionEulerAdvancedGeneric euler(1e6, 1e5, 1e4, 1e4, 0, 0, 0, 0, 0, 12.0, 0.4, 0.05, -0.03);
+    euler.compute_Ri_Ki_by_autodiff = true;
+    euler.ComputeInertiaDampingMatrix(Ri_ad, w);
+    auto Ri_fd = QuadraticTermsJacobian(euler, w);
+    ASSERT_GT(Ri_fd.lpNorm<Eigen::Infinity>(), 0);
+    ASSERT_LT((Ri_ad - Ri_fd).lpNorm<Eigen::Infinity>(), 1e-8);
+
+    // Cosserat inertia with offset mass center
+    ChInertiaCosseratAdvanced inertia(12.0, 0.05, -0.03, 0.2, 0.3, 0.01);
+    inertia.ComputeInertiaDampingMatrix(Ri_analytic, w);
+    inertia.compute_Ri_Ki_by_autodiff = true;
+    inertia.ComputeInertiaDampingMatrix(Ri_ad, w);
+    ASSERT_GT(Ri_analytic.lpNorm<Eigen::Infinity>(), 0);
+    ASSERT_LT((Ri_ad - Ri_analytic).lpNorm<Eigen::Infinity>(), 1e-12);
+}
+
+TEST(ChBeamSection, inertia_stiffness_AD) {
+    ChVector<> wvel(0.3, -1.2, 2.5);
+    ChVector<> wacc(-0.7, 0.4, 1.1);
+    ChVector<> xacc(2.0, -3.0, 0.5);
+    ChMatrixNM<double, 6, 6> Ki_ad;
+    ChMatrixNM<double, 6, 6> Ki_fd;
+
+    // The base class implementation on dual numbers must match its numerical differentiation
+    ChBeamSectionEulerAdvancedGeneric euler(1e6, 1e5, 1e4, 1e4, 0, 0, 0, 0, 0, 12.0, 0.4, 0.05, -0.03);
+    euler.compute_Ri_Ki_by_autodiff = true;
+    euler.ComputeInertiaStiffnessMatrix(Ki_ad, wvel, wacc, xacc);
+    euler.compute_Ri_Ki_by_num_diff = true;
+    euler.ComputeInertiaStiffnessMatrix(Ki_fd, wvel, wacc, xacc);
+    ASSERT_GT(Ki_fd.lpNorm<Eigen::Infinity>(), 0);
+    ASSERT_LT((Ki_ad - Ki_fd).lpNorm<Eigen::Infinity>(), 1e-5 * Ki_fd.lpNorm<Eigen::Infinity>());
+
+    ChInertiaCosseratAdvanced inertia(12.0, 0.05, -0.03, 0.2, 0.3, 0.01);
+    inertia.compute_Ri_Ki_by_autodiff = true;
+    inertia.ComputeInertiaStiffnessMatrix(Ki_ad, wvel, wacc, xacc);
+    inertia.compute_Ri_Ki_by_num_diff = true;
+    inertia.ComputeInertiaStiffnessMatrix(Ki_fd, wvel, wacc, xacc);
+    ASSERT_GT(Ki_fd.lpNorm<Eigen::Infinity>(), 0);
+    ASSERT_LT((Ki_ad - Ki_fd).lpNorm<Eigen::Infinity>(), 1e-5 * Ki_fd.lpNorm<Eigen::Infinity>());
+}
@@ -0,0 +1,142 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Unit test for the element coloring in ChMesh.
+// - every element is assigned exactly one color;
+// - no two elements of the same color share a node;
+// - the coloring is recomputed when elements are added;
+// - parallel (per color) force loads and parallel Jacobian loads give the same results as a
+//   single-threaded evaluation.
+// =============================================================================
+
+#include <set>
+#include <vector>
+
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a n x n x n grid of hexahedral elements, with the bottom nodes fixed.
+static std::shared_ptr<ChMesh> CreateMesh(int n, std::vector<std::shared_ptr<ChNodeFEAxyz>>& nodes) {
+    auto mesh = chrono_types::make_shared<ChMesh>();
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(1e6);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    double h = 0.1;
+    auto idx = [n](int i, int j, int k) { return (i * (n + 1) + j) * (n + 1) + k; };
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            for (int k = 0; k <= n; k++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(i * h, j * h, k * h));
+                node->SetFixed(k == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            for (int k = 0; k < n; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(nodes[idx(i, j, k)], nodes[idx(i, j + 1, k)], nodes[idx(i + 1, j + 1, k)],
+                                  nodes[idx(i + 1, j, k)], nodes[idx(i, j, k + 1)], nodes[idx(i, j + 1, k + 1)],
+                                  nodes[idx(i + 1, j + 1, k + 1)], nodes[idx(i + 1, j, k + 1)]);
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+        }
+    }
+
+    return mesh;
+}
+
+// Check that the coloring is a partition of the elements and that elements of the same color do not share nodes.
+static void CheckColoring(ChMesh& mesh) {
+    const auto& elements = mesh.GetElements();
+    std::vector<int> count(elements.size(), 0);
+
+    for (unsigned int color = 0; color < mesh.GetNumElementColors(); color++) {
+        auto indices = mesh.GetElementsOfColor(color);
+        ASSERT_FALSE(indices.empty());
+
+        std::set<ChNodeFEAbase*> color_nodes;
+        for (auto ie : indices) {
+            ASSERT_LT(ie, elements.size());
+            count[ie]++;
+            for (int in = 0; in < elements[ie]->GetNnodes(); in++) {
+                auto inserted = color_nodes.insert(elements[ie]->GetNodeN(in).get()).second;
+                ASSERT_TRUE(inserted) << "color " << color << " has two elements sharing a node";
+            }
+        }
+    }
+
+    for (size_t ie = 0; ie < elements.size(); ie++)
+        ASSERT_EQ(count[ie], 1) << "element " << ie;
+}
+
+TEST(ChMesh, element_coloring) {
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto mesh = CreateMesh(4, nodes);
+
+    // An interior node is shared by 8 hexahedra, which therefore need 8 distinct colors
+    ASSERT_GE(mesh->GetNumElementColors(), 8u);
+    CheckColoring(*mesh);
+
+    // Adding an element (sharing nodes with existing ones) updates the coloring
+    auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+    element->SetMaterial(chrono_types::make_shared<ChContinuumElastic>());
+    mesh->AddElement(element);
+    CheckColoring(*mesh);
+}
+
+TEST(ChMesh, colored_parallel_loads) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    sys1.SetNumThreads(1);
+    sys2.SetNumThreads(4);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes1;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes2;
+    sys1.Add(CreateMesh(4, nodes1));
+    sys2.Add(CreateMesh(4, nodes2));
+
+    for (auto sys : {&sys1, &sys2}) {
+        sys->Set_G_acc(ChVector<>(0, 0, -9.81));
+        auto solver = chrono_types::make_shared<ChSolverMINRES>();
+        solver->SetMaxIterations(200);
+        solver->SetTolerance(1e-12);
+        sys->SetSolver(solver);
+        sys->SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    }
+
+    for (int i = 0; i < 20; i++) {
+        sys1.DoStepDynamics(1e-3);
+        sys2.DoStepDynamics(1e-3);
+    }
+
+    // Within a color, no two elements write to the same entries, so that the results do not depend on the number
+    // of threads. The mesh must have deformed under gravity.
+    ASSERT_LT(nodes1.back()->GetPos().z(), nodes1.back()->GetX0().z());
+    for (size_t i = 0; i < nodes1.size(); i++) {
+        ASSERT_NEAR((nodes1[i]->GetPos() - nodes2[i]->GetPos()).Length(), 0.0, 1e-12);
+        ASSERT_NEAR((nodes1[i]->GetPos_dt() - nodes2[i]->GetPos_dt()).Length(), 0.0, 1e-10);
+    }
+}
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the CPU (OpenMP) backend of Chrono::FSI.
+// A smaller version of utest_FSI_Poiseuille_flow (narrower periodic domain,
+// fewer steps): the explicit WCSPH velocity profile must match the analytical
+// solution of the Poiseuille flow, with the same tolerance.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+
+#include "chrono_fsi/ChSystemFsi.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fsi;
+
+// Dimensions of the computational domain (periodic in x and y, walls in z)
+static const double bxDim = 0.06;
+static const double byDim = 0.04;
+static const double bzDim = 0.2;
+
+// Analytical solution of the Poiseuille flow (see utest_FSI_Poiseuille_flow)
+static double PoiseuilleAnalytical(double Z, double L, double time, ChSystemFsi& sysFSI) {
+    double nu = sysFSI.GetViscosity() / sysFSI.GetDensity();
+    double F = sysFSI.GetBodyForce().x();
+    double initSpace0 = sysFSI.GetInitialSpacing();
+    double pi = 3.1415926;
+
+    double L_modify = L + initSpace0;
+    double Z_modify = Z + 0.5 * initSpace0;
+
+    double theory = 1.0 / (2.0 * nu) * F * Z_modify * (L_modify - Z_modify);
+
+    for (int n = 0; n < 50; n++) {
+        theory = theory - 4.0 * F * pow(L_modify, 2) / (nu * pow(pi, 3) * pow(2 * n + 1, 3)) *
+                              sin(pi * Z_modify * (2 * n + 1) / L_modify) *
+                              exp(-pow(2 * n + 1, 2) * pow(pi, 2) * nu * time / pow(L_modify, 2));
+    }
+
+    return theory;
+}
+
+TEST(ChFsiCPU, Poiseuille_flow) {
+    ChSystemSMC sysMBS;
+    ChSystemFsi sysFSI(&sysMBS);
+
+    std::string json = GetChronoDataFile("fsi/input_json/demo_FSI_Poiseuille_flow_Explicit.json");
+    sysFSI.ReadParametersFromFile(json);
+
+    auto initSpace0 = sysFSI.GetInitialSpacing();
+    ChVector<> cMin(-bxDim / 2 - initSpace0 / 2, -byDim / 2 - initSpace0 / 2, -10.0 * initSpace0);
+    ChVector<> cMax(bxDim / 2 + initSpace0 / 2, byDim / 2 + initSpace0 / 2, bzDim + 10.0 * initSpace0);
+    sysFSI.SetBoundaries(cMin, cMax);
+
+    // Fluid particles, initialized with the analytical velocity at t = 0.5
+    chrono::utils::GridSampler<> sampler(initSpace0);
+    std::vector<ChVector<>> points =
+        sampler.SampleBox(ChVector<>(0, 0, bzDim / 2), ChVector<>(bxDim / 2, byDim / 2, bzDim / 2));
+    size_t numPart = points.size();
+    ASSERT_GT(numPart, 0);
+    for (const auto& p : points)
+        sysFSI.AddSPHParticle(p, ChVector<>(PoiseuilleAnalytical(p.z(), bzDim, 0.5, sysFSI), 0, 0));
+
+    // Bottom and top walls, with BCE markers
+    auto material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetIdentifier(-1);
+    body->SetBodyFixed(true);
+    body->SetCollide(true);
+    chrono::utils::AddBoxGeometry(body.get(), material, ChVector<>(bxDim, byDim, 4 * initSpace0),
+                                  ChVector<>(0, 0, -3 * initSpace0), QUNIT, true);
+    sysMBS.AddBody(body);
+    sysFSI.AddBoxContainerBCE(body, ChFrame<>(ChVector<>(0, 0, bzDim / 2), QUNIT), ChVector<>(bxDim, byDim, bzDim),
+                              ChVector<int>(0, 0, 2));
+
+    sysFSI.Initialize();
+
+    double dT = sysFSI.GetStepSize();
+    double time = 0;
+    for (int step = 0; step < 50; step++) {
+        sysFSI.DoStepDynamics_FSI();
+        time += dT;
+
+        auto pos = sysFSI.GetParticlePositions();
+        auto vel = sysFSI.GetParticleVelocities();
+
+        double error = 0;
+        double norm = 0;
+        for (size_t i = 0; i < numPart; i++) {
+            double vel_ana = PoiseuilleAnalytical(pos[i].z(), bzDim, time + 0.5, sysFSI);
+            error += std::pow(vel[i].x() - vel_ana, 2);
+            norm += std::pow(vel_ana, 2);
+        }
+        double error_rel = std::sqrt(error / norm);
+        if (step > 1)
+            ASSERT_LT(error_rel, 1e-2) << "step " << step;
+    }
+}
@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Unit test for the CPU (OpenMP) backend of Chrono::Gpu.
+// Without CUDA, the kernel launcher must execute every thread of the grid
+// exactly once and the atomics must not lose concurrent updates. With either
+// backend, a pile of spheres settled on a plane (frictionless and frictional
+// contact) must transmit its weight to the plane.
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/utils/ChUtilsSamplers.h"
+#include "chrono_gpu/ChConfigGpu.h"
+#include "chrono_gpu/physics/ChSystemGpu.h"
+
+#ifndef CHRONO_GPU_USE_CUDA
+    #include "chrono_gpu/utils/ChCudaHostKernel.h"
+#endif
+
+using namespace chrono;
+using namespace chrono::gpu;
+
+#ifndef CHRONO_GPU_USE_CUDA
+
+__global__ void countThreads(unsigned int* counts, unsigned int* dims, unsigned int n) {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        counts[i]++;
+        dims[i] = blockDim.x;
+    }
+}
+
+__global__ void accumulate(float* sum_f, double* sum_d, unsigned int* sum_u, unsigned int n) {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n) {
+        chrono::cuda_host::atomicAdd(sum_f, 1.f);
+        chrono::cuda_host::atomicAdd(sum_d, 0.5);
+        chrono::cuda_host::atomicAdd(sum_u, 2u);
+    }
+}
+
+TEST(gpuHostBackend, launch) {
+    const unsigned int nThreads = 128;
+    const unsigned int n = 1000;
+    const unsigned int nBlocks = (n + nThreads - 1) / nThreads;
+
+    std::vector<unsigned int> counts(n, 0);
+    std::vector<unsigned int> dims(n, 0);
+    chrono::cuda_host::LaunchKernel(nBlocks, nThreads, [&]() { countThreads(counts.data(), dims.data(), n); });
+
+    for (unsigned int i = 0; i < n; i++) {
+        ASSERT_EQ(counts[i], 1u);
+        ASSERT_EQ(dims[i], nThreads);
+    }
+}
+
+TEST(gpuHostBackend, atomics) {
+    const unsigned int nThreads = 256;
+    const unsigned int n = 64 * nThreads;
+
+    float sum_f = 0;
+    double sum_d = 0;
+    unsigned int sum_u = 0;
+    chrono::cuda_host::LaunchKernel(n / nThreads, nThreads, [&]() { accumulate(&sum_f, &sum_d, &sum_u, n); });
+
+    ASSERT_EQ(sum_f, (float)n);
+    ASSERT_EQ(sum_d, 0.5 * n);
+    ASSERT_EQ(sum_u, 2 * n);
+}
+
+#endif
+
+// Settle a pile of spheres on a plane and return the relative error of the plane reaction force w.r.t. the weight
+static float SettlePile(CHGPU_FRICTION_MODE friction_mode) {
+    float radius = 1.f;
+    float density = 2.5f;
+    float g = 980.f;
+    float box_size = 20.f;
+
+    ChSystemGpu gpu_sys(radius, density, ChVector<float>(box_size, box_size, box_size));
+    gpu_sys.SetGravitationalAcceleration(ChVector<float>(0, 0, -g));
+    gpu_sys.SetFrictionMode(friction_mode);
+    gpu_sys.SetTimeIntegrator(CHGPU_TIME_INTEGRATOR::CENTERED_DIFFERENCE);
+
+    gpu_sys.SetKn_SPH2SPH(5e7f);
+    gpu_sys.SetKn_SPH2WALL(5e7f);
+    gpu_sys.SetGn_SPH2SPH(2e4f);
+    gpu_sys.SetGn_SPH2WALL(2e4f);
+    gpu_sys.SetKt_SPH2SPH(2e7f);
+    gpu_sys.SetKt_SPH2WALL(2e7f);
+    gpu_sys.SetGt_SPH2SPH(1e4f);
+    gpu_sys.SetGt_SPH2WALL(1e4f);
+    gpu_sys.SetStaticFrictionCoeff_SPH2SPH(0.5f);
+    gpu_sys.SetStaticFrictionCoeff_SPH2WALL(0.f);  // the box walls must not carry the weight of the pile
+
+    // Fill the bottom half of the box
+    utils::HCPSampler<float> sampler(2.1f * radius);
+    ChVector<float> center(0.f, 0.f, -0.25f * box_size);
+    ChVector<float> hdims(box_size / 2 - radius, box_size / 2 - radius, box_size / 4 - radius);
+    std::vector<ChVector<float>> points = sampler.SampleBox(center, hdims);
+    gpu_sys.SetParticles(points);
+
+    // Upward facing plane just above the bottom of the box
+    size_t plane_bc_id =
+        gpu_sys.CreateBCPlane(ChVector<float>(0, 0, -box_size / 2 + 2 * radius), ChVector<float>(0, 0, 1), true);
+
+    gpu_sys.SetBDFixed(true);
+    gpu_sys.SetFixedStepSize(5e-5f);
+    gpu_sys.SetVerbosity(CHGPU_VERBOSITY::QUIET);
+    gpu_sys.Initialize();
+
+    gpu_sys.AdvanceSimulation(0.5f);
+
+    ChVector<float> reaction_force;
+    if (!gpu_sys.GetBCReactionForces(plane_bc_id, reaction_force))
+        return 1.f;
+
+    // The reaction force is the force exerted by the spheres on the plane
+    float weight = (float)points.size() * (4.f / 3.f) * (float)CH_C_PI * radius * radius * radius * density * g;
+    return std::abs((reaction_force.z() + weight) / weight);
+}
+
+TEST(gpuHostBackend, settling_frictionless) {
+    ASSERT_LT(SettlePile(CHGPU_FRICTION_MODE::FRICTIONLESS), 0.01f);
+}
+
+TEST(gpuHostBackend, settling_frictional) {
+    ASSERT_LT(SettlePile(CHGPU_FRICTION_MODE::SINGLE_STEP), 0.01f);
+}
@@ -0,0 +1,169 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Multicore unit test for batches of 3d vectors and the batch kernels.
+// The kernels for all instruction sets supported by the CPU are checked against
+// the scalar real3 and quaternion functions.
+// =============================================================================
+
+#include "unit_testing.h"
+
+#include "chrono/core/ChMathematics.h"
+#include "chrono/multicore_math/real3_batch.h"
+
+const real precision = 1e-12;
+
+static real3 RandomVector() {
+    return real3(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5);
+}
+
+static quaternion RandomQuaternion() {
+    quaternion q(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5);
+    return Normalize(q);
+}
+
+// Instruction sets supported on this machine
+static std::vector<BatchInstructionSet> InstructionSets() {
+    std::vector<BatchInstructionSet> sets;
+    for (auto set : {BatchInstructionSet::SCALAR, BatchInstructionSet::AVX2, BatchInstructionSet::AVX512}) {
+        if (SetBatchInstructionSet(set) == set)
+            sets.push_back(set);
+    }
+    return sets;
+}
+
+TEST(real3_batch, storage) {
+    real3_batch a(5);
+    ASSERT_EQ(a.size(), 5);
+    ASSERT_EQ(a.capacity() % 8, 0);
+    for (int i = 0; i < 5; i++)
+        a.set(i, real3(i, 2 * i, 3 * i));
+
+    // Existing elements are preserved when growing
+    a.resize(21);
+    ASSERT_EQ(a.size(), 21);
+    for (int i = 0; i < 5; i++)
+        Assert_eq(a.get(i), real3(i, 2 * i, 3 * i));
+
+    std::vector<quaternion> q(11);
+    for (auto& qi : q)
+        qi = RandomQuaternion();
+    quaternion_batch b;
+    b.load(q.data(), (int)q.size());
+    ASSERT_EQ(b.size(), 11);
+    for (int i = 0; i < 11; i++)
+        Assert_near(b.get(i), q[i], precision);
+}
+
+TEST(real3_batch, kernels) {
+    const int n = 203;
+    ChSetRandomSeed(7);
+
+    std::vector<real3> u(n), a(n), b(n);
+    std::vector<quaternion> q(n);
+    for (int i = 0; i < n; i++) {
+        u[i] = Normalize(RandomVector());
+        a[i] = RandomVector();
+        b[i] = RandomVector();
+        q[i] = RandomQuaternion();
+    }
+    // Normals along (or close to) the y axis
+    u[3] = real3(0, 1, 0);
+    u[4] = real3(0, -1, 0);
+    u[5] = Normalize(real3(1e-6, 1, -1e-6));
+
+    real3_batch U, A, B;
+    quaternion_batch Q;
+    U.load(u.data(), n);
+    A.load(a.data(), n);
+    B.load(b.data(), n);
+    Q.load(q.data(), n);
+
+    auto default_set = GetBatchInstructionSet();
+
+    for (auto set : InstructionSets()) {
+        SetBatchInstructionSet(set);
+
+        real3_batch R, C, V, W;
+        Rotate(A, Q, R);
+        Cross(A, B, C);
+        Orthogonalize(U, V, W);
+        ASSERT_EQ(R.size(), n);
+        ASSERT_EQ(C.size(), n);
+        ASSERT_EQ(V.size(), n);
+        ASSERT_EQ(W.size(), n);
+
+        for (int i = 0; i < n; i++) {
+            Assert_near(R.get(i), Rotate(a[i], q[i]), precision);
+            Assert_near(C.get(i), Cross(a[i], b[i]), precision);
+
+            // (u, v, w) is a right-handed orthonormal frame
+            real3 v = V.get(i);
+            real3 w = W.get(i);
+            ASSERT_NEAR(Length(v), 1.0, precision);
+            ASSERT_NEAR(Length(w), 1.0, precision);
+            ASSERT_NEAR(Dot(u[i], v), 0.0, precision);
+            ASSERT_NEAR(Dot(u[i], w), 0.0, precision);
+            Assert_near(Cross(u[i], v), w, precision);
+        }
+    }
+
+    SetBatchInstructionSet(default_set);
+}
+
+TEST(real3_batch, friction_cones) {
+    const int n = 203;
+    ChSetRandomSeed(11);
+
+    std::vector<real> gamma_n(n), gamma_uv(2 * n), cohesion(n);
+    std::vector<real3> friction(n);
+    for (int i = 0; i < n; i++) {
+        gamma_n[i] = 2 * ChRandom() - 1;
+        gamma_uv[2 * i + 0] = 2 * ChRandom() - 1;
+        gamma_uv[2 * i + 1] = 2 * ChRandom() - 1;
+        cohesion[i] = (i % 3 == 0) ? 0.1 * ChRandom() : 0;
+        friction[i] = real3((i % 7 == 0) ? 0 : ChRandom(), 0, 0);
+    }
+
+    // Reference: scalar projection
+    auto default_set = GetBatchInstructionSet();
+    SetBatchInstructionSet(BatchInstructionSet::SCALAR);
+    auto ref_n = gamma_n;
+    auto ref_uv = gamma_uv;
+    ProjectFrictionCones(n, ref_n.data(), ref_uv.data(), friction.data(), cohesion.data());
+
+    for (int i = 0; i < n; i++) {
+        real mu = friction[i].x;
+        real gn = ref_n[i] + cohesion[i];
+        real gt = Sqrt(ref_uv[2 * i] * ref_uv[2 * i] + ref_uv[2 * i + 1] * ref_uv[2 * i + 1]);
+        if (mu == 0) {
+            // Frictionless contacts
+            ASSERT_EQ(ref_n[i], std::max(gamma_n[i], -cohesion[i]));
+            ASSERT_EQ(gt, 0.0);
+        } else {
+            // Projected impulses are inside the friction cone
+            ASSERT_LE(gt, mu * gn + precision);
+        }
+    }
+
+    // All other instruction sets give the same result
+    for (auto set : InstructionSets()) {
+        SetBatchInstructionSet(set);
+        auto res_n = gamma_n;
+        auto res_uv = gamma_uv;
+        ProjectFrictionCones(n, res_n.data(), res_uv.data(), friction.data(), cohesion.data());
+        Assert_near(res_n, ref_n, precision);
+        Assert_near(res_uv, ref_uv, precision);
+    }
+
+    SetBatchInstructionSet(default_set);
+}
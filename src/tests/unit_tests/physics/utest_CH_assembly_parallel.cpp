@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Unit test for the parallel update mode of ChAssembly.
+// Two identical systems (a set of chains of pendulums, connected by a mix of
+// thread-safe mate joints and non-thread-safe lock joints and springs) are
+// simulated, one with serial and one with parallel per-item loops. Since items
+// processed concurrently only write to their own state entries, the two
+// simulations must produce identical results.
+// Thread safety is declared by audited classes only and is not inherited by
+// derived classes.
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// User class derived from an audited class; it may hold shared state, so it must not be thread-safe by default.
+class CustomBody : public ChBodyEasySphere {
+  public:
+    CustomBody() : ChBodyEasySphere(1.0, 1000, false, false) {}
+};
+
+static void CreateModel(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& bodies) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetSolverMaxIterations(100);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int ic = 0; ic < 8; ic++) {
+        auto prev = ground;
+        for (int ib = 0; ib < 16; ib++) {
+            auto body = chrono_types::make_shared<ChBody>();
+            body->SetMass(1.0);
+            body->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+            body->SetPos(ChVector<>(1.0 * (ib + 1), 2.0 * ic, 0));
+            sys.AddBody(body);
+            bodies.push_back(body);
+
+            ChFrame<> frame(ChVector<>(1.0 * ib + 0.5, 2.0 * ic, 0));
+            if (ib % 2 == 0) {
+                auto joint = chrono_types::make_shared<ChLinkMateSpherical>();
+                joint->Initialize(body, prev, frame);
+                sys.AddLink(joint);
+            } else {
+                auto joint = chrono_types::make_shared<ChLinkLockSpherical>();
+                joint->Initialize(body, prev, frame.GetCoord());
+                sys.AddLink(joint);
+            }
+
+            auto spring = chrono_types::make_shared<ChLinkTSDA>();
+            spring->Initialize(body, ground, false, body->GetPos(), ChVector<>(1.0 * (ib + 1), 2.0 * ic, 1));
+            spring->SetSpringCoefficient(10);
+            spring->SetDampingCoefficient(1);
+            sys.AddLink(spring);
+
+            prev = body;
+        }
+    }
+}
+
+TEST(ChAssembly, parallel_update) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    sys1.SetNumThreads(1);
+    sys2.SetNumThreads(4);
+    sys2.SetParallelUpdate(true);
+
+    std::vector<std::shared_ptr<ChBody>> bodies1;
+    std::vector<std::shared_ptr<ChBody>> bodies2;
+    CreateModel(sys1, bodies1);
+    CreateModel(sys2, bodies2);
+
+    ASSERT_FALSE(sys1.GetAssembly().GetParallelUpdate());
+    ASSERT_TRUE(sys2.GetAssembly().GetParallelUpdate());
+
+    double step = 1e-3;
+    for (int i = 0; i < 200; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+
+        for (size_t j = 0; j < bodies1.size(); j++) {
+            ASSERT_NEAR((bodies1[j]->GetPos() - bodies2[j]->GetPos()).Length(), 0.0, 1e-12);
+            ASSERT_NEAR((bodies1[j]->GetPos_dt() - bodies2[j]->GetPos_dt()).Length(), 0.0, 1e-12);
+        }
+    }
+}
+
+TEST(ChAssembly, thread_safe_items) {
+    ASSERT_TRUE(ChBody().IsThreadSafe());
+    ASSERT_TRUE(ChBodyAuxRef().IsThreadSafe());
+    ASSERT_TRUE(ChBodyEasySphere(1.0, 1000, false, false).IsThreadSafe());
+    ASSERT_TRUE(ChShaft().IsThreadSafe());
+    ASSERT_TRUE(ChLinkMateGeneric().IsThreadSafe());
+    ASSERT_TRUE(ChLinkMateSpherical().IsThreadSafe());
+
+    ASSERT_FALSE(CustomBody().IsThreadSafe());
+    ASSERT_FALSE(ChLinkMotorRotationSpeed().IsThreadSafe());
+    ASSERT_FALSE(ChLinkLockRevolute().IsThreadSafe());
+
+    // Bodies with markers or forces are processed serially
+    ChBody body_marker;
+    body_marker.AddMarker(chrono_types::make_shared<ChMarker>());
+    ASSERT_FALSE(body_marker.IsThreadSafe());
+    ChBodyEasySphere body_force(1.0, 1000, false, false);
+    body_force.AddForce(chrono_types::make_shared<ChForce>());
+    ASSERT_FALSE(body_force.IsThreadSafe());
+}
@@ -0,0 +1,159 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Unit test for binary checkpoint/restart of a ChSystem.
+// A system (a chain of pendulums and a set of spheres falling on a box) is
+// simulated and a checkpoint is written at an intermediate time. A second,
+// identical system is restored from the checkpoint; continuing both simulations
+// from that point must produce identical results. An NSC system is used, with
+// a warm-started iterative solver, so that the results depend on the restored
+// Lagrange multipliers of both joints and contacts.
+// Restoring into a system with a different constraint layout must fail and
+// leave the system unchanged.
+// =============================================================================
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/serialization/ChCheckpointBinary.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static void CreateModel(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& bodies) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(20);
+    solver->EnableWarmStart(true);
+    sys.SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    // Chain of pendulums
+    std::shared_ptr<ChBody> prev = ground;
+    for (int ib = 0; ib < 4; ib++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector<>(0.5 * (ib + 1), 0, 2));
+        sys.AddBody(body);
+        bodies.push_back(body);
+
+        auto joint = chrono_types::make_shared<ChLinkLockSpherical>();
+        joint->Initialize(body, prev, ChCoordsys<>(ChVector<>(0.5 * ib, 0, 2)));
+        sys.AddLink(joint);
+        prev = body;
+    }
+
+    // Falling spheres
+    for (int ix = 0; ix < 3; ix++) {
+        for (int iy = 0; iy < 3; iy++) {
+            auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, true, true, mat);
+            ball->SetPos(ChVector<>(-1 + 0.25 * ix + 0.01 * iy, -1 + 0.25 * iy, 0.2 + 0.05 * ix));
+            sys.AddBody(ball);
+            bodies.push_back(ball);
+        }
+    }
+}
+
+class ChCheckpointBinaryTest : public ::testing::Test {
+  protected:
+    ChCheckpointBinaryTest() {
+        filename = std::string(::testing::UnitTest::GetInstance()->current_test_suite()->name()) + "_" +
+                   std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".dat";
+        CreateModel(sys1, bodies1);
+        CreateModel(sys2, bodies2);
+    }
+
+    ~ChCheckpointBinaryTest() { std::remove(filename.c_str()); }
+
+    std::string filename;
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    std::vector<std::shared_ptr<ChBody>> bodies1;
+    std::vector<std::shared_ptr<ChBody>> bodies2;
+};
+
+TEST_F(ChCheckpointBinaryTest, restart) {
+    double step = 1e-3;
+    for (int i = 0; i < 300; i++)
+        sys1.DoStepDynamics(step);
+    ASSERT_GT(sys1.GetNcontacts(), 0);
+
+    // Checkpoint the first system and restore it in the second one
+    ASSERT_TRUE(ChCheckpointBinary::Write(sys1, filename));
+
+    ChCheckpointBinary checkpoint;
+    ASSERT_TRUE(checkpoint.Open(filename));
+    ASSERT_DOUBLE_EQ(checkpoint.GetTime(), sys1.GetChTime());
+
+    size_t nx;
+    ASSERT_TRUE(checkpoint.GetBlock(ChCheckpointBinary::BlockType::STATE_X, nx) != nullptr);
+    ASSERT_EQ(nx, (size_t)sys1.GetNcoords_x());
+
+    ASSERT_TRUE(checkpoint.Restore(sys2));
+    checkpoint.Close();
+
+    ASSERT_DOUBLE_EQ(sys2.GetChTime(), sys1.GetChTime());
+    for (size_t j = 0; j < bodies1.size(); j++) {
+        ASSERT_EQ(bodies1[j]->GetPos(), bodies2[j]->GetPos());
+        ASSERT_EQ(bodies1[j]->GetPos_dt(), bodies2[j]->GetPos_dt());
+    }
+
+    // Continue both simulations
+    for (int i = 0; i < 300; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+
+        for (size_t j = 0; j < bodies1.size(); j++) {
+            ASSERT_NEAR((bodies1[j]->GetPos() - bodies2[j]->GetPos()).Length(), 0.0, 1e-10);
+            ASSERT_NEAR((bodies1[j]->GetPos_dt() - bodies2[j]->GetPos_dt()).Length(), 0.0, 1e-10);
+        }
+    }
+}
+
+TEST_F(ChCheckpointBinaryTest, constraint_mismatch) {
+    for (int i = 0; i < 100; i++)
+        sys1.DoStepDynamics(1e-3);
+    ASSERT_TRUE(ChCheckpointBinary::Write(sys1, filename));
+
+    // Add a joint to the second system, so that its constraint layout no longer matches the checkpoint
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(bodies2[0], bodies2[1], ChCoordsys<>(ChVector<>(0.75, 0, 2)));
+    sys2.AddLink(joint);
+    sys2.Setup();
+    std::vector<ChVector<>> pos;
+    for (const auto& body : bodies2)
+        pos.push_back(body->GetPos());
+
+    ChCheckpointBinary checkpoint;
+    ASSERT_TRUE(checkpoint.Open(filename));
+    ASSERT_FALSE(checkpoint.Restore(sys2));
+
+    for (size_t j = 0; j < bodies2.size(); j++)
+        ASSERT_EQ(bodies2[j]->GetPos(), pos[j]);
+}
+
+TEST(ChCheckpointBinary, invalid_file) {
+    ChCheckpointBinary checkpoint;
+    ASSERT_FALSE(checkpoint.Open("ChCheckpointBinary_missing_file.dat"));
+    ASSERT_FALSE(checkpoint.IsOpen());
+}
@@ -0,0 +1,181 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Unit tests for the pooled NSC contact container:
+// - ChContactArena constructs each contact once and reuses it in place;
+// - ChContactContainerNSCpooled is a drop-in replacement for ChContactContainerNSC.
+// =============================================================================
+
+#include <type_traits>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSCpooled.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Minimal contact type, counting constructions and resets.
+struct TestContact {
+    TestContact(ChContactContainer* container, int* a, int* b, const ChCollisionInfo& cinfo,
+                const ChMaterialCompositeNSC& cmat)
+        : valA(*a), valB(*b) {
+        num_constructed++;
+    }
+    ~TestContact() { num_destroyed++; }
+    void Reset(int* a, int* b, const ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat) {
+        valA = *a;
+        valB = *b;
+        num_reset++;
+    }
+    int valA;
+    int valB;
+    static int num_constructed;
+    static int num_destroyed;
+    static int num_reset;
+};
+
+int TestContact::num_constructed = 0;
+int TestContact::num_destroyed = 0;
+int TestContact::num_reset = 0;
+
+// The arena owns its storage, so copying it would release the same chunks twice.
+static_assert(!std::is_copy_constructible<ChContactArena<TestContact>>::value, "ChContactArena must not be copyable");
+static_assert(!std::is_copy_assignable<ChContactArena<TestContact>>::value, "ChContactArena must not be copyable");
+
+TEST(ChContactArena, reuse) {
+    ChCollisionInfo cinfo;
+    ChMaterialCompositeNSC cmat;
+    const int n = 2500;  // spans three chunks
+    std::vector<int> vals(n);
+    for (int i = 0; i < n; i++)
+        vals[i] = i;
+
+    {
+        ChContactArena<TestContact> arena;
+        std::vector<TestContact*> ptrs;
+        for (int i = 0; i < n; i++)
+            ptrs.push_back(arena.Acquire(nullptr, &vals[i], &vals[n - 1 - i], cinfo, cmat));
+        ASSERT_EQ(arena.size(), n);
+        ASSERT_EQ(arena.capacity(), n);
+        ASSERT_EQ(TestContact::num_constructed, n);
+        ASSERT_EQ(TestContact::num_reset, 0);
+
+        // Contacts within a chunk are contiguous
+        ASSERT_EQ(ptrs[1] - ptrs[0], 1);
+        ASSERT_EQ(ptrs[1023] - ptrs[0], 1023);
+
+        // Fewer contacts at the next step: objects are reused in place, in the same order
+        arena.Rewind();
+        ASSERT_EQ(arena.size(), 0);
+        for (int i = 0; i < n / 2; i++)
+            ASSERT_EQ(arena.Acquire(nullptr, &vals[n - 1 - i], &vals[i], cinfo, cmat), ptrs[i]);
+        ASSERT_EQ(arena.size(), n / 2);
+        ASSERT_EQ(arena.capacity(), n);
+        ASSERT_EQ(TestContact::num_constructed, n);
+        ASSERT_EQ(TestContact::num_reset, n / 2);
+        ASSERT_EQ(arena[10].valA, n - 1 - 10);
+
+        // Only active contacts are visited, in insertion order
+        int count = 0;
+        arena.ForEach([&](TestContact& c) {
+            EXPECT_EQ(c.valB, count);
+            count++;
+            return true;
+        });
+        ASSERT_EQ(count, n / 2);
+
+        // More contacts: existing objects are reused and only the extra ones are constructed
+        arena.Rewind();
+        for (int i = 0; i < n + 10; i++)
+            arena.Acquire(nullptr, &vals[i % n], &vals[i % n], cinfo, cmat);
+        ASSERT_EQ(arena.capacity(), n + 10);
+        ASSERT_EQ(TestContact::num_constructed, n + 10);
+        ASSERT_EQ(TestContact::num_destroyed, 0);
+
+        arena.Clear();
+        ASSERT_EQ(arena.capacity(), 0);
+        ASSERT_EQ(TestContact::num_destroyed, n + 10);
+    }
+    ASSERT_EQ(TestContact::num_destroyed, n + 10);
+}
+
+static void CreateModel(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& bodies) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetSolverMaxIterations(50);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    utils::CreateBoxContainer(&sys, 0, mat, ChVector<>(1, 1, 0.5), 0.1);
+
+    // Mix of smooth and rolling-friction contacts
+    auto mat_rolling = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat_rolling->SetFriction(0.4f);
+    mat_rolling->SetRollingFriction(0.01f);
+
+    double radius = 0.05;
+    for (int ix = 0; ix < 6; ix++) {
+        for (int iy = 0; iy < 6; iy++) {
+            for (int iz = 0; iz < 4; iz++) {
+                ChVector<> pos(-0.3 + 0.12 * ix, -0.3 + 0.12 * iy, 0.1 + 0.12 * iz + 0.01 * ix);
+                std::shared_ptr<ChBody> body;
+                if ((ix + iy + iz) % 2 == 0)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, true, true,
+                                                                       (iz % 2) ? mat : mat_rolling);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(1.5 * radius, 1.5 * radius, 1.5 * radius, 1000,
+                                                                    true, true, mat);
+                body->SetPos(pos);
+                sys.AddBody(body);
+                bodies.push_back(body);
+            }
+        }
+    }
+}
+
+TEST(ChContactContainerNSCpooled, same_results) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    sys2.SetContactContainer(chrono_types::make_shared<ChContactContainerNSCpooled>());
+    ASSERT_TRUE(std::dynamic_pointer_cast<ChContactContainerNSCpooled>(sys2.GetContactContainer()) != nullptr);
+
+    std::vector<std::shared_ptr<ChBody>> bodies1;
+    std::vector<std::shared_ptr<ChBody>> bodies2;
+    CreateModel(sys1, bodies1);
+    CreateModel(sys2, bodies2);
+
+    double step = 2e-3;
+    int max_contacts = 0;
+    for (int i = 0; i < 400; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+
+        ASSERT_EQ(sys1.GetNcontacts(), sys2.GetNcontacts());
+        max_contacts = std::max(max_contacts, sys1.GetNcontacts());
+
+        for (size_t j = 0; j < bodies1.size(); j++) {
+            ASSERT_NEAR((bodies1[j]->GetPos() - bodies2[j]->GetPos()).Length(), 0.0, 1e-12);
+            ASSERT_NEAR((bodies1[j]->GetPos_dt() - bodies2[j]->GetPos_dt()).Length(), 0.0, 1e-12);
+        }
+    }
+    ASSERT_GT(max_contacts, 0);
+
+    // Contact forces are reported identically
+    sys1.GetContactContainer()->ComputeContactForces();
+    sys2.GetContactContainer()->ComputeContactForces();
+    for (size_t j = 0; j < bodies1.size(); j++) {
+        ASSERT_NEAR((bodies1[j]->GetContactForce() - bodies2[j]->GetContactForce()).Length(), 0.0, 1e-9);
+    }
+}
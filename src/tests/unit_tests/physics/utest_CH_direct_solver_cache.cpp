@@ -0,0 +1,158 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Unit test for the sparsity pattern cache of the direct linear solvers.
+// Two identical systems (chains of pendulums with revolute joints and bushing
+// loads) are simulated with a sparse LU solver, with and without caching of
+// the sparsity pattern and symbolic factorization. The solutions must match,
+// also after the problem structure changes (a joint is disabled and a new
+// body is added).
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChLoadsBody.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class DirectSolverCacheTest : public ::testing::Test {
+  protected:
+    DirectSolverCacheTest() {
+        solver1 = CreateSystem(sys1, bodies1, links1, false);
+        solver2 = CreateSystem(sys2, bodies2, links2, true);
+    }
+
+    std::shared_ptr<ChSolverSparseLU> CreateSystem(ChSystemNSC& sys,
+                                                   std::vector<std::shared_ptr<ChBody>>& bodies,
+                                                   std::vector<std::shared_ptr<ChLinkLockRevolute>>& links,
+                                                   bool cache);
+
+    // Add a new pendulum, attached to the ground, to the given system.
+    void AddPendulum(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& bodies);
+
+    // Advance both systems by the given number of steps and compare their states.
+    void Simulate(int num_steps);
+
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    std::vector<std::shared_ptr<ChBody>> bodies1;
+    std::vector<std::shared_ptr<ChBody>> bodies2;
+    std::vector<std::shared_ptr<ChLinkLockRevolute>> links1;
+    std::vector<std::shared_ptr<ChLinkLockRevolute>> links2;
+    std::shared_ptr<ChSolverSparseLU> solver1;
+    std::shared_ptr<ChSolverSparseLU> solver2;
+};
+
+std::shared_ptr<ChSolverSparseLU> DirectSolverCacheTest::CreateSystem(
+    ChSystemNSC& sys,
+    std::vector<std::shared_ptr<ChBody>>& bodies,
+    std::vector<std::shared_ptr<ChLinkLockRevolute>>& links,
+    bool cache) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->UseSparsityPatternCache(cache);
+    sys.SetSolver(solver);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+    bodies.push_back(ground);
+
+    auto loads = chrono_types::make_shared<ChLoadContainer>();
+    sys.Add(loads);
+
+    auto prev = ground;
+    for (int ib = 0; ib < 10; ib++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetMass(1.0);
+        body->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+        body->SetPos(ChVector<>(1.0 * (ib + 1), 0, 0));
+        sys.AddBody(body);
+        bodies.push_back(body);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(body, prev, ChCoordsys<>(ChVector<>(1.0 * ib + 0.5, 0, 0), Q_from_AngX(CH_C_PI_2)));
+        sys.AddLink(joint);
+        links.push_back(joint);
+
+        // Bushing loads provide stiffness blocks in the system matrix
+        auto bushing = chrono_types::make_shared<ChLoadBodyBodyBushingSpherical>(
+            body, ground, ChFrame<>(body->GetPos()), ChVector<>(20, 20, 20), ChVector<>(1, 1, 1));
+        loads->Add(bushing);
+
+        prev = body;
+    }
+
+    return solver;
+}
+
+void DirectSolverCacheTest::AddPendulum(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& bodies) {
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetMass(2.0);
+    body->SetInertiaXX(ChVector<>(0.2, 0.2, 0.2));
+    body->SetPos(ChVector<>(0, 0, -1));
+    sys.AddBody(body);
+    bodies.push_back(body);
+
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(body, bodies[0], ChCoordsys<>(ChVector<>(0, 0, -0.5), Q_from_AngX(CH_C_PI_2)));
+    sys.AddLink(joint);
+}
+
+void DirectSolverCacheTest::Simulate(int num_steps) {
+    for (int i = 0; i < num_steps; i++) {
+        sys1.DoStepDynamics(1e-3);
+        sys2.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_EQ(bodies1.size(), bodies2.size());
+    for (size_t i = 0; i < bodies1.size(); i++) {
+        ASSERT_NEAR((bodies1[i]->GetPos() - bodies2[i]->GetPos()).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((bodies1[i]->GetPos_dt() - bodies2[i]->GetPos_dt()).Length(), 0.0, 1e-8);
+    }
+}
+
+TEST_F(DirectSolverCacheTest, same_results) {
+    // Fixed structure: after the first call, all Setup calls reuse the cached pattern
+    Simulate(50);
+    ASSERT_EQ(solver1->GetNumSetupReuses(), 0);
+    ASSERT_EQ(solver2->GetNumSetupReuses(), solver2->GetNumSetupCalls() - 1);
+
+    // Disable a joint: the constraint rows change, so the cached pattern must be discarded once
+    links1[4]->SetDisabled(true);
+    links2[4]->SetDisabled(true);
+    int calls = solver2->GetNumSetupCalls();
+    int reuses = solver2->GetNumSetupReuses();
+    Simulate(1);
+    ASSERT_EQ(solver2->GetNumSetupReuses(), reuses);
+    Simulate(20);
+    ASSERT_EQ(solver2->GetNumSetupReuses(), reuses + (solver2->GetNumSetupCalls() - calls - 1));
+
+    // Add a body and a joint: the problem size changes
+    AddPendulum(sys1, bodies1);
+    AddPendulum(sys2, bodies2);
+    calls = solver2->GetNumSetupCalls();
+    reuses = solver2->GetNumSetupReuses();
+    Simulate(1);
+    ASSERT_EQ(solver2->GetNumSetupReuses(), reuses);
+    Simulate(20);
+    ASSERT_EQ(solver2->GetNumSetupReuses(), reuses + (solver2->GetNumSetupCalls() - calls - 1));
+
+    // The pendulums must have moved
+    ASSERT_GT((bodies1.back()->GetPos() - ChVector<>(0, 0, -1)).Length(), 1e-6);
+}
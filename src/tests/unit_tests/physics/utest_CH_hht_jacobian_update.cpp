@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the Newton matrix update policies of the HHT integrator.
+//
+// The model consists of a pendulum attached to ground through a revolute joint
+// and a spring-damper. The same model is simulated with the Newton matrix
+// updated at every step and with the matrix reused across steps (AUTOMATIC).
+// The test checks that both simulations produce the same results and that the
+// AUTOMATIC policy requires fewer matrix factorizations.
+// The Newton matrix update settings are also checked for serialization.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/serialization/ChArchiveJSON.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+using namespace chrono;
+
+struct HHTResult {
+    ChVector<> pos;
+    ChVector<> vel;
+    int num_setups;
+};
+
+static HHTResult Simulate(ChTimestepperHHT::JacobianUpdate method, bool step_control) {
+    ChSystemSMC sys;
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    auto pend = chrono_types::make_shared<ChBody>();
+    pend->SetMass(2);
+    pend->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+    pend->SetPos(ChVector<>(1, 0, 0));
+    sys.AddBody(pend);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    sys.AddLink(rev);
+
+    auto spring = chrono_types::make_shared<ChLinkTSDA>();
+    spring->Initialize(ground, pend, false, ChVector<>(1, 1, 0), ChVector<>(1, 0, 0));
+    spring->SetRestLength(0.5);
+    spring->SetSpringCoefficient(200);
+    spring->SetDampingCoefficient(2);
+    sys.AddLink(spring);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+    integrator->SetJacobianUpdateMethod(method);
+    integrator->SetStepControl(step_control);
+    integrator->SetMaxiters(20);
+    integrator->SetRelTolerance(1e-8);
+    integrator->SetAbsTolerances(1e-10);
+
+    HHTResult res;
+    res.num_setups = 0;
+    while (sys.GetChTime() < 2) {
+        sys.DoStepDynamics(1e-3);
+        res.num_setups += integrator->GetNumSetupCalls();
+        EXPECT_GE(integrator->GetJacobianAge(), 0);
+        EXPECT_LE(integrator->GetJacobianAge(), 20);
+    }
+    res.pos = pend->GetPos();
+    res.vel = pend->GetPos_dt();
+
+    return res;
+}
+
+TEST(ChTimestepperHHT, jacobian_update) {
+    for (bool step_control : {false, true}) {
+        auto ref = Simulate(ChTimestepperHHT::JacobianUpdate::EVERY_STEP, step_control);
+        auto aut = Simulate(ChTimestepperHHT::JacobianUpdate::AUTOMATIC, step_control);
+
+        ASSERT_GT(aut.num_setups, 0) << "step control: " << step_control;
+        ASSERT_LT(aut.num_setups, ref.num_setups / 4) << "step control: " << step_control;
+        ASSERT_NEAR((aut.pos - ref.pos).Length(), 0, 1e-6) << "step control: " << step_control;
+        ASSERT_NEAR((aut.vel - ref.vel).Length(), 0, 1e-5) << "step control: " << step_control;
+    }
+}
+
+TEST(ChTimestepperHHT, archive) {
+    std::string filename = "ChTimestepperHHT_archive.json";
+    {
+        ChTimestepperHHT hht;
+        hht.SetJacobianUpdateMethod(ChTimestepperHHT::JacobianUpdate::AUTOMATIC);
+        hht.SetMaxJacobianAge(7);
+        hht.SetMaxContractionRate(0.3);
+        ChStreamOutAsciiFile file(filename.c_str());
+        ChArchiveOutJSON archive(file);
+        archive << CHNVP(hht);
+    }
+
+    ChTimestepperHHT hht;
+    ASSERT_EQ(hht.GetJacobianUpdateMethod(), ChTimestepperHHT::JacobianUpdate::EVERY_STEP);
+    {
+        ChStreamInAsciiFile file(filename.c_str());
+        ChArchiveInJSON archive(file);
+        archive >> CHNVP(hht);
+    }
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(hht.GetJacobianUpdateMethod(), ChTimestepperHHT::JacobianUpdate::AUTOMATIC);
+    ASSERT_EQ(hht.GetMaxJacobianAge(), 7);
+    ASSERT_EQ(hht.GetMaxContractionRate(), 0.3);
+}
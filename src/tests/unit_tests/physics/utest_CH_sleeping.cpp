@@ -0,0 +1,215 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Test for the island-based sleeping of bodies.
+//
+// Two separate stacks of boxes are dropped on the ground and left to settle.
+// The test checks that:
+// - both stacks (islands) are put to sleep and removed from the system,
+// - a box dropped on the first stack wakes up that stack only,
+// - a force applied to a box of the second stack wakes up that stack,
+// - ChForce objects and external loads wake up the stack they act on,
+// - a fixed body moved kinematically against a stack wakes up that stack,
+// - links between sleeping bodies are deactivated, and reactivated when
+//   sleeping is disabled.
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChForce.h"
+#include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChLoadsBody.h"
+#include "chrono/physics/ChLinkLock.h"
+
+using namespace chrono;
+
+class SleepingTest : public ::testing::TestWithParam<ChContactMethod> {
+  protected:
+    SleepingTest();
+    ~SleepingTest() { delete sys; }
+
+    std::shared_ptr<ChBody> AddBox(const ChVector<>& pos);
+    bool IsSleeping(const std::vector<std::shared_ptr<ChBody>>& stack) const;
+    bool IsAwake(const std::vector<std::shared_ptr<ChBody>>& stack) const;
+    void Simulate(double duration);
+
+    ChSystem* sys;
+    std::shared_ptr<ChMaterialSurface> mat;
+    double step;
+    std::vector<std::shared_ptr<ChBody>> stackA;
+    std::vector<std::shared_ptr<ChBody>> stackB;
+};
+
+SleepingTest::SleepingTest() {
+    if (GetParam() == ChContactMethod::SMC) {
+        sys = new ChSystemSMC;
+        auto mat_smc = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        mat_smc->SetYoungModulus(1e7f);
+        mat_smc->SetRestitution(0.1f);
+        mat_smc->SetFriction(0.5f);
+        mat = mat_smc;
+        step = 1e-4;
+    } else {
+        sys = new ChSystemNSC;
+        auto mat_nsc = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        mat_nsc->SetFriction(0.5f);
+        mat = mat_nsc;
+        step = 2e-3;
+    }
+
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys->SetUseSleeping(true);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.1));
+    ground->SetBodyFixed(true);
+    sys->AddBody(ground);
+
+    for (int i = 0; i < 3; i++) {
+        stackA.push_back(AddBox(ChVector<>(-1, 0, 0.1 + 0.201 * i)));
+        stackB.push_back(AddBox(ChVector<>(+1, 0, 0.1 + 0.201 * i)));
+    }
+}
+
+std::shared_ptr<ChBody> SleepingTest::AddBox(const ChVector<>& pos) {
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, false, true, mat);
+    box->SetPos(pos);
+    sys->AddBody(box);
+    return box;
+}
+
+bool SleepingTest::IsSleeping(const std::vector<std::shared_ptr<ChBody>>& stack) const {
+    for (const auto& body : stack)
+        if (!body->GetSleeping())
+            return false;
+    return true;
+}
+
+bool SleepingTest::IsAwake(const std::vector<std::shared_ptr<ChBody>>& stack) const {
+    for (const auto& body : stack)
+        if (body->GetSleeping())
+            return false;
+    return true;
+}
+
+void SleepingTest::Simulate(double duration) {
+    double end_time = sys->GetChTime() + duration;
+    while (sys->GetChTime() < end_time - step / 2)
+        sys->DoStepDynamics(step);
+}
+
+TEST_P(SleepingTest, islands) {
+    // Both stacks settle and are put to sleep
+    Simulate(2.0);
+    ASSERT_TRUE(IsSleeping(stackA));
+    ASSERT_TRUE(IsSleeping(stackB));
+    ASSERT_EQ(sys->GetNbodiesSleeping(), 6);
+    ASSERT_EQ(sys->GetNbodies(), 0);
+    ASSERT_EQ(sys->GetNcoords_w(), 0);
+
+    // A box falling on the first stack wakes up the boxes it hits, but not the other stack
+    auto box = AddBox(ChVector<>(-1, 0, 1.0));
+    sys->GetCollisionSystem()->BindItem(box);
+    bool woken = false;
+    double end_time = sys->GetChTime() + 1.0;
+    while (sys->GetChTime() < end_time) {
+        sys->DoStepDynamics(step);
+        woken |= !stackA.back()->GetSleeping();
+        ASSERT_TRUE(IsSleeping(stackB));
+    }
+    ASSERT_TRUE(woken);
+
+    // Everything goes back to sleep, with the falling box resting on the first stack
+    Simulate(2.0);
+    ASSERT_TRUE(IsSleeping(stackA));
+    ASSERT_TRUE(box->GetSleeping());
+    ASSERT_NEAR(box->GetPos().z(), 0.7, 0.01);
+
+    // A force applied to the top box of the second stack wakes up that stack
+    stackB.back()->Accumulate_force(ChVector<>(100, 0, 0), stackB.back()->GetPos(), false);
+    sys->DoStepDynamics(step);
+    ASSERT_FALSE(stackB.back()->GetSleeping());
+    ASSERT_TRUE(IsSleeping(stackA));
+    Simulate(0.05);
+    ASSERT_TRUE(IsAwake(stackB));
+    ASSERT_TRUE(IsSleeping(stackA));
+    ASSERT_GT(stackB.back()->GetPos().x(), 1.0);
+}
+
+TEST_P(SleepingTest, external_forces) {
+    Simulate(2.0);
+    ASSERT_TRUE(IsSleeping(stackA));
+    ASSERT_TRUE(IsSleeping(stackB));
+
+    // A ChForce applied to the top box of the first stack wakes up that stack only
+    auto force = chrono_types::make_shared<ChForce>();
+    stackA.back()->AddForce(force);
+    force->SetMode(ChForce::FORCE);
+    force->SetDir(VECT_X);
+    force->SetMforce(100);
+    Simulate(0.01);
+    ASSERT_TRUE(IsAwake(stackA));
+    ASSERT_TRUE(IsSleeping(stackB));
+
+    // A load applied to the top box of the second stack wakes up that stack
+    auto loads = chrono_types::make_shared<ChLoadContainer>();
+    sys->Add(loads);
+    auto load = chrono_types::make_shared<ChLoadBodyForce>(stackB.back(), ChVector<>(100, 0, 0), false,
+                                                           stackB.back()->GetPos(), false);
+    loads->Add(load);
+    Simulate(0.01);
+    ASSERT_TRUE(IsAwake(stackB));
+}
+
+TEST_P(SleepingTest, kinematic_body) {
+    // Fixed box, moved explicitly (without velocity) towards the second stack after it has fallen asleep
+    auto pusher = AddBox(ChVector<>(1.5, 0, 0.1));
+    pusher->SetBodyFixed(true);
+
+    Simulate(2.0);
+    ASSERT_TRUE(IsSleeping(stackA));
+    ASSERT_TRUE(IsSleeping(stackB));
+
+    bool woken = false;
+    double end_time = sys->GetChTime() + 0.5;
+    while (sys->GetChTime() < end_time && !woken) {
+        pusher->SetPos(pusher->GetPos() - ChVector<>(step, 0, 0));
+        sys->DoStepDynamics(step);
+        woken = !stackB.front()->GetSleeping();
+        ASSERT_TRUE(IsSleeping(stackA));
+    }
+    ASSERT_TRUE(woken);
+    ASSERT_LT(pusher->GetPos().x(), 1.3);
+}
+
+TEST_P(SleepingTest, links) {
+    // Lock the two top boxes of the first stack together
+    auto link = chrono_types::make_shared<ChLinkLockLock>();
+    link->Initialize(stackA[1], stackA[2], ChCoordsys<>(stackA[2]->GetPos()));
+    sys->AddLink(link);
+
+    Simulate(2.0);
+    ASSERT_TRUE(IsSleeping(stackA));
+    ASSERT_FALSE(link->IsActive());
+    ASSERT_EQ(sys->GetNdoc_w(), 0);
+
+    // Disabling sleeping reactivates the link
+    sys->SetUseSleeping(false);
+    sys->DoStepDynamics(step);
+    ASSERT_TRUE(link->IsActive());
+    ASSERT_EQ(sys->GetNdoc_w(), 6);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChSystem, SleepingTest, ::testing::Values(ChContactMethod::NSC, ChContactMethod::SMC));
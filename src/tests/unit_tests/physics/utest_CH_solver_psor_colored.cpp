@@ -0,0 +1,105 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Unit test for the graph-colored PSOR solver.
+// Starting from the same state of a pile of spheres, one step is taken with
+// ChSolverPSOR and with ChSolverPSORcolored, both iterated to convergence.
+// The velocities at the end of the step (unique solution of the NSC problem)
+// must agree, even though the two solvers relax constraints in different orders.
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static void CreateModel(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& bodies) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.3f);
+
+    utils::CreateBoxContainer(&sys, 0, mat, ChVector<>(0.5, 0.5, 0.5), 0.1);
+
+    double radius = 0.05;
+    for (int ix = 0; ix < 6; ix++) {
+        for (int iy = 0; iy < 6; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                ChVector<> pos(-0.4 + 0.11 * ix + 0.01 * iz, -0.4 + 0.11 * iy, radius + 0.1 * iz);
+                auto body = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, true, true, mat);
+                body->SetPos(pos);
+                body->SetPos_dt(ChVector<>(0.1 * (iy % 3) - 0.1, 0.05 * (ix % 2), 0));
+                sys.AddBody(body);
+                bodies.push_back(body);
+            }
+        }
+    }
+}
+
+TEST(ChSolverPSORcolored, same_solution) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+
+    std::vector<std::shared_ptr<ChBody>> bodies1;
+    std::vector<std::shared_ptr<ChBody>> bodies2;
+    CreateModel(sys1, bodies1);
+    CreateModel(sys2, bodies2);
+
+    // Bring both systems to the same state, with many contacts
+    double step = 1e-3;
+    for (int i = 0; i < 50; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+    }
+    ASSERT_GT(sys1.GetNcontacts(), 100);
+
+    auto psor = chrono_types::make_shared<ChSolverPSOR>();
+    auto psor_colored = chrono_types::make_shared<ChSolverPSORcolored>();
+    psor_colored->SetNumThreads(4);
+    for (auto solver : std::vector<std::shared_ptr<ChIterativeSolverVI>>{psor, psor_colored}) {
+        solver->SetMaxIterations(3000);
+        solver->SetTolerance(1e-12);
+    }
+    sys1.SetSolver(psor);
+    sys2.SetSolver(psor_colored);
+
+    sys1.DoStepDynamics(step);
+    sys2.DoStepDynamics(step);
+
+    // Constraints were colored, and none was left for serial processing
+    ASSERT_GT(psor_colored->GetNumColors(), 1);
+    ASSERT_EQ(psor_colored->GetNumSerialBlocks(), 0);
+
+    for (size_t j = 0; j < bodies1.size(); j++) {
+        ASSERT_NEAR((bodies1[j]->GetPos_dt() - bodies2[j]->GetPos_dt()).Length(), 0.0, 1e-6);
+        ASSERT_NEAR((bodies1[j]->GetWvel_par() - bodies2[j]->GetWvel_par()).Length(), 0.0, 1e-5);
+    }
+}
+
+TEST(ChSolverPSORcolored, num_threads) {
+    ChSystemNSC sys;
+    sys.SetNumThreads(3);
+    sys.SetSolverType(ChSolver::Type::PSOR_COLORED);
+    auto solver = std::dynamic_pointer_cast<ChSolverPSORcolored>(sys.GetSolver());
+    ASSERT_TRUE(solver);
+    ASSERT_EQ(solver->GetNumThreads(), 3);
+
+    // Changing the number of threads of the system is forwarded to an installed solver
+    sys.SetNumThreads(2);
+    ASSERT_EQ(solver->GetNumThreads(), 2);
+}
@@ -0,0 +1,198 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Round-trip test for the binary state files of the Blender exporter.
+//
+// Two bodies and a particle cloud are exported over several frames. The test
+// reads back each stateNNNNN.bin file and checks the poses against the ones
+// of the exported items, and checks that the object table gets a new entry
+// only when the list of shapes of an item changes.
+// =============================================================================
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/assets/ChVisualShapeBox.h"
+#include "chrono/assets/ChVisualShapeSphere.h"
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_postprocess/ChBlender.h"
+
+using namespace chrono;
+using namespace chrono::postprocess;
+
+const std::string out_dir = "utest_POST_blender_binary";
+
+// Content of a binary state file
+struct BinaryFrame {
+    uint32_t header[8];
+    std::vector<int32_t> object_ids;
+    std::vector<float> object_poses;
+    std::vector<int32_t> cloud_ids;
+    std::vector<uint32_t> cloud_sizes;
+    std::vector<float> cloud_poses;
+    std::vector<float> particle_poses;
+    std::vector<float> contacts;
+};
+
+template <typename T>
+static void ReadArray(std::ifstream& file, std::vector<T>& data, size_t size) {
+    data.resize(size);
+    file.read((char*)data.data(), size * sizeof(T));
+}
+
+static bool ReadFrame(const std::string& filename, BinaryFrame& frame) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+        return false;
+    file.read((char*)frame.header, sizeof(frame.header));
+    ReadArray(file, frame.object_ids, frame.header[2]);
+    ReadArray(file, frame.object_poses, 7 * frame.header[2]);
+    ReadArray(file, frame.cloud_ids, frame.header[3]);
+    ReadArray(file, frame.cloud_sizes, frame.header[3]);
+    ReadArray(file, frame.cloud_poses, 7 * frame.header[3]);
+    ReadArray(file, frame.particle_poses, 7 * frame.header[4]);
+    ReadArray(file, frame.contacts, 10 * frame.header[5]);
+    if (!file)
+        return false;
+
+    // Nothing must follow the arrays
+    file.get();
+    return file.eof();
+}
+
+static void CheckPose(const float* pose, const ChVector<>& pos, const ChQuaternion<>& rot) {
+    ASSERT_EQ(pose[0], (float)pos.x());
+    ASSERT_EQ(pose[1], (float)pos.y());
+    ASSERT_EQ(pose[2], (float)pos.z());
+    ASSERT_EQ(pose[3], (float)rot.e0());
+    ASSERT_EQ(pose[4], (float)rot.e1());
+    ASSERT_EQ(pose[5], (float)rot.e2());
+    ASSERT_EQ(pose[6], (float)rot.e3());
+}
+
+// Pose of the specified body at the specified frame
+static ChVector<> BodyPos(int frame, int body) {
+    return ChVector<>(0.1 * frame, body, -0.3 * frame);
+}
+
+static ChQuaternion<> BodyRot(int frame, int body) {
+    return Q_from_AngZ(0.2 * frame + body);
+}
+
+// Entries of the object table (one per line starting with '(', as '(frame, index, name, ...')
+static std::vector<std::string> ReadObjectTable(const std::string& filename) {
+    std::vector<std::string> entries;
+    std::ifstream file(filename);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line[0] == '(')
+            entries.push_back(line);
+    }
+    return entries;
+}
+
+TEST(ChBlender, binary_round_trip) {
+    const int num_frames = 6;
+    const int num_particles = 5;
+
+    ChSystemNSC sys;
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 2; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetName(("body_" + std::to_string(i)).c_str());
+        if (i == 0)
+            body->AddVisualShape(chrono_types::make_shared<ChVisualShapeBox>(0.4, 1.0, 0.2),
+                                 ChFrame<>(ChVector<>(1, 0, 0)));
+        else
+            body->AddVisualShape(chrono_types::make_shared<ChVisualShapeSphere>(0.3));
+        sys.AddBody(body);
+        bodies.push_back(body);
+    }
+
+    auto cloud = chrono_types::make_shared<ChParticleCloud>();
+    cloud->SetName("cloud");
+    for (int i = 0; i < num_particles; i++)
+        cloud->AddParticle(ChCoordsys<>(ChVector<>(i, 0, 0)));
+    cloud->AddVisualShape(chrono_types::make_shared<ChVisualShapeSphere>(0.05));
+    sys.Add(cloud);
+
+    ChBlender blender(&sys);
+    blender.SetBasePath(out_dir);
+    blender.SetBlenderUp_is_ChronoZ();
+    blender.SetUseBinaryData(true);
+    blender.AddAll();
+    blender.ExportScript();
+
+    for (int frame = 0; frame < num_frames; frame++) {
+        for (int i = 0; i < 2; i++) {
+            bodies[i]->SetPos(BodyPos(frame, i));
+            bodies[i]->SetRot(BodyRot(frame, i));
+        }
+        for (int i = 0; i < num_particles; i++)
+            cloud->GetParticle(i).SetPos(ChVector<>(i, 0.5 * frame, 0));
+
+        // Renaming an item changes its list of shapes
+        if (frame == 3)
+            bodies[0]->SetName("body_0_renamed");
+
+        blender.ExportData();
+    }
+
+    // Object table: one entry per item at frame 0, plus one for the renamed body
+    auto table = ReadObjectTable(out_dir + "/exported.objects.dat");
+    ASSERT_EQ(table.size(), 4u);
+    int num_renamed = 0;
+    for (const auto& entry : table) {
+        if (entry.find("'body_0_renamed'") != std::string::npos) {
+            ASSERT_EQ(entry.compare(0, 3, "(3,"), 0);
+            num_renamed++;
+        } else {
+            ASSERT_EQ(entry.compare(0, 3, "(0,"), 0);
+        }
+    }
+    ASSERT_EQ(num_renamed, 1);
+
+    for (int frame = 0; frame < num_frames; frame++) {
+        char filename[64];
+        snprintf(filename, sizeof(filename), "/output/state%05d.bin", frame);
+
+        BinaryFrame data;
+        ASSERT_TRUE(ReadFrame(out_dir + filename, data));
+        ASSERT_EQ(std::memcmp(data.header, "CHBL", 4), 0);
+        ASSERT_EQ(data.header[1], 1u);
+        ASSERT_EQ(data.header[2], 2u);
+        ASSERT_EQ(data.header[3], 1u);
+        ASSERT_EQ(data.header[4], (uint32_t)num_particles);
+        ASSERT_EQ(data.header[5], 0u);
+
+        // Bodies may be exported in any order (body i is at y = i), but with different indices in the object table
+        ASSERT_NE(data.object_ids[0], data.object_ids[1]);
+        for (int k = 0; k < 2; k++) {
+            int i = (int)std::lround(data.object_poses[7 * k + 1]);
+            ASSERT_TRUE(i == 0 || i == 1);
+            CheckPose(&data.object_poses[7 * k], BodyPos(frame, i), BodyRot(frame, i));
+        }
+
+        ASSERT_EQ(data.cloud_sizes[0], (uint32_t)num_particles);
+        ASSERT_NE(data.cloud_ids[0], data.object_ids[0]);
+        ASSERT_NE(data.cloud_ids[0], data.object_ids[1]);
+        CheckPose(&data.cloud_poses[0], VNULL, QUNIT);
+        for (int i = 0; i < num_particles; i++)
+            CheckPose(&data.particle_poses[7 * i], ChVector<>(i, 0.5 * frame, 0), QUNIT);
+    }
+}
@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the CPU ray-cast lidar and depth camera (no GPU required).
+// The sensors look at a wall and the generated point clouds are checked.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_sensor/ChSensorManager.h"
+#include "chrono_sensor/sensors/ChRaycastSensor.h"
+#include "chrono_sensor/filters/ChFilterAccess.h"
+#include "chrono_sensor/filters/ChFilterPCfromDepth.h"
+
+using namespace chrono;
+using namespace sensor;
+
+// Points must be on the wall, up to the collision envelope
+const double tolerance = 0.1;
+
+TEST(ChRaycastSensor, wall) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    // wall with its front face in the x = 10 plane
+    auto wall = chrono_types::make_shared<ChBodyEasyBox>(1, 20, 20, 1000, false, true);
+    wall->SetPos({10.5, 0, 0});
+    wall->SetBodyFixed(true);
+    sys.Add(wall);
+
+    auto cart = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, false);
+    cart->SetBodyFixed(true);
+    sys.Add(cart);
+
+    ChSensorManager manager(&sys);
+
+    // full 360 degree lidar: only the beams within 45 degrees of the x axis hit the wall
+    auto lidar = chrono_types::make_shared<ChRaycastLidarSensor>(cart, 10.f, ChFrame<double>(), 360, 8,
+                                                                 2 * (float)CH_C_PI, 0.1f, -0.1f, 50.f);
+    lidar->SetNumThreads(2);
+    lidar->PushFilter(chrono_types::make_shared<ChFilterDIAccess>());
+    lidar->PushFilter(chrono_types::make_shared<ChFilterPCfromDepth>());
+    lidar->PushFilter(chrono_types::make_shared<ChFilterXYZIAccess>());
+    manager.AddSensor(lidar);
+
+    // depth camera: all pixels see the wall
+    auto camera = chrono_types::make_shared<ChRaycastDepthCamera>(cart, 10.f, ChFrame<double>(), 64, 48,
+                                                                  (float)CH_C_PI / 2, 50.f);
+    camera->PushFilter(chrono_types::make_shared<ChFilterPCfromDepth>());
+    camera->PushFilter(chrono_types::make_shared<ChFilterXYZIAccess>());
+    manager.AddSensor(camera);
+
+    while (sys.GetChTime() < 0.25) {
+        manager.Update();
+        sys.DoStepDynamics(0.01);
+    }
+
+    auto di = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
+    ASSERT_EQ(di->Width, 360u);
+    ASSERT_EQ(di->Height, 8u);
+
+    auto pc = lidar->GetMostRecentBuffer<UserXYZIBufferPtr>();
+    ASSERT_EQ(pc->Height, 1u);
+    ASSERT_NEAR(pc->Width, 360 * 8 / 4, 2 * 8);
+    for (unsigned int i = 0; i < pc->Width; i++) {
+        const auto& p = pc->Buffer[i];
+        ASSERT_NEAR(p.x, 10.0, tolerance);
+        // diffuse intensity is the cosine of the incidence angle
+        ASSERT_NEAR(p.intensity, 10.0 / std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z), 0.02);
+    }
+
+    auto pc_camera = camera->GetMostRecentBuffer<UserXYZIBufferPtr>();
+    ASSERT_EQ(pc_camera->Width, 64u * 48u);
+    for (unsigned int i = 0; i < pc_camera->Width; i++) {
+        ASSERT_NEAR(pc_camera->Buffer[i].x, 10.0, tolerance);
+    }
+}
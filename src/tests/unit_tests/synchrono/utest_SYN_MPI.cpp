@@ -16,6 +16,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <numeric>
 
 #include "gtest/gtest.h"
@@ -23,6 +24,7 @@
 #include "chrono_thirdparty/cxxopts/ChCLI.h"
 #include "chrono_synchrono/SynChronoManager.h"
 #include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
+#include "chrono_synchrono/flatbuffer/message/SynSimulationMessage.h"
 
 #include "chrono_synchrono/utils/SynDataLoader.h"
 
@@ -34,6 +36,7 @@ using namespace synchrono;
 
 int rank;
 int num_ranks;
+std::shared_ptr<SynMPICommunicator> mpi_communicator;
 
 // Define our own main here to handle the MPI setup
 int main(int argc, char* argv[]) {
@@ -44,6 +47,7 @@ int main(int argc, char* argv[]) {
     auto communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
     rank = communicator->GetRank();
     num_ranks = communicator->GetNumRanks();
+    mpi_communicator = communicator;
     SynChronoManager syn_manager(rank, num_ranks, communicator);
 
     ::testing::TestEventListeners& listeners = ::testing::UnitTest::GetInstance()->listeners();
@@ -52,7 +56,9 @@ int main(int argc, char* argv[]) {
     }
 
     // Each rank will be running each test
-    return RUN_ALL_TESTS();
+    int result = RUN_ALL_TESTS();
+    mpi_communicator = nullptr;
+    return result;
 }
 
 TEST(SynChrono, SynChronoInit) {
@@ -102,4 +108,35 @@ TEST(SynChrono, SynChronoInit) {
 
     delete[] msg_lengths;
     delete[] msg_displs;
-}
\ No newline at end of file
+}
+
+TEST(SynChrono, SynChronoInterest) {
+    // Ranks are placed 10 m apart along the x axis, each only interested in its neighbors
+    std::vector<SynAreaOfInterest> areas = {{ChVector<>(10.0 * rank, 0, 0), 15.0}};
+    mpi_communicator->SetAreasOfInterest(areas);
+    mpi_communicator->EnableInterestManagement(true);
+
+    SynMessageList messages;
+    messages.push_back(chrono_types::make_shared<SynSimulationMessage>(AgentKey(rank, 1), AgentKey(), false));
+    mpi_communicator->AddOutgoingMessages(messages);
+    mpi_communicator->Synchronize();
+
+    std::vector<int> senders;
+    for (auto& message : mpi_communicator->GetMessages())
+        senders.push_back(message->GetSourceKey().GetNodeID());
+    std::sort(senders.begin(), senders.end());
+
+    std::vector<int> neighbors;
+    if (rank > 0)
+        neighbors.push_back(rank - 1);
+    if (rank < num_ranks - 1)
+        neighbors.push_back(rank + 1);
+
+    mpi_communicator->Reset();
+    mpi_communicator->SetAreasOfInterest({});
+    mpi_communicator->EnableInterestManagement(false);
+
+    ASSERT_EQ(senders, neighbors);
+    ASSERT_EQ(mpi_communicator->GetNumPeersSent(), (int)neighbors.size());
+    ASSERT_EQ(mpi_communicator->GetNumPeersReceived(), (int)neighbors.size());
+}
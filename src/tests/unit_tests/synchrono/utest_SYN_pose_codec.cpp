@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the compact (quantized, delta-encoded) SynChrono pose encoding
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChMathematics.h"
+#include "chrono_synchrono/flatbuffer/message/SynPoseCodec.h"
+
+using namespace chrono;
+using namespace synchrono;
+
+// Size of a full-precision pose (position, rotation and their derivatives) in a state message
+const size_t full_pose_size = 6 * 4 * sizeof(double);
+
+// Poses of a vehicle far from the origin, with a chassis and the given number of attached bodies
+static std::vector<SynPose> VehiclePoses(int num_bodies, double t) {
+    ChVector<> chassis_pos(1200.0 + 15 * t, -3400.0 + 2 * t, 1.5);
+    ChQuaternion<> chassis_rot = Q_from_AngZ(0.3 + 0.1 * t) * Q_from_AngX(0.02 * t);
+
+    std::vector<SynPose> poses;
+    poses.emplace_back(chassis_pos, chassis_rot);
+    poses[0].GetFrame().SetPos_dt(ChVector<>(15, 2, 0));
+    poses[0].GetFrame().SetWvel_par(ChVector<>(0.02, 0, 0.1));
+
+    for (int i = 0; i < num_bodies; i++) {
+        double angle = CH_C_2PI * i / num_bodies + 2 * t;
+        ChVector<> rel_pos(2 * std::cos(angle), (i % 2) ? 1.2 : -1.2, 0.5 * std::sin(angle));
+        ChQuaternion<> rel_rot = Q_from_AngY(angle);
+        poses.emplace_back(chassis_pos + chassis_rot.Rotate(rel_pos), chassis_rot * rel_rot);
+    }
+
+    return poses;
+}
+
+static void CheckPoses(const std::vector<SynPose>& expected, const std::vector<SynPose>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        const auto& e = expected[i].GetFrame();
+        const auto& a = actual[i].GetFrame();
+        ASSERT_LT((e.GetPos() - a.GetPos()).Length(), 5e-4);
+        // Same rotation, up to the sign of the quaternion
+        ASSERT_GT(std::abs(e.GetRot() ^ a.GetRot()), 1 - 1e-8);
+    }
+    ASSERT_LT((expected[0].GetFrame().GetPos_dt() - actual[0].GetFrame().GetPos_dt()).Length(), 1e-3);
+    ASSERT_LT((expected[0].GetFrame().GetWvel_par() - actual[0].GetFrame().GetWvel_par()).Length(), 1e-3);
+}
+
+TEST(SynPoseCodec, RoundTrip) {
+    const int num_bodies = 200;
+    SynPoseCodec encoder;
+    SynPoseCodec decoder;
+    encoder.SetKeyFrameInterval(10);
+
+    std::vector<uint8_t> data;
+    std::vector<SynPose> decoded;
+
+    for (int frame = 0; frame < 25; frame++) {
+        auto poses = VehiclePoses(num_bodies, 0.01 * frame);
+        encoder.Encode(poses, data);
+        ASSERT_TRUE(decoder.Decode(data, decoded));
+        CheckPoses(poses, decoded);
+
+        // At least an order of magnitude smaller than the full-precision poses
+        ASSERT_LT(10 * data.size(), (num_bodies + 1) * full_pose_size);
+    }
+}
+
+TEST(SynPoseCodec, MissingKeyFrame) {
+    SynPoseCodec encoder;
+    SynPoseCodec decoder;
+    encoder.SetKeyFrameInterval(5);
+
+    std::vector<uint8_t> data;
+    std::vector<SynPose> decoded;
+
+    for (int frame = 0; frame < 12; frame++) {
+        auto poses = VehiclePoses(10, 0.01 * frame);
+        encoder.Encode(poses, data);
+        bool key_frame = (frame % 5 == 0);
+
+        // The decoder starts listening after the first key frame was sent
+        if (frame < 2)
+            continue;
+
+        // Deltas against a key frame that was not received are rejected
+        bool decoded_ok = decoder.Decode(data, decoded);
+        ASSERT_EQ(decoded_ok, frame >= 5);
+        if (key_frame || decoded_ok)
+            CheckPoses(poses, decoded);
+    }
+}
+
+TEST(SynPoseCodec, ChassisOnly) {
+    SynPoseCodec encoder;
+    encoder.SetKeyFrameInterval(5);
+
+    std::vector<uint8_t> data;
+    SynPose chassis;
+
+    // The chassis pose is available from every message, including deltas whose key frame was never received
+    for (int frame = 0; frame < 8; frame++) {
+        auto poses = VehiclePoses(10, 0.01 * frame);
+        encoder.Encode(poses, data);
+        ASSERT_TRUE(SynPoseCodec::DecodeChassis(data, chassis));
+        CheckPoses({poses[0]}, {chassis});
+    }
+
+    ASSERT_FALSE(SynPoseCodec::DecodeChassis(std::vector<uint8_t>(), chassis));
+}
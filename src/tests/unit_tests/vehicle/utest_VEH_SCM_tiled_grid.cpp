@@ -0,0 +1,153 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the sparse tiled grid used by the SCM deformable terrain.
+// The grid is checked against a std::map on insertions and lookups spanning
+// several tiles (including negative node indices), on iteration over all nodes,
+// and on iteration over the set of modified nodes.
+//
+// =============================================================================
+
+#include <cstdlib>
+#include <map>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/terrain/SCMTiledGrid.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Grid with 4x4 tiles, so that small node ranges span many tiles
+using Grid = SCMTiledGrid<double, 2>;
+using NodeMap = std::map<std::pair<int, int>, double>;
+
+static double Value(int i, int j) {
+    return 1000.0 * i + j;
+}
+
+TEST(SCMTiledGrid, insert_lookup) {
+    Grid grid;
+    EXPECT_EQ(grid.size(), 0);
+    EXPECT_EQ(grid.Find(ChVector2<int>(0, 0)), nullptr);
+
+    // Insert every other node in a region straddling the origin (tiles in all four quadrants)
+    for (int i = -9; i <= 9; i++) {
+        for (int j = -7; j <= 7; j++) {
+            if ((i + j) % 2 != 0)
+                continue;
+            auto res = grid.Insert(ChVector2<int>(i, j), Value(i, j));
+            ASSERT_TRUE(res.second);
+            ASSERT_EQ(*res.first, Value(i, j));
+        }
+    }
+    EXPECT_EQ(grid.size(), 143);
+    EXPECT_EQ(grid.GetNumTiles(), 24);
+
+    // Lookup all nodes in a larger region, on both sides of all tile borders
+    for (int i = -12; i <= 12; i++) {
+        for (int j = -10; j <= 10; j++) {
+            const auto* rec = grid.Find(ChVector2<int>(i, j));
+            bool recorded = std::abs(i) <= 9 && std::abs(j) <= 7 && (i + j) % 2 == 0;
+            ASSERT_EQ(rec != nullptr, recorded) << i << " " << j;
+            if (recorded)
+                ASSERT_EQ(*rec, Value(i, j)) << i << " " << j;
+        }
+    }
+
+    // Re-inserting an existing node does not overwrite its record
+    auto res = grid.Insert(ChVector2<int>(-4, 4), -1.0);
+    EXPECT_FALSE(res.second);
+    EXPECT_EQ(*res.first, Value(-4, 4));
+    EXPECT_EQ(grid.size(), 143);
+
+    // Access through at() and operator[]
+    grid.at(ChVector2<int>(3, -1)) = 5.0;
+    EXPECT_EQ(grid.at(ChVector2<int>(3, -1)), 5.0);
+    EXPECT_THROW(grid.at(ChVector2<int>(3, -2)), std::out_of_range);
+    grid[ChVector2<int>(3, -2)] = 7.0;
+    EXPECT_EQ(grid.at(ChVector2<int>(3, -2)), 7.0);
+    EXPECT_EQ(grid.size(), 144);
+
+    grid.clear();
+    EXPECT_EQ(grid.size(), 0);
+    EXPECT_EQ(grid.GetNumTiles(), 0);
+    EXPECT_EQ(grid.Find(ChVector2<int>(0, 0)), nullptr);
+}
+
+TEST(SCMTiledGrid, iteration) {
+    Grid grid;
+    NodeMap expected;
+
+    // Scattered nodes, inserted in an arbitrary order
+    for (int n = 0; n < 500; n++) {
+        int i = (n * 37) % 41 - 20;
+        int j = (n * 53) % 29 - 14;
+        grid.Insert(ChVector2<int>(i, j), Value(i, j));
+        expected[std::make_pair(i, j)] = Value(i, j);
+    }
+    ASSERT_EQ(grid.size(), expected.size());
+
+    // Each recorded node is visited exactly once, with its record
+    NodeMap visited;
+    grid.ForEach([&](const ChVector2<int>& ij, double& val) {
+        ASSERT_TRUE(visited.insert(std::make_pair(std::make_pair(ij.x(), ij.y()), val)).second);
+        val = -val;
+    });
+    EXPECT_EQ(visited, expected);
+
+    // Records were modified in place
+    const Grid& cgrid = grid;
+    cgrid.ForEach([&](const ChVector2<int>& ij, const double& val) { ASSERT_EQ(val, -Value(ij.x(), ij.y())); });
+}
+
+TEST(SCMTiledGrid, modified) {
+    Grid grid;
+    for (int i = -6; i < 6; i++) {
+        for (int j = -6; j < 6; j++)
+            grid.Insert(ChVector2<int>(i, j), Value(i, j));
+    }
+    EXPECT_EQ(grid.GetNumModified(), 0);
+    EXPECT_THROW(grid.SetModified(ChVector2<int>(20, 20)), std::out_of_range);
+
+    // Mark the nodes on a diagonal band (some of them twice)
+    NodeMap expected;
+    for (int i = -6; i < 6; i++) {
+        for (int j = -6; j < 6; j++) {
+            if (std::abs(i - j) > 1)
+                continue;
+            grid.SetModified(ChVector2<int>(i, j));
+            grid.SetModified(ChVector2<int>(i, j));
+            expected[std::make_pair(i, j)] = Value(i, j);
+        }
+    }
+    EXPECT_EQ(grid.GetNumModified(), expected.size());
+
+    NodeMap visited;
+    grid.ForEachModified([&](const ChVector2<int>& ij, const double& val) {
+        ASSERT_TRUE(visited.insert(std::make_pair(std::make_pair(ij.x(), ij.y()), val)).second);
+    });
+    EXPECT_EQ(visited, expected);
+
+    // Inserting new nodes does not alter the set of modified nodes
+    grid.Insert(ChVector2<int>(-7, -7), 0.0);
+    grid.Insert(ChVector2<int>(6, 5), 0.0);
+    EXPECT_EQ(grid.GetNumModified(), expected.size());
+
+    grid.ClearModified();
+    EXPECT_EQ(grid.GetNumModified(), 0);
+    int count = 0;
+    grid.ForEachModified([&](const ChVector2<int>&, const double&) { count++; });
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(grid.size(), 146);
+}
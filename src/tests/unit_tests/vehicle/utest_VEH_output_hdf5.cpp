@@ -0,0 +1,181 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Unit test for the HDF5 vehicle output database.
+//
+// Several output databases (each CHUNKED one with its own writer thread) are
+// written concurrently from different simulation threads. The test checks
+// that no output is lost or mixed up, and that an output database can still
+// be created after others were destroyed.
+// =============================================================================
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Output record of a body, as read back from the file
+struct body_record {
+    int id;
+    double x, y, z;
+};
+
+// Output record of a shaft, as read back from the file
+struct shaft_record {
+    int id;
+    double x;
+};
+
+// Position of the specified body at the specified frame
+static ChVector<> BodyPos(int offset, int frame, int body) {
+    return ChVector<>(offset + frame, body, 0.5 * frame);
+}
+
+// Write 'num_frames' output frames of 'num_bodies' bodies and one shaft
+static void WriteOutput(const std::string& filename,
+                        ChVehicleOutputHDF5::Layout layout,
+                        int offset,
+                        int num_frames,
+                        int num_bodies) {
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetIdentifier(offset + i);
+        bodies.push_back(body);
+    }
+    std::vector<std::shared_ptr<ChShaft>> shafts(1, chrono_types::make_shared<ChShaft>());
+    shafts[0]->SetIdentifier(offset);
+
+    ChVehicleOutputHDF5 hdf5(filename, layout, 2, 4);
+    ChVehicleOutput& db = hdf5;
+    for (int frame = 0; frame < num_frames; frame++) {
+        for (int i = 0; i < num_bodies; i++)
+            bodies[i]->SetPos(BodyPos(offset, frame, i));
+        shafts[0]->SetPos(offset + 0.25 * frame);
+
+        db.WriteTime(frame, 0.01 * frame);
+        db.WriteSection("Chassis");
+        db.WriteBodies(bodies);
+        db.WriteSection("Driveline");
+        db.WriteShafts(shafts);
+    }
+}
+
+static H5::CompType BodyRecordType() {
+    H5::CompType type(sizeof(body_record));
+    type.insertMember("id", HOFFSET(body_record, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(body_record, x), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("y", HOFFSET(body_record, y), H5::PredType::NATIVE_DOUBLE);
+    type.insertMember("z", HOFFSET(body_record, z), H5::PredType::NATIVE_DOUBLE);
+    return type;
+}
+
+static H5::CompType ShaftRecordType() {
+    H5::CompType type(sizeof(shaft_record));
+    type.insertMember("id", HOFFSET(shaft_record, id), H5::PredType::NATIVE_INT);
+    type.insertMember("x", HOFFSET(shaft_record, x), H5::PredType::NATIVE_DOUBLE);
+    return type;
+}
+
+static void CheckBodies(const std::vector<body_record>& records, int offset, int frame) {
+    for (int i = 0; i < (int)records.size(); i++) {
+        ChVector<> pos = BodyPos(offset, frame, i);
+        ASSERT_EQ(records[i].id, offset + i);
+        ASSERT_EQ(records[i].x, pos.x());
+        ASSERT_EQ(records[i].y, pos.y());
+        ASSERT_EQ(records[i].z, pos.z());
+    }
+}
+
+// Check the output written by WriteOutput with the CHUNKED layout
+static void CheckChunkedOutput(const std::string& filename, int offset, int num_frames, int num_bodies) {
+    H5::H5File file(filename, H5F_ACC_RDONLY);
+
+    std::vector<int> frames(num_frames);
+    std::vector<double> times(num_frames);
+    H5::DataSet frame_set = file.openDataSet("/Frame");
+    H5::DataSet time_set = file.openDataSet("/Time");
+    hsize_t dims[2];
+    frame_set.getSpace().getSimpleExtentDims(dims);
+    ASSERT_EQ(dims[0], (hsize_t)num_frames);
+    frame_set.read(frames.data(), H5::PredType::NATIVE_INT);
+    time_set.read(times.data(), H5::PredType::NATIVE_DOUBLE);
+
+    H5::DataSet body_set = file.openDataSet("/Chassis/Bodies");
+    body_set.getSpace().getSimpleExtentDims(dims);
+    ASSERT_EQ(dims[0], (hsize_t)num_frames);
+    ASSERT_EQ(dims[1], (hsize_t)num_bodies);
+    std::vector<body_record> bodies(num_frames * num_bodies);
+    body_set.read(bodies.data(), BodyRecordType());
+
+    H5::DataSet shaft_set = file.openDataSet("/Driveline/Shafts");
+    std::vector<shaft_record> shafts(num_frames);
+    shaft_set.read(shafts.data(), ShaftRecordType());
+
+    for (int frame = 0; frame < num_frames; frame++) {
+        ASSERT_EQ(frames[frame], frame);
+        ASSERT_EQ(times[frame], 0.01 * frame);
+        std::vector<body_record> records(bodies.begin() + frame * num_bodies,
+                                         bodies.begin() + (frame + 1) * num_bodies);
+        CheckBodies(records, offset, frame);
+        ASSERT_EQ(shafts[frame].id, offset);
+        ASSERT_EQ(shafts[frame].x, offset + 0.25 * frame);
+    }
+}
+
+// Check the output written by WriteOutput with the FRAMES layout
+static void CheckFramesOutput(const std::string& filename, int offset, int num_frames, int num_bodies) {
+    H5::H5File file(filename, H5F_ACC_RDONLY);
+
+    for (int frame = 0; frame < num_frames; frame++) {
+        char name[32];
+        snprintf(name, sizeof(name), "/Frames/Frame_%06d", frame);
+        H5::DataSet body_set = file.openDataSet(std::string(name) + "/Chassis/Bodies");
+        std::vector<body_record> records(num_bodies);
+        body_set.read(records.data(), BodyRecordType());
+        CheckBodies(records, offset, frame);
+    }
+}
+
+TEST(ChVehicleOutputHDF5, concurrent) {
+    const int num_frames = 300;
+    const int num_bodies = 7;
+
+    // Two CHUNKED databases and one FRAMES database, written from three simulation threads
+    std::thread t1(WriteOutput, "utest_VEH_output_hdf5_1.h5", ChVehicleOutputHDF5::Layout::CHUNKED, 100, num_frames,
+                   num_bodies);
+    std::thread t2(WriteOutput, "utest_VEH_output_hdf5_2.h5", ChVehicleOutputHDF5::Layout::CHUNKED, 200, num_frames,
+                   num_bodies);
+    std::thread t3(WriteOutput, "utest_VEH_output_hdf5_3.h5", ChVehicleOutputHDF5::Layout::FRAMES, 300, num_frames,
+                   num_bodies);
+    t1.join();
+    t2.join();
+    t3.join();
+
+    CheckChunkedOutput("utest_VEH_output_hdf5_1.h5", 100, num_frames, num_bodies);
+    CheckChunkedOutput("utest_VEH_output_hdf5_2.h5", 200, num_frames, num_bodies);
+    CheckFramesOutput("utest_VEH_output_hdf5_3.h5", 300, num_frames, num_bodies);
+}
+
+TEST(ChVehicleOutputHDF5, sequential) {
+    // The record types of a database must outlive the ones destroyed before it was created
+    WriteOutput("utest_VEH_output_hdf5_4.h5", ChVehicleOutputHDF5::Layout::CHUNKED, 400, 10, 3);
+    WriteOutput("utest_VEH_output_hdf5_5.h5", ChVehicleOutputHDF5::Layout::CHUNKED, 500, 10, 3);
+
+    CheckChunkedOutput("utest_VEH_output_hdf5_4.h5", 400, 10, 3);
+    CheckChunkedOutput("utest_VEH_output_hdf5_5.h5", 500, 10, 3);
+}